@@ -17,11 +17,22 @@
 
 #include "res_config_impl.h"
 #include "hap_resource.h"
+#include "insert_only_table.h"
 #include "res_desc.h"
 #include "lock.h"
+#include "utils/format_template.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
 #include <locale_info.h>
+#include <map>
+#include <memory>
 #include <plural_format.h>
+#include <thread>
+#include <types.h>
 #include <vector>
 
 namespace OHOS {
@@ -29,6 +40,309 @@ namespace Global {
 namespace Resource {
 class HapManager {
 public:
+    /**
+     * What is kept of a hap when it is evicted: the path, id range and a filter of names.
+     * Lookups skip a hap whose stub can not contain the resource, others reload an evicted hap.
+     */
+    class HapStub {
+    public:
+        explicit HapStub(const HapResource *hapResource);
+
+        inline const std::string &GetIndexPath() const
+        {
+            return indexPath_;
+        }
+
+        inline size_t GetDataSize() const
+        {
+            return dataSize_;
+        }
+
+        inline const FileStamp &GetFileStamp() const
+        {
+            return fileStamp_;
+        }
+
+        inline bool MayContainId(uint32_t id) const
+        {
+            return id >= minId_ && id <= maxId_;
+        }
+
+        /**
+         * Whether the hap may contain the name, false positive is possible but false negative is not
+         * @param name the resource name
+         * @param resType the resource type
+         */
+        bool MayContainName(const std::string &name, const ResType resType) const;
+
+        /**
+         * Whether the hap may contain the name, false positive is possible but false negative is not
+         * @param hash the HashResName of the resource name and type
+         */
+        bool MayContainHash(uint64_t hash) const;
+
+        // the access clock of the last lookup hit, the least recently used hap is evicted first
+        mutable std::atomic<uint64_t> lastUse_;
+
+    private:
+        static uint64_t HashName(const std::string &name, const ResType resType);
+
+        std::string indexPath_;
+
+        size_t dataSize_;
+
+        FileStamp fileStamp_;
+
+        uint32_t minId_;
+
+        uint32_t maxId_;
+
+        // bloom filter of (resType, name)
+        std::vector<uint64_t> nameFilter_;
+
+        HapStub(const HapStub &src) = delete;
+
+        HapStub &operator=(const HapStub &src) = delete;
+    };
+
+    /**
+     * The plural rules of one language, immutable once built and shared by every snapshot of that language.
+     * Quantities in [0, MEMO_SIZE) are answered from a table filled when the rules are built.
+     */
+    class PluralRules {
+    public:
+        static const int MEMO_SIZE = 1000;
+
+        PluralRules(const std::string &language, OHOS::I18N::PluralFormat *pluralFormat);
+
+        ~PluralRules();
+
+        inline const std::string &GetLanguage() const
+        {
+            return language_;
+        }
+
+        /**
+         * Select the plural rule of quantity
+         * @param quantity the language quantity
+         * @return the plural rule related to quantity
+         */
+        OHOS::I18N::PluralRuleType Select(int quantity) const;
+
+    private:
+        std::string language_;
+
+        // owned, only quantities out of memo_ reach it
+        OHOS::I18N::PluralFormat *pluralFormat_;
+
+        // guards pluralFormat_
+        mutable Lock lock_;
+
+        uint8_t memo_[MEMO_SIZE];
+
+        PluralRules(const PluralRules &src) = delete;
+
+        PluralRules &operator=(const PluralRules &src) = delete;
+    };
+
+    /**
+     * Immutable view of the loaded haps and the resConfig they were loaded with.
+     * A published Snapshot is never modified, AddResource and UpdateResConfig build a new one and swap it in.
+     */
+    class Snapshot {
+    public:
+        Snapshot(HapManager *hapManager, const std::shared_ptr<ResConfigImpl> &resConfig, uint32_t epoch);
+
+        ~Snapshot();
+
+        inline const ResConfigImpl *GetResConfig() const
+        {
+            return resConfig_.get();
+        }
+
+        /**
+         * Get the epoch of this snapshot, every snapshot published in the process has a new and greater one
+         */
+        inline uint32_t GetEpoch() const
+        {
+            return epoch_;
+        }
+
+        inline size_t HapSize() const
+        {
+            return hapResources_.size();
+        }
+
+        /**
+         * Whether some haps added by AddResourceAsync are still being parsed
+         */
+        inline bool IsLoading() const
+        {
+            return pendingHapCount_ > 0;
+        }
+
+        /**
+         * Get the state of a missed lookup, NOT_READY while haps are loading, else NOT_FOUND
+         */
+        inline RState GetMissState() const
+        {
+            return IsLoading() ? NOT_READY : NOT_FOUND;
+        }
+
+        const IdItem *FindResourceById(uint32_t id) const;
+
+        const IdItem *FindResourceByName(const char *name, const ResType resType) const;
+
+        const IdItem *FindResourceByName(const ResName &name) const;
+
+        // hapIndex, if not null, is set to the index of the hap the resource is found in
+        const HapResource::ValueUnderQualifierDir *FindQualifierValueById(uint32_t id,
+            size_t *hapIndex = nullptr) const;
+
+        const HapResource::ValueUnderQualifierDir *FindQualifierValueByName(const char *name,
+            const ResType resType, size_t *hapIndex = nullptr) const;
+
+        const HapResource::ValueUnderQualifierDir *FindQualifierValueByName(const ResName &name,
+            size_t *hapIndex = nullptr) const;
+
+        const HapResource::IdValues *GetResourceList(uint32_t ident, size_t *hapIndex = nullptr) const;
+
+        const HapResource::IdValues *GetResourceListByName(const char *name, const ResType resType,
+            size_t *hapIndex = nullptr) const;
+
+        const HapResource::IdValues *GetResourceListByName(const ResName &name, size_t *hapIndex = nullptr) const;
+
+        /**
+         * Mark the hap at index as used for the memory budget, for a lookup which bypasses the find functions
+         * @param index the index of the hap
+         */
+        void TouchHap(size_t index) const;
+
+        /**
+         * Follow a reference to its literal value without lock, the chain of each id is cached per snapshot
+         * @param ref the reference parsed at load
+         * @return the IdItem whose value_ is literal, null if the chain is broken, cyclic or too deep
+         */
+        const IdItem *ResolveReference(const IdItem::ValueRef &ref) const;
+
+        /**
+         * Get the flattened map of a theme or pattern of this snapshot
+         * @param idItem the theme or pattern found in this snapshot
+         * @return the map, null if it is not flattened yet
+         */
+        std::shared_ptr<const std::map<std::string, std::string>> GetFlattenedMap(const IdItem *idItem) const;
+
+        /**
+         * Cache the flattened map of a theme or pattern, it lives as long as this snapshot
+         * @param idItem the theme or pattern found in this snapshot
+         * @param flattened the map with parents and references resolved under the resConfig of this snapshot
+         * @return the cached map, which is the one put first when several readers race
+         */
+        std::shared_ptr<const std::map<std::string, std::string>> PutFlattenedMap(const IdItem *idItem,
+            const std::shared_ptr<const std::map<std::string, std::string>> &flattened) const;
+
+        /**
+         * Get the format template of a value, it is parsed on first use
+         * @param value the resolved value, it lives as long as this snapshot
+         * @return the template, null if no memory
+         */
+        std::shared_ptr<const FormatTemplate> GetFormatTemplate(const std::string *value) const;
+
+    private:
+        const HapResource::ValueUnderQualifierDir *GetBestQualifierValue(
+            const HapResource::IdValues *idValues) const;
+
+        // get the hap at index, an evicted hap is reloaded
+        const HapResource *GetHapResource(size_t index) const;
+
+        // get the hap at index, including one reloaded into this snapshot, null if it is evicted
+        std::shared_ptr<const HapResource> GetResidentHap(size_t index) const;
+
+        HapManager *hapManager_;
+
+        // shared with the previous snapshot when only haps changed
+        std::shared_ptr<ResConfigImpl> resConfig_;
+
+        // resConfig_ prepared for QualifierMatcher::Match
+        QualifierMatcher::Request request_;
+
+        // set of hap Resources, a hap which is not reloaded is shared between snapshots, null if evicted
+        std::vector<std::shared_ptr<const HapResource>> hapResources_;
+
+        // haps reloaded by lookups of this snapshot after they were evicted, at most one per index.
+        // sized when published, an entry is set once and owned by this snapshot
+        mutable std::vector<std::atomic<const std::shared_ptr<const HapResource> *>> reloadedHaps_;
+
+        // stub of each hap in hapResources_, kept when the hap is evicted
+        std::vector<std::shared_ptr<HapStub>> hapStubs_;
+
+        // set of loaded hap path
+        std::vector<std::string> loadedHapPaths_;
+
+        uint32_t epoch_;
+
+        // count of haps added by AddResourceAsync but not published yet, the size of pendingHapPaths_ at clone
+        uint32_t pendingHapCount_;
+
+        // plural rules of the language of resConfig_, set on the first plural lookup, owned by HapManager
+        mutable std::atomic<const PluralRules *> pluralRules_;
+
+        struct ResolvedRef {
+            // type of the IdItem of the referenced id, MAX_RES_TYPE if not found
+            ResType resType_;
+            // end of the chain, null if the chain is broken
+            const IdItem *target_;
+        };
+
+        // follow the chain from id
+        ResolvedRef FollowReference(uint32_t id) const;
+
+        // resolved chains keyed by the referenced id, filled by lookups without lock
+        mutable InsertOnlyTable<ResolvedRef> resolvedRefs_;
+
+        // flattened themes and patterns keyed by the address of IdItem, filled by lookups without lock,
+        // so a new snapshot starts empty
+        mutable InsertOnlyTable<std::shared_ptr<const std::map<std::string, std::string>>> flattenedMaps_;
+
+        // format templates keyed by the address of the resolved value, filled by lookups without lock
+        mutable InsertOnlyTable<std::shared_ptr<const FormatTemplate>> formatTemplates_;
+
+        friend class HapManager;
+    };
+
+    /**
+     * Pin the current snapshot while reading, it never blocks.
+     * The guard records its snapshot in a reader slot, a replaced snapshot is reclaimed once no slot holds it.
+     */
+    class SnapshotGuard {
+    public:
+        explicit SnapshotGuard(HapManager *hapManager);
+
+        ~SnapshotGuard();
+
+        inline const Snapshot *Get() const
+        {
+            return snapshot_;
+        }
+
+        inline const Snapshot *operator->() const
+        {
+            return snapshot_;
+        }
+
+    private:
+        HapManager *hapManager_;
+
+        const Snapshot *snapshot_;
+
+        // index in readerSlots_, READER_SLOT_COUNT if all slots were taken
+        size_t slot_;
+
+        SnapshotGuard(const SnapshotGuard &src) = delete;
+
+        SnapshotGuard &operator=(const SnapshotGuard &src) = delete;
+    };
+
     /**
      * The constructor of HapManager
      */
@@ -40,7 +354,7 @@ public:
     ~HapManager();
 
     /**
-     * Update the resConfig
+     * Update the resConfig, nothing is reloaded if its ResConfigKey is the current one
      * @param resConfig the resource config
      * @return SUCCESS if the resConfig updated success, else HAP_INIT_FAILED
      */
@@ -60,67 +374,230 @@ public:
     bool AddResource(const char *path);
 
     /**
-     * Find resource by resource id
-     * @param id the resource id
-     * @return the resources related to resource id
+     * Add resource paths to hap paths, the haps are parsed in parallel and published at once
+     * @param paths the resource paths, a hap listed earlier wins when an id exists in several haps
+     * @return true if all resource paths are added success, else false and none of them is added
+     */
+    bool AddResources(const std::vector<std::string> &paths);
+
+    /**
+     * Reload the haps whose resources.index changed since they were loaded, others are shared with the current
+     * snapshot. In watch mode it returns immediately unless the watcher has seen a change.
+     * @return SUCCESS if nothing changed or changed haps are reloaded, else HAP_INIT_FAILED and the old hap is kept
+     */
+    RState Refresh();
+
+    /**
+     * Start watching the loaded haps on a background thread, a changed hap is reloaded and swapped in.
+     * It uses inotify on linux, else polls the FileStamp of resources.index
+     * @param intervalMs the poll interval in milliseconds, 0 means DEFAULT_WATCH_INTERVAL_MS
+     * @return true if the watcher is started, false if it is already running
      */
-    const IdItem *FindResourceById(uint32_t id);
+    bool StartWatch(uint32_t intervalMs);
 
     /**
-     * Find resource by resource name
-     * @param name the resource name
-     * @param resType the resource type
-     * @return the resources related to resource name
+     * Stop watching the loaded haps, it waits for the watcher thread to exit
      */
-    const IdItem *FindResourceByName(const char *name, const ResType resType);
+    void StopWatch();
 
     /**
-     * Find best resource path by resource id
-     * @param id the resource id
-     * @return the best resource path
+     * Set the memory budget of haps, the least recently used haps are evicted when it is exceeded.
+     * An evicted hap is reloaded on its next access, at least one hap is kept resident.
+     * @param budget the budget in bytes of resources.index data, 0 means no budget
      */
-    const HapResource::ValueUnderQualifierDir *FindQualifierValueById(uint32_t id);
+    void SetMemoryBudget(size_t budget);
 
     /**
-     * Find best resource path by resource name
-     * @param name the resource name
-     * @param resType the resource type
-     * @return the best resource path
+     * Get the residency of haps under the memory budget
+     * @param stats the residency write to
      */
-    const HapResource::ValueUnderQualifierDir *FindQualifierValueByName(const char *name, const ResType resType);
+    void GetResidencyStats(ResidencyStats &stats);
 
     /**
-     * Get the language pluralRule related to quantity
+     * Add resource path to hap paths, the hap is parsed on a worker thread.
+     * Until it is published, lookups missing from the loaded haps get NOT_READY.
+     * @param path the resource path
+     * @return the future of the result, true if add resource path success, else false
+     */
+    std::shared_future<bool> AddResourceAsync(const char *path);
+
+    /**
+     * Get the language pluralRule related to quantity, it takes no lock once the snapshot has met its language
+     * @param snapshot the snapshot which provides the resConfig
      * @param quantity the language quantity
-     * @return the language pluralRule related to quantity
+     * @return the language pluralRule related to quantity, OTHER if the language has no pluralRule
+     */
+    OHOS::I18N::PluralRuleType GetPluralRule(const Snapshot *snapshot, int quantity);
+
+    /**
+     * Keep every published snapshot alive until UnpinSnapshots, like a SnapshotGuard spanning several lookups.
+     * Retired snapshots are not reclaimed while any pin is alive
+     */
+    void PinSnapshots();
+
+    /**
+     * Release a PinSnapshots
      */
-    std::string GetPluralRulesAndSelect(int quantity);
+    void UnpinSnapshots();
 
 private:
-    void UpdateResConfigImpl(ResConfigImpl &resConfig);
+    // guards that are alive at once beyond this count make reclamation wait until they are released
+    static constexpr size_t READER_SLOT_COUNT = 64;
+
+    /**
+     * A fixed count of worker threads running queued tasks in order, a worker is started when a task finds
+     * every started worker busy. Stop runs the queued tasks before joining.
+     */
+    class LoaderPool {
+    public:
+        explicit LoaderPool(size_t threadCount);
+
+        ~LoaderPool();
+
+        /**
+         * Queue task to run on a worker thread
+         * @param task the task
+         * @return true if task is queued, false if the pool is stopped
+         */
+        bool Post(const std::function<void()> &task);
+
+        /**
+         * Stop taking tasks, wait for the queued tasks to be done and the workers to exit
+         */
+        void Stop();
+
+    private:
+        void Run();
+
+        size_t threadCount_;
 
-    void GetResConfigImpl(ResConfigImpl &resConfig);
+        // must hold lock_
+        std::vector<std::thread> threads_;
 
-    const HapResource::IdValues *GetResourceList(uint32_t ident) const;
+        // must hold lock_
+        std::deque<std::function<void()>> tasks_;
 
-    const HapResource::IdValues *GetResourceListByName(const char *name, const ResType resType) const;
+        // must hold lock_, count of workers waiting for a task
+        size_t idleCount_;
 
+        // must hold lock_
+        bool stopping_;
+
+        Lock lock_;
+
+        std::condition_variable_any ready_;
+
+        LoaderPool(const LoaderPool &src) = delete;
+
+        LoaderPool &operator=(const LoaderPool &src) = delete;
+    };
+
+    // must hold lock_
     bool AddResourcePath(const char *path);
 
-    // when resConfig_ updated we must call ReloadAll()
-    RState ReloadAll();
+    // run on the worker thread of AddResourceAsync
+    bool LoadPendingResource(const std::string &path);
+
+    // parse paths under resConfig on the calling thread and the loaders, results keep the order of paths
+    void LoadInParallel(const std::vector<std::string> &paths, const std::shared_ptr<ResConfigImpl> &resConfig,
+        std::vector<const HapResource *> &results);
+
+    // must hold lock_, reload and publish the haps whose FileStamp changed
+    RState ReloadChanged();
+
+    // run on the watcher thread
+    void WatchLoop();
+
+    // must hold lock_, whether the path is loaded or being loaded
+    bool IsHapPathKnown(const std::string &path) const;
+
+    // must hold lock_, whether paths are distinct and none of them is known
+    bool AreNewHapPaths(const std::vector<std::string> &paths) const;
+
+    // must hold lock_, copy the current snapshot with a new epoch
+    Snapshot *CloneSnapshot() const;
+
+    // get an epoch no snapshot of the process has had
+    static uint32_t NextEpoch();
+
+    // must hold lock_, put hapResource at index of snapshot, index == HapSize() appends, false if no memory
+    bool PutHap(Snapshot *snapshot, size_t index, const HapResource *hapResource);
+
+    // must hold lock_, evict the least recently used haps of snapshot until it fits in memoryBudget_
+    void EvictColdHaps(Snapshot *snapshot);
+
+    // reload the evicted hap at index into snapshot without lock_, the result lives as long as snapshot
+    const HapResource *ReloadEvicted(const Snapshot *snapshot, size_t index);
+
+    // publish a copy of snapshot holding its reloaded haps, so the budget is enforced again. It never waits,
+    // it does nothing if lock_ is held since the writer evicts when it publishes
+    void PublishReloaded(const Snapshot *snapshot);
+
+    // must hold lock_, reload all haps of current snapshot under resConfig
+    RState ReloadAll(const std::shared_ptr<ResConfigImpl> &resConfig);
+
+    // find or build the plural rules of language, null if it fails
+    const PluralRules *GetPluralRules(const std::string &language);
+
+    // must hold lock_, make snapshot visible to readers and retire the current one
+    void Publish(Snapshot *snapshot);
+
+    // must hold lock_, delete the retired snapshots that no reader slot holds
+    void ReclaimRetiredSnapshots();
+
+    // ReclaimRetiredSnapshots if lock_ is free, it never waits
+    void TryReclaimRetiredSnapshots();
+
+    // the snapshot before first publish, it is owned by HapManager and never deleted alone
+    Snapshot initialSnapshot_;
+
+    // the published snapshot
+    std::atomic<Snapshot *> snapshot_;
+
+    // the snapshot each alive SnapshotGuard entered, null if the slot is free
+    std::atomic<const Snapshot *> readerSlots_[READER_SLOT_COUNT];
+
+    // count of alive SnapshotGuard without a slot, nothing is reclaimed while it is not 0
+    std::atomic<uint32_t> overflowReaders_;
+
+    // count of PinSnapshots not released yet
+    std::atomic<uint32_t> pinCount_;
+
+    // snapshots replaced but maybe still read
+    std::vector<Snapshot *> retiredSnapshots_;
+
+    // paths being parsed by AddResourceAsync, every snapshot built copies its size as pendingHapCount_
+    std::vector<std::string> pendingHapPaths_;
+
+    // worker threads of AddResourceAsync, stopped when HapManager is destructed
+    LoaderPool loaders_;
+
+    // the watcher thread of StartWatch
+    std::thread watcher_;
+
+    std::atomic<bool> watching_;
+
+    // set by the watcher when a watched directory changed, cleared after reload
+    std::atomic<bool> changed_;
+
+    uint32_t watchIntervalMs_;
+
+    std::atomic<size_t> memoryBudget_;
+
+    // increased by every lookup hit when memoryBudget_ is set
+    std::atomic<uint64_t> accessClock_;
+
+    std::atomic<uint32_t> evictionCount_;
 
-    // app res config
-    ResConfigImpl *resConfig_;
+    std::atomic<uint32_t> reloadCount_;
 
-    // set of hap Resources
-    std::vector<HapResource *> hapResources_;
+    std::atomic<uint64_t> reloadTimeUs_;
 
-    // set of loaded hap path
-    std::vector<std::string> loadedHapPaths_;
+    // one entry per language met, never shrinks since snapshots point into it
+    std::vector<PluralRules *> pluralRulesCache_;
 
-    // key is language
-    std::vector<std::pair<std::string, OHOS::I18N::PluralFormat *>> plurRulesCache_;
+    // guards pluralRulesCache_, so building plural rules does not wait for hap loading
+    Lock pluralLock_;
 
     Lock lock_;
 };
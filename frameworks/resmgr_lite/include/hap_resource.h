@@ -18,9 +18,12 @@
 #include <map>
 #include <string>
 #include <time.h>
+#include <utility>
 #include <vector>
+#include "qualifier_matcher.h"
 #include "res_desc.h"
 #include "res_config_impl.h"
+#include "utils/utils.h"
 
 namespace OHOS {
 namespace Global {
@@ -56,6 +59,22 @@ public:
         return indexPath_;
     }
 
+    /**
+     * Get the stamp of resource.index file when it was loaded
+     */
+    inline const FileStamp &GetFileStamp() const
+    {
+        return fileStamp_;
+    }
+
+    /**
+     * Get the size of resources.index data, it is used to account the memory of this hap
+     */
+    inline size_t GetDataSize() const
+    {
+        return dataSize_;
+    }
+
     /**
      * Get the resource path
      */
@@ -128,6 +147,7 @@ public:
         inline void AddLimitPath(ValueUnderQualifierDir *vuqd)
         {
             limitPaths_.push_back(vuqd);
+            matcher_.Add(vuqd->GetResConfig());
         }
 
         inline const std::vector<ValueUnderQualifierDir *> &GetLimitPathsConst() const
@@ -135,11 +155,22 @@ public:
             return limitPaths_;
         }
 
+        /**
+         * Get the qualifier configs of the limit paths, candidate i is limit path i
+         */
+        inline const QualifierMatcher &GetQualifierMatcher() const
+        {
+            return matcher_;
+        }
+
         ~IdValues();
 
     private:
         // the folder desc
         std::vector<ValueUnderQualifierDir *> limitPaths_;
+
+        // the configs of limitPaths_ laid out to be matched in blocks
+        QualifierMatcher matcher_;
     };
 
     /**
@@ -157,6 +188,13 @@ public:
      */
     const IdValues *GetIdValuesByName(const std::string name, const ResType resType) const;
 
+    /**
+     * Get the resource value by resource name hashed at build time, no string is built or compared but the match
+     * @param name the resource name with its hash
+     * @return the resource value related to resource name
+     */
+    const IdValues *GetIdValuesByName(const ResName &name) const;
+
     /**
      * Get the resource id by resource name
      * @param name the resource name
@@ -170,8 +208,30 @@ public:
         return idValuesMap_.size();
     }
 
+    /**
+     * Get all resource values, the key is resource id
+     */
+    inline const std::map<uint32_t, IdValues *> &GetIdValuesMap() const
+    {
+        return idValuesMap_;
+    }
+
+    /**
+     * Get all resource values of resType, the key is resource name
+     * @param resType the resource type
+     * @return the resource values, null if the hap is not initialized
+     */
+    inline const std::map<std::string, IdValues *> *GetIdValuesNameMap(const ResType resType) const
+    {
+        if (static_cast<size_t>(resType) >= idValuesNameMap_.size()) {
+            return nullptr;
+        }
+        return idValuesNameMap_[resType];
+    }
+
 private:
-    HapResource(const std::string path, time_t lastModTime, const ResConfig *defaultConfig, ResDesc *resDes);
+    HapResource(const std::string path, const FileStamp &fileStamp, const ResConfig *defaultConfig,
+        ResDesc *resDes);
 
     // must call Init() after constructor
     bool Init();
@@ -179,14 +239,20 @@ private:
     // step of Init(), called in Init()
     bool InitIdList();
 
+    // step of Init(), index idValuesNameMap_ by HashResName
+    void InitNameHashIndex();
+
     // resources.index file path
     const std::string indexPath_;
 
     // resource path , calculated from indexPath_
     std::string resourcePath_;
 
-    // last mod time of hap file
-    time_t lastModTime_;
+    // stamp of resources.index file, taken before it was read
+    FileStamp fileStamp_;
+
+    // size of resources.index data
+    size_t dataSize_;
 
     // resource information stored in resDesc_
     ResDesc *resDesc_;
@@ -197,6 +263,9 @@ private:
     // name may conflict in same restype !
     std::vector<std::map<std::string, IdValues *> *> idValuesNameMap_;
 
+    // (HashResName, IdValues) of every entry of idValuesNameMap_, sorted by hash
+    std::vector<std::pair<uint64_t, IdValues *>> nameHashIndex_;
+
     // default resconfig
     const ResConfig *defaultConfig_;
 };
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_RESOURCE_MANAGER_INSERT_ONLY_TABLE_H
+#define OHOS_RESOURCE_MANAGER_INSERT_ONLY_TABLE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+/**
+ * Hash table filled by concurrent readers without lock, an entry is never changed or removed until destruction.
+ * Find is wait-free, Insert is lock-free and the value inserted first for a key wins.
+ */
+template<typename T>
+class InsertOnlyTable {
+public:
+    InsertOnlyTable() : size_(0)
+    {
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            buckets_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~InsertOnlyTable()
+    {
+        for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+            Node *node = buckets_[i].load(std::memory_order_relaxed);
+            while (node != nullptr) {
+                Node *next = node->next_;
+                delete (node);
+                node = next;
+            }
+        }
+    }
+
+    /**
+     * Find the value of key
+     * @param key the key
+     * @return the value, it lives as long as the table, null if key is absent
+     */
+    const T *Find(uint64_t key) const
+    {
+        return Find(buckets_[Bucket(key)].load(std::memory_order_acquire), nullptr, key);
+    }
+
+    /**
+     * Insert value unless key is present
+     * @param key the key
+     * @param value the value
+     * @return the value of key in the table, which is the one inserted first when several readers race,
+     *         null if no memory
+     */
+    const T *Insert(uint64_t key, const T &value)
+    {
+        std::atomic<Node *> &bucket = buckets_[Bucket(key)];
+        Node *checked = bucket.load(std::memory_order_acquire);
+        const T *found = Find(checked, nullptr, key);
+        if (found != nullptr) {
+            return found;
+        }
+        Node *node = new (std::nothrow) Node(key, value, checked);
+        if (node == nullptr) {
+            return nullptr;
+        }
+        while (!bucket.compare_exchange_weak(node->next_, node, std::memory_order_release,
+            std::memory_order_acquire)) {
+            // only the nodes pushed since the last check may hold key
+            found = Find(node->next_, checked, key);
+            if (found != nullptr) {
+                delete (node);
+                return found;
+            }
+            checked = node->next_;
+        }
+        size_.fetch_add(1, std::memory_order_relaxed);
+        return &node->value_;
+    }
+
+    /**
+     * Get the count of keys
+     */
+    size_t Size() const
+    {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+private:
+    static const size_t BUCKET_BITS = 7;
+
+    static const size_t BUCKET_COUNT = 1 << BUCKET_BITS;
+
+    struct Node {
+        Node(uint64_t key, const T &value, Node *next) : key_(key), value_(value), next_(next)
+        {}
+
+        uint64_t key_;
+        T value_;
+        Node *next_;
+    };
+
+    static size_t Bucket(uint64_t key)
+    {
+        // fibonacci hashing, so keys of aligned pointers spread over the buckets
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> (64 - BUCKET_BITS));
+    }
+
+    // search the chain from first until last, last excluded
+    static const T *Find(const Node *first, const Node *last, uint64_t key)
+    {
+        for (const Node *node = first; node != last; node = node->next_) {
+            if (node->key_ == key) {
+                return &node->value_;
+            }
+        }
+        return nullptr;
+    }
+
+    std::atomic<Node *> buckets_[BUCKET_COUNT];
+
+    std::atomic<size_t> size_;
+
+    InsertOnlyTable(const InsertOnlyTable &src) = delete;
+
+    InsertOnlyTable &operator=(const InsertOnlyTable &src) = delete;
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -25,6 +25,17 @@ public:
         const ResLocale *other,
         const ResLocale *request);
 
+    /**
+     * Compute the suitability score of a candidate for the request, the candidate must Match the request.
+     * Between two such candidates the higher score is the one IsMoreSuitable prefers, equal scores compare as 0,
+     * so the best candidate is the one with the max score and sorting the scores ranks them.
+     * The candidate without locale is left out, IsMoreSuitable does not order it consistently against the others
+     * @param candidate the candidate ResLocale
+     * @param request the request ResLocale
+     * @return the suitability score, 0 if candidate or request is nullptr
+     */
+    static uint32_t ComputeSuitability(const ResLocale *candidate, const ResLocale *request);
+
     /**
      * Whether the current ResLocale same to the other ResLocale
      * @param current the current ResLocale
@@ -77,9 +88,14 @@ public:
     static uint64_t EN_US_ENCODE;
     static uint64_t EN_GB_ENCODE;
     static uint64_t EN_QAAG_ENCODE;
+    static uint64_t EN_LATN_ENCODE;
+    static uint64_t EN_ENCODE;
+    static uint64_t EN_001_ENCODE;
     static uint64_t ZH_HANT_MO_ENCODE;
     static uint64_t ZH_HK_ENCODE;
     static uint32_t HANT_ENCODE;
+    static uint16_t EN_LANGUAGE_ENCODE;
+    static uint16_t US_REGION_ENCODE;
     static constexpr uint64_t ROOT_LOCALE = 0x0;
     static constexpr uint16_t NULL_LANGUAGE = 0x0;
     static constexpr uint16_t NULL_REGION = 0x0;
@@ -29,6 +29,8 @@ public:
 
     bool unlock();
 
+    bool try_lock();
+
 private:
     std::mutex* mtx_;
 
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_RESOURCE_MANAGER_QUALIFIER_MATCHER_H
+#define OHOS_RESOURCE_MANAGER_QUALIFIER_MATCHER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "res_config_impl.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+/**
+ * The qualifier configs of the candidates of an id as integer arrays, one per qualifier, so that a request is
+ * matched against several candidates at once, with SSE2 or NEON when available.
+ * A candidate matches exactly when ResConfigImpl::Match of the request returns true for its config.
+ */
+class QualifierMatcher {
+public:
+    // the request side of the match, computed once per request config
+    struct Request {
+        bool hasLocale;
+        bool isEnQaag;
+        uint32_t language;
+        // the old or new code of language, language itself if it has none
+        uint32_t languageAlias;
+        // the script, or the default script of language and region if the script is not set
+        uint32_t script;
+        uint32_t region;
+        uint32_t direction;
+        uint32_t deviceType;
+    };
+
+    // count of candidates matched by one call of Match
+    static constexpr size_t BLOCK_SIZE = 64;
+
+    /**
+     * Compute the request side of the match
+     * @param resConfig the request config
+     * @param request the request to fill
+     */
+    static void MakeRequest(const ResConfigImpl *resConfig, Request &request);
+
+    QualifierMatcher();
+
+    /**
+     * Append a candidate config
+     * @param resConfig the config of the candidate, a null config never matches
+     */
+    void Add(const ResConfigImpl *resConfig);
+
+    size_t Size() const
+    {
+        return count_;
+    }
+
+    /**
+     * Match the request against a block of candidates
+     * @param request the request made by MakeRequest
+     * @param begin index of the first candidate of the block
+     * @return bit i is set if candidate begin + i matches, for the BLOCK_SIZE candidates from begin
+     */
+    uint64_t Match(const Request &request, size_t begin) const;
+
+private:
+    // arrays padded to a multiple of the lane count with candidates which never match
+    std::vector<uint32_t> languages_;
+    std::vector<uint32_t> scripts_;
+    std::vector<uint32_t> regions_;
+    // direction | device type << 8 | flags, see qualifier_matcher.cpp
+    std::vector<uint32_t> qualifiers_;
+    size_t count_;
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
+#endif
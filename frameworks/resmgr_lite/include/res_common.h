@@ -16,6 +16,12 @@
 #ifndef OHOS_RES_COMMON_H
 #define OHOS_RES_COMMON_H
 
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "rstate.h"
+
 namespace OHOS {
 namespace Global {
 namespace Resource {
@@ -113,6 +119,110 @@ enum Direction {
     DIRECTION_VERTICAL = 0,
     DIRECTION_HORIZONTAL = 1
 };
+
+// the residency of haps under the memory budget
+struct ResidencyStats {
+    // 0 means no budget, haps are never evicted
+    size_t memoryBudget;
+    // size of resources.index data of the resident haps
+    size_t residentSize;
+    uint32_t residentHapCount;
+    uint32_t evictedHapCount;
+    // total count of haps evicted to stubs
+    uint32_t evictionCount;
+    // total count and cost of reloading evicted haps on access
+    uint32_t reloadCount;
+    uint64_t reloadTimeUs;
+};
+
+// a typed argument of the format getters, a string is borrowed and must outlive the call
+struct FormatArg {
+    enum Type {
+        INT,
+        UINT,
+        DOUBLE,
+        STRING,
+    };
+
+    FormatArg(int value) : type(INT), intValue(value) {}
+
+    FormatArg(long value) : type(INT), intValue(value) {}
+
+    FormatArg(long long value) : type(INT), intValue(value) {}
+
+    FormatArg(unsigned int value) : type(UINT), uintValue(value) {}
+
+    FormatArg(unsigned long value) : type(UINT), uintValue(value) {}
+
+    FormatArg(unsigned long long value) : type(UINT), uintValue(value) {}
+
+    FormatArg(double value) : type(DOUBLE), doubleValue(value) {}
+
+    FormatArg(const char *value) : type(STRING), strValue(value) {}
+
+    FormatArg(const std::string &value) : type(STRING), strValue(value.c_str()) {}
+
+    Type type;
+    union {
+        long long intValue;
+        unsigned long long uintValue;
+        double doubleValue;
+        const char *strValue;
+    };
+};
+
+// step of HashResName over the rest of name
+constexpr uint64_t HashResNameFrom(const char *name, uint64_t hash)
+{
+    return (*name == '\0') ? hash :
+        HashResNameFrom(name + 1, (hash ^ static_cast<uint8_t>(*name)) * 0x100000001b3ULL);
+}
+
+// FNV-1a over resType and name, a constant name is hashed at compile time
+constexpr uint64_t HashResName(const char *name, ResType resType)
+{
+    return HashResNameFrom(name, (0xcbf29ce484222325ULL ^ static_cast<uint8_t>(resType)) * 0x100000001b3ULL);
+}
+
+// a resource name with its HashResName, the ResourceTable header generated by restable_gen holds one per resource
+struct ResName {
+    const char *name;
+    ResType resType;
+    uint64_t hash;
+};
+
+// a resource bound by ResourceManager::Resolve, getters taking it skip the lookup while the binding is current.
+// A getter rebinds the handle in place, so a thread must not use a handle another thread may pass to a getter
+struct ResHandle {
+    // the resource id, 0 if not resolved
+    uint32_t id;
+    // the epoch of the resources binding was made in, unique in the process
+    uint32_t epoch;
+    // opaque, the value selected for id under the config of epoch
+    const void *binding;
+    // opaque, the index of the hap binding is in
+    uint32_t hapIndex;
+};
+
+// one item of a batched lookup, resType selects which value is filled
+struct ResourceBatchItem {
+    // in: the resource id
+    uint32_t id;
+    // in: STRING, PLURALS, INTEGER, FLOAT, BOOLEAN or COLOR
+    ResType resType;
+    // in: the quantity of PLURALS
+    int quantity;
+    // out: the state of this item
+    RState state;
+    // out: stringValue is a view of STRING and PLURALS, valid as documented in ResourceManager::ViewScope
+    union {
+        const std::string *stringValue;
+        int intValue;
+        float floatValue;
+        bool boolValue;
+        uint32_t colorValue;
+    };
+};
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
@@ -61,6 +61,15 @@ LocaleInfo *BuildFromParts(const char *language, const char *script, const char
 
 void FindAndSort(const std::string localeStr, std::vector<std::string> &candidateLocale,
     std::vector<std::string> &outValue);
+
+/**
+ * Find the candidate locales matching the locale and sort them, the most suitable first, without parsing strings
+ * @param localeInfo the locale to match
+ * @param candidateLocale the candidate locales, a candidate without language is the default one
+ * @param outValue the indexes in candidateLocale of the matching candidates are appended to it, sorted
+ */
+void FindAndSort(const LocaleInfo &localeInfo, const std::vector<LocaleInfo> &candidateLocale,
+    std::vector<size_t> &outValue);
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
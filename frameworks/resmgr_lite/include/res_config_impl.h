@@ -15,7 +15,9 @@
 #ifndef OHOS_RESOURCE_MANAGER_RESCONFIG_IMPL_H
 #define OHOS_RESOURCE_MANAGER_RESCONFIG_IMPL_H
 
+#include <stddef.h>
 #include <stdint.h>
+#include <atomic>
 #include "locale_info.h"
 #include "res_locale.h"
 #include "res_common.h"
@@ -25,6 +27,101 @@ using OHOS::I18N::LocaleInfo;
 namespace OHOS {
 namespace Global {
 namespace Resource {
+/**
+ * The qualifiers of a resConfig packed in 16 bytes, so that configs are compared, hashed and copied as two
+ * integers. Two resConfigs with the same key select the same resources.
+ * Night mode, mcc and mnc are reserved, ResConfigImpl does not keep them so they are not set in its key.
+ */
+class ResConfigKey {
+public:
+    // a night mode, mcc or mnc which is not set
+    static const int32_t NOT_SET = -1;
+
+    ResConfigKey();
+
+    /**
+     * Get the encoded locale, see Utils::EncodeLocale
+     * @return the encoded locale, 0 if the locale is not set
+     */
+    uint64_t GetEncodedLocale() const
+    {
+        return locale_;
+    }
+
+    void SetEncodedLocale(uint64_t encodedLocale)
+    {
+        locale_ = encodedLocale;
+    }
+
+    Direction GetDirection() const;
+
+    void SetDirection(Direction direction);
+
+    DeviceType GetDeviceType() const;
+
+    void SetDeviceType(DeviceType deviceType);
+
+    ScreenDensity GetScreenDensity() const;
+
+    void SetScreenDensity(ScreenDensity screenDensity);
+
+    /**
+     * Get the night mode, see NightMode
+     * @return the night mode, NOT_SET if it is not set
+     */
+    int32_t GetNightMode() const;
+
+    void SetNightMode(int32_t nightMode);
+
+    /**
+     * Get the mobile country code
+     * @return the mcc from 0 to 999, NOT_SET if it is not set
+     */
+    int32_t GetMcc() const;
+
+    void SetMcc(int32_t mcc);
+
+    /**
+     * Get the mobile network code
+     * @return the mnc from 0 to 999, NOT_SET if it is not set
+     */
+    int32_t GetMnc() const;
+
+    void SetMnc(int32_t mnc);
+
+    bool operator==(const ResConfigKey &other) const
+    {
+        // one branch for both words
+        return ((locale_ ^ other.locale_) | (qualifiers_ ^ other.qualifiers_)) == 0;
+    }
+
+    bool operator!=(const ResConfigKey &other) const
+    {
+        return !(*this == other);
+    }
+
+    /**
+     * Hash of a key, for unordered containers keyed by ResConfigKey
+     */
+    struct Hash {
+        size_t operator()(const ResConfigKey &key) const;
+    };
+
+private:
+    uint32_t GetField(uint32_t shift, uint32_t mask) const;
+
+    void SetField(uint32_t shift, uint32_t mask, uint32_t value);
+
+    int32_t GetOptionalField(uint32_t shift, uint32_t mask) const;
+
+    void SetOptionalField(uint32_t shift, uint32_t mask, int32_t value);
+
+    uint64_t locale_;
+    // screen density | direction << 16 | device type << 24 | night mode << 32 | mcc << 40 | mnc << 52,
+    // a field with all bits set is not set
+    uint64_t qualifiers_;
+};
+
 class ResConfigImpl : public ResConfig {
 public:
     ResConfigImpl();
@@ -71,6 +168,11 @@ public:
      */
     void SetScreenDensity(ScreenDensity screenDensity);
 
+    /**
+     * Get the locale information, it is built from the resLocale on the first call so that creating and copying
+     * a resConfig does not allocate
+     * @return the locale information, nullptr if the locale is not set
+     */
     const LocaleInfo *GetLocaleInfo() const;
 
     const ResLocale *GetResLocale() const;
@@ -106,6 +208,20 @@ public:
      */
     bool IsCompletedScript() const;
 
+    /**
+     * Get the packed qualifiers of this resConfig
+     * @return the key, resConfigs with equal keys select the same resources
+     */
+    ResConfigKey GetKey() const;
+
+    /**
+     * Set the locale, direction, device type and screen density of this resConfig from a key, the reserved
+     * qualifiers of the key are ignored
+     * @param key the key
+     * @return SUCCESS if the locale of the key is valid, else the locale of this resConfig is unchanged
+     */
+    RState SetKey(const ResConfigKey &key);
+
     virtual ~ResConfigImpl();
 
 private:
@@ -113,13 +229,15 @@ private:
 
     bool CopyLocale(ResConfig &other);
 
+    void ClearLocale();
+
 private:
-    ResLocale *resLocale_;
+    ResLocale resLocale_;
     Direction direction_;
     ScreenDensity screenDensity_;
     DeviceType deviceType_;
     bool isCompletedScript_;
-    LocaleInfo *localeInfo_;
+    mutable std::atomic<LocaleInfo *> localeInfo_;
 };
 } // namespace Resource
 } // namespace Global
@@ -21,6 +21,7 @@
 #include <string>
 #include <vector>
 #include "res_common.h"
+#include "rstate.h"
 
 namespace OHOS {
 namespace Global {
@@ -85,8 +86,69 @@ public:
      */
     static bool IsRef(const std::string &value, ResType &resType, int &id);
 
+    /**
+     * A "$type:id" value parsed once at load
+     */
+    struct ValueRef {
+        ResType resType_;
+        // 0 if the value is literal
+        uint32_t id_;
+    };
+
+    /**
+     * Parse value_ and values_ into valueRef_ and valueRefs_, called once after they are parsed
+     */
+    void InitValueRefs();
+
+    /**
+     * The value of an INTEGER, FLOAT, BOOLEAN or COLOR resource decoded from text
+     */
+    union TypedValue {
+        int intValue_;
+        float floatValue_;
+        bool boolValue_;
+        uint32_t colorValue_;
+    };
+
+    /**
+     * Decode a text value as type
+     * @param type INTEGER, FLOAT, BOOLEAN or COLOR
+     * @param value the text value
+     * @param typedValue the decoded value write to
+     * @return SUCCESS if the value is valid for type, else ERROR or INVALID_FORMAT
+     */
+    static RState DecodeValue(ResType type, const std::string &value, TypedValue &typedValue);
+
+    /**
+     * Decode literal value_ or values_ by resType_ into typedValue_ or intValues_, called once after the refs
+     * are parsed, so an invalid value is reported once at load
+     */
+    void DecodeValues();
+
+    /**
+     * Get the reference parsed from values_[index]
+     * @param index the index in values_
+     * @return the reference, its id_ is 0 if the value is literal
+     */
+    const ValueRef &GetValueRef(size_t index) const;
+
     std::string ToString() const;
 
+    /**
+     * Index the values_ of a plurals resource by plural category, called once after values_ is parsed
+     */
+    void InitPluralForms();
+
+    /**
+     * Get the index in values_ of the value of a plural category, fall back to "other" when the category is absent
+     * @param category the plural category, in the order of PluralRuleType: zero, one, two, few, many, other
+     * @return the index, -1 if neither the category nor "other" exists
+     */
+    int32_t GetPluralIndex(int category) const;
+
+    // zero, one, two, few, many, other
+    static const int PLURAL_CATEGORY_COUNT = 6;
+
     uint32_t size_;
     ResType resType_;
     uint32_t id_;
@@ -95,6 +157,17 @@ public:
     std::string value_;
     std::vector<std::string> values_;
     std::string name_;
+    // the reference parsed from value_
+    ValueRef valueRef_ = { ResType::VALUES, 0 };
+    // the references parsed from values_, empty if all of them are literal
+    std::vector<ValueRef> valueRefs_;
+    // literal value_ decoded at load, valid if decodeState_ is SUCCESS
+    TypedValue typedValue_ = { 0 };
+    RState decodeState_ = NOT_FOUND;
+    // literal values_ of INTARRAY decoded at load, empty if some of values_ is a reference or invalid
+    std::vector<int> intValues_;
+    // index in values_ of the value of each plural category, -1 if absent
+    int32_t pluralForms_[PLURAL_CATEGORY_COUNT] = {-1, -1, -1, -1, -1, -1};
 
 private:
     static bool sInit;
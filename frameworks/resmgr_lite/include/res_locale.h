@@ -16,11 +16,14 @@
 #ifndef OHOS_RESOURCE_MANAGER_RES_LOCALE_H
 #define OHOS_RESOURCE_MANAGER_RES_LOCALE_H
 
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 #include "rstate.h"
 #include "lock.h"
 #include "locale_info.h"
+#include "utils/common.h"
 
 using OHOS::I18N::LocaleInfo;
 namespace OHOS {
@@ -35,6 +38,9 @@ struct ParseResult {
     int16_t regionTagLen = 0;
 };
 
+/**
+ * The tags are stored inline so a ResLocale is a trivially copyable value, building or copying it never allocates.
+ */
 class ResLocale {
 public:
     const char *GetLanguage() const;
@@ -43,6 +49,27 @@ public:
 
     const char *GetScript() const;
 
+    /**
+     * Get the encoded tags, computed once when the tag is set, see Utils::EncodeLanguage, EncodeScript,
+     * EncodeRegion and EncodeLocale
+     */
+    uint16_t GetEncodedLanguage() const
+    {
+        return encodedLanguage_;
+    }
+
+    uint32_t GetEncodedScript() const
+    {
+        return encodedScript_;
+    }
+
+    uint16_t GetEncodedRegion() const
+    {
+        return encodedRegion_;
+    }
+
+    uint64_t GetEncodedLocale() const;
+
     ResLocale();
 
     /**
@@ -59,8 +86,18 @@ public:
      */
     RState Copy(const ResLocale *other);
 
+    /**
+     * Get the system default locale, wait-free
+     * @return the default locale, valid until the process exits, nullptr if it was never set
+     */
     static const LocaleInfo *GetDefault();
 
+    /**
+     * Publish a new system default locale, the previous one stays valid for the readers which got it
+     * @param localeInfo the new default locale
+     * @param needNotify unused
+     * @return true if the default locale is updated, false if no memory
+     */
     static bool UpdateDefault(const LocaleInfo &localeInfo, bool needNotify);
 
     /**
@@ -72,6 +109,16 @@ public:
      */
     static ResLocale *BuildFromString(const char *bcp47String, char sep, RState &rState);
 
+    /**
+     * Build resLocal from string without allocating
+     * @param bcp47String the target string
+     * @param sep the parse string position
+     * @param outValue the resLocal to build, it has no language if bcp47String is empty,
+     *        left unchanged if bcp47String is invalid
+     * @return SUCCESS if bcp47String is empty or valid, else the parse status
+     */
+    static RState BuildFromString(const char *bcp47String, char sep, ResLocale &outValue);
+
     /**
      * Build resLocal from parts
      * @param language the resLocal language
@@ -82,7 +129,15 @@ public:
      */
     static ResLocale *BuildFromParts(const char *language, const char *script, const char *region, RState &rState);
 
-    ~ResLocale();
+    /**
+     * Build resLocal from parts without allocating
+     * @param language the resLocal language
+     * @param script the resLocal script
+     * @param region the resLocal region
+     * @param outValue the resLocal to build, left unchanged if the parts are invalid
+     * @return SUCCESS if the parts are valid, else the INVALID_BCP47_* state of the first invalid part
+     */
+    static RState BuildFromParts(const char *language, const char *script, const char *region, ResLocale &outValue);
 
     static constexpr uint16_t END_TYPE = 0x0000;
     // language parse
@@ -101,21 +156,31 @@ private:
 
     RState SetRegion(const char *region, size_t len);
 
-    static ResLocale *DoParse(const char *bcp47String, char sep, RState &rState);
+    static RState DoParse(const char *bcp47String, char sep, ResLocale &outValue);
 
-    static ResLocale *CreateResLocale(ParseResult &parseResult, RState &rState);
+    static RState CreateResLocale(ParseResult &parseResult, ResLocale &outValue);
 
     RState Init(const char *language, size_t languageLen, const char *script, size_t scriptLen,
         const char *region, size_t regionLen);
 
-    const char *language_;
+    char language_[LANGUAGE_ARRAY_LEN];
+
+    char region_[REGION_ARRAY_LEN];
+
+    char script_[SCRIPT_ARRAY_LEN];
+
+    uint16_t encodedLanguage_;
+
+    uint32_t encodedScript_;
 
-    const char *region_;
+    uint16_t encodedRegion_;
 
-    const char *script_;
+    static std::atomic<const LocaleInfo *> defaultLocale_;
 
-    static LocaleInfo *defaultLocale_;
+    // every default locale published so far, never deleted, a locale published again is reused from it
+    static std::vector<LocaleInfo *> defaultLocales_;
 
+    // serializes UpdateDefault, GetDefault does not take it
     static Lock lock_;
 
     friend class LocaleMatcher;
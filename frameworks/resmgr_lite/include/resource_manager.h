@@ -15,7 +15,9 @@
 #ifndef OHOS_RESOURCE_MANAGER_RESOURCEMANAGER_H
 #define OHOS_RESOURCE_MANAGER_RESOURCEMANAGER_H
 
+#include <future>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include "res_config.h"
@@ -25,11 +27,50 @@ namespace Global {
 namespace Resource {
 class ResourceManager {
 public:
+    /**
+     * Keep the values returned by the view getters alive while it is in scope, it never blocks.
+     * Without a ViewScope a view is valid until the next AddResource, UpdateResConfig, Refresh or SetMemoryBudget,
+     * use a ViewScope when AddResourceAsync, StartWatch or a memory budget may replace resources meanwhile.
+     * Replaced resources are freed only after every ViewScope is destructed, so keep it short.
+     */
+    class ViewScope {
+    public:
+        explicit ViewScope(ResourceManager &resourceManager) : resourceManager_(resourceManager)
+        {
+            resourceManager_.PinViews();
+        }
+
+        ~ViewScope()
+        {
+            resourceManager_.UnpinViews();
+        }
+
+    private:
+        ResourceManager &resourceManager_;
+
+        ViewScope(const ViewScope &src) = delete;
+
+        ViewScope &operator=(const ViewScope &src) = delete;
+    };
 
     virtual ~ResourceManager() = 0;
 
     virtual bool AddResource(const char *path) = 0;
 
+    virtual std::shared_future<bool> AddResourceAsync(const char *path) = 0;
+
+    virtual bool AddResources(const std::vector<std::string> &paths) = 0;
+
+    virtual RState Refresh() = 0;
+
+    virtual bool StartWatch(uint32_t intervalMs) = 0;
+
+    virtual void StopWatch() = 0;
+
+    virtual void SetMemoryBudget(size_t budget) = 0;
+
+    virtual void GetResidencyStats(ResidencyStats &stats) = 0;
+
     virtual RState UpdateResConfig(ResConfig &resConfig) = 0;
 
     virtual void GetResConfig(ResConfig &resConfig) = 0;
@@ -38,57 +79,147 @@ public:
 
     virtual RState GetStringByName(const char *name, std::string &outValue) = 0;
 
+    virtual RState GetStringByName(const ResName &name, std::string &outValue) = 0;
+
+    virtual RState GetStringViewById(uint32_t id, const std::string *&outValue) = 0;
+
+    virtual RState GetStringViewByName(const char *name, const std::string *&outValue) = 0;
+
+    virtual RState GetStringViewByName(const ResName &name, const std::string *&outValue) = 0;
+
     virtual RState GetStringFormatById(std::string &outValue, uint32_t id, ...) = 0;
 
     virtual RState GetStringFormatByName(std::string &outValue, const char *name, ...) = 0;
 
+    virtual RState GetStringFormatById(std::string &outValue, uint32_t id, const std::vector<FormatArg> &args) = 0;
+
+    virtual RState GetStringFormatByName(std::string &outValue, const char *name,
+        const std::vector<FormatArg> &args) = 0;
+
     virtual RState GetStringArrayById(uint32_t id, std::vector<std::string> &outValue) = 0;
 
     virtual RState GetStringArrayByName(const char *name, std::vector<std::string> &outValue) = 0;
 
+    virtual RState GetStringArrayByName(const ResName &name, std::vector<std::string> &outValue) = 0;
+
+    virtual RState GetStringArrayViewById(uint32_t id, std::vector<const std::string *> &outValue) = 0;
+
+    virtual RState GetStringArrayViewByName(const char *name, std::vector<const std::string *> &outValue) = 0;
+
     virtual RState GetPatternById(uint32_t id, std::map<std::string, std::string> &outValue) = 0;
 
     virtual RState GetPatternByName(const char *name, std::map<std::string, std::string> &outValue) = 0;
 
+    virtual RState GetPatternById(uint32_t id, std::shared_ptr<const std::map<std::string, std::string>> &outValue) = 0;
+
+    virtual RState GetPatternByName(const char *name,
+        std::shared_ptr<const std::map<std::string, std::string>> &outValue) = 0;
+
+    virtual RState GetPatternByName(const ResName &name,
+        std::shared_ptr<const std::map<std::string, std::string>> &outValue) = 0;
+
     virtual RState GetPluralStringById(uint32_t id, int quantity, std::string &outValue) = 0;
 
     virtual RState GetPluralStringByName(const char *name, int quantity, std::string &outValue) = 0;
 
+    virtual RState GetPluralStringByName(const ResName &name, int quantity, std::string &outValue) = 0;
+
     virtual RState GetPluralStringByIdFormat(std::string &outValue, uint32_t id, int quantity, ...) = 0;
 
     virtual RState GetPluralStringByNameFormat(std::string &outValue, const char *name, int quantity, ...) = 0;
 
+    virtual RState GetPluralStringByIdFormat(std::string &outValue, uint32_t id, int quantity,
+        const std::vector<FormatArg> &args) = 0;
+
+    virtual RState GetPluralStringByNameFormat(std::string &outValue, const char *name, int quantity,
+        const std::vector<FormatArg> &args) = 0;
+
     virtual RState GetThemeById(uint32_t id, std::map<std::string, std::string> &outValue) = 0;
 
     virtual RState GetThemeByName(const char *name, std::map<std::string, std::string> &outValue) = 0;
 
+    virtual RState GetThemeById(uint32_t id, std::shared_ptr<const std::map<std::string, std::string>> &outValue) = 0;
+
+    virtual RState GetThemeByName(const char *name,
+        std::shared_ptr<const std::map<std::string, std::string>> &outValue) = 0;
+
+    virtual RState GetThemeByName(const ResName &name,
+        std::shared_ptr<const std::map<std::string, std::string>> &outValue) = 0;
+
     virtual RState GetBooleanById(uint32_t id, bool &outValue) = 0;
 
     virtual RState GetBooleanByName(const char *name, bool &outValue) = 0;
 
+    virtual RState GetBooleanByName(const ResName &name, bool &outValue) = 0;
+
     virtual RState GetIntegerById(uint32_t id, int &outValue) = 0;
 
     virtual RState GetIntegerByName(const char *name, int &outValue) = 0;
 
+    virtual RState GetIntegerByName(const ResName &name, int &outValue) = 0;
+
     virtual RState GetFloatById(uint32_t id, float &outValue) = 0;
 
     virtual RState GetFloatByName(const char *name, float &outValue) = 0;
 
+    virtual RState GetFloatByName(const ResName &name, float &outValue) = 0;
+
     virtual RState GetIntArrayById(uint32_t id, std::vector<int> &outValue) = 0;
 
     virtual RState GetIntArrayByName(const char *name, std::vector<int> &outValue) = 0;
 
+    virtual RState GetIntArrayByName(const ResName &name, std::vector<int> &outValue) = 0;
+
     virtual RState GetColorById(uint32_t id, uint32_t &outValue) = 0;
 
     virtual RState GetColorByName(const char *name, uint32_t &outValue) = 0;
 
+    virtual RState GetColorByName(const ResName &name, uint32_t &outValue) = 0;
+
     virtual RState GetProfileById(uint32_t id, std::string &outValue) = 0;
 
     virtual RState GetProfileByName(const char *name, std::string &outValue) = 0;
 
+    virtual RState GetProfileByName(const ResName &name, std::string &outValue) = 0;
+
     virtual RState GetMediaById(uint32_t id, std::string &outValue) = 0;
 
     virtual RState GetMediaByName(const char *name, std::string &outValue) = 0;
+
+    virtual RState GetMediaByName(const ResName &name, std::string &outValue) = 0;
+
+    virtual RState GetStringsByIds(const uint32_t *ids, size_t count, std::string *outValues, RState *outStates) = 0;
+
+    virtual RState GetStringViewsByIds(const uint32_t *ids, size_t count, const std::string **outValues,
+        RState *outStates) = 0;
+
+    virtual RState GetResourcesByIds(ResourceBatchItem *items, size_t count) = 0;
+
+    virtual RState Resolve(const char *name, const ResType resType, ResHandle &outHandle) = 0;
+
+    virtual RState Resolve(const ResName &name, ResHandle &outHandle) = 0;
+
+    virtual RState GetStringByHandle(ResHandle &handle, std::string &outValue) = 0;
+
+    virtual RState GetStringViewByHandle(ResHandle &handle, const std::string *&outValue) = 0;
+
+    virtual RState GetStringArrayByHandle(ResHandle &handle, std::vector<std::string> &outValue) = 0;
+
+    virtual RState GetPluralStringByHandle(ResHandle &handle, int quantity, std::string &outValue) = 0;
+
+    virtual RState GetBooleanByHandle(ResHandle &handle, bool &outValue) = 0;
+
+    virtual RState GetIntegerByHandle(ResHandle &handle, int &outValue) = 0;
+
+    virtual RState GetFloatByHandle(ResHandle &handle, float &outValue) = 0;
+
+    virtual RState GetIntArrayByHandle(ResHandle &handle, std::vector<int> &outValue) = 0;
+
+    virtual RState GetColorByHandle(ResHandle &handle, uint32_t &outValue) = 0;
+
+    virtual void PinViews() = 0;
+
+    virtual void UnpinViews() = 0;
 };
 
 ResourceManager *CreateResourceManager();
@@ -15,6 +15,8 @@
 #ifndef OHOS_RESOURCE_MANAGER_RESOURCEMANAGERIMPL_H
 #define OHOS_RESOURCE_MANAGER_RESOURCEMANAGERIMPL_H
 
+#include <cstdarg>
+#include <future>
 #include <map>
 #include <string>
 #include <vector>
@@ -39,6 +41,52 @@ public:
      */
     virtual bool AddResource(const char *path);
 
+    /**
+     * Add resource path to hap paths, the hap is parsed on a worker thread
+     * @param path the resource path
+     * @return the future of the result, true if add resource path success, else false.
+     *     Until it is ready, getters return NOT_READY for resources not found in the loaded haps
+     */
+    virtual std::shared_future<bool> AddResourceAsync(const char *path);
+
+    /**
+     * Add resource paths to hap paths, the haps are parsed in parallel and published at once
+     * @param paths the resource paths
+     * @return true if all resource paths are added success, else false
+     */
+    virtual bool AddResources(const std::vector<std::string> &paths);
+
+    /**
+     * Reload the haps whose resources.index changed since they were loaded
+     * @return SUCCESS if nothing changed or changed haps are reloaded, else HAP_INIT_FAILED
+     */
+    virtual RState Refresh();
+
+    /**
+     * Start watching the added haps, a changed hap is reloaded in the background
+     * @param intervalMs the poll interval in milliseconds, 0 means the default interval
+     * @return true if the watcher is started, false if it is already running
+     */
+    virtual bool StartWatch(uint32_t intervalMs);
+
+    /**
+     * Stop watching the added haps
+     */
+    virtual void StopWatch();
+
+    /**
+     * Set the memory budget of haps, the least recently used haps are evicted to stubs when it is exceeded
+     * and reloaded on their next access
+     * @param budget the budget in bytes of resources.index data, 0 means no budget
+     */
+    virtual void SetMemoryBudget(size_t budget);
+
+    /**
+     * Get the residency of haps under the memory budget
+     * @param stats the residency write to
+     */
+    virtual void GetResidencyStats(ResidencyStats &stats);
+
     /**
      * Update the resConfig
      * @param resConfig the resource config
@@ -68,6 +116,38 @@ public:
      */
     virtual RState GetStringByName(const char *name, std::string &outValue);
 
+    /**
+     * Get string by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the resource write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetStringByName(const ResName &name, std::string &outValue);
+
+    /**
+     * Get string resource by id without copying it
+     * @param id the resource id
+     * @param outValue the resource owned by the resource manager, valid as documented in ResourceManager::ViewScope
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetStringViewById(uint32_t id, const std::string *&outValue);
+
+    /**
+     * Get string resource by name without copying it
+     * @param name the resource name
+     * @param outValue the resource owned by the resource manager, valid as documented in ResourceManager::ViewScope
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetStringViewByName(const char *name, const std::string *&outValue);
+
+    /**
+     * Get string resource by name hashed at build time without copying it
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the resource owned by the resource manager, valid as documented in ResourceManager::ViewScope
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetStringViewByName(const ResName &name, const std::string *&outValue);
+
     /**
      * Get formatstring by resource id
      * @param id the resource id
@@ -84,6 +164,24 @@ public:
      */
     virtual RState GetStringFormatByName(std::string &outValue, const char *name, ...);
 
+    /**
+     * Get formatstring by resource id with typed args, the format is parsed once per config
+     * @param outValue the resource write to, its buffer is reused
+     * @param id the resource id
+     * @param args the args of the placeholders
+     * @return SUCCESS if resource exist and args match the format, else NOT_FOUND or ERROR
+     */
+    virtual RState GetStringFormatById(std::string &outValue, uint32_t id, const std::vector<FormatArg> &args);
+
+    /**
+     * Get formatstring by resource name with typed args, the format is parsed once per config
+     * @param outValue the resource write to, its buffer is reused
+     * @param name the resource name
+     * @param args the args of the placeholders
+     * @return SUCCESS if resource exist and args match the format, else NOT_FOUND or ERROR
+     */
+    virtual RState GetStringFormatByName(std::string &outValue, const char *name, const std::vector<FormatArg> &args);
+
     /**
      * Get the STRINGARRAY resource by resource id
      * @param id the resource id
@@ -100,6 +198,30 @@ public:
      */
     virtual RState GetStringArrayByName(const char *name, std::vector<std::string> &outValue);
 
+    /**
+     * Get the STRINGARRAY resource by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the resource write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetStringArrayByName(const ResName &name, std::vector<std::string> &outValue);
+
+    /**
+     * Get the STRINGARRAY resource by resource id without copying its strings
+     * @param id the resource id
+     * @param outValue the strings owned by the resource manager, valid as documented in ResourceManager::ViewScope
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetStringArrayViewById(uint32_t id, std::vector<const std::string *> &outValue);
+
+    /**
+     * Get the STRINGARRAY resource by resource name without copying its strings
+     * @param name the resource name
+     * @param outValue the strings owned by the resource manager, valid as documented in ResourceManager::ViewScope
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetStringArrayViewByName(const char *name, std::vector<const std::string *> &outValue);
+
     /**
      * Get the PATTERN resource by resource id
      * @param id the resource id
@@ -116,6 +238,32 @@ public:
      */
     virtual RState GetPatternByName(const char *name, std::map<std::string, std::string> &outValue);
 
+    /**
+     * Get the PATTERN resource by resource id, the map is flattened once per config and shared by callers
+     * @param id the resource id
+     * @param outValue the resource write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetPatternById(uint32_t id, std::shared_ptr<const std::map<std::string, std::string>> &outValue);
+
+    /**
+     * Get the PATTERN resource by resource name, the map is flattened once per config and shared by callers
+     * @param name the resource name
+     * @param outValue the resource write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetPatternByName(const char *name,
+        std::shared_ptr<const std::map<std::string, std::string>> &outValue);
+
+    /**
+     * Get the PATTERN resource by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the flattened map shared by readers of the same config
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetPatternByName(const ResName &name,
+        std::shared_ptr<const std::map<std::string, std::string>> &outValue);
+
     /**
      * Get the plural string by resource id
      * @param id the resource id
@@ -134,6 +282,14 @@ public:
      */
     virtual RState GetPluralStringByName(const char *name, int quantity, std::string &outValue);
 
+    /**
+     * Get the plural string by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the resource write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetPluralStringByName(const ResName &name, int quantity, std::string &outValue);
+
     /**
      * Get the plural format string by resource id
      * @param outValue the resource write to
@@ -152,6 +308,28 @@ public:
      */
     virtual RState GetPluralStringByNameFormat(std::string &outValue, const char *name, int quantity, ...);
 
+    /**
+     * Get the plural format string by resource id with typed args, the format is parsed once per config
+     * @param outValue the resource write to, its buffer is reused
+     * @param id the resource id
+     * @param quantity the language quantity
+     * @param args the args of the placeholders
+     * @return SUCCESS if resource exist and args match the format, else NOT_FOUND or ERROR
+     */
+    virtual RState GetPluralStringByIdFormat(std::string &outValue, uint32_t id, int quantity,
+        const std::vector<FormatArg> &args);
+
+    /**
+     * Get the plural format string by resource name with typed args, the format is parsed once per config
+     * @param outValue the resource write to, its buffer is reused
+     * @param name the resource name
+     * @param quantity the language quantity
+     * @param args the args of the placeholders
+     * @return SUCCESS if resource exist and args match the format, else NOT_FOUND or ERROR
+     */
+    virtual RState GetPluralStringByNameFormat(std::string &outValue, const char *name, int quantity,
+        const std::vector<FormatArg> &args);
+
     /**
      * Get the THEME resource by resource id
      * @param id the resource id
@@ -168,6 +346,32 @@ public:
      */
     virtual RState GetThemeByName(const char *name, std::map<std::string, std::string> &outValue);
 
+    /**
+     * Get the THEME resource by resource id, the map is flattened once per config and shared by callers
+     * @param id the resource id
+     * @param outValue the resource write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetThemeById(uint32_t id, std::shared_ptr<const std::map<std::string, std::string>> &outValue);
+
+    /**
+     * Get the THEME resource by resource name, the map is flattened once per config and shared by callers
+     * @param name the resource name
+     * @param outValue the resource write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetThemeByName(const char *name,
+        std::shared_ptr<const std::map<std::string, std::string>> &outValue);
+
+    /**
+     * Get the THEME resource by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the flattened map shared by readers of the same config
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetThemeByName(const ResName &name,
+        std::shared_ptr<const std::map<std::string, std::string>> &outValue);
+
     /**
      * Get the BOOLEAN resource by resource id
      * @param id the resource id
@@ -184,6 +388,14 @@ public:
      */
     virtual RState GetBooleanByName(const char *name, bool &outValue);
 
+    /**
+     * Get the BOOLEAN resource by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the obtain boolean value write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetBooleanByName(const ResName &name, bool &outValue);
+
     /**
      * Get the INTEGER resource by resource id
      * @param id the resource id
@@ -200,6 +412,14 @@ public:
      */
     virtual RState GetIntegerByName(const char *name, int &outValue);
 
+    /**
+     * Get the INTEGER resource by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the obtain Integer value write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetIntegerByName(const ResName &name, int &outValue);
+
     /**
      * Get the FLOAT resource by resource id
      * @param id the resource id
@@ -216,6 +436,14 @@ public:
      */
     virtual RState GetFloatByName(const char *name, float &outValue);
 
+    /**
+     * Get the FLOAT resource by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the obtain float value write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetFloatByName(const ResName &name, float &outValue);
+
     /**
      * Get the INTARRAY resource by resource id
      * @param id the resource id
@@ -232,6 +460,14 @@ public:
      */
     virtual RState GetIntArrayByName(const char *name, std::vector<int> &outValue);
 
+    /**
+     * Get the INTARRAY resource by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the obtain int array write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetIntArrayByName(const ResName &name, std::vector<int> &outValue);
+
     /**
      * Get the COLOR resource by resource id
      * @param id the resource id
@@ -248,6 +484,14 @@ public:
      */
     virtual RState GetColorByName(const char *name, uint32_t &outValue);
 
+    /**
+     * Get the COLOR resource by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the obtain color value write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetColorByName(const ResName &name, uint32_t &outValue);
+
     /**
      * Get the PROF resource by resource id
      * @param id the resource id
@@ -264,6 +508,14 @@ public:
      */
     virtual RState GetProfileByName(const char *name, std::string &outValue);
 
+    /**
+     * Get the PROF resource by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the obtain resource path write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetProfileByName(const ResName &name, std::string &outValue);
+
     /**
      * Get the MEDIA resource by resource id
      * @param id the resource id
@@ -280,33 +532,228 @@ public:
      */
     virtual RState GetMediaByName(const char *name, std::string &outValue);
 
+    /**
+     * Get the MEDIA resource by resource name hashed at build time
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outValue the obtain resource path write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetMediaByName(const ResName &name, std::string &outValue);
+
+    /**
+     * Get string resources of several ids under one snapshot
+     * @param ids the resource ids
+     * @param count the count of ids
+     * @param outValues count strings the resources write to, a failed item is left unchanged
+     * @param outStates count states of the items write to, may be null
+     * @return SUCCESS if all resources exist, else the state of the first failed item
+     */
+    virtual RState GetStringsByIds(const uint32_t *ids, size_t count, std::string *outValues, RState *outStates);
+
+    /**
+     * Get string resources of several ids under one snapshot without copying them
+     * @param ids the resource ids
+     * @param count the count of ids
+     * @param outValues count views write to, valid as documented in ResourceManager::ViewScope, null if failed
+     * @param outStates count states of the items write to, may be null
+     * @return SUCCESS if all resources exist, else the state of the first failed item
+     */
+    virtual RState GetStringViewsByIds(const uint32_t *ids, size_t count, const std::string **outValues,
+        RState *outStates);
+
+    /**
+     * Get resources of mixed types under one snapshot, the value of each item is selected by its resType
+     * @param items the items to lookup, their state and value are written
+     * @param count the count of items
+     * @return SUCCESS if all resources exist, else the state of the first failed item
+     */
+    virtual RState GetResourcesByIds(ResourceBatchItem *items, size_t count);
+
+    /**
+     * Resolve a resource name once, the getters taking the handle skip the name and qualifier lookup
+     * until resources or config change, then they rebind the handle by its id
+     * @param name the resource name
+     * @param resType the resource type
+     * @param outHandle the handle write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState Resolve(const char *name, const ResType resType, ResHandle &outHandle);
+
+    /**
+     * Resolve a resource name hashed at build time, see Resolve(const char *, const ResType, ResHandle &)
+     * @param name the resource name with its hash, from the generated ResourceTable header
+     * @param outHandle the handle write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState Resolve(const ResName &name, ResHandle &outHandle);
+
+    /**
+     * Get string resource by handle
+     * @param handle the handle from Resolve, it is rebound in place when resources or config changed
+     * @param outValue the resource write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetStringByHandle(ResHandle &handle, std::string &outValue);
+
+    /**
+     * Get string resource by handle without copying it
+     * @param handle the handle from Resolve, it is rebound in place when resources or config changed
+     * @param outValue the resource owned by the resource manager, valid as documented in ResourceManager::ViewScope
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetStringViewByHandle(ResHandle &handle, const std::string *&outValue);
+
+    /**
+     * Get the STRINGARRAY resource by handle
+     * @param handle the handle from Resolve, it is rebound in place when resources or config changed
+     * @param outValue the resource write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetStringArrayByHandle(ResHandle &handle, std::vector<std::string> &outValue);
+
+    /**
+     * Get the plural string by handle
+     * @param handle the handle from Resolve, it is rebound in place when resources or config changed
+     * @param quantity the language quantity
+     * @param outValue the resource write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetPluralStringByHandle(ResHandle &handle, int quantity, std::string &outValue);
+
+    /**
+     * Get the BOOLEAN resource by handle
+     * @param handle the handle from Resolve, it is rebound in place when resources or config changed
+     * @param outValue the obtain boolean value write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetBooleanByHandle(ResHandle &handle, bool &outValue);
+
+    /**
+     * Get the INTEGER resource by handle
+     * @param handle the handle from Resolve, it is rebound in place when resources or config changed
+     * @param outValue the obtain Integer value write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetIntegerByHandle(ResHandle &handle, int &outValue);
+
+    /**
+     * Get the FLOAT resource by handle
+     * @param handle the handle from Resolve, it is rebound in place when resources or config changed
+     * @param outValue the obtain float value write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetFloatByHandle(ResHandle &handle, float &outValue);
+
+    /**
+     * Get the INTARRAY resource by handle
+     * @param handle the handle from Resolve, it is rebound in place when resources or config changed
+     * @param outValue the obtain int array write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetIntArrayByHandle(ResHandle &handle, std::vector<int> &outValue);
+
+    /**
+     * Get the COLOR resource by handle
+     * @param handle the handle from Resolve, it is rebound in place when resources or config changed
+     * @param outValue the obtain color value write to
+     * @return SUCCESS if resource exist, else NOT_FOUND
+     */
+    virtual RState GetColorByHandle(ResHandle &handle, uint32_t &outValue);
+
+    /**
+     * Keep the resources seen by the view getters alive until UnpinViews, calls nest
+     */
+    virtual void PinViews();
+
+    /**
+     * Release a PinViews
+     */
+    virtual void UnpinViews();
+
 private:
-    RState GetString(const IdItem *idItem, std::string &outValue);
+    RState GetString(const HapManager::Snapshot *snapshot, const IdItem *idItem, std::string &outValue);
+
+    // the resolved value lives as long as snapshot is pinned
+    RState GetStringValue(const HapManager::Snapshot *snapshot, const IdItem *idItem, const std::string *&outValue);
+
+    RState FormatValue(const HapManager::Snapshot *snapshot, const std::string *value, std::string &outValue,
+        va_list args);
 
-    RState GetStringArray(const IdItem *idItem, std::vector<std::string> &outValue);
+    RState FormatValue(const HapManager::Snapshot *snapshot, const std::string *value, std::string &outValue,
+        const std::vector<FormatArg> &args);
 
-    RState GetPattern(const IdItem *idItem, std::map<std::string, std::string> &outValue);
+    RState GetStringArray(const HapManager::Snapshot *snapshot, const IdItem *idItem,
+        std::vector<std::string> &outValue);
 
-    RState GetTheme(const IdItem *idItem, std::map<std::string, std::string> &outValue);
+    // the resolved values live as long as snapshot is pinned
+    RState GetStringArrayValue(const HapManager::Snapshot *snapshot, const IdItem *idItem,
+        std::vector<const std::string *> &outValue);
 
-    RState GetPluralString(const HapResource::ValueUnderQualifierDir *vuqd, int quantity, std::string &outValue);
+    RState GetPattern(const HapManager::Snapshot *snapshot, const IdItem *idItem,
+        std::shared_ptr<const std::map<std::string, std::string>> &outValue);
 
-    RState ResolveReference(const std::string value, std::string &outValue);
+    RState GetTheme(const HapManager::Snapshot *snapshot, const IdItem *idItem,
+        std::shared_ptr<const std::map<std::string, std::string>> &outValue);
 
-    RState GetBoolean(const IdItem *idItem, bool &outValue);
+    // flatten the theme or pattern under snapshot, or take the map flattened before
+    RState GetFlattenedMap(const HapManager::Snapshot *snapshot, const IdItem *idItem,
+        std::shared_ptr<const std::map<std::string, std::string>> &outValue);
 
-    RState GetFloat(const IdItem *idItem, float &outValue);
+    RState GetPluralString(const HapManager::Snapshot *snapshot, const HapResource::ValueUnderQualifierDir *vuqd,
+        int quantity, std::string &outValue);
 
-    RState GetInteger(const IdItem *idItem, int &outValue);
+    // the resolved value lives as long as snapshot is pinned
+    RState GetPluralValue(const HapManager::Snapshot *snapshot, const HapResource::ValueUnderQualifierDir *vuqd,
+        int quantity, const std::string *&outValue);
 
-    RState GetColor(const IdItem *idItem, uint32_t &outValue);
+    RState ResolveReference(const std::string &value, std::string &outValue);
 
-    RState GetIntArray(const IdItem *idItem, std::vector<int> &outValue);
+    /**
+     * Resolve the reference against one snapshot, so every hop of the chain sees the same config and haps
+     * @param snapshot the snapshot pinned by the caller
+     * @param value the value which may be a reference
+     * @param outValue the resolved value write to
+     * @return SUCCESS if resolve success, else ERROR
+     */
+    RState ResolveReference(const HapManager::Snapshot *snapshot, const std::string &value, std::string &outValue);
+
+    /**
+     * Resolve a value of an IdItem by the reference parsed at load, a literal is not copied
+     * @param snapshot the snapshot pinned by the caller
+     * @param value the value in the IdItem
+     * @param ref the reference parsed from value
+     * @param outValue points to the literal value, valid as long as snapshot is pinned
+     * @return SUCCESS if resolve success, else ERROR
+     */
+    RState ResolveValue(const HapManager::Snapshot *snapshot, const std::string &value, const IdItem::ValueRef &ref,
+        const std::string *&outValue);
+
+    // resolve value_ of an INTEGER, FLOAT, BOOLEAN or COLOR idItem and take the value decoded at load
+    RState GetTypedValue(const HapManager::Snapshot *snapshot, const IdItem *idItem, IdItem::TypedValue &outValue);
+
+    RState GetBoolean(const HapManager::Snapshot *snapshot, const IdItem *idItem, bool &outValue);
+
+    RState GetFloat(const HapManager::Snapshot *snapshot, const IdItem *idItem, float &outValue);
+
+    RState GetInteger(const HapManager::Snapshot *snapshot, const IdItem *idItem, int &outValue);
+
+    RState GetColor(const HapManager::Snapshot *snapshot, const IdItem *idItem, uint32_t &outValue);
+
+    RState GetIntArray(const HapManager::Snapshot *snapshot, const IdItem *idItem, std::vector<int> &outValue);
 
     RState GetRawFile(const HapResource::ValueUnderQualifierDir *vuqd, const ResType resType, std::string &outValue);
 
+    // the value of handle under snapshot, rebind handle if it was bound in another epoch
+    const HapResource::ValueUnderQualifierDir *GetBinding(const HapManager::Snapshot *snapshot, ResHandle &handle);
+
+    // fill the value of item selected by its resType
+    RState GetBatchItem(const HapManager::Snapshot *snapshot, ResourceBatchItem &item);
+
     RState ResolveParentReference(const IdItem *idItem, std::map<std::string, std::string> &outValue);
 
+    RState ResolveParentReference(const HapManager::Snapshot *snapshot, const IdItem *idItem,
+        std::map<std::string, std::string> &outValue);
+
     HapManager *hapManager_;
 };
 } // namespace Resource
@@ -31,6 +31,7 @@ enum RState {
     INVALID_FORMAT = 8,
     LOCALEINFO_IS_NULL = 9,
     NOT_ENOUGH_MEM = 10,
+    NOT_READY = 11,
     ERROR = 10000
 };
 } // namespace Resource
@@ -23,8 +23,12 @@ namespace Global {
 namespace Resource {
 static constexpr int KILO = 1000;
 static constexpr int MILLION = 1000000;
+static constexpr uint8_t LANGUAGE_MAX_LEN = 3;
+static constexpr uint8_t LANGUAGE_ARRAY_LEN = 4;
 static constexpr uint8_t SCRIPT_LEN = 4;
 static constexpr uint8_t SCRIPT_ARRAY_LEN = 5;
+static constexpr uint8_t REGION_MAX_LEN = 3;
+static constexpr uint8_t REGION_ARRAY_LEN = 4;
 static constexpr uint8_t MAX_DEPTH_REF_SEARCH = 20;
 static constexpr char DASH_SEP = '-';
 static constexpr char UNDERLINE_SEP = '_';
@@ -0,0 +1,4324 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// generated by tools/locale_data_gen.cpp from tools/locale_data, do not edit
+#ifndef RESOURCE_MANAGER_COMPACT_LOCALE_DATA_H
+#define RESOURCE_MANAGER_COMPACT_LOCALE_DATA_H
+#include <cstdint>
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+// a packed locale is language << 16 | script index << 8 | region index,
+// packed subtags are script index << 8 | region index
+// sorted, the index of a script
+constexpr uint32_t SCRIPT_CODES[] = {
+    static_cast<uint32_t>(0x00000000), /* none */
+    static_cast<uint32_t>(0x41646c6d), /* Adlm */
+    static_cast<uint32_t>(0x41686f6d), /* Ahom */
+    static_cast<uint32_t>(0x41726162), /* Arab */
+    static_cast<uint32_t>(0x41726d69), /* Armi */
+    static_cast<uint32_t>(0x41726d6e), /* Armn */
+    static_cast<uint32_t>(0x41767374), /* Avst */
+    static_cast<uint32_t>(0x42616d75), /* Bamu */
+    static_cast<uint32_t>(0x42617373), /* Bass */
+    static_cast<uint32_t>(0x42656e67), /* Beng */
+    static_cast<uint32_t>(0x426f706f), /* Bopo */
+    static_cast<uint32_t>(0x42726168), /* Brah */
+    static_cast<uint32_t>(0x43616b6d), /* Cakm */
+    static_cast<uint32_t>(0x43616e73), /* Cans */
+    static_cast<uint32_t>(0x43617269), /* Cari */
+    static_cast<uint32_t>(0x4368616d), /* Cham */
+    static_cast<uint32_t>(0x43686572), /* Cher */
+    static_cast<uint32_t>(0x43687273), /* Chrs */
+    static_cast<uint32_t>(0x436f7074), /* Copt */
+    static_cast<uint32_t>(0x43707274), /* Cprt */
+    static_cast<uint32_t>(0x4379726c), /* Cyrl */
+    static_cast<uint32_t>(0x44657661), /* Deva */
+    static_cast<uint32_t>(0x44737274), /* Dsrt */
+    static_cast<uint32_t>(0x45677970), /* Egyp */
+    static_cast<uint32_t>(0x45746869), /* Ethi */
+    static_cast<uint32_t>(0x47656f72), /* Geor */
+    static_cast<uint32_t>(0x476c6167), /* Glag */
+    static_cast<uint32_t>(0x476f6e67), /* Gong */
+    static_cast<uint32_t>(0x476f6e6d), /* Gonm */
+    static_cast<uint32_t>(0x476f7468), /* Goth */
+    static_cast<uint32_t>(0x4772656b), /* Grek */
+    static_cast<uint32_t>(0x47756a72), /* Gujr */
+    static_cast<uint32_t>(0x47757275), /* Guru */
+    static_cast<uint32_t>(0x48616e62), /* Hanb */
+    static_cast<uint32_t>(0x48616e73), /* Hans */
+    static_cast<uint32_t>(0x48616e74), /* Hant */
+    static_cast<uint32_t>(0x48617472), /* Hatr */
+    static_cast<uint32_t>(0x48656272), /* Hebr */
+    static_cast<uint32_t>(0x486c7577), /* Hluw */
+    static_cast<uint32_t>(0x486d6e67), /* Hmng */
+    static_cast<uint32_t>(0x486d6e70), /* Hmnp */
+    static_cast<uint32_t>(0x4974616c), /* Ital */
+    static_cast<uint32_t>(0x4a70616e), /* Jpan */
+    static_cast<uint32_t>(0x4b616c69), /* Kali */
+    static_cast<uint32_t>(0x4b616e61), /* Kana */
+    static_cast<uint32_t>(0x4b686172), /* Khar */
+    static_cast<uint32_t>(0x4b686d72), /* Khmr */
+    static_cast<uint32_t>(0x4b686f6a), /* Khoj */
+    static_cast<uint32_t>(0x4b697473), /* Kits */
+    static_cast<uint32_t>(0x4b6e6461), /* Knda */
+    static_cast<uint32_t>(0x4b6f7265), /* Kore */
+    static_cast<uint32_t>(0x4c616e61), /* Lana */
+    static_cast<uint32_t>(0x4c616f6f), /* Laoo */
+    static_cast<uint32_t>(0x4c61746e), /* Latn */
+    static_cast<uint32_t>(0x4c657063), /* Lepc */
+    static_cast<uint32_t>(0x4c696d62), /* Limb */
+    static_cast<uint32_t>(0x4c696e61), /* Lina */
+    static_cast<uint32_t>(0x4c696e62), /* Linb */
+    static_cast<uint32_t>(0x4c697375), /* Lisu */
+    static_cast<uint32_t>(0x4c796369), /* Lyci */
+    static_cast<uint32_t>(0x4c796469), /* Lydi */
+    static_cast<uint32_t>(0x4d616e64), /* Mand */
+    static_cast<uint32_t>(0x4d616e69), /* Mani */
+    static_cast<uint32_t>(0x4d656466), /* Medf */
+    static_cast<uint32_t>(0x4d657263), /* Merc */
+    static_cast<uint32_t>(0x4d6c796d), /* Mlym */
+    static_cast<uint32_t>(0x4d6f6e67), /* Mong */
+    static_cast<uint32_t>(0x4d726f6f), /* Mroo */
+    static_cast<uint32_t>(0x4d746569), /* Mtei */
+    static_cast<uint32_t>(0x4d796d72), /* Mymr */
+    static_cast<uint32_t>(0x4e617262), /* Narb */
+    static_cast<uint32_t>(0x4e626174), /* Nbat */
+    static_cast<uint32_t>(0x4e6b6f6f), /* Nkoo */
+    static_cast<uint32_t>(0x4e736875), /* Nshu */
+    static_cast<uint32_t>(0x4f67616d), /* Ogam */
+    static_cast<uint32_t>(0x4f6c636b), /* Olck */
+    static_cast<uint32_t>(0x4f726b68), /* Orkh */
+    static_cast<uint32_t>(0x4f727961), /* Orya */
+    static_cast<uint32_t>(0x4f736765), /* Osge */
+    static_cast<uint32_t>(0x50616c6d), /* Palm */
+    static_cast<uint32_t>(0x50617563), /* Pauc */
+    static_cast<uint32_t>(0x50686c69), /* Phli */
+    static_cast<uint32_t>(0x50686c70), /* Phlp */
+    static_cast<uint32_t>(0x50686e78), /* Phnx */
+    static_cast<uint32_t>(0x506c7264), /* Plrd */
+    static_cast<uint32_t>(0x50727469), /* Prti */
+    static_cast<uint32_t>(0x52756e72), /* Runr */
+    static_cast<uint32_t>(0x53616d72), /* Samr */
+    static_cast<uint32_t>(0x53617262), /* Sarb */
+    static_cast<uint32_t>(0x53617572), /* Saur */
+    static_cast<uint32_t>(0x53676e77), /* Sgnw */
+    static_cast<uint32_t>(0x53686177), /* Shaw */
+    static_cast<uint32_t>(0x53696e64), /* Sind */
+    static_cast<uint32_t>(0x53696e68), /* Sinh */
+    static_cast<uint32_t>(0x536f6764), /* Sogd */
+    static_cast<uint32_t>(0x536f7261), /* Sora */
+    static_cast<uint32_t>(0x536f796f), /* Soyo */
+    static_cast<uint32_t>(0x53797263), /* Syrc */
+    static_cast<uint32_t>(0x54616c65), /* Tale */
+    static_cast<uint32_t>(0x54616c75), /* Talu */
+    static_cast<uint32_t>(0x54616d6c), /* Taml */
+    static_cast<uint32_t>(0x54616e67), /* Tang */
+    static_cast<uint32_t>(0x54617674), /* Tavt */
+    static_cast<uint32_t>(0x54656c75), /* Telu */
+    static_cast<uint32_t>(0x54666e67), /* Tfng */
+    static_cast<uint32_t>(0x54686161), /* Thaa */
+    static_cast<uint32_t>(0x54686169), /* Thai */
+    static_cast<uint32_t>(0x54696274), /* Tibt */
+    static_cast<uint32_t>(0x55676172), /* Ugar */
+    static_cast<uint32_t>(0x56616969), /* Vaii */
+    static_cast<uint32_t>(0x5763686f), /* Wcho */
+    static_cast<uint32_t>(0x5870656f), /* Xpeo */
+    static_cast<uint32_t>(0x58737578), /* Xsux */
+    static_cast<uint32_t>(0x59657a69), /* Yezi */
+    static_cast<uint32_t>(0x59696969), /* Yiii */
+};
+// sorted, the index of a region
+constexpr uint16_t REGION_CODES[] = {
+    static_cast<uint16_t>(0x0000), /* none */
+    static_cast<uint16_t>(0x4146), /* AF */
+    static_cast<uint16_t>(0x4147), /* AG */
+    static_cast<uint16_t>(0x4149), /* AI */
+    static_cast<uint16_t>(0x414c), /* AL */
+    static_cast<uint16_t>(0x414d), /* AM */
+    static_cast<uint16_t>(0x414f), /* AO */
+    static_cast<uint16_t>(0x4152), /* AR */
+    static_cast<uint16_t>(0x4154), /* AT */
+    static_cast<uint16_t>(0x4155), /* AU */
+    static_cast<uint16_t>(0x4157), /* AW */
+    static_cast<uint16_t>(0x415a), /* AZ */
+    static_cast<uint16_t>(0x4241), /* BA */
+    static_cast<uint16_t>(0x4242), /* BB */
+    static_cast<uint16_t>(0x4244), /* BD */
+    static_cast<uint16_t>(0x4245), /* BE */
+    static_cast<uint16_t>(0x4246), /* BF */
+    static_cast<uint16_t>(0x4247), /* BG */
+    static_cast<uint16_t>(0x4249), /* BI */
+    static_cast<uint16_t>(0x424a), /* BJ */
+    static_cast<uint16_t>(0x424d), /* BM */
+    static_cast<uint16_t>(0x424e), /* BN */
+    static_cast<uint16_t>(0x424f), /* BO */
+    static_cast<uint16_t>(0x4252), /* BR */
+    static_cast<uint16_t>(0x4253), /* BS */
+    static_cast<uint16_t>(0x4254), /* BT */
+    static_cast<uint16_t>(0x4257), /* BW */
+    static_cast<uint16_t>(0x4259), /* BY */
+    static_cast<uint16_t>(0x425a), /* BZ */
+    static_cast<uint16_t>(0x4341), /* CA */
+    static_cast<uint16_t>(0x4343), /* CC */
+    static_cast<uint16_t>(0x4344), /* CD */
+    static_cast<uint16_t>(0x4346), /* CF */
+    static_cast<uint16_t>(0x4348), /* CH */
+    static_cast<uint16_t>(0x4349), /* CI */
+    static_cast<uint16_t>(0x434b), /* CK */
+    static_cast<uint16_t>(0x434c), /* CL */
+    static_cast<uint16_t>(0x434d), /* CM */
+    static_cast<uint16_t>(0x434e), /* CN */
+    static_cast<uint16_t>(0x434f), /* CO */
+    static_cast<uint16_t>(0x4352), /* CR */
+    static_cast<uint16_t>(0x4355), /* CU */
+    static_cast<uint16_t>(0x4356), /* CV */
+    static_cast<uint16_t>(0x4358), /* CX */
+    static_cast<uint16_t>(0x4359), /* CY */
+    static_cast<uint16_t>(0x435a), /* CZ */
+    static_cast<uint16_t>(0x4445), /* DE */
+    static_cast<uint16_t>(0x4447), /* DG */
+    static_cast<uint16_t>(0x444b), /* DK */
+    static_cast<uint16_t>(0x444d), /* DM */
+    static_cast<uint16_t>(0x444f), /* DO */
+    static_cast<uint16_t>(0x445a), /* DZ */
+    static_cast<uint16_t>(0x4543), /* EC */
+    static_cast<uint16_t>(0x4545), /* EE */
+    static_cast<uint16_t>(0x4547), /* EG */
+    static_cast<uint16_t>(0x4548), /* EH */
+    static_cast<uint16_t>(0x4552), /* ER */
+    static_cast<uint16_t>(0x4553), /* ES */
+    static_cast<uint16_t>(0x4554), /* ET */
+    static_cast<uint16_t>(0x4649), /* FI */
+    static_cast<uint16_t>(0x464a), /* FJ */
+    static_cast<uint16_t>(0x464b), /* FK */
+    static_cast<uint16_t>(0x464d), /* FM */
+    static_cast<uint16_t>(0x464f), /* FO */
+    static_cast<uint16_t>(0x4652), /* FR */
+    static_cast<uint16_t>(0x4741), /* GA */
+    static_cast<uint16_t>(0x4742), /* GB */
+    static_cast<uint16_t>(0x4744), /* GD */
+    static_cast<uint16_t>(0x4745), /* GE */
+    static_cast<uint16_t>(0x4746), /* GF */
+    static_cast<uint16_t>(0x4747), /* GG */
+    static_cast<uint16_t>(0x4748), /* GH */
+    static_cast<uint16_t>(0x4749), /* GI */
+    static_cast<uint16_t>(0x474c), /* GL */
+    static_cast<uint16_t>(0x474d), /* GM */
+    static_cast<uint16_t>(0x474e), /* GN */
+    static_cast<uint16_t>(0x4751), /* GQ */
+    static_cast<uint16_t>(0x4752), /* GR */
+    static_cast<uint16_t>(0x4754), /* GT */
+    static_cast<uint16_t>(0x4755), /* GU */
+    static_cast<uint16_t>(0x4757), /* GW */
+    static_cast<uint16_t>(0x4759), /* GY */
+    static_cast<uint16_t>(0x484b), /* HK */
+    static_cast<uint16_t>(0x484e), /* HN */
+    static_cast<uint16_t>(0x4852), /* HR */
+    static_cast<uint16_t>(0x4854), /* HT */
+    static_cast<uint16_t>(0x4855), /* HU */
+    static_cast<uint16_t>(0x4944), /* ID */
+    static_cast<uint16_t>(0x4945), /* IE */
+    static_cast<uint16_t>(0x494c), /* IL */
+    static_cast<uint16_t>(0x494d), /* IM */
+    static_cast<uint16_t>(0x494e), /* IN */
+    static_cast<uint16_t>(0x494f), /* IO */
+    static_cast<uint16_t>(0x4951), /* IQ */
+    static_cast<uint16_t>(0x4952), /* IR */
+    static_cast<uint16_t>(0x4953), /* IS */
+    static_cast<uint16_t>(0x4954), /* IT */
+    static_cast<uint16_t>(0x4a45), /* JE */
+    static_cast<uint16_t>(0x4a4d), /* JM */
+    static_cast<uint16_t>(0x4a4f), /* JO */
+    static_cast<uint16_t>(0x4a50), /* JP */
+    static_cast<uint16_t>(0x4b45), /* KE */
+    static_cast<uint16_t>(0x4b47), /* KG */
+    static_cast<uint16_t>(0x4b48), /* KH */
+    static_cast<uint16_t>(0x4b49), /* KI */
+    static_cast<uint16_t>(0x4b4d), /* KM */
+    static_cast<uint16_t>(0x4b4e), /* KN */
+    static_cast<uint16_t>(0x4b52), /* KR */
+    static_cast<uint16_t>(0x4b59), /* KY */
+    static_cast<uint16_t>(0x4b5a), /* KZ */
+    static_cast<uint16_t>(0x4c41), /* LA */
+    static_cast<uint16_t>(0x4c42), /* LB */
+    static_cast<uint16_t>(0x4c43), /* LC */
+    static_cast<uint16_t>(0x4c4b), /* LK */
+    static_cast<uint16_t>(0x4c52), /* LR */
+    static_cast<uint16_t>(0x4c53), /* LS */
+    static_cast<uint16_t>(0x4c54), /* LT */
+    static_cast<uint16_t>(0x4c55), /* LU */
+    static_cast<uint16_t>(0x4c56), /* LV */
+    static_cast<uint16_t>(0x4c59), /* LY */
+    static_cast<uint16_t>(0x4d41), /* MA */
+    static_cast<uint16_t>(0x4d44), /* MD */
+    static_cast<uint16_t>(0x4d45), /* ME */
+    static_cast<uint16_t>(0x4d47), /* MG */
+    static_cast<uint16_t>(0x4d48), /* MH */
+    static_cast<uint16_t>(0x4d4b), /* MK */
+    static_cast<uint16_t>(0x4d4c), /* ML */
+    static_cast<uint16_t>(0x4d4d), /* MM */
+    static_cast<uint16_t>(0x4d4e), /* MN */
+    static_cast<uint16_t>(0x4d4f), /* MO */
+    static_cast<uint16_t>(0x4d53), /* MS */
+    static_cast<uint16_t>(0x4d54), /* MT */
+    static_cast<uint16_t>(0x4d55), /* MU */
+    static_cast<uint16_t>(0x4d56), /* MV */
+    static_cast<uint16_t>(0x4d57), /* MW */
+    static_cast<uint16_t>(0x4d58), /* MX */
+    static_cast<uint16_t>(0x4d59), /* MY */
+    static_cast<uint16_t>(0x4d5a), /* MZ */
+    static_cast<uint16_t>(0x4e41), /* NA */
+    static_cast<uint16_t>(0x4e45), /* NE */
+    static_cast<uint16_t>(0x4e46), /* NF */
+    static_cast<uint16_t>(0x4e47), /* NG */
+    static_cast<uint16_t>(0x4e49), /* NI */
+    static_cast<uint16_t>(0x4e4c), /* NL */
+    static_cast<uint16_t>(0x4e4f), /* NO */
+    static_cast<uint16_t>(0x4e50), /* NP */
+    static_cast<uint16_t>(0x4e52), /* NR */
+    static_cast<uint16_t>(0x4e55), /* NU */
+    static_cast<uint16_t>(0x4e5a), /* NZ */
+    static_cast<uint16_t>(0x5041), /* PA */
+    static_cast<uint16_t>(0x5045), /* PE */
+    static_cast<uint16_t>(0x5046), /* PF */
+    static_cast<uint16_t>(0x5047), /* PG */
+    static_cast<uint16_t>(0x5048), /* PH */
+    static_cast<uint16_t>(0x504b), /* PK */
+    static_cast<uint16_t>(0x504c), /* PL */
+    static_cast<uint16_t>(0x504e), /* PN */
+    static_cast<uint16_t>(0x5052), /* PR */
+    static_cast<uint16_t>(0x5054), /* PT */
+    static_cast<uint16_t>(0x5057), /* PW */
+    static_cast<uint16_t>(0x5059), /* PY */
+    static_cast<uint16_t>(0x5245), /* RE */
+    static_cast<uint16_t>(0x524f), /* RO */
+    static_cast<uint16_t>(0x5253), /* RS */
+    static_cast<uint16_t>(0x5255), /* RU */
+    static_cast<uint16_t>(0x5257), /* RW */
+    static_cast<uint16_t>(0x5341), /* SA */
+    static_cast<uint16_t>(0x5342), /* SB */
+    static_cast<uint16_t>(0x5343), /* SC */
+    static_cast<uint16_t>(0x5344), /* SD */
+    static_cast<uint16_t>(0x5345), /* SE */
+    static_cast<uint16_t>(0x5347), /* SG */
+    static_cast<uint16_t>(0x5348), /* SH */
+    static_cast<uint16_t>(0x5349), /* SI */
+    static_cast<uint16_t>(0x534b), /* SK */
+    static_cast<uint16_t>(0x534c), /* SL */
+    static_cast<uint16_t>(0x534e), /* SN */
+    static_cast<uint16_t>(0x534f), /* SO */
+    static_cast<uint16_t>(0x5352), /* SR */
+    static_cast<uint16_t>(0x5353), /* SS */
+    static_cast<uint16_t>(0x5354), /* ST */
+    static_cast<uint16_t>(0x5356), /* SV */
+    static_cast<uint16_t>(0x5358), /* SX */
+    static_cast<uint16_t>(0x5359), /* SY */
+    static_cast<uint16_t>(0x535a), /* SZ */
+    static_cast<uint16_t>(0x5443), /* TC */
+    static_cast<uint16_t>(0x5447), /* TG */
+    static_cast<uint16_t>(0x5448), /* TH */
+    static_cast<uint16_t>(0x544a), /* TJ */
+    static_cast<uint16_t>(0x544b), /* TK */
+    static_cast<uint16_t>(0x544c), /* TL */
+    static_cast<uint16_t>(0x544d), /* TM */
+    static_cast<uint16_t>(0x544e), /* TN */
+    static_cast<uint16_t>(0x544f), /* TO */
+    static_cast<uint16_t>(0x5452), /* TR */
+    static_cast<uint16_t>(0x5454), /* TT */
+    static_cast<uint16_t>(0x5456), /* TV */
+    static_cast<uint16_t>(0x5457), /* TW */
+    static_cast<uint16_t>(0x545a), /* TZ */
+    static_cast<uint16_t>(0x5541), /* UA */
+    static_cast<uint16_t>(0x5547), /* UG */
+    static_cast<uint16_t>(0x5553), /* US */
+    static_cast<uint16_t>(0x5559), /* UY */
+    static_cast<uint16_t>(0x555a), /* UZ */
+    static_cast<uint16_t>(0x5641), /* VA */
+    static_cast<uint16_t>(0x5643), /* VC */
+    static_cast<uint16_t>(0x5645), /* VE */
+    static_cast<uint16_t>(0x5647), /* VG */
+    static_cast<uint16_t>(0x564e), /* VN */
+    static_cast<uint16_t>(0x5655), /* VU */
+    static_cast<uint16_t>(0x5746), /* WF */
+    static_cast<uint16_t>(0x5753), /* WS */
+    static_cast<uint16_t>(0x584b), /* XK */
+    static_cast<uint16_t>(0x5945), /* YE */
+    static_cast<uint16_t>(0x5954), /* YT */
+    static_cast<uint16_t>(0x5a41), /* ZA */
+    static_cast<uint16_t>(0x5a4d), /* ZM */
+    static_cast<uint16_t>(0x5a57), /* ZW */
+    static_cast<uint16_t>(0x5a5a), /* ZZ */
+    static_cast<uint16_t>(0x8001), /* 001 */
+    static_cast<uint16_t>(0x8025), /* 015 */
+    static_cast<uint16_t>(0x84a0), /* 150 */
+    static_cast<uint16_t>(0x9029), /* 419 */
+};
+// sorted, likely subtags of a bare language
+constexpr uint16_t LIKELY_TAGS_LANGUAGE_KEY[] = {
+    static_cast<uint16_t>(0x6161), /* aa */
+    static_cast<uint16_t>(0x6162), /* ab */
+    static_cast<uint16_t>(0x6165), /* ae */
+    static_cast<uint16_t>(0x6166), /* af */
+    static_cast<uint16_t>(0x616b), /* ak */
+    static_cast<uint16_t>(0x616d), /* am */
+    static_cast<uint16_t>(0x616e), /* an */
+    static_cast<uint16_t>(0x6172), /* ar */
+    static_cast<uint16_t>(0x6173), /* as */
+    static_cast<uint16_t>(0x6176), /* av */
+    static_cast<uint16_t>(0x6179), /* ay */
+    static_cast<uint16_t>(0x617a), /* az */
+    static_cast<uint16_t>(0x6261), /* ba */
+    static_cast<uint16_t>(0x6265), /* be */
+    static_cast<uint16_t>(0x6267), /* bg */
+    static_cast<uint16_t>(0x6269), /* bi */
+    static_cast<uint16_t>(0x626d), /* bm */
+    static_cast<uint16_t>(0x626e), /* bn */
+    static_cast<uint16_t>(0x626f), /* bo */
+    static_cast<uint16_t>(0x6272), /* br */
+    static_cast<uint16_t>(0x6273), /* bs */
+    static_cast<uint16_t>(0x6361), /* ca */
+    static_cast<uint16_t>(0x6365), /* ce */
+    static_cast<uint16_t>(0x6368), /* ch */
+    static_cast<uint16_t>(0x636f), /* co */
+    static_cast<uint16_t>(0x6372), /* cr */
+    static_cast<uint16_t>(0x6373), /* cs */
+    static_cast<uint16_t>(0x6375), /* cu */
+    static_cast<uint16_t>(0x6376), /* cv */
+    static_cast<uint16_t>(0x6379), /* cy */
+    static_cast<uint16_t>(0x6461), /* da */
+    static_cast<uint16_t>(0x6465), /* de */
+    static_cast<uint16_t>(0x6476), /* dv */
+    static_cast<uint16_t>(0x647a), /* dz */
+    static_cast<uint16_t>(0x6565), /* ee */
+    static_cast<uint16_t>(0x656c), /* el */
+    static_cast<uint16_t>(0x656e), /* en */
+    static_cast<uint16_t>(0x656f), /* eo */
+    static_cast<uint16_t>(0x6573), /* es */
+    static_cast<uint16_t>(0x6574), /* et */
+    static_cast<uint16_t>(0x6575), /* eu */
+    static_cast<uint16_t>(0x6661), /* fa */
+    static_cast<uint16_t>(0x6666), /* ff */
+    static_cast<uint16_t>(0x6669), /* fi */
+    static_cast<uint16_t>(0x666a), /* fj */
+    static_cast<uint16_t>(0x666f), /* fo */
+    static_cast<uint16_t>(0x6672), /* fr */
+    static_cast<uint16_t>(0x6679), /* fy */
+    static_cast<uint16_t>(0x6761), /* ga */
+    static_cast<uint16_t>(0x6764), /* gd */
+    static_cast<uint16_t>(0x676c), /* gl */
+    static_cast<uint16_t>(0x676e), /* gn */
+    static_cast<uint16_t>(0x6775), /* gu */
+    static_cast<uint16_t>(0x6776), /* gv */
+    static_cast<uint16_t>(0x6861), /* ha */
+    static_cast<uint16_t>(0x6865), /* he */
+    static_cast<uint16_t>(0x6869), /* hi */
+    static_cast<uint16_t>(0x686f), /* ho */
+    static_cast<uint16_t>(0x6872), /* hr */
+    static_cast<uint16_t>(0x6874), /* ht */
+    static_cast<uint16_t>(0x6875), /* hu */
+    static_cast<uint16_t>(0x6879), /* hy */
+    static_cast<uint16_t>(0x687a), /* hz */
+    static_cast<uint16_t>(0x6961), /* ia */
+    static_cast<uint16_t>(0x6964), /* id */
+    static_cast<uint16_t>(0x6967), /* ig */
+    static_cast<uint16_t>(0x6969), /* ii */
+    static_cast<uint16_t>(0x696b), /* ik */
+    static_cast<uint16_t>(0x696e), /* in */
+    static_cast<uint16_t>(0x696f), /* io */
+    static_cast<uint16_t>(0x6973), /* is */
+    static_cast<uint16_t>(0x6974), /* it */
+    static_cast<uint16_t>(0x6975), /* iu */
+    static_cast<uint16_t>(0x6977), /* iw */
+    static_cast<uint16_t>(0x6a61), /* ja */
+    static_cast<uint16_t>(0x6a69), /* ji */
+    static_cast<uint16_t>(0x6a76), /* jv */
+    static_cast<uint16_t>(0x6a77), /* jw */
+    static_cast<uint16_t>(0x6b61), /* ka */
+    static_cast<uint16_t>(0x6b67), /* kg */
+    static_cast<uint16_t>(0x6b69), /* ki */
+    static_cast<uint16_t>(0x6b6a), /* kj */
+    static_cast<uint16_t>(0x6b6b), /* kk */
+    static_cast<uint16_t>(0x6b6c), /* kl */
+    static_cast<uint16_t>(0x6b6d), /* km */
+    static_cast<uint16_t>(0x6b6e), /* kn */
+    static_cast<uint16_t>(0x6b6f), /* ko */
+    static_cast<uint16_t>(0x6b72), /* kr */
+    static_cast<uint16_t>(0x6b73), /* ks */
+    static_cast<uint16_t>(0x6b75), /* ku */
+    static_cast<uint16_t>(0x6b76), /* kv */
+    static_cast<uint16_t>(0x6b77), /* kw */
+    static_cast<uint16_t>(0x6b79), /* ky */
+    static_cast<uint16_t>(0x6c61), /* la */
+    static_cast<uint16_t>(0x6c62), /* lb */
+    static_cast<uint16_t>(0x6c67), /* lg */
+    static_cast<uint16_t>(0x6c69), /* li */
+    static_cast<uint16_t>(0x6c6e), /* ln */
+    static_cast<uint16_t>(0x6c6f), /* lo */
+    static_cast<uint16_t>(0x6c74), /* lt */
+    static_cast<uint16_t>(0x6c75), /* lu */
+    static_cast<uint16_t>(0x6c76), /* lv */
+    static_cast<uint16_t>(0x6d67), /* mg */
+    static_cast<uint16_t>(0x6d68), /* mh */
+    static_cast<uint16_t>(0x6d69), /* mi */
+    static_cast<uint16_t>(0x6d6b), /* mk */
+    static_cast<uint16_t>(0x6d6c), /* ml */
+    static_cast<uint16_t>(0x6d6e), /* mn */
+    static_cast<uint16_t>(0x6d6f), /* mo */
+    static_cast<uint16_t>(0x6d72), /* mr */
+    static_cast<uint16_t>(0x6d73), /* ms */
+    static_cast<uint16_t>(0x6d74), /* mt */
+    static_cast<uint16_t>(0x6d79), /* my */
+    static_cast<uint16_t>(0x6e61), /* na */
+    static_cast<uint16_t>(0x6e62), /* nb */
+    static_cast<uint16_t>(0x6e64), /* nd */
+    static_cast<uint16_t>(0x6e65), /* ne */
+    static_cast<uint16_t>(0x6e67), /* ng */
+    static_cast<uint16_t>(0x6e6c), /* nl */
+    static_cast<uint16_t>(0x6e6e), /* nn */
+    static_cast<uint16_t>(0x6e6f), /* no */
+    static_cast<uint16_t>(0x6e72), /* nr */
+    static_cast<uint16_t>(0x6e76), /* nv */
+    static_cast<uint16_t>(0x6e79), /* ny */
+    static_cast<uint16_t>(0x6f63), /* oc */
+    static_cast<uint16_t>(0x6f6d), /* om */
+    static_cast<uint16_t>(0x6f72), /* or */
+    static_cast<uint16_t>(0x6f73), /* os */
+    static_cast<uint16_t>(0x7061), /* pa */
+    static_cast<uint16_t>(0x706c), /* pl */
+    static_cast<uint16_t>(0x7073), /* ps */
+    static_cast<uint16_t>(0x7074), /* pt */
+    static_cast<uint16_t>(0x7175), /* qu */
+    static_cast<uint16_t>(0x726d), /* rm */
+    static_cast<uint16_t>(0x726e), /* rn */
+    static_cast<uint16_t>(0x726f), /* ro */
+    static_cast<uint16_t>(0x7275), /* ru */
+    static_cast<uint16_t>(0x7277), /* rw */
+    static_cast<uint16_t>(0x7361), /* sa */
+    static_cast<uint16_t>(0x7363), /* sc */
+    static_cast<uint16_t>(0x7364), /* sd */
+    static_cast<uint16_t>(0x7365), /* se */
+    static_cast<uint16_t>(0x7367), /* sg */
+    static_cast<uint16_t>(0x7369), /* si */
+    static_cast<uint16_t>(0x736b), /* sk */
+    static_cast<uint16_t>(0x736c), /* sl */
+    static_cast<uint16_t>(0x736d), /* sm */
+    static_cast<uint16_t>(0x736e), /* sn */
+    static_cast<uint16_t>(0x736f), /* so */
+    static_cast<uint16_t>(0x7371), /* sq */
+    static_cast<uint16_t>(0x7372), /* sr */
+    static_cast<uint16_t>(0x7373), /* ss */
+    static_cast<uint16_t>(0x7374), /* st */
+    static_cast<uint16_t>(0x7375), /* su */
+    static_cast<uint16_t>(0x7376), /* sv */
+    static_cast<uint16_t>(0x7377), /* sw */
+    static_cast<uint16_t>(0x7461), /* ta */
+    static_cast<uint16_t>(0x7465), /* te */
+    static_cast<uint16_t>(0x7467), /* tg */
+    static_cast<uint16_t>(0x7468), /* th */
+    static_cast<uint16_t>(0x7469), /* ti */
+    static_cast<uint16_t>(0x746b), /* tk */
+    static_cast<uint16_t>(0x746c), /* tl */
+    static_cast<uint16_t>(0x746e), /* tn */
+    static_cast<uint16_t>(0x746f), /* to */
+    static_cast<uint16_t>(0x7472), /* tr */
+    static_cast<uint16_t>(0x7473), /* ts */
+    static_cast<uint16_t>(0x7474), /* tt */
+    static_cast<uint16_t>(0x7479), /* ty */
+    static_cast<uint16_t>(0x7567), /* ug */
+    static_cast<uint16_t>(0x756b), /* uk */
+    static_cast<uint16_t>(0x7572), /* ur */
+    static_cast<uint16_t>(0x757a), /* uz */
+    static_cast<uint16_t>(0x7665), /* ve */
+    static_cast<uint16_t>(0x7669), /* vi */
+    static_cast<uint16_t>(0x766f), /* vo */
+    static_cast<uint16_t>(0x7761), /* wa */
+    static_cast<uint16_t>(0x776f), /* wo */
+    static_cast<uint16_t>(0x7868), /* xh */
+    static_cast<uint16_t>(0x7969), /* yi */
+    static_cast<uint16_t>(0x796f), /* yo */
+    static_cast<uint16_t>(0x7a61), /* za */
+    static_cast<uint16_t>(0x7a68), /* zh */
+    static_cast<uint16_t>(0x7a75), /* zu */
+    static_cast<uint16_t>(0x8008), /* aai */
+    static_cast<uint16_t>(0x800a), /* aak */
+    static_cast<uint16_t>(0x8014), /* aau */
+    static_cast<uint16_t>(0x8028), /* abi */
+    static_cast<uint16_t>(0x8030), /* abq */
+    static_cast<uint16_t>(0x8031), /* abr */
+    static_cast<uint16_t>(0x8033), /* abt */
+    static_cast<uint16_t>(0x8038), /* aby */
+    static_cast<uint16_t>(0x8043), /* acd */
+    static_cast<uint16_t>(0x8044), /* ace */
+    static_cast<uint16_t>(0x8047), /* ach */
+    static_cast<uint16_t>(0x8060), /* ada */
+    static_cast<uint16_t>(0x8064), /* ade */
+    static_cast<uint16_t>(0x8069), /* adj */
+    static_cast<uint16_t>(0x806f), /* adp */
+    static_cast<uint16_t>(0x8078), /* ady */
+    static_cast<uint16_t>(0x8079), /* adz */
+    static_cast<uint16_t>(0x8081), /* aeb */
+    static_cast<uint16_t>(0x8098), /* aey */
+    static_cast<uint16_t>(0x80c2), /* agc */
+    static_cast<uint16_t>(0x80c3), /* agd */
+    static_cast<uint16_t>(0x80c6), /* agg */
+    static_cast<uint16_t>(0x80cc), /* agm */
+    static_cast<uint16_t>(0x80ce), /* ago */
+    static_cast<uint16_t>(0x80d0), /* agq */
+    static_cast<uint16_t>(0x80e0), /* aha */
+    static_cast<uint16_t>(0x80eb), /* ahl */
+    static_cast<uint16_t>(0x80ee), /* aho */
+    static_cast<uint16_t>(0x8126), /* ajg */
+    static_cast<uint16_t>(0x814a), /* akk */
+    static_cast<uint16_t>(0x8160), /* ala */
+    static_cast<uint16_t>(0x8168), /* ali */
+    static_cast<uint16_t>(0x816d), /* aln */
+    static_cast<uint16_t>(0x8173), /* alt */
+    static_cast<uint16_t>(0x818c), /* amm */
+    static_cast<uint16_t>(0x818d), /* amn */
+    static_cast<uint16_t>(0x818e), /* amo */
+    static_cast<uint16_t>(0x818f), /* amp */
+    static_cast<uint16_t>(0x81a2), /* anc */
+    static_cast<uint16_t>(0x81aa), /* ank */
+    static_cast<uint16_t>(0x81ad), /* ann */
+    static_cast<uint16_t>(0x81b8), /* any */
+    static_cast<uint16_t>(0x81c9), /* aoj */
+    static_cast<uint16_t>(0x81cc), /* aom */
+    static_cast<uint16_t>(0x81d9), /* aoz */
+    static_cast<uint16_t>(0x81e2), /* apc */
+    static_cast<uint16_t>(0x81e3), /* apd */
+    static_cast<uint16_t>(0x81e4), /* ape */
+    static_cast<uint16_t>(0x81f1), /* apr */
+    static_cast<uint16_t>(0x81f2), /* aps */
+    static_cast<uint16_t>(0x81f9), /* apz */
+    static_cast<uint16_t>(0x8222), /* arc */
+    static_cast<uint16_t>(0x8227), /* arh */
+    static_cast<uint16_t>(0x822d), /* arn */
+    static_cast<uint16_t>(0x822e), /* aro */
+    static_cast<uint16_t>(0x8230), /* arq */
+    static_cast<uint16_t>(0x8232), /* ars */
+    static_cast<uint16_t>(0x8238), /* ary */
+    static_cast<uint16_t>(0x8239), /* arz */
+    static_cast<uint16_t>(0x8240), /* asa */
+    static_cast<uint16_t>(0x8244), /* ase */
+    static_cast<uint16_t>(0x8246), /* asg */
+    static_cast<uint16_t>(0x824e), /* aso */
+    static_cast<uint16_t>(0x8253), /* ast */
+    static_cast<uint16_t>(0x8260), /* ata */
+    static_cast<uint16_t>(0x8266), /* atg */
+    static_cast<uint16_t>(0x8269), /* atj */
+    static_cast<uint16_t>(0x8298), /* auy */
+    static_cast<uint16_t>(0x82ab), /* avl */
+    static_cast<uint16_t>(0x82ad), /* avn */
+    static_cast<uint16_t>(0x82b3), /* avt */
+    static_cast<uint16_t>(0x82b4), /* avu */
+    static_cast<uint16_t>(0x82c0), /* awa */
+    static_cast<uint16_t>(0x82c1), /* awb */
+    static_cast<uint16_t>(0x82ce), /* awo */
+    static_cast<uint16_t>(0x82d7), /* awx */
+    static_cast<uint16_t>(0x8301), /* ayb */
+    static_cast<uint16_t>(0x840b), /* bal */
+    static_cast<uint16_t>(0x840d), /* ban */
+    static_cast<uint16_t>(0x840f), /* bap */
+    static_cast<uint16_t>(0x8411), /* bar */
+    static_cast<uint16_t>(0x8412), /* bas */
+    static_cast<uint16_t>(0x8415), /* bav */
+    static_cast<uint16_t>(0x8417), /* bax */
+    static_cast<uint16_t>(0x8420), /* bba */
+    static_cast<uint16_t>(0x8421), /* bbb */
+    static_cast<uint16_t>(0x8422), /* bbc */
+    static_cast<uint16_t>(0x8423), /* bbd */
+    static_cast<uint16_t>(0x8429), /* bbj */
+    static_cast<uint16_t>(0x842f), /* bbp */
+    static_cast<uint16_t>(0x8431), /* bbr */
+    static_cast<uint16_t>(0x8445), /* bcf */
+    static_cast<uint16_t>(0x8447), /* bch */
+    static_cast<uint16_t>(0x8448), /* bci */
+    static_cast<uint16_t>(0x844c), /* bcm */
+    static_cast<uint16_t>(0x844d), /* bcn */
+    static_cast<uint16_t>(0x844e), /* bco */
+    static_cast<uint16_t>(0x8450), /* bcq */
+    static_cast<uint16_t>(0x8454), /* bcu */
+    static_cast<uint16_t>(0x8463), /* bdd */
+    static_cast<uint16_t>(0x8485), /* bef */
+    static_cast<uint16_t>(0x8487), /* beh */
+    static_cast<uint16_t>(0x8489), /* bej */
+    static_cast<uint16_t>(0x848c), /* bem */
+    static_cast<uint16_t>(0x8493), /* bet */
+    static_cast<uint16_t>(0x8496), /* bew */
+    static_cast<uint16_t>(0x8497), /* bex */
+    static_cast<uint16_t>(0x8499), /* bez */
+    static_cast<uint16_t>(0x84a3), /* bfd */
+    static_cast<uint16_t>(0x84b0), /* bfq */
+    static_cast<uint16_t>(0x84b3), /* bft */
+    static_cast<uint16_t>(0x84b8), /* bfy */
+    static_cast<uint16_t>(0x84c2), /* bgc */
+    static_cast<uint16_t>(0x84cd), /* bgn */
+    static_cast<uint16_t>(0x84d7), /* bgx */
+    static_cast<uint16_t>(0x84e1), /* bhb */
+    static_cast<uint16_t>(0x84e6), /* bhg */
+    static_cast<uint16_t>(0x84e8), /* bhi */
+    static_cast<uint16_t>(0x84eb), /* bhl */
+    static_cast<uint16_t>(0x84ee), /* bho */
+    static_cast<uint16_t>(0x84f8), /* bhy */
+    static_cast<uint16_t>(0x8501), /* bib */
+    static_cast<uint16_t>(0x8506), /* big */
+    static_cast<uint16_t>(0x850a), /* bik */
+    static_cast<uint16_t>(0x850c), /* bim */
+    static_cast<uint16_t>(0x850d), /* bin */
+    static_cast<uint16_t>(0x850e), /* bio */
+    static_cast<uint16_t>(0x8510), /* biq */
+    static_cast<uint16_t>(0x8527), /* bjh */
+    static_cast<uint16_t>(0x8528), /* bji */
+    static_cast<uint16_t>(0x8529), /* bjj */
+    static_cast<uint16_t>(0x852d), /* bjn */
+    static_cast<uint16_t>(0x852e), /* bjo */
+    static_cast<uint16_t>(0x8531), /* bjr */
+    static_cast<uint16_t>(0x8533), /* bjt */
+    static_cast<uint16_t>(0x8539), /* bjz */
+    static_cast<uint16_t>(0x8542), /* bkc */
+    static_cast<uint16_t>(0x854c), /* bkm */
+    static_cast<uint16_t>(0x8550), /* bkq */
+    static_cast<uint16_t>(0x8554), /* bku */
+    static_cast<uint16_t>(0x8555), /* bkv */
+    static_cast<uint16_t>(0x8573), /* blt */
+    static_cast<uint16_t>(0x8587), /* bmh */
+    static_cast<uint16_t>(0x858a), /* bmk */
+    static_cast<uint16_t>(0x8590), /* bmq */
+    static_cast<uint16_t>(0x8594), /* bmu */
+    static_cast<uint16_t>(0x85a6), /* bng */
+    static_cast<uint16_t>(0x85ac), /* bnm */
+    static_cast<uint16_t>(0x85af), /* bnp */
+    static_cast<uint16_t>(0x85c9), /* boj */
+    static_cast<uint16_t>(0x85cc), /* bom */
+    static_cast<uint16_t>(0x85cd), /* bon */
+    static_cast<uint16_t>(0x85f8), /* bpy */
+    static_cast<uint16_t>(0x8602), /* bqc */
+    static_cast<uint16_t>(0x8608), /* bqi */
+    static_cast<uint16_t>(0x860f), /* bqp */
+    static_cast<uint16_t>(0x8615), /* bqv */
+    static_cast<uint16_t>(0x8620), /* bra */
+    static_cast<uint16_t>(0x8627), /* brh */
+    static_cast<uint16_t>(0x8637), /* brx */
+    static_cast<uint16_t>(0x8639), /* brz */
+    static_cast<uint16_t>(0x8649), /* bsj */
+    static_cast<uint16_t>(0x8650), /* bsq */
+    static_cast<uint16_t>(0x8652), /* bss */
+    static_cast<uint16_t>(0x8653), /* bst */
+    static_cast<uint16_t>(0x866e), /* bto */
+    static_cast<uint16_t>(0x8673), /* btt */
+    static_cast<uint16_t>(0x8675), /* btv */
+    static_cast<uint16_t>(0x8680), /* bua */
+    static_cast<uint16_t>(0x8682), /* buc */
+    static_cast<uint16_t>(0x8683), /* bud */
+    static_cast<uint16_t>(0x8686), /* bug */
+    static_cast<uint16_t>(0x868a), /* buk */
+    static_cast<uint16_t>(0x868c), /* bum */
+    static_cast<uint16_t>(0x868e), /* buo */
+    static_cast<uint16_t>(0x8692), /* bus */
+    static_cast<uint16_t>(0x8694), /* buu */
+    static_cast<uint16_t>(0x86a1), /* bvb */
+    static_cast<uint16_t>(0x86c3), /* bwd */
+    static_cast<uint16_t>(0x86d1), /* bwr */
+    static_cast<uint16_t>(0x86e7), /* bxh */
+    static_cast<uint16_t>(0x8704), /* bye */
+    static_cast<uint16_t>(0x870d), /* byn */
+    static_cast<uint16_t>(0x8711), /* byr */
+    static_cast<uint16_t>(0x8712), /* bys */
+    static_cast<uint16_t>(0x8715), /* byv */
+    static_cast<uint16_t>(0x8717), /* byx */
+    static_cast<uint16_t>(0x8720), /* bza */
+    static_cast<uint16_t>(0x8724), /* bze */
+    static_cast<uint16_t>(0x8725), /* bzf */
+    static_cast<uint16_t>(0x8727), /* bzh */
+    static_cast<uint16_t>(0x8736), /* bzw */
+    static_cast<uint16_t>(0x8803), /* cad */
+    static_cast<uint16_t>(0x880d), /* can */
+    static_cast<uint16_t>(0x8829), /* cbj */
+    static_cast<uint16_t>(0x8847), /* cch */
+    static_cast<uint16_t>(0x884f), /* ccp */
+    static_cast<uint16_t>(0x8881), /* ceb */
+    static_cast<uint16_t>(0x88a0), /* cfa */
+    static_cast<uint16_t>(0x88c6), /* cgg */
+    static_cast<uint16_t>(0x88ea), /* chk */
+    static_cast<uint16_t>(0x88ec), /* chm */
+    static_cast<uint16_t>(0x88ee), /* cho */
+    static_cast<uint16_t>(0x88ef), /* chp */
+    static_cast<uint16_t>(0x88f1), /* chr */
+    static_cast<uint16_t>(0x8902), /* cic */
+    static_cast<uint16_t>(0x8920), /* cja */
+    static_cast<uint16_t>(0x892c), /* cjm */
+    static_cast<uint16_t>(0x8935), /* cjv */
+    static_cast<uint16_t>(0x8941), /* ckb */
+    static_cast<uint16_t>(0x894b), /* ckl */
+    static_cast<uint16_t>(0x894e), /* cko */
+    static_cast<uint16_t>(0x8958), /* cky */
+    static_cast<uint16_t>(0x8960), /* cla */
+    static_cast<uint16_t>(0x8984), /* cme */
+    static_cast<uint16_t>(0x8986), /* cmg */
+    static_cast<uint16_t>(0x89cf), /* cop */
+    static_cast<uint16_t>(0x89f2), /* cps */
+    static_cast<uint16_t>(0x8a27), /* crh */
+    static_cast<uint16_t>(0x8a29), /* crj */
+    static_cast<uint16_t>(0x8a2a), /* crk */
+    static_cast<uint16_t>(0x8a2b), /* crl */
+    static_cast<uint16_t>(0x8a2c), /* crm */
+    static_cast<uint16_t>(0x8a32), /* crs */
+    static_cast<uint16_t>(0x8a41), /* csb */
+    static_cast<uint16_t>(0x8a56), /* csw */
+    static_cast<uint16_t>(0x8a63), /* ctd */
+    static_cast<uint16_t>(0x8c03), /* dad */
+    static_cast<uint16_t>(0x8c05), /* daf */
+    static_cast<uint16_t>(0x8c06), /* dag */
+    static_cast<uint16_t>(0x8c07), /* dah */
+    static_cast<uint16_t>(0x8c0a), /* dak */
+    static_cast<uint16_t>(0x8c11), /* dar */
+    static_cast<uint16_t>(0x8c15), /* dav */
+    static_cast<uint16_t>(0x8c23), /* dbd */
+    static_cast<uint16_t>(0x8c30), /* dbq */
+    static_cast<uint16_t>(0x8c42), /* dcc */
+    static_cast<uint16_t>(0x8c6d), /* ddn */
+    static_cast<uint16_t>(0x8c83), /* ded */
+    static_cast<uint16_t>(0x8c8d), /* den */
+    static_cast<uint16_t>(0x8cc0), /* dga */
+    static_cast<uint16_t>(0x8cc7), /* dgh */
+    static_cast<uint16_t>(0x8cc8), /* dgi */
+    static_cast<uint16_t>(0x8ccb), /* dgl */
+    static_cast<uint16_t>(0x8cd1), /* dgr */
+    static_cast<uint16_t>(0x8cd9), /* dgz */
+    static_cast<uint16_t>(0x8d00), /* dia */
+    static_cast<uint16_t>(0x8d24), /* dje */
+    static_cast<uint16_t>(0x8da9), /* dnj */
+    static_cast<uint16_t>(0x8dc1), /* dob */
+    static_cast<uint16_t>(0x8dc8), /* doi */
+    static_cast<uint16_t>(0x8dcf), /* dop */
+    static_cast<uint16_t>(0x8dd6), /* dow */
+    static_cast<uint16_t>(0x8e27), /* drh */
+    static_cast<uint16_t>(0x8e28), /* dri */
+    static_cast<uint16_t>(0x8e32), /* drs */
+    static_cast<uint16_t>(0x8e41), /* dsb */
+    static_cast<uint16_t>(0x8e6c), /* dtm */
+    static_cast<uint16_t>(0x8e6f), /* dtp */
+    static_cast<uint16_t>(0x8e72), /* dts */
+    static_cast<uint16_t>(0x8e78), /* dty */
+    static_cast<uint16_t>(0x8e80), /* dua */
+    static_cast<uint16_t>(0x8e82), /* duc */
+    static_cast<uint16_t>(0x8e83), /* dud */
+    static_cast<uint16_t>(0x8e86), /* dug */
+    static_cast<uint16_t>(0x8ea0), /* dva */
+    static_cast<uint16_t>(0x8ed6), /* dww */
+    static_cast<uint16_t>(0x8f0e), /* dyo */
+    static_cast<uint16_t>(0x8f14), /* dyu */
+    static_cast<uint16_t>(0x8f26), /* dzg */
+    static_cast<uint16_t>(0x9034), /* ebu */
+    static_cast<uint16_t>(0x90a8), /* efi */
+    static_cast<uint16_t>(0x90cb), /* egl */
+    static_cast<uint16_t>(0x90d8), /* egy */
+    static_cast<uint16_t>(0x9140), /* eka */
+    static_cast<uint16_t>(0x9158), /* eky */
+    static_cast<uint16_t>(0x9180), /* ema */
+    static_cast<uint16_t>(0x9188), /* emi */
+    static_cast<uint16_t>(0x91ad), /* enn */
+    static_cast<uint16_t>(0x91b0), /* enq */
+    static_cast<uint16_t>(0x9228), /* eri */
+    static_cast<uint16_t>(0x9246), /* esg */
+    static_cast<uint16_t>(0x9254), /* esu */
+    static_cast<uint16_t>(0x9271), /* etr */
+    static_cast<uint16_t>(0x9273), /* ett */
+    static_cast<uint16_t>(0x9274), /* etu */
+    static_cast<uint16_t>(0x9277), /* etx */
+    static_cast<uint16_t>(0x92ce), /* ewo */
+    static_cast<uint16_t>(0x92f3), /* ext */
+    static_cast<uint16_t>(0x9320), /* eza */
+    static_cast<uint16_t>(0x9400), /* faa */
+    static_cast<uint16_t>(0x9401), /* fab */
+    static_cast<uint16_t>(0x9406), /* fag */
+    static_cast<uint16_t>(0x9408), /* fai */
+    static_cast<uint16_t>(0x940d), /* fan */
+    static_cast<uint16_t>(0x94a8), /* ffi */
+    static_cast<uint16_t>(0x94ac), /* ffm */
+    static_cast<uint16_t>(0x9500), /* fia */
+    static_cast<uint16_t>(0x950b), /* fil */
+    static_cast<uint16_t>(0x9513), /* fit */
+    static_cast<uint16_t>(0x9571), /* flr */
+    static_cast<uint16_t>(0x958f), /* fmp */
+    static_cast<uint16_t>(0x95c3), /* fod */
+    static_cast<uint16_t>(0x95cd), /* fon */
+    static_cast<uint16_t>(0x95d1), /* for */
+    static_cast<uint16_t>(0x95e4), /* fpe */
+    static_cast<uint16_t>(0x9612), /* fqs */
+    static_cast<uint16_t>(0x9622), /* frc */
+    static_cast<uint16_t>(0x962f), /* frp */
+    static_cast<uint16_t>(0x9631), /* frr */
+    static_cast<uint16_t>(0x9632), /* frs */
+    static_cast<uint16_t>(0x9681), /* fub */
+    static_cast<uint16_t>(0x9683), /* fud */
+    static_cast<uint16_t>(0x9684), /* fue */
+    static_cast<uint16_t>(0x9685), /* fuf */
+    static_cast<uint16_t>(0x9687), /* fuh */
+    static_cast<uint16_t>(0x9690), /* fuq */
+    static_cast<uint16_t>(0x9691), /* fur */
+    static_cast<uint16_t>(0x9695), /* fuv */
+    static_cast<uint16_t>(0x9698), /* fuy */
+    static_cast<uint16_t>(0x96b1), /* fvr */
+    static_cast<uint16_t>(0x9800), /* gaa */
+    static_cast<uint16_t>(0x9805), /* gaf */
+    static_cast<uint16_t>(0x9806), /* gag */
+    static_cast<uint16_t>(0x9807), /* gah */
+    static_cast<uint16_t>(0x9809), /* gaj */
+    static_cast<uint16_t>(0x980c), /* gam */
+    static_cast<uint16_t>(0x980d), /* gan */
+    static_cast<uint16_t>(0x9816), /* gaw */
+    static_cast<uint16_t>(0x9818), /* gay */
+    static_cast<uint16_t>(0x9820), /* gba */
+    static_cast<uint16_t>(0x9825), /* gbf */
+    static_cast<uint16_t>(0x982c), /* gbm */
+    static_cast<uint16_t>(0x9838), /* gby */
+    static_cast<uint16_t>(0x9839), /* gbz */
+    static_cast<uint16_t>(0x9851), /* gcr */
+    static_cast<uint16_t>(0x9864), /* gde */
+    static_cast<uint16_t>(0x986d), /* gdn */
+    static_cast<uint16_t>(0x9871), /* gdr */
+    static_cast<uint16_t>(0x9881), /* geb */
+    static_cast<uint16_t>(0x9889), /* gej */
+    static_cast<uint16_t>(0x988b), /* gel */
+    static_cast<uint16_t>(0x9899), /* gez */
+    static_cast<uint16_t>(0x98aa), /* gfk */
+    static_cast<uint16_t>(0x98cd), /* ggn */
+    static_cast<uint16_t>(0x98f2), /* ghs */
+    static_cast<uint16_t>(0x990b), /* gil */
+    static_cast<uint16_t>(0x990c), /* gim */
+    static_cast<uint16_t>(0x992a), /* gjk */
+    static_cast<uint16_t>(0x992d), /* gjn */
+    static_cast<uint16_t>(0x9934), /* gju */
+    static_cast<uint16_t>(0x994d), /* gkn */
+    static_cast<uint16_t>(0x994f), /* gkp */
+    static_cast<uint16_t>(0x996a), /* glk */
+    static_cast<uint16_t>(0x998c), /* gmm */
+    static_cast<uint16_t>(0x9995), /* gmv */
+    static_cast<uint16_t>(0x99a3), /* gnd */
+    static_cast<uint16_t>(0x99a6), /* gng */
+    static_cast<uint16_t>(0x99c3), /* god */
+    static_cast<uint16_t>(0x99c5), /* gof */
+    static_cast<uint16_t>(0x99c8), /* goi */
+    static_cast<uint16_t>(0x99cc), /* gom */
+    static_cast<uint16_t>(0x99cd), /* gon */
+    static_cast<uint16_t>(0x99d1), /* gor */
+    static_cast<uint16_t>(0x99d2), /* gos */
+    static_cast<uint16_t>(0x99d3), /* got */
+    static_cast<uint16_t>(0x9a21), /* grb */
+    static_cast<uint16_t>(0x9a22), /* grc */
+    static_cast<uint16_t>(0x9a33), /* grt */
+    static_cast<uint16_t>(0x9a36), /* grw */
+    static_cast<uint16_t>(0x9a56), /* gsw */
+    static_cast<uint16_t>(0x9a81), /* gub */
+    static_cast<uint16_t>(0x9a82), /* guc */
+    static_cast<uint16_t>(0x9a83), /* gud */
+    static_cast<uint16_t>(0x9a91), /* gur */
+    static_cast<uint16_t>(0x9a96), /* guw */
+    static_cast<uint16_t>(0x9a97), /* gux */
+    static_cast<uint16_t>(0x9a99), /* guz */
+    static_cast<uint16_t>(0x9aa5), /* gvf */
+    static_cast<uint16_t>(0x9ab1), /* gvr */
+    static_cast<uint16_t>(0x9ab2), /* gvs */
+    static_cast<uint16_t>(0x9ac2), /* gwc */
+    static_cast<uint16_t>(0x9ac8), /* gwi */
+    static_cast<uint16_t>(0x9ad3), /* gwt */
+    static_cast<uint16_t>(0x9b08), /* gyi */
+    static_cast<uint16_t>(0x9c06), /* hag */
+    static_cast<uint16_t>(0x9c0a), /* hak */
+    static_cast<uint16_t>(0x9c0c), /* ham */
+    static_cast<uint16_t>(0x9c16), /* haw */
+    static_cast<uint16_t>(0x9c19), /* haz */
+    static_cast<uint16_t>(0x9c21), /* hbb */
+    static_cast<uint16_t>(0x9c78), /* hdy */
+    static_cast<uint16_t>(0x9cf8), /* hhy */
+    static_cast<uint16_t>(0x9d00), /* hia */
+    static_cast<uint16_t>(0x9d05), /* hif */
+    static_cast<uint16_t>(0x9d06), /* hig */
+    static_cast<uint16_t>(0x9d07), /* hih */
+    static_cast<uint16_t>(0x9d0b), /* hil */
+    static_cast<uint16_t>(0x9d60), /* hla */
+    static_cast<uint16_t>(0x9d74), /* hlu */
+    static_cast<uint16_t>(0x9d83), /* hmd */
+    static_cast<uint16_t>(0x9d93), /* hmt */
+    static_cast<uint16_t>(0x9da3), /* hnd */
+    static_cast<uint16_t>(0x9da4), /* hne */
+    static_cast<uint16_t>(0x9da9), /* hnj */
+    static_cast<uint16_t>(0x9dad), /* hnn */
+    static_cast<uint16_t>(0x9dae), /* hno */
+    static_cast<uint16_t>(0x9dc2), /* hoc */
+    static_cast<uint16_t>(0x9dc9), /* hoj */
+    static_cast<uint16_t>(0x9dd3), /* hot */
+    static_cast<uint16_t>(0x9e41), /* hsb */
+    static_cast<uint16_t>(0x9e4d), /* hsn */
+    static_cast<uint16_t>(0x9e88), /* hui */
+    static_cast<uint16_t>(0xa00d), /* ian */
+    static_cast<uint16_t>(0xa011), /* iar */
+    static_cast<uint16_t>(0xa020), /* iba */
+    static_cast<uint16_t>(0xa021), /* ibb */
+    static_cast<uint16_t>(0xa038), /* iby */
+    static_cast<uint16_t>(0xa040), /* ica */
+    static_cast<uint16_t>(0xa047), /* ich */
+    static_cast<uint16_t>(0xa063), /* idd */
+    static_cast<uint16_t>(0xa068), /* idi */
+    static_cast<uint16_t>(0xa074), /* idu */
+    static_cast<uint16_t>(0xa0a4), /* ife */
+    static_cast<uint16_t>(0xa0c1), /* igb */
+    static_cast<uint16_t>(0xa0c4), /* ige */
+    static_cast<uint16_t>(0xa129), /* ijj */
+    static_cast<uint16_t>(0xa14a), /* ikk */
+    static_cast<uint16_t>(0xa153), /* ikt */
+    static_cast<uint16_t>(0xa156), /* ikw */
+    static_cast<uint16_t>(0xa157), /* ikx */
+    static_cast<uint16_t>(0xa16e), /* ilo */
+    static_cast<uint16_t>(0xa18e), /* imo */
+    static_cast<uint16_t>(0xa1a7), /* inh */
+    static_cast<uint16_t>(0xa1d4), /* iou */
+    static_cast<uint16_t>(0xa228), /* iri */
+    static_cast<uint16_t>(0xa2cc), /* iwm */
+    static_cast<uint16_t>(0xa2d2), /* iws */
+    static_cast<uint16_t>(0xa327), /* izh */
+    static_cast<uint16_t>(0xa328), /* izi */
+    static_cast<uint16_t>(0xa401), /* jab */
+    static_cast<uint16_t>(0xa40c), /* jam */
+    static_cast<uint16_t>(0xa411), /* jar */
+    static_cast<uint16_t>(0xa42e), /* jbo */
+    static_cast<uint16_t>(0xa434), /* jbu */
+    static_cast<uint16_t>(0xa48d), /* jen */
+    static_cast<uint16_t>(0xa4ca), /* jgk */
+    static_cast<uint16_t>(0xa4ce), /* jgo */
+    static_cast<uint16_t>(0xa501), /* jib */
+    static_cast<uint16_t>(0xa582), /* jmc */
+    static_cast<uint16_t>(0xa58b), /* jml */
+    static_cast<uint16_t>(0xa620), /* jra */
+    static_cast<uint16_t>(0xa693), /* jut */
+    static_cast<uint16_t>(0xa800), /* kaa */
+    static_cast<uint16_t>(0xa801), /* kab */
+    static_cast<uint16_t>(0xa802), /* kac */
+    static_cast<uint16_t>(0xa803), /* kad */
+    static_cast<uint16_t>(0xa808), /* kai */
+    static_cast<uint16_t>(0xa809), /* kaj */
+    static_cast<uint16_t>(0xa80c), /* kam */
+    static_cast<uint16_t>(0xa80e), /* kao */
+    static_cast<uint16_t>(0xa823), /* kbd */
+    static_cast<uint16_t>(0xa82c), /* kbm */
+    static_cast<uint16_t>(0xa82f), /* kbp */
+    static_cast<uint16_t>(0xa830), /* kbq */
+    static_cast<uint16_t>(0xa837), /* kbx */
+    static_cast<uint16_t>(0xa838), /* kby */
+    static_cast<uint16_t>(0xa846), /* kcg */
+    static_cast<uint16_t>(0xa84a), /* kck */
+    static_cast<uint16_t>(0xa84b), /* kcl */
+    static_cast<uint16_t>(0xa853), /* kct */
+    static_cast<uint16_t>(0xa864), /* kde */
+    static_cast<uint16_t>(0xa867), /* kdh */
+    static_cast<uint16_t>(0xa86b), /* kdl */
+    static_cast<uint16_t>(0xa873), /* kdt */
+    static_cast<uint16_t>(0xa880), /* kea */
+    static_cast<uint16_t>(0xa88d), /* ken */
+    static_cast<uint16_t>(0xa899), /* kez */
+    static_cast<uint16_t>(0xa8ae), /* kfo */
+    static_cast<uint16_t>(0xa8b1), /* kfr */
+    static_cast<uint16_t>(0xa8b8), /* kfy */
+    static_cast<uint16_t>(0xa8c4), /* kge */
+    static_cast<uint16_t>(0xa8c5), /* kgf */
+    static_cast<uint16_t>(0xa8cf), /* kgp */
+    static_cast<uint16_t>(0xa8e0), /* kha */
+    static_cast<uint16_t>(0xa8e1), /* khb */
+    static_cast<uint16_t>(0xa8ed), /* khn */
+    static_cast<uint16_t>(0xa8f0), /* khq */
+    static_cast<uint16_t>(0xa8f2), /* khs */
+    static_cast<uint16_t>(0xa8f3), /* kht */
+    static_cast<uint16_t>(0xa8f6), /* khw */
+    static_cast<uint16_t>(0xa8f9), /* khz */
+    static_cast<uint16_t>(0xa909), /* kij */
+    static_cast<uint16_t>(0xa914), /* kiu */
+    static_cast<uint16_t>(0xa916), /* kiw */
+    static_cast<uint16_t>(0xa923), /* kjd */
+    static_cast<uint16_t>(0xa926), /* kjg */
+    static_cast<uint16_t>(0xa932), /* kjs */
+    static_cast<uint16_t>(0xa938), /* kjy */
+    static_cast<uint16_t>(0xa942), /* kkc */
+    static_cast<uint16_t>(0xa949), /* kkj */
+    static_cast<uint16_t>(0xa96d), /* kln */
+    static_cast<uint16_t>(0xa970), /* klq */
+    static_cast<uint16_t>(0xa973), /* klt */
+    static_cast<uint16_t>(0xa977), /* klx */
+    static_cast<uint16_t>(0xa981), /* kmb */
+    static_cast<uint16_t>(0xa987), /* kmh */
+    static_cast<uint16_t>(0xa98e), /* kmo */
+    static_cast<uint16_t>(0xa992), /* kms */
+    static_cast<uint16_t>(0xa994), /* kmu */
+    static_cast<uint16_t>(0xa996), /* kmw */
+    static_cast<uint16_t>(0xa9a5), /* knf */
+    static_cast<uint16_t>(0xa9af), /* knp */
+    static_cast<uint16_t>(0xa9c8), /* koi */
+    static_cast<uint16_t>(0xa9ca), /* kok */
+    static_cast<uint16_t>(0xa9cb), /* kol */
+    static_cast<uint16_t>(0xa9d2), /* kos */
+    static_cast<uint16_t>(0xa9d9), /* koz */
+    static_cast<uint16_t>(0xa9e4), /* kpe */
+    static_cast<uint16_t>(0xa9e5), /* kpf */
+    static_cast<uint16_t>(0xa9ee), /* kpo */
+    static_cast<uint16_t>(0xa9f1), /* kpr */
+    static_cast<uint16_t>(0xa9f7), /* kpx */
+    static_cast<uint16_t>(0xaa01), /* kqb */
+    static_cast<uint16_t>(0xaa05), /* kqf */
+    static_cast<uint16_t>(0xaa12), /* kqs */
+    static_cast<uint16_t>(0xaa18), /* kqy */
+    static_cast<uint16_t>(0xaa22), /* krc */
+    static_cast<uint16_t>(0xaa28), /* kri */
+    static_cast<uint16_t>(0xaa29), /* krj */
+    static_cast<uint16_t>(0xaa2b), /* krl */
+    static_cast<uint16_t>(0xaa32), /* krs */
+    static_cast<uint16_t>(0xaa34), /* kru */
+    static_cast<uint16_t>(0xaa41), /* ksb */
+    static_cast<uint16_t>(0xaa43), /* ksd */
+    static_cast<uint16_t>(0xaa45), /* ksf */
+    static_cast<uint16_t>(0xaa47), /* ksh */
+    static_cast<uint16_t>(0xaa49), /* ksj */
+    static_cast<uint16_t>(0xaa51), /* ksr */
+    static_cast<uint16_t>(0xaa61), /* ktb */
+    static_cast<uint16_t>(0xaa6c), /* ktm */
+    static_cast<uint16_t>(0xaa6e), /* kto */
+    static_cast<uint16_t>(0xaa71), /* ktr */
+    static_cast<uint16_t>(0xaa81), /* kub */
+    static_cast<uint16_t>(0xaa83), /* kud */
+    static_cast<uint16_t>(0xaa84), /* kue */
+    static_cast<uint16_t>(0xaa89), /* kuj */
+    static_cast<uint16_t>(0xaa8c), /* kum */
+    static_cast<uint16_t>(0xaa8d), /* kun */
+    static_cast<uint16_t>(0xaa8f), /* kup */
+    static_cast<uint16_t>(0xaa92), /* kus */
+    static_cast<uint16_t>(0xaaa6), /* kvg */
+    static_cast<uint16_t>(0xaab1), /* kvr */
+    static_cast<uint16_t>(0xaab7), /* kvx */
+    static_cast<uint16_t>(0xaac9), /* kwj */
+    static_cast<uint16_t>(0xaace), /* kwo */
+    static_cast<uint16_t>(0xaad0), /* kwq */
+    static_cast<uint16_t>(0xaae0), /* kxa */
+    static_cast<uint16_t>(0xaae2), /* kxc */
+    static_cast<uint16_t>(0xaae4), /* kxe */
+    static_cast<uint16_t>(0xaaeb), /* kxl */
+    static_cast<uint16_t>(0xaaec), /* kxm */
+    static_cast<uint16_t>(0xaaef), /* kxp */
+    static_cast<uint16_t>(0xaaf6), /* kxw */
+    static_cast<uint16_t>(0xaaf9), /* kxz */
+    static_cast<uint16_t>(0xab04), /* kye */
+    static_cast<uint16_t>(0xab17), /* kyx */
+    static_cast<uint16_t>(0xab27), /* kzh */
+    static_cast<uint16_t>(0xab29), /* kzj */
+    static_cast<uint16_t>(0xab31), /* kzr */
+    static_cast<uint16_t>(0xab33), /* kzt */
+    static_cast<uint16_t>(0xac01), /* lab */
+    static_cast<uint16_t>(0xac03), /* lad */
+    static_cast<uint16_t>(0xac06), /* lag */
+    static_cast<uint16_t>(0xac07), /* lah */
+    static_cast<uint16_t>(0xac09), /* laj */
+    static_cast<uint16_t>(0xac12), /* las */
+    static_cast<uint16_t>(0xac24), /* lbe */
+    static_cast<uint16_t>(0xac34), /* lbu */
+    static_cast<uint16_t>(0xac36), /* lbw */
+    static_cast<uint16_t>(0xac4c), /* lcm */
+    static_cast<uint16_t>(0xac4f), /* lcp */
+    static_cast<uint16_t>(0xac61), /* ldb */
+    static_cast<uint16_t>(0xac83), /* led */
+    static_cast<uint16_t>(0xac84), /* lee */
+    static_cast<uint16_t>(0xac8c), /* lem */
+    static_cast<uint16_t>(0xac8f), /* lep */
+    static_cast<uint16_t>(0xac90), /* leq */
+    static_cast<uint16_t>(0xac94), /* leu */
+    static_cast<uint16_t>(0xac99), /* lez */
+    static_cast<uint16_t>(0xacc6), /* lgg */
+    static_cast<uint16_t>(0xad00), /* lia */
+    static_cast<uint16_t>(0xad03), /* lid */
+    static_cast<uint16_t>(0xad05), /* lif */
+    static_cast<uint16_t>(0xad06), /* lig */
+    static_cast<uint16_t>(0xad07), /* lih */
+    static_cast<uint16_t>(0xad09), /* lij */
+    static_cast<uint16_t>(0xad12), /* lis */
+    static_cast<uint16_t>(0xad2f), /* ljp */
+    static_cast<uint16_t>(0xad48), /* lki */
+    static_cast<uint16_t>(0xad53), /* lkt */
+    static_cast<uint16_t>(0xad64), /* lle */
+    static_cast<uint16_t>(0xad6d), /* lln */
+    static_cast<uint16_t>(0xad8d), /* lmn */
+    static_cast<uint16_t>(0xad8e), /* lmo */
+    static_cast<uint16_t>(0xad8f), /* lmp */
+    static_cast<uint16_t>(0xadb2), /* lns */
+    static_cast<uint16_t>(0xadb4), /* lnu */
+    static_cast<uint16_t>(0xadc9), /* loj */
+    static_cast<uint16_t>(0xadca), /* lok */
+    static_cast<uint16_t>(0xadcb), /* lol */
+    static_cast<uint16_t>(0xadd1), /* lor */
+    static_cast<uint16_t>(0xadd2), /* los */
+    static_cast<uint16_t>(0xadd9), /* loz */
+    static_cast<uint16_t>(0xae22), /* lrc */
+    static_cast<uint16_t>(0xae66), /* ltg */
+    static_cast<uint16_t>(0xae80), /* lua */
+    static_cast<uint16_t>(0xae8e), /* luo */
+    static_cast<uint16_t>(0xae98), /* luy */
+    static_cast<uint16_t>(0xae99), /* luz */
+    static_cast<uint16_t>(0xaecb), /* lwl */
+    static_cast<uint16_t>(0xaf27), /* lzh */
+    static_cast<uint16_t>(0xaf39), /* lzz */
+    static_cast<uint16_t>(0xb003), /* mad */
+    static_cast<uint16_t>(0xb005), /* maf */
+    static_cast<uint16_t>(0xb006), /* mag */
+    static_cast<uint16_t>(0xb008), /* mai */
+    static_cast<uint16_t>(0xb00a), /* mak */
+    static_cast<uint16_t>(0xb00d), /* man */
+    static_cast<uint16_t>(0xb012), /* mas */
+    static_cast<uint16_t>(0xb016), /* maw */
+    static_cast<uint16_t>(0xb019), /* maz */
+    static_cast<uint16_t>(0xb027), /* mbh */
+    static_cast<uint16_t>(0xb02e), /* mbo */
+    static_cast<uint16_t>(0xb030), /* mbq */
+    static_cast<uint16_t>(0xb034), /* mbu */
+    static_cast<uint16_t>(0xb036), /* mbw */
+    static_cast<uint16_t>(0xb048), /* mci */
+    static_cast<uint16_t>(0xb04f), /* mcp */
+    static_cast<uint16_t>(0xb050), /* mcq */
+    static_cast<uint16_t>(0xb051), /* mcr */
+    static_cast<uint16_t>(0xb054), /* mcu */
+    static_cast<uint16_t>(0xb060), /* mda */
+    static_cast<uint16_t>(0xb064), /* mde */
+    static_cast<uint16_t>(0xb065), /* mdf */
+    static_cast<uint16_t>(0xb067), /* mdh */
+    static_cast<uint16_t>(0xb069), /* mdj */
+    static_cast<uint16_t>(0xb071), /* mdr */
+    static_cast<uint16_t>(0xb077), /* mdx */
+    static_cast<uint16_t>(0xb083), /* med */
+    static_cast<uint16_t>(0xb084), /* mee */
+    static_cast<uint16_t>(0xb08a), /* mek */
+    static_cast<uint16_t>(0xb08d), /* men */
+    static_cast<uint16_t>(0xb091), /* mer */
+    static_cast<uint16_t>(0xb093), /* met */
+    static_cast<uint16_t>(0xb094), /* meu */
+    static_cast<uint16_t>(0xb0a0), /* mfa */
+    static_cast<uint16_t>(0xb0a4), /* mfe */
+    static_cast<uint16_t>(0xb0ad), /* mfn */
+    static_cast<uint16_t>(0xb0ae), /* mfo */
+    static_cast<uint16_t>(0xb0b0), /* mfq */
+    static_cast<uint16_t>(0xb0c7), /* mgh */
+    static_cast<uint16_t>(0xb0cb), /* mgl */
+    static_cast<uint16_t>(0xb0ce), /* mgo */
+    static_cast<uint16_t>(0xb0cf), /* mgp */
+    static_cast<uint16_t>(0xb0d8), /* mgy */
+    static_cast<uint16_t>(0xb0e8), /* mhi */
+    static_cast<uint16_t>(0xb0eb), /* mhl */
+    static_cast<uint16_t>(0xb105), /* mif */
+    static_cast<uint16_t>(0xb10d), /* min */
+    static_cast<uint16_t>(0xb112), /* mis */
+    static_cast<uint16_t>(0xb116), /* miw */
+    static_cast<uint16_t>(0xb148), /* mki */
+    static_cast<uint16_t>(0xb14b), /* mkl */
+    static_cast<uint16_t>(0xb14f), /* mkp */
+    static_cast<uint16_t>(0xb156), /* mkw */
+    static_cast<uint16_t>(0xb164), /* mle */
+    static_cast<uint16_t>(0xb16f), /* mlp */
+    static_cast<uint16_t>(0xb172), /* mls */
+    static_cast<uint16_t>(0xb18e), /* mmo */
+    static_cast<uint16_t>(0xb194), /* mmu */
+    static_cast<uint16_t>(0xb197), /* mmx */
+    static_cast<uint16_t>(0xb1a0), /* mna */
+    static_cast<uint16_t>(0xb1a5), /* mnf */
+    static_cast<uint16_t>(0xb1a8), /* mni */
+    static_cast<uint16_t>(0xb1b6), /* mnw */
+    static_cast<uint16_t>(0xb1c0), /* moa */
+    static_cast<uint16_t>(0xb1c4), /* moe */
+    static_cast<uint16_t>(0xb1c7), /* moh */
+    static_cast<uint16_t>(0xb1d2), /* mos */
+    static_cast<uint16_t>(0xb1d7), /* mox */
+    static_cast<uint16_t>(0xb1ef), /* mpp */
+    static_cast<uint16_t>(0xb1f2), /* mps */
+    static_cast<uint16_t>(0xb1f3), /* mpt */
+    static_cast<uint16_t>(0xb1f7), /* mpx */
+    static_cast<uint16_t>(0xb20b), /* mql */
+    static_cast<uint16_t>(0xb223), /* mrd */
+    static_cast<uint16_t>(0xb229), /* mrj */
+    static_cast<uint16_t>(0xb22e), /* mro */
+    static_cast<uint16_t>(0xb262), /* mtc */
+    static_cast<uint16_t>(0xb265), /* mtf */
+    static_cast<uint16_t>(0xb268), /* mti */
+    static_cast<uint16_t>(0xb271), /* mtr */
+    static_cast<uint16_t>(0xb280), /* mua */
+    static_cast<uint16_t>(0xb291), /* mur */
+    static_cast<uint16_t>(0xb292), /* mus */
+    static_cast<uint16_t>(0xb2a0), /* mva */
+    static_cast<uint16_t>(0xb2ad), /* mvn */
+    static_cast<uint16_t>(0xb2b8), /* mvy */
+    static_cast<uint16_t>(0xb2ca), /* mwk */
+    static_cast<uint16_t>(0xb2d1), /* mwr */
+    static_cast<uint16_t>(0xb2d5), /* mwv */
+    static_cast<uint16_t>(0xb2d6), /* mww */
+    static_cast<uint16_t>(0xb2e2), /* mxc */
+    static_cast<uint16_t>(0xb2ec), /* mxm */
+    static_cast<uint16_t>(0xb30a), /* myk */
+    static_cast<uint16_t>(0xb30c), /* mym */
+    static_cast<uint16_t>(0xb315), /* myv */
+    static_cast<uint16_t>(0xb316), /* myw */
+    static_cast<uint16_t>(0xb317), /* myx */
+    static_cast<uint16_t>(0xb319), /* myz */
+    static_cast<uint16_t>(0xb32a), /* mzk */
+    static_cast<uint16_t>(0xb32c), /* mzm */
+    static_cast<uint16_t>(0xb32d), /* mzn */
+    static_cast<uint16_t>(0xb32f), /* mzp */
+    static_cast<uint16_t>(0xb336), /* mzw */
+    static_cast<uint16_t>(0xb339), /* mzz */
+    static_cast<uint16_t>(0xb402), /* nac */
+    static_cast<uint16_t>(0xb405), /* naf */
+    static_cast<uint16_t>(0xb40a), /* nak */
+    static_cast<uint16_t>(0xb40d), /* nan */
+    static_cast<uint16_t>(0xb40f), /* nap */
+    static_cast<uint16_t>(0xb410), /* naq */
+    static_cast<uint16_t>(0xb412), /* nas */
+    static_cast<uint16_t>(0xb440), /* nca */
+    static_cast<uint16_t>(0xb444), /* nce */
+    static_cast<uint16_t>(0xb445), /* ncf */
+    static_cast<uint16_t>(0xb447), /* nch */
+    static_cast<uint16_t>(0xb44e), /* nco */
+    static_cast<uint16_t>(0xb454), /* ncu */
+    static_cast<uint16_t>(0xb462), /* ndc */
+    static_cast<uint16_t>(0xb472), /* nds */
+    static_cast<uint16_t>(0xb481), /* neb */
+    static_cast<uint16_t>(0xb496), /* new */
+    static_cast<uint16_t>(0xb497), /* nex */
+    static_cast<uint16_t>(0xb4b1), /* nfr */
+    static_cast<uint16_t>(0xb4c0), /* nga */
+    static_cast<uint16_t>(0xb4c1), /* ngb */
+    static_cast<uint16_t>(0xb4cb), /* ngl */
+    static_cast<uint16_t>(0xb4e1), /* nhb */
+    static_cast<uint16_t>(0xb4e4), /* nhe */
+    static_cast<uint16_t>(0xb4f6), /* nhw */
+    static_cast<uint16_t>(0xb505), /* nif */
+    static_cast<uint16_t>(0xb508), /* nii */
+    static_cast<uint16_t>(0xb509), /* nij */
+    static_cast<uint16_t>(0xb50d), /* nin */
+    static_cast<uint16_t>(0xb514), /* niu */
+    static_cast<uint16_t>(0xb518), /* niy */
+    static_cast<uint16_t>(0xb519), /* niz */
+    static_cast<uint16_t>(0xb52e), /* njo */
+    static_cast<uint16_t>(0xb546), /* nkg */
+    static_cast<uint16_t>(0xb54e), /* nko */
+    static_cast<uint16_t>(0xb586), /* nmg */
+    static_cast<uint16_t>(0xb599), /* nmz */
+    static_cast<uint16_t>(0xb5a5), /* nnf */
+    static_cast<uint16_t>(0xb5a7), /* nnh */
+    static_cast<uint16_t>(0xb5aa), /* nnk */
+    static_cast<uint16_t>(0xb5ac), /* nnm */
+    static_cast<uint16_t>(0xb5af), /* nnp */
+    static_cast<uint16_t>(0xb5c3), /* nod */
+    static_cast<uint16_t>(0xb5c4), /* noe */
+    static_cast<uint16_t>(0xb5cd), /* non */
+    static_cast<uint16_t>(0xb5cf), /* nop */
+    static_cast<uint16_t>(0xb5d4), /* nou */
+    static_cast<uint16_t>(0xb60e), /* nqo */
+    static_cast<uint16_t>(0xb621), /* nrb */
+    static_cast<uint16_t>(0xb64a), /* nsk */
+    static_cast<uint16_t>(0xb64d), /* nsn */
+    static_cast<uint16_t>(0xb64e), /* nso */
+    static_cast<uint16_t>(0xb652), /* nss */
+    static_cast<uint16_t>(0xb66c), /* ntm */
+    static_cast<uint16_t>(0xb671), /* ntr */
+    static_cast<uint16_t>(0xb688), /* nui */
+    static_cast<uint16_t>(0xb68f), /* nup */
+    static_cast<uint16_t>(0xb692), /* nus */
+    static_cast<uint16_t>(0xb695), /* nuv */
+    static_cast<uint16_t>(0xb697), /* nux */
+    static_cast<uint16_t>(0xb6c1), /* nwb */
+    static_cast<uint16_t>(0xb6f0), /* nxq */
+    static_cast<uint16_t>(0xb6f1), /* nxr */
+    static_cast<uint16_t>(0xb70c), /* nym */
+    static_cast<uint16_t>(0xb70d), /* nyn */
+    static_cast<uint16_t>(0xb728), /* nzi */
+    static_cast<uint16_t>(0xb8c2), /* ogc */
+    static_cast<uint16_t>(0xb951), /* okr */
+    static_cast<uint16_t>(0xb955), /* okv */
+    static_cast<uint16_t>(0xb9a6), /* ong */
+    static_cast<uint16_t>(0xb9ad), /* onn */
+    static_cast<uint16_t>(0xb9b2), /* ons */
+    static_cast<uint16_t>(0xb9ec), /* opm */
+    static_cast<uint16_t>(0xba2e), /* oro */
+    static_cast<uint16_t>(0xba34), /* oru */
+    static_cast<uint16_t>(0xba40), /* osa */
+    static_cast<uint16_t>(0xba60), /* ota */
+    static_cast<uint16_t>(0xba6a), /* otk */
+    static_cast<uint16_t>(0xbb2c), /* ozm */
+    static_cast<uint16_t>(0xbc06), /* pag */
+    static_cast<uint16_t>(0xbc0b), /* pal */
+    static_cast<uint16_t>(0xbc0c), /* pam */
+    static_cast<uint16_t>(0xbc0f), /* pap */
+    static_cast<uint16_t>(0xbc14), /* pau */
+    static_cast<uint16_t>(0xbc28), /* pbi */
+    static_cast<uint16_t>(0xbc43), /* pcd */
+    static_cast<uint16_t>(0xbc4c), /* pcm */
+    static_cast<uint16_t>(0xbc62), /* pdc */
+    static_cast<uint16_t>(0xbc73), /* pdt */
+    static_cast<uint16_t>(0xbc83), /* ped */
+    static_cast<uint16_t>(0xbc8e), /* peo */
+    static_cast<uint16_t>(0xbc97), /* pex */
+    static_cast<uint16_t>(0xbcab), /* pfl */
+    static_cast<uint16_t>(0xbceb), /* phl */
+    static_cast<uint16_t>(0xbced), /* phn */
+    static_cast<uint16_t>(0xbd0b), /* pil */
+    static_cast<uint16_t>(0xbd0f), /* pip */
+    static_cast<uint16_t>(0xbd40), /* pka */
+    static_cast<uint16_t>(0xbd4e), /* pko */
+    static_cast<uint16_t>(0xbd60), /* pla */
+    static_cast<uint16_t>(0xbd92), /* pms */
+    static_cast<uint16_t>(0xbda6), /* png */
+    static_cast<uint16_t>(0xbdad), /* pnn */
+    static_cast<uint16_t>(0xbdb3), /* pnt */
+    static_cast<uint16_t>(0xbdcd), /* pon */
+    static_cast<uint16_t>(0xbde0), /* ppa */
+    static_cast<uint16_t>(0xbdee), /* ppo */
+    static_cast<uint16_t>(0xbe20), /* pra */
+    static_cast<uint16_t>(0xbe23), /* prd */
+    static_cast<uint16_t>(0xbe26), /* prg */
+    static_cast<uint16_t>(0xbe52), /* pss */
+    static_cast<uint16_t>(0xbe6f), /* ptp */
+    static_cast<uint16_t>(0xbe94), /* puu */
+    static_cast<uint16_t>(0xbec0), /* pwa */
+    static_cast<uint16_t>(0xc282), /* quc */
+    static_cast<uint16_t>(0xc286), /* qug */
+    static_cast<uint16_t>(0xc408), /* rai */
+    static_cast<uint16_t>(0xc409), /* raj */
+    static_cast<uint16_t>(0xc40e), /* rao */
+    static_cast<uint16_t>(0xc445), /* rcf */
+    static_cast<uint16_t>(0xc489), /* rej */
+    static_cast<uint16_t>(0xc48b), /* rel */
+    static_cast<uint16_t>(0xc492), /* res */
+    static_cast<uint16_t>(0xc4cd), /* rgn */
+    static_cast<uint16_t>(0xc4e6), /* rhg */
+    static_cast<uint16_t>(0xc500), /* ria */
+    static_cast<uint16_t>(0xc505), /* rif */
+    static_cast<uint16_t>(0xc532), /* rjs */
+    static_cast<uint16_t>(0xc553), /* rkt */
+    static_cast<uint16_t>(0xc585), /* rmf */
+    static_cast<uint16_t>(0xc58e), /* rmo */
+    static_cast<uint16_t>(0xc593), /* rmt */
+    static_cast<uint16_t>(0xc594), /* rmu */
+    static_cast<uint16_t>(0xc5a0), /* rna */
+    static_cast<uint16_t>(0xc5a6), /* rng */
+    static_cast<uint16_t>(0xc5c1), /* rob */
+    static_cast<uint16_t>(0xc5c5), /* rof */
+    static_cast<uint16_t>(0xc5ce), /* roo */
+    static_cast<uint16_t>(0xc62e), /* rro */
+    static_cast<uint16_t>(0xc66c), /* rtm */
+    static_cast<uint16_t>(0xc684), /* rue */
+    static_cast<uint16_t>(0xc686), /* rug */
+    static_cast<uint16_t>(0xc6ca), /* rwk */
+    static_cast<uint16_t>(0xc6ce), /* rwo */
+    static_cast<uint16_t>(0xc714), /* ryu */
+    static_cast<uint16_t>(0xc805), /* saf */
+    static_cast<uint16_t>(0xc807), /* sah */
+    static_cast<uint16_t>(0xc810), /* saq */
+    static_cast<uint16_t>(0xc812), /* sas */
+    static_cast<uint16_t>(0xc813), /* sat */
+    static_cast<uint16_t>(0xc815), /* sav */
+    static_cast<uint16_t>(0xc819), /* saz */
+    static_cast<uint16_t>(0xc820), /* sba */
+    static_cast<uint16_t>(0xc824), /* sbe */
+    static_cast<uint16_t>(0xc82f), /* sbp */
+    static_cast<uint16_t>(0xc84a), /* sck */
+    static_cast<uint16_t>(0xc84b), /* scl */
+    static_cast<uint16_t>(0xc84d), /* scn */
+    static_cast<uint16_t>(0xc84e), /* sco */
+    static_cast<uint16_t>(0xc852), /* scs */
+    static_cast<uint16_t>(0xc862), /* sdc */
+    static_cast<uint16_t>(0xc867), /* sdh */
+    static_cast<uint16_t>(0xc885), /* sef */
+    static_cast<uint16_t>(0xc887), /* seh */
+    static_cast<uint16_t>(0xc888), /* sei */
+    static_cast<uint16_t>(0xc892), /* ses */
+    static_cast<uint16_t>(0xc8c0), /* sga */
+    static_cast<uint16_t>(0xc8d2), /* sgs */
+    static_cast<uint16_t>(0xc8d6), /* sgw */
+    static_cast<uint16_t>(0xc8d9), /* sgz */
+    static_cast<uint16_t>(0xc8e8), /* shi */
+    static_cast<uint16_t>(0xc8ea), /* shk */
+    static_cast<uint16_t>(0xc8ed), /* shn */
+    static_cast<uint16_t>(0xc8f4), /* shu */
+    static_cast<uint16_t>(0xc903), /* sid */
+    static_cast<uint16_t>(0xc906), /* sig */
+    static_cast<uint16_t>(0xc90b), /* sil */
+    static_cast<uint16_t>(0xc90c), /* sim */
+    static_cast<uint16_t>(0xc931), /* sjr */
+    static_cast<uint16_t>(0xc942), /* skc */
+    static_cast<uint16_t>(0xc951), /* skr */
+    static_cast<uint16_t>(0xc952), /* sks */
+    static_cast<uint16_t>(0xc963), /* sld */
+    static_cast<uint16_t>(0xc968), /* sli */
+    static_cast<uint16_t>(0xc96b), /* sll */
+    static_cast<uint16_t>(0xc978), /* sly */
+    static_cast<uint16_t>(0xc980), /* sma */
+    static_cast<uint16_t>(0xc989), /* smj */
+    static_cast<uint16_t>(0xc98d), /* smn */
+    static_cast<uint16_t>(0xc98f), /* smp */
+    static_cast<uint16_t>(0xc990), /* smq */
+    static_cast<uint16_t>(0xc992), /* sms */
+    static_cast<uint16_t>(0xc9a2), /* snc */
+    static_cast<uint16_t>(0xc9aa), /* snk */
+    static_cast<uint16_t>(0xc9af), /* snp */
+    static_cast<uint16_t>(0xc9b7), /* snx */
+    static_cast<uint16_t>(0xc9b8), /* sny */
+    static_cast<uint16_t>(0xc9c6), /* sog */
+    static_cast<uint16_t>(0xc9ca), /* sok */
+    static_cast<uint16_t>(0xc9d0), /* soq */
+    static_cast<uint16_t>(0xc9d4), /* sou */
+    static_cast<uint16_t>(0xc9d8), /* soy */
+    static_cast<uint16_t>(0xc9e3), /* spd */
+    static_cast<uint16_t>(0xc9eb), /* spl */
+    static_cast<uint16_t>(0xc9f2), /* sps */
+    static_cast<uint16_t>(0xca21), /* srb */
+    static_cast<uint16_t>(0xca2d), /* srn */
+    static_cast<uint16_t>(0xca31), /* srr */
+    static_cast<uint16_t>(0xca37), /* srx */
+    static_cast<uint16_t>(0xca43), /* ssd */
+    static_cast<uint16_t>(0xca46), /* ssg */
+    static_cast<uint16_t>(0xca58), /* ssy */
+    static_cast<uint16_t>(0xca6a), /* stk */
+    static_cast<uint16_t>(0xca70), /* stq */
+    static_cast<uint16_t>(0xca80), /* sua */
+    static_cast<uint16_t>(0xca84), /* sue */
+    static_cast<uint16_t>(0xca8a), /* suk */
+    static_cast<uint16_t>(0xca91), /* sur */
+    static_cast<uint16_t>(0xca92), /* sus */
+    static_cast<uint16_t>(0xcac1), /* swb */
+    static_cast<uint16_t>(0xcac2), /* swc */
+    static_cast<uint16_t>(0xcac6), /* swg */
+    static_cast<uint16_t>(0xcacf), /* swp */
+    static_cast<uint16_t>(0xcad5), /* swv */
+    static_cast<uint16_t>(0xcaed), /* sxn */
+    static_cast<uint16_t>(0xcaf6), /* sxw */
+    static_cast<uint16_t>(0xcb0b), /* syl */
+    static_cast<uint16_t>(0xcb11), /* syr */
+    static_cast<uint16_t>(0xcb2b), /* szl */
+    static_cast<uint16_t>(0xcc09), /* taj */
+    static_cast<uint16_t>(0xcc0b), /* tal */
+    static_cast<uint16_t>(0xcc0d), /* tan */
+    static_cast<uint16_t>(0xcc10), /* taq */
+    static_cast<uint16_t>(0xcc22), /* tbc */
+    static_cast<uint16_t>(0xcc23), /* tbd */
+    static_cast<uint16_t>(0xcc25), /* tbf */
+    static_cast<uint16_t>(0xcc26), /* tbg */
+    static_cast<uint16_t>(0xcc2e), /* tbo */
+    static_cast<uint16_t>(0xcc36), /* tbw */
+    static_cast<uint16_t>(0xcc39), /* tbz */
+    static_cast<uint16_t>(0xcc48), /* tci */
+    static_cast<uint16_t>(0xcc58), /* tcy */
+    static_cast<uint16_t>(0xcc63), /* tdd */
+    static_cast<uint16_t>(0xcc66), /* tdg */
+    static_cast<uint16_t>(0xcc67), /* tdh */
+    static_cast<uint16_t>(0xcc74), /* tdu */
+    static_cast<uint16_t>(0xcc83), /* ted */
+    static_cast<uint16_t>(0xcc8c), /* tem */
+    static_cast<uint16_t>(0xcc8e), /* teo */
+    static_cast<uint16_t>(0xcc93), /* tet */
+    static_cast<uint16_t>(0xcca8), /* tfi */
+    static_cast<uint16_t>(0xccc2), /* tgc */
+    static_cast<uint16_t>(0xccce), /* tgo */
+    static_cast<uint16_t>(0xccd4), /* tgu */
+    static_cast<uint16_t>(0xcceb), /* thl */
+    static_cast<uint16_t>(0xccf0), /* thq */
+    static_cast<uint16_t>(0xccf1), /* thr */
+    static_cast<uint16_t>(0xcd05), /* tif */
+    static_cast<uint16_t>(0xcd06), /* tig */
+    static_cast<uint16_t>(0xcd0a), /* tik */
+    static_cast<uint16_t>(0xcd0c), /* tim */
+    static_cast<uint16_t>(0xcd0e), /* tio */
+    static_cast<uint16_t>(0xcd15), /* tiv */
+    static_cast<uint16_t>(0xcd4b), /* tkl */
+    static_cast<uint16_t>(0xcd51), /* tkr */
+    static_cast<uint16_t>(0xcd53), /* tkt */
+    static_cast<uint16_t>(0xcd65), /* tlf */
+    static_cast<uint16_t>(0xcd77), /* tlx */
+    static_cast<uint16_t>(0xcd78), /* tly */
+    static_cast<uint16_t>(0xcd87), /* tmh */
+    static_cast<uint16_t>(0xcd98), /* tmy */
+    static_cast<uint16_t>(0xcda7), /* tnh */
+    static_cast<uint16_t>(0xcdc5), /* tof */
+    static_cast<uint16_t>(0xcdc6), /* tog */
+    static_cast<uint16_t>(0xcdd0), /* toq */
+    static_cast<uint16_t>(0xcde8), /* tpi */
+    static_cast<uint16_t>(0xcdec), /* tpm */
+    static_cast<uint16_t>(0xcdf9), /* tpz */
+    static_cast<uint16_t>(0xce0e), /* tqo */
+    static_cast<uint16_t>(0xce34), /* tru */
+    static_cast<uint16_t>(0xce35), /* trv */
+    static_cast<uint16_t>(0xce36), /* trw */
+    static_cast<uint16_t>(0xce43), /* tsd */
+    static_cast<uint16_t>(0xce45), /* tsf */
+    static_cast<uint16_t>(0xce46), /* tsg */
+    static_cast<uint16_t>(0xce49), /* tsj */
+    static_cast<uint16_t>(0xce56), /* tsw */
+    static_cast<uint16_t>(0xce63), /* ttd */
+    static_cast<uint16_t>(0xce64), /* tte */
+    static_cast<uint16_t>(0xce69), /* ttj */
+    static_cast<uint16_t>(0xce71), /* ttr */
+    static_cast<uint16_t>(0xce72), /* tts */
+    static_cast<uint16_t>(0xce73), /* ttt */
+    static_cast<uint16_t>(0xce87), /* tuh */
+    static_cast<uint16_t>(0xce8b), /* tul */
+    static_cast<uint16_t>(0xce8c), /* tum */
+    static_cast<uint16_t>(0xce90), /* tuq */
+    static_cast<uint16_t>(0xcea3), /* tvd */
+    static_cast<uint16_t>(0xceab), /* tvl */
+    static_cast<uint16_t>(0xceb4), /* tvu */
+    static_cast<uint16_t>(0xcec7), /* twh */
+    static_cast<uint16_t>(0xced0), /* twq */
+    static_cast<uint16_t>(0xcee6), /* txg */
+    static_cast<uint16_t>(0xcf00), /* tya */
+    static_cast<uint16_t>(0xcf15), /* tyv */
+    static_cast<uint16_t>(0xcf2c), /* tzm */
+    static_cast<uint16_t>(0xd034), /* ubu */
+    static_cast<uint16_t>(0xd06c), /* udm */
+    static_cast<uint16_t>(0xd0c0), /* uga */
+    static_cast<uint16_t>(0xd168), /* uli */
+    static_cast<uint16_t>(0xd181), /* umb */
+    static_cast<uint16_t>(0xd1b1), /* unr */
+    static_cast<uint16_t>(0xd1b7), /* unx */
+    static_cast<uint16_t>(0xd1ca), /* uok */
+    static_cast<uint16_t>(0xd228), /* uri */
+    static_cast<uint16_t>(0xd233), /* urt */
+    static_cast<uint16_t>(0xd236), /* urw */
+    static_cast<uint16_t>(0xd240), /* usa */
+    static_cast<uint16_t>(0xd267), /* uth */
+    static_cast<uint16_t>(0xd271), /* utr */
+    static_cast<uint16_t>(0xd2a7), /* uvh */
+    static_cast<uint16_t>(0xd2ab), /* uvl */
+    static_cast<uint16_t>(0xd406), /* vag */
+    static_cast<uint16_t>(0xd408), /* vai */
+    static_cast<uint16_t>(0xd40d), /* van */
+    static_cast<uint16_t>(0xd482), /* vec */
+    static_cast<uint16_t>(0xd48f), /* vep */
+    static_cast<uint16_t>(0xd502), /* vic */
+    static_cast<uint16_t>(0xd515), /* viv */
+    static_cast<uint16_t>(0xd572), /* vls */
+    static_cast<uint16_t>(0xd585), /* vmf */
+    static_cast<uint16_t>(0xd596), /* vmw */
+    static_cast<uint16_t>(0xd5d3), /* vot */
+    static_cast<uint16_t>(0xd62e), /* vro */
+    static_cast<uint16_t>(0xd68d), /* vun */
+    static_cast<uint16_t>(0xd693), /* vut */
+    static_cast<uint16_t>(0xd804), /* wae */
+    static_cast<uint16_t>(0xd809), /* waj */
+    static_cast<uint16_t>(0xd80b), /* wal */
+    static_cast<uint16_t>(0xd80d), /* wan */
+    static_cast<uint16_t>(0xd811), /* war */
+    static_cast<uint16_t>(0xd82f), /* wbp */
+    static_cast<uint16_t>(0xd830), /* wbq */
+    static_cast<uint16_t>(0xd831), /* wbr */
+    static_cast<uint16_t>(0xd848), /* wci */
+    static_cast<uint16_t>(0xd891), /* wer */
+    static_cast<uint16_t>(0xd8c8), /* wgi */
+    static_cast<uint16_t>(0xd8e6), /* whg */
+    static_cast<uint16_t>(0xd901), /* wib */
+    static_cast<uint16_t>(0xd914), /* wiu */
+    static_cast<uint16_t>(0xd915), /* wiv */
+    static_cast<uint16_t>(0xd920), /* wja */
+    static_cast<uint16_t>(0xd928), /* wji */
+    static_cast<uint16_t>(0xd972), /* wls */
+    static_cast<uint16_t>(0xd98e), /* wmo */
+    static_cast<uint16_t>(0xd9a2), /* wnc */
+    static_cast<uint16_t>(0xd9a8), /* wni */
+    static_cast<uint16_t>(0xd9b4), /* wnu */
+    static_cast<uint16_t>(0xd9c1), /* wob */
+    static_cast<uint16_t>(0xd9d2), /* wos */
+    static_cast<uint16_t>(0xda32), /* wrs */
+    static_cast<uint16_t>(0xda46), /* wsg */
+    static_cast<uint16_t>(0xda4a), /* wsk */
+    static_cast<uint16_t>(0xda6c), /* wtm */
+    static_cast<uint16_t>(0xda94), /* wuu */
+    static_cast<uint16_t>(0xda95), /* wuv */
+    static_cast<uint16_t>(0xdac0), /* wwa */
+    static_cast<uint16_t>(0xdc15), /* xav */
+    static_cast<uint16_t>(0xdc28), /* xbi */
+    static_cast<uint16_t>(0xdc4e), /* xco */
+    static_cast<uint16_t>(0xdc51), /* xcr */
+    static_cast<uint16_t>(0xdc92), /* xes */
+    static_cast<uint16_t>(0xdd60), /* xla */
+    static_cast<uint16_t>(0xdd62), /* xlc */
+    static_cast<uint16_t>(0xdd63), /* xld */
+    static_cast<uint16_t>(0xdd85), /* xmf */
+    static_cast<uint16_t>(0xdd8d), /* xmn */
+    static_cast<uint16_t>(0xdd91), /* xmr */
+    static_cast<uint16_t>(0xdda0), /* xna */
+    static_cast<uint16_t>(0xddb1), /* xnr */
+    static_cast<uint16_t>(0xddc6), /* xog */
+    static_cast<uint16_t>(0xddcd), /* xon */
+    static_cast<uint16_t>(0xddf1), /* xpr */
+    static_cast<uint16_t>(0xde21), /* xrb */
+    static_cast<uint16_t>(0xde40), /* xsa */
+    static_cast<uint16_t>(0xde48), /* xsi */
+    static_cast<uint16_t>(0xde4c), /* xsm */
+    static_cast<uint16_t>(0xde51), /* xsr */
+    static_cast<uint16_t>(0xdec4), /* xwe */
+    static_cast<uint16_t>(0xe00c), /* yam */
+    static_cast<uint16_t>(0xe00e), /* yao */
+    static_cast<uint16_t>(0xe00f), /* yap */
+    static_cast<uint16_t>(0xe012), /* yas */
+    static_cast<uint16_t>(0xe013), /* yat */
+    static_cast<uint16_t>(0xe015), /* yav */
+    static_cast<uint16_t>(0xe018), /* yay */
+    static_cast<uint16_t>(0xe019), /* yaz */
+    static_cast<uint16_t>(0xe020), /* yba */
+    static_cast<uint16_t>(0xe021), /* ybb */
+    static_cast<uint16_t>(0xe038), /* yby */
+    static_cast<uint16_t>(0xe091), /* yer */
+    static_cast<uint16_t>(0xe0d1), /* ygr */
+    static_cast<uint16_t>(0xe0d6), /* ygw */
+    static_cast<uint16_t>(0xe14e), /* yko */
+    static_cast<uint16_t>(0xe164), /* yle */
+    static_cast<uint16_t>(0xe166), /* ylg */
+    static_cast<uint16_t>(0xe16b), /* yll */
+    static_cast<uint16_t>(0xe18b), /* yml */
+    static_cast<uint16_t>(0xe1cd), /* yon */
+    static_cast<uint16_t>(0xe221), /* yrb */
+    static_cast<uint16_t>(0xe224), /* yre */
+    static_cast<uint16_t>(0xe22b), /* yrl */
+    static_cast<uint16_t>(0xe252), /* yss */
+    static_cast<uint16_t>(0xe280), /* yua */
+    static_cast<uint16_t>(0xe284), /* yue */
+    static_cast<uint16_t>(0xe289), /* yuj */
+    static_cast<uint16_t>(0xe293), /* yut */
+    static_cast<uint16_t>(0xe296), /* yuw */
+    static_cast<uint16_t>(0xe406), /* zag */
+    static_cast<uint16_t>(0xe469), /* zdj */
+    static_cast<uint16_t>(0xe480), /* zea */
+    static_cast<uint16_t>(0xe4c7), /* zgh */
+    static_cast<uint16_t>(0xe4f7), /* zhx */
+    static_cast<uint16_t>(0xe500), /* zia */
+    static_cast<uint16_t>(0xe553), /* zkt */
+    static_cast<uint16_t>(0xe56c), /* zlm */
+    static_cast<uint16_t>(0xe588), /* zmi */
+    static_cast<uint16_t>(0xe5a4), /* zne */
+    static_cast<uint16_t>(0xe720), /* zza */
+};
+// packed subtags
+constexpr uint16_t LIKELY_TAGS_LANGUAGE_VALUE[] = {
+    static_cast<uint16_t>(0x353a), /* aa-Latn-ET */
+    static_cast<uint16_t>(0x1444), /* ab-Cyrl-GE */
+    static_cast<uint16_t>(0x065e), /* ae-Avst-IR */
+    static_cast<uint16_t>(0x35d7), /* af-Latn-ZA */
+    static_cast<uint16_t>(0x3547), /* ak-Latn-GH */
+    static_cast<uint16_t>(0x183a), /* am-Ethi-ET */
+    static_cast<uint16_t>(0x3539), /* an-Latn-ES */
+    static_cast<uint16_t>(0x0336), /* ar-Arab-EG */
+    static_cast<uint16_t>(0x095b), /* as-Beng-IN */
+    static_cast<uint16_t>(0x14a4), /* av-Cyrl-RU */
+    static_cast<uint16_t>(0x3516), /* ay-Latn-BO */
+    static_cast<uint16_t>(0x350b), /* az-Latn-AZ */
+    static_cast<uint16_t>(0x14a4), /* ba-Cyrl-RU */
+    static_cast<uint16_t>(0x141b), /* be-Cyrl-BY */
+    static_cast<uint16_t>(0x1411), /* bg-Cyrl-BG */
+    static_cast<uint16_t>(0x35d1), /* bi-Latn-VU */
+    static_cast<uint16_t>(0x357e), /* bm-Latn-ML */
+    static_cast<uint16_t>(0x090e), /* bn-Beng-BD */
+    static_cast<uint16_t>(0x6b26), /* bo-Tibt-CN */
+    static_cast<uint16_t>(0x3540), /* br-Latn-FR */
+    static_cast<uint16_t>(0x350c), /* bs-Latn-BA */
+    static_cast<uint16_t>(0x3539), /* ca-Latn-ES */
+    static_cast<uint16_t>(0x14a4), /* ce-Cyrl-RU */
+    static_cast<uint16_t>(0x354f), /* ch-Latn-GU */
+    static_cast<uint16_t>(0x3540), /* co-Latn-FR */
+    static_cast<uint16_t>(0x0d1d), /* cr-Cans-CA */
+    static_cast<uint16_t>(0x352d), /* cs-Latn-CZ */
+    static_cast<uint16_t>(0x14a4), /* cu-Cyrl-RU */
+    static_cast<uint16_t>(0x14a4), /* cv-Cyrl-RU */
+    static_cast<uint16_t>(0x3542), /* cy-Latn-GB */
+    static_cast<uint16_t>(0x3530), /* da-Latn-DK */
+    static_cast<uint16_t>(0x352e), /* de-Latn-DE */
+    static_cast<uint16_t>(0x6985), /* dv-Thaa-MV */
+    static_cast<uint16_t>(0x6b19), /* dz-Tibt-BT */
+    static_cast<uint16_t>(0x3547), /* ee-Latn-GH */
+    static_cast<uint16_t>(0x1e4d), /* el-Grek-GR */
+    static_cast<uint16_t>(0x35c9), /* en-Latn-US */
+    static_cast<uint16_t>(0x35db), /* eo-Latn-001 */
+    static_cast<uint16_t>(0x3539), /* es-Latn-ES */
+    static_cast<uint16_t>(0x3535), /* et-Latn-EE */
+    static_cast<uint16_t>(0x3539), /* eu-Latn-ES */
+    static_cast<uint16_t>(0x035e), /* fa-Arab-IR */
+    static_cast<uint16_t>(0x35b0), /* ff-Latn-SN */
+    static_cast<uint16_t>(0x353b), /* fi-Latn-FI */
+    static_cast<uint16_t>(0x353c), /* fj-Latn-FJ */
+    static_cast<uint16_t>(0x353f), /* fo-Latn-FO */
+    static_cast<uint16_t>(0x3540), /* fr-Latn-FR */
+    static_cast<uint16_t>(0x358f), /* fy-Latn-NL */
+    static_cast<uint16_t>(0x3558), /* ga-Latn-IE */
+    static_cast<uint16_t>(0x3542), /* gd-Latn-GB */
+    static_cast<uint16_t>(0x3539), /* gl-Latn-ES */
+    static_cast<uint16_t>(0x35a0), /* gn-Latn-PY */
+    static_cast<uint16_t>(0x1f5b), /* gu-Gujr-IN */
+    static_cast<uint16_t>(0x355a), /* gv-Latn-IM */
+    static_cast<uint16_t>(0x358d), /* ha-Latn-NG */
+    static_cast<uint16_t>(0x2559), /* he-Hebr-IL */
+    static_cast<uint16_t>(0x155b), /* hi-Deva-IN */
+    static_cast<uint16_t>(0x3598), /* ho-Latn-PG */
+    static_cast<uint16_t>(0x3554), /* hr-Latn-HR */
+    static_cast<uint16_t>(0x3555), /* ht-Latn-HT */
+    static_cast<uint16_t>(0x3556), /* hu-Latn-HU */
+    static_cast<uint16_t>(0x0505), /* hy-Armn-AM */
+    static_cast<uint16_t>(0x358a), /* hz-Latn-NA */
+    static_cast<uint16_t>(0x35db), /* ia-Latn-001 */
+    static_cast<uint16_t>(0x3557), /* id-Latn-ID */
+    static_cast<uint16_t>(0x358d), /* ig-Latn-NG */
+    static_cast<uint16_t>(0x7226), /* ii-Yiii-CN */
+    static_cast<uint16_t>(0x35c9), /* ik-Latn-US */
+    static_cast<uint16_t>(0x3557), /* in-Latn-ID */
+    static_cast<uint16_t>(0x35db), /* io-Latn-001 */
+    static_cast<uint16_t>(0x355f), /* is-Latn-IS */
+    static_cast<uint16_t>(0x3560), /* it-Latn-IT */
+    static_cast<uint16_t>(0x0d1d), /* iu-Cans-CA */
+    static_cast<uint16_t>(0x2559), /* iw-Hebr-IL */
+    static_cast<uint16_t>(0x2a64), /* ja-Jpan-JP */
+    static_cast<uint16_t>(0x25c7), /* ji-Hebr-UA */
+    static_cast<uint16_t>(0x3557), /* jv-Latn-ID */
+    static_cast<uint16_t>(0x3557), /* jw-Latn-ID */
+    static_cast<uint16_t>(0x1944), /* ka-Geor-GE */
+    static_cast<uint16_t>(0x351f), /* kg-Latn-CD */
+    static_cast<uint16_t>(0x3565), /* ki-Latn-KE */
+    static_cast<uint16_t>(0x358a), /* kj-Latn-NA */
+    static_cast<uint16_t>(0x146d), /* kk-Cyrl-KZ */
+    static_cast<uint16_t>(0x3549), /* kl-Latn-GL */
+    static_cast<uint16_t>(0x2e67), /* km-Khmr-KH */
+    static_cast<uint16_t>(0x315b), /* kn-Knda-IN */
+    static_cast<uint16_t>(0x326b), /* ko-Kore-KR */
+    static_cast<uint16_t>(0x35da), /* kr-Latn-ZZ */
+    static_cast<uint16_t>(0x035b), /* ks-Arab-IN */
+    static_cast<uint16_t>(0x35c2), /* ku-Latn-TR */
+    static_cast<uint16_t>(0x14a4), /* kv-Cyrl-RU */
+    static_cast<uint16_t>(0x3542), /* kw-Latn-GB */
+    static_cast<uint16_t>(0x1466), /* ky-Cyrl-KG */
+    static_cast<uint16_t>(0x35cc), /* la-Latn-VA */
+    static_cast<uint16_t>(0x3575), /* lb-Latn-LU */
+    static_cast<uint16_t>(0x35c8), /* lg-Latn-UG */
+    static_cast<uint16_t>(0x358f), /* li-Latn-NL */
+    static_cast<uint16_t>(0x351f), /* ln-Latn-CD */
+    static_cast<uint16_t>(0x346e), /* lo-Laoo-LA */
+    static_cast<uint16_t>(0x3574), /* lt-Latn-LT */
+    static_cast<uint16_t>(0x351f), /* lu-Latn-CD */
+    static_cast<uint16_t>(0x3576), /* lv-Latn-LV */
+    static_cast<uint16_t>(0x357b), /* mg-Latn-MG */
+    static_cast<uint16_t>(0x357c), /* mh-Latn-MH */
+    static_cast<uint16_t>(0x3594), /* mi-Latn-NZ */
+    static_cast<uint16_t>(0x147d), /* mk-Cyrl-MK */
+    static_cast<uint16_t>(0x415b), /* ml-Mlym-IN */
+    static_cast<uint16_t>(0x1480), /* mn-Cyrl-MN */
+    static_cast<uint16_t>(0x35a2), /* mo-Latn-RO */
+    static_cast<uint16_t>(0x155b), /* mr-Deva-IN */
+    static_cast<uint16_t>(0x3588), /* ms-Latn-MY */
+    static_cast<uint16_t>(0x3583), /* mt-Latn-MT */
+    static_cast<uint16_t>(0x457f), /* my-Mymr-MM */
+    static_cast<uint16_t>(0x3592), /* na-Latn-NR */
+    static_cast<uint16_t>(0x3590), /* nb-Latn-NO */
+    static_cast<uint16_t>(0x35d9), /* nd-Latn-ZW */
+    static_cast<uint16_t>(0x1591), /* ne-Deva-NP */
+    static_cast<uint16_t>(0x358a), /* ng-Latn-NA */
+    static_cast<uint16_t>(0x358f), /* nl-Latn-NL */
+    static_cast<uint16_t>(0x3590), /* nn-Latn-NO */
+    static_cast<uint16_t>(0x3590), /* no-Latn-NO */
+    static_cast<uint16_t>(0x35d7), /* nr-Latn-ZA */
+    static_cast<uint16_t>(0x35c9), /* nv-Latn-US */
+    static_cast<uint16_t>(0x3586), /* ny-Latn-MW */
+    static_cast<uint16_t>(0x3540), /* oc-Latn-FR */
+    static_cast<uint16_t>(0x353a), /* om-Latn-ET */
+    static_cast<uint16_t>(0x4d5b), /* or-Orya-IN */
+    static_cast<uint16_t>(0x1444), /* os-Cyrl-GE */
+    static_cast<uint16_t>(0x205b), /* pa-Guru-IN */
+    static_cast<uint16_t>(0x359b), /* pl-Latn-PL */
+    static_cast<uint16_t>(0x0301), /* ps-Arab-AF */
+    static_cast<uint16_t>(0x3517), /* pt-Latn-BR */
+    static_cast<uint16_t>(0x3596), /* qu-Latn-PE */
+    static_cast<uint16_t>(0x3521), /* rm-Latn-CH */
+    static_cast<uint16_t>(0x3512), /* rn-Latn-BI */
+    static_cast<uint16_t>(0x35a2), /* ro-Latn-RO */
+    static_cast<uint16_t>(0x14a4), /* ru-Cyrl-RU */
+    static_cast<uint16_t>(0x35a5), /* rw-Latn-RW */
+    static_cast<uint16_t>(0x155b), /* sa-Deva-IN */
+    static_cast<uint16_t>(0x3560), /* sc-Latn-IT */
+    static_cast<uint16_t>(0x039a), /* sd-Arab-PK */
+    static_cast<uint16_t>(0x3590), /* se-Latn-NO */
+    static_cast<uint16_t>(0x3520), /* sg-Latn-CF */
+    static_cast<uint16_t>(0x5d71), /* si-Sinh-LK */
+    static_cast<uint16_t>(0x35ae), /* sk-Latn-SK */
+    static_cast<uint16_t>(0x35ad), /* sl-Latn-SI */
+    static_cast<uint16_t>(0x35d3), /* sm-Latn-WS */
+    static_cast<uint16_t>(0x35d9), /* sn-Latn-ZW */
+    static_cast<uint16_t>(0x35b1), /* so-Latn-SO */
+    static_cast<uint16_t>(0x3504), /* sq-Latn-AL */
+    static_cast<uint16_t>(0x14a3), /* sr-Cyrl-RS */
+    static_cast<uint16_t>(0x35d7), /* ss-Latn-ZA */
+    static_cast<uint16_t>(0x35d7), /* st-Latn-ZA */
+    static_cast<uint16_t>(0x3557), /* su-Latn-ID */
+    static_cast<uint16_t>(0x35aa), /* sv-Latn-SE */
+    static_cast<uint16_t>(0x35c6), /* sw-Latn-TZ */
+    static_cast<uint16_t>(0x645b), /* ta-Taml-IN */
+    static_cast<uint16_t>(0x675b), /* te-Telu-IN */
+    static_cast<uint16_t>(0x14bc), /* tg-Cyrl-TJ */
+    static_cast<uint16_t>(0x6abb), /* th-Thai-TH */
+    static_cast<uint16_t>(0x183a), /* ti-Ethi-ET */
+    static_cast<uint16_t>(0x35bf), /* tk-Latn-TM */
+    static_cast<uint16_t>(0x3599), /* tl-Latn-PH */
+    static_cast<uint16_t>(0x35d7), /* tn-Latn-ZA */
+    static_cast<uint16_t>(0x35c1), /* to-Latn-TO */
+    static_cast<uint16_t>(0x35c2), /* tr-Latn-TR */
+    static_cast<uint16_t>(0x35d7), /* ts-Latn-ZA */
+    static_cast<uint16_t>(0x14a4), /* tt-Cyrl-RU */
+    static_cast<uint16_t>(0x3597), /* ty-Latn-PF */
+    static_cast<uint16_t>(0x0326), /* ug-Arab-CN */
+    static_cast<uint16_t>(0x14c7), /* uk-Cyrl-UA */
+    static_cast<uint16_t>(0x039a), /* ur-Arab-PK */
+    static_cast<uint16_t>(0x35cb), /* uz-Latn-UZ */
+    static_cast<uint16_t>(0x35d7), /* ve-Latn-ZA */
+    static_cast<uint16_t>(0x35d0), /* vi-Latn-VN */
+    static_cast<uint16_t>(0x35db), /* vo-Latn-001 */
+    static_cast<uint16_t>(0x350f), /* wa-Latn-BE */
+    static_cast<uint16_t>(0x35b0), /* wo-Latn-SN */
+    static_cast<uint16_t>(0x35d7), /* xh-Latn-ZA */
+    static_cast<uint16_t>(0x25db), /* yi-Hebr-001 */
+    static_cast<uint16_t>(0x358d), /* yo-Latn-NG */
+    static_cast<uint16_t>(0x3526), /* za-Latn-CN */
+    static_cast<uint16_t>(0x2226), /* zh-Hans-CN */
+    static_cast<uint16_t>(0x35d7), /* zu-Latn-ZA */
+    static_cast<uint16_t>(0x35da), /* aai-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* aak-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* aau-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* abi-Latn-ZZ */
+    static_cast<uint16_t>(0x14da), /* abq-Cyrl-ZZ */
+    static_cast<uint16_t>(0x3547), /* abr-Latn-GH */
+    static_cast<uint16_t>(0x35da), /* abt-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* aby-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* acd-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* ace-Latn-ID */
+    static_cast<uint16_t>(0x35c8), /* ach-Latn-UG */
+    static_cast<uint16_t>(0x3547), /* ada-Latn-GH */
+    static_cast<uint16_t>(0x35da), /* ade-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* adj-Latn-ZZ */
+    static_cast<uint16_t>(0x6b19), /* adp-Tibt-BT */
+    static_cast<uint16_t>(0x14a4), /* ady-Cyrl-RU */
+    static_cast<uint16_t>(0x35da), /* adz-Latn-ZZ */
+    static_cast<uint16_t>(0x03c0), /* aeb-Arab-TN */
+    static_cast<uint16_t>(0x35da), /* aey-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* agc-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* agd-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* agg-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* agm-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ago-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* agq-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* aha-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ahl-Latn-ZZ */
+    static_cast<uint16_t>(0x025b), /* aho-Ahom-IN */
+    static_cast<uint16_t>(0x35da), /* ajg-Latn-ZZ */
+    static_cast<uint16_t>(0x705d), /* akk-Xsux-IQ */
+    static_cast<uint16_t>(0x35da), /* ala-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ali-Latn-ZZ */
+    static_cast<uint16_t>(0x35d4), /* aln-Latn-XK */
+    static_cast<uint16_t>(0x14a4), /* alt-Cyrl-RU */
+    static_cast<uint16_t>(0x35da), /* amm-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* amn-Latn-ZZ */
+    static_cast<uint16_t>(0x358d), /* amo-Latn-NG */
+    static_cast<uint16_t>(0x35da), /* amp-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* anc-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ank-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ann-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* any-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* aoj-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* aom-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* aoz-Latn-ID */
+    static_cast<uint16_t>(0x03da), /* apc-Arab-ZZ */
+    static_cast<uint16_t>(0x03ba), /* apd-Arab-TG */
+    static_cast<uint16_t>(0x35da), /* ape-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* apr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* aps-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* apz-Latn-ZZ */
+    static_cast<uint16_t>(0x045e), /* arc-Armi-IR */
+    static_cast<uint16_t>(0x35da), /* arh-Latn-ZZ */
+    static_cast<uint16_t>(0x3524), /* arn-Latn-CL */
+    static_cast<uint16_t>(0x3516), /* aro-Latn-BO */
+    static_cast<uint16_t>(0x0333), /* arq-Arab-DZ */
+    static_cast<uint16_t>(0x03a6), /* ars-Arab-SA */
+    static_cast<uint16_t>(0x0378), /* ary-Arab-MA */
+    static_cast<uint16_t>(0x0336), /* arz-Arab-EG */
+    static_cast<uint16_t>(0x35c6), /* asa-Latn-TZ */
+    static_cast<uint16_t>(0x5ac9), /* ase-Sgnw-US */
+    static_cast<uint16_t>(0x35da), /* asg-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* aso-Latn-ZZ */
+    static_cast<uint16_t>(0x3539), /* ast-Latn-ES */
+    static_cast<uint16_t>(0x35da), /* ata-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* atg-Latn-ZZ */
+    static_cast<uint16_t>(0x351d), /* atj-Latn-CA */
+    static_cast<uint16_t>(0x35da), /* auy-Latn-ZZ */
+    static_cast<uint16_t>(0x03da), /* avl-Arab-ZZ */
+    static_cast<uint16_t>(0x35da), /* avn-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* avt-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* avu-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* awa-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* awb-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* awo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* awx-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ayb-Latn-ZZ */
+    static_cast<uint16_t>(0x039a), /* bal-Arab-PK */
+    static_cast<uint16_t>(0x3557), /* ban-Latn-ID */
+    static_cast<uint16_t>(0x1591), /* bap-Deva-NP */
+    static_cast<uint16_t>(0x3508), /* bar-Latn-AT */
+    static_cast<uint16_t>(0x3525), /* bas-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* bav-Latn-ZZ */
+    static_cast<uint16_t>(0x0725), /* bax-Bamu-CM */
+    static_cast<uint16_t>(0x35da), /* bba-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bbb-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* bbc-Latn-ID */
+    static_cast<uint16_t>(0x35da), /* bbd-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* bbj-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* bbp-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bbr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bcf-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bch-Latn-ZZ */
+    static_cast<uint16_t>(0x3522), /* bci-Latn-CI */
+    static_cast<uint16_t>(0x35da), /* bcm-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bcn-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bco-Latn-ZZ */
+    static_cast<uint16_t>(0x18da), /* bcq-Ethi-ZZ */
+    static_cast<uint16_t>(0x35da), /* bcu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bdd-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bef-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* beh-Latn-ZZ */
+    static_cast<uint16_t>(0x03a9), /* bej-Arab-SD */
+    static_cast<uint16_t>(0x35d8), /* bem-Latn-ZM */
+    static_cast<uint16_t>(0x35da), /* bet-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* bew-Latn-ID */
+    static_cast<uint16_t>(0x35da), /* bex-Latn-ZZ */
+    static_cast<uint16_t>(0x35c6), /* bez-Latn-TZ */
+    static_cast<uint16_t>(0x3525), /* bfd-Latn-CM */
+    static_cast<uint16_t>(0x645b), /* bfq-Taml-IN */
+    static_cast<uint16_t>(0x039a), /* bft-Arab-PK */
+    static_cast<uint16_t>(0x155b), /* bfy-Deva-IN */
+    static_cast<uint16_t>(0x155b), /* bgc-Deva-IN */
+    static_cast<uint16_t>(0x039a), /* bgn-Arab-PK */
+    static_cast<uint16_t>(0x1ec2), /* bgx-Grek-TR */
+    static_cast<uint16_t>(0x155b), /* bhb-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* bhg-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* bhi-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* bhl-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* bho-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* bhy-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bib-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* big-Latn-ZZ */
+    static_cast<uint16_t>(0x3599), /* bik-Latn-PH */
+    static_cast<uint16_t>(0x35da), /* bim-Latn-ZZ */
+    static_cast<uint16_t>(0x358d), /* bin-Latn-NG */
+    static_cast<uint16_t>(0x35da), /* bio-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* biq-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bjh-Latn-ZZ */
+    static_cast<uint16_t>(0x18da), /* bji-Ethi-ZZ */
+    static_cast<uint16_t>(0x155b), /* bjj-Deva-IN */
+    static_cast<uint16_t>(0x3557), /* bjn-Latn-ID */
+    static_cast<uint16_t>(0x35da), /* bjo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bjr-Latn-ZZ */
+    static_cast<uint16_t>(0x35b0), /* bjt-Latn-SN */
+    static_cast<uint16_t>(0x35da), /* bjz-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bkc-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* bkm-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* bkq-Latn-ZZ */
+    static_cast<uint16_t>(0x3599), /* bku-Latn-PH */
+    static_cast<uint16_t>(0x35da), /* bkv-Latn-ZZ */
+    static_cast<uint16_t>(0x66d0), /* blt-Tavt-VN */
+    static_cast<uint16_t>(0x35da), /* bmh-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bmk-Latn-ZZ */
+    static_cast<uint16_t>(0x357e), /* bmq-Latn-ML */
+    static_cast<uint16_t>(0x35da), /* bmu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bng-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bnm-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bnp-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* boj-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bom-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bon-Latn-ZZ */
+    static_cast<uint16_t>(0x095b), /* bpy-Beng-IN */
+    static_cast<uint16_t>(0x35da), /* bqc-Latn-ZZ */
+    static_cast<uint16_t>(0x035e), /* bqi-Arab-IR */
+    static_cast<uint16_t>(0x35da), /* bqp-Latn-ZZ */
+    static_cast<uint16_t>(0x3522), /* bqv-Latn-CI */
+    static_cast<uint16_t>(0x155b), /* bra-Deva-IN */
+    static_cast<uint16_t>(0x039a), /* brh-Arab-PK */
+    static_cast<uint16_t>(0x155b), /* brx-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* brz-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bsj-Latn-ZZ */
+    static_cast<uint16_t>(0x0872), /* bsq-Bass-LR */
+    static_cast<uint16_t>(0x3525), /* bss-Latn-CM */
+    static_cast<uint16_t>(0x18da), /* bst-Ethi-ZZ */
+    static_cast<uint16_t>(0x3599), /* bto-Latn-PH */
+    static_cast<uint16_t>(0x35da), /* btt-Latn-ZZ */
+    static_cast<uint16_t>(0x159a), /* btv-Deva-PK */
+    static_cast<uint16_t>(0x14a4), /* bua-Cyrl-RU */
+    static_cast<uint16_t>(0x35d6), /* buc-Latn-YT */
+    static_cast<uint16_t>(0x35da), /* bud-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* bug-Latn-ID */
+    static_cast<uint16_t>(0x35da), /* buk-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* bum-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* buo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bus-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* buu-Latn-ZZ */
+    static_cast<uint16_t>(0x354c), /* bvb-Latn-GQ */
+    static_cast<uint16_t>(0x35da), /* bwd-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bwr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bxh-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bye-Latn-ZZ */
+    static_cast<uint16_t>(0x1838), /* byn-Ethi-ER */
+    static_cast<uint16_t>(0x35da), /* byr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bys-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* byv-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* byx-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bza-Latn-ZZ */
+    static_cast<uint16_t>(0x357e), /* bze-Latn-ML */
+    static_cast<uint16_t>(0x35da), /* bzf-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bzh-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* bzw-Latn-ZZ */
+    static_cast<uint16_t>(0x35c9), /* cad-Latn-US */
+    static_cast<uint16_t>(0x35da), /* can-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* cbj-Latn-ZZ */
+    static_cast<uint16_t>(0x358d), /* cch-Latn-NG */
+    static_cast<uint16_t>(0x0c0e), /* ccp-Cakm-BD */
+    static_cast<uint16_t>(0x3599), /* ceb-Latn-PH */
+    static_cast<uint16_t>(0x35da), /* cfa-Latn-ZZ */
+    static_cast<uint16_t>(0x35c8), /* cgg-Latn-UG */
+    static_cast<uint16_t>(0x353e), /* chk-Latn-FM */
+    static_cast<uint16_t>(0x14a4), /* chm-Cyrl-RU */
+    static_cast<uint16_t>(0x35c9), /* cho-Latn-US */
+    static_cast<uint16_t>(0x351d), /* chp-Latn-CA */
+    static_cast<uint16_t>(0x10c9), /* chr-Cher-US */
+    static_cast<uint16_t>(0x35c9), /* cic-Latn-US */
+    static_cast<uint16_t>(0x0367), /* cja-Arab-KH */
+    static_cast<uint16_t>(0x0fd0), /* cjm-Cham-VN */
+    static_cast<uint16_t>(0x35da), /* cjv-Latn-ZZ */
+    static_cast<uint16_t>(0x035d), /* ckb-Arab-IQ */
+    static_cast<uint16_t>(0x35da), /* ckl-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* cko-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* cky-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* cla-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* cme-Latn-ZZ */
+    static_cast<uint16_t>(0x6080), /* cmg-Soyo-MN */
+    static_cast<uint16_t>(0x1236), /* cop-Copt-EG */
+    static_cast<uint16_t>(0x3599), /* cps-Latn-PH */
+    static_cast<uint16_t>(0x14c7), /* crh-Cyrl-UA */
+    static_cast<uint16_t>(0x0d1d), /* crj-Cans-CA */
+    static_cast<uint16_t>(0x0d1d), /* crk-Cans-CA */
+    static_cast<uint16_t>(0x0d1d), /* crl-Cans-CA */
+    static_cast<uint16_t>(0x0d1d), /* crm-Cans-CA */
+    static_cast<uint16_t>(0x35a8), /* crs-Latn-SC */
+    static_cast<uint16_t>(0x359b), /* csb-Latn-PL */
+    static_cast<uint16_t>(0x0d1d), /* csw-Cans-CA */
+    static_cast<uint16_t>(0x507f), /* ctd-Pauc-MM */
+    static_cast<uint16_t>(0x35da), /* dad-Latn-ZZ */
+    static_cast<uint16_t>(0x3522), /* daf-Latn-CI */
+    static_cast<uint16_t>(0x35da), /* dag-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* dah-Latn-ZZ */
+    static_cast<uint16_t>(0x35c9), /* dak-Latn-US */
+    static_cast<uint16_t>(0x14a4), /* dar-Cyrl-RU */
+    static_cast<uint16_t>(0x3565), /* dav-Latn-KE */
+    static_cast<uint16_t>(0x35da), /* dbd-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* dbq-Latn-ZZ */
+    static_cast<uint16_t>(0x035b), /* dcc-Arab-IN */
+    static_cast<uint16_t>(0x35da), /* ddn-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ded-Latn-ZZ */
+    static_cast<uint16_t>(0x351d), /* den-Latn-CA */
+    static_cast<uint16_t>(0x35da), /* dga-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* dgh-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* dgi-Latn-ZZ */
+    static_cast<uint16_t>(0x03da), /* dgl-Arab-ZZ */
+    static_cast<uint16_t>(0x351d), /* dgr-Latn-CA */
+    static_cast<uint16_t>(0x35da), /* dgz-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* dia-Latn-ZZ */
+    static_cast<uint16_t>(0x358b), /* dje-Latn-NE */
+    static_cast<uint16_t>(0x3522), /* dnj-Latn-CI */
+    static_cast<uint16_t>(0x35da), /* dob-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* doi-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* dop-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* dow-Latn-ZZ */
+    static_cast<uint16_t>(0x4226), /* drh-Mong-CN */
+    static_cast<uint16_t>(0x35da), /* dri-Latn-ZZ */
+    static_cast<uint16_t>(0x18da), /* drs-Ethi-ZZ */
+    static_cast<uint16_t>(0x352e), /* dsb-Latn-DE */
+    static_cast<uint16_t>(0x357e), /* dtm-Latn-ML */
+    static_cast<uint16_t>(0x3588), /* dtp-Latn-MY */
+    static_cast<uint16_t>(0x35da), /* dts-Latn-ZZ */
+    static_cast<uint16_t>(0x1591), /* dty-Deva-NP */
+    static_cast<uint16_t>(0x3525), /* dua-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* duc-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* dud-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* dug-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* dva-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* dww-Latn-ZZ */
+    static_cast<uint16_t>(0x35b0), /* dyo-Latn-SN */
+    static_cast<uint16_t>(0x3510), /* dyu-Latn-BF */
+    static_cast<uint16_t>(0x35da), /* dzg-Latn-ZZ */
+    static_cast<uint16_t>(0x3565), /* ebu-Latn-KE */
+    static_cast<uint16_t>(0x358d), /* efi-Latn-NG */
+    static_cast<uint16_t>(0x3560), /* egl-Latn-IT */
+    static_cast<uint16_t>(0x1736), /* egy-Egyp-EG */
+    static_cast<uint16_t>(0x35da), /* eka-Latn-ZZ */
+    static_cast<uint16_t>(0x2b7f), /* eky-Kali-MM */
+    static_cast<uint16_t>(0x35da), /* ema-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* emi-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* enn-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* enq-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* eri-Latn-ZZ */
+    static_cast<uint16_t>(0x1c5b), /* esg-Gonm-IN */
+    static_cast<uint16_t>(0x35c9), /* esu-Latn-US */
+    static_cast<uint16_t>(0x35da), /* etr-Latn-ZZ */
+    static_cast<uint16_t>(0x2960), /* ett-Ital-IT */
+    static_cast<uint16_t>(0x35da), /* etu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* etx-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* ewo-Latn-CM */
+    static_cast<uint16_t>(0x3539), /* ext-Latn-ES */
+    static_cast<uint16_t>(0x35da), /* eza-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* faa-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* fab-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* fag-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* fai-Latn-ZZ */
+    static_cast<uint16_t>(0x354c), /* fan-Latn-GQ */
+    static_cast<uint16_t>(0x35da), /* ffi-Latn-ZZ */
+    static_cast<uint16_t>(0x357e), /* ffm-Latn-ML */
+    static_cast<uint16_t>(0x03a9), /* fia-Arab-SD */
+    static_cast<uint16_t>(0x3599), /* fil-Latn-PH */
+    static_cast<uint16_t>(0x35aa), /* fit-Latn-SE */
+    static_cast<uint16_t>(0x35da), /* flr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* fmp-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* fod-Latn-ZZ */
+    static_cast<uint16_t>(0x3513), /* fon-Latn-BJ */
+    static_cast<uint16_t>(0x35da), /* for-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* fpe-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* fqs-Latn-ZZ */
+    static_cast<uint16_t>(0x35c9), /* frc-Latn-US */
+    static_cast<uint16_t>(0x3540), /* frp-Latn-FR */
+    static_cast<uint16_t>(0x352e), /* frr-Latn-DE */
+    static_cast<uint16_t>(0x352e), /* frs-Latn-DE */
+    static_cast<uint16_t>(0x0325), /* fub-Arab-CM */
+    static_cast<uint16_t>(0x35d2), /* fud-Latn-WF */
+    static_cast<uint16_t>(0x35da), /* fue-Latn-ZZ */
+    static_cast<uint16_t>(0x354b), /* fuf-Latn-GN */
+    static_cast<uint16_t>(0x35da), /* fuh-Latn-ZZ */
+    static_cast<uint16_t>(0x358b), /* fuq-Latn-NE */
+    static_cast<uint16_t>(0x3560), /* fur-Latn-IT */
+    static_cast<uint16_t>(0x358d), /* fuv-Latn-NG */
+    static_cast<uint16_t>(0x35da), /* fuy-Latn-ZZ */
+    static_cast<uint16_t>(0x35a9), /* fvr-Latn-SD */
+    static_cast<uint16_t>(0x3547), /* gaa-Latn-GH */
+    static_cast<uint16_t>(0x35da), /* gaf-Latn-ZZ */
+    static_cast<uint16_t>(0x3579), /* gag-Latn-MD */
+    static_cast<uint16_t>(0x35da), /* gah-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* gaj-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* gam-Latn-ZZ */
+    static_cast<uint16_t>(0x2226), /* gan-Hans-CN */
+    static_cast<uint16_t>(0x35da), /* gaw-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* gay-Latn-ID */
+    static_cast<uint16_t>(0x35da), /* gba-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* gbf-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* gbm-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* gby-Latn-ZZ */
+    static_cast<uint16_t>(0x035e), /* gbz-Arab-IR */
+    static_cast<uint16_t>(0x3545), /* gcr-Latn-GF */
+    static_cast<uint16_t>(0x35da), /* gde-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* gdn-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* gdr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* geb-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* gej-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* gel-Latn-ZZ */
+    static_cast<uint16_t>(0x183a), /* gez-Ethi-ET */
+    static_cast<uint16_t>(0x35da), /* gfk-Latn-ZZ */
+    static_cast<uint16_t>(0x1591), /* ggn-Deva-NP */
+    static_cast<uint16_t>(0x35da), /* ghs-Latn-ZZ */
+    static_cast<uint16_t>(0x3568), /* gil-Latn-KI */
+    static_cast<uint16_t>(0x35da), /* gim-Latn-ZZ */
+    static_cast<uint16_t>(0x039a), /* gjk-Arab-PK */
+    static_cast<uint16_t>(0x35da), /* gjn-Latn-ZZ */
+    static_cast<uint16_t>(0x039a), /* gju-Arab-PK */
+    static_cast<uint16_t>(0x35da), /* gkn-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* gkp-Latn-ZZ */
+    static_cast<uint16_t>(0x035e), /* glk-Arab-IR */
+    static_cast<uint16_t>(0x35da), /* gmm-Latn-ZZ */
+    static_cast<uint16_t>(0x18da), /* gmv-Ethi-ZZ */
+    static_cast<uint16_t>(0x35da), /* gnd-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* gng-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* god-Latn-ZZ */
+    static_cast<uint16_t>(0x18da), /* gof-Ethi-ZZ */
+    static_cast<uint16_t>(0x35da), /* goi-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* gom-Deva-IN */
+    static_cast<uint16_t>(0x675b), /* gon-Telu-IN */
+    static_cast<uint16_t>(0x3557), /* gor-Latn-ID */
+    static_cast<uint16_t>(0x358f), /* gos-Latn-NL */
+    static_cast<uint16_t>(0x1dc7), /* got-Goth-UA */
+    static_cast<uint16_t>(0x35da), /* grb-Latn-ZZ */
+    static_cast<uint16_t>(0x132c), /* grc-Cprt-CY */
+    static_cast<uint16_t>(0x095b), /* grt-Beng-IN */
+    static_cast<uint16_t>(0x35da), /* grw-Latn-ZZ */
+    static_cast<uint16_t>(0x3521), /* gsw-Latn-CH */
+    static_cast<uint16_t>(0x3517), /* gub-Latn-BR */
+    static_cast<uint16_t>(0x3527), /* guc-Latn-CO */
+    static_cast<uint16_t>(0x35da), /* gud-Latn-ZZ */
+    static_cast<uint16_t>(0x3547), /* gur-Latn-GH */
+    static_cast<uint16_t>(0x35da), /* guw-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* gux-Latn-ZZ */
+    static_cast<uint16_t>(0x3565), /* guz-Latn-KE */
+    static_cast<uint16_t>(0x35da), /* gvf-Latn-ZZ */
+    static_cast<uint16_t>(0x1591), /* gvr-Deva-NP */
+    static_cast<uint16_t>(0x35da), /* gvs-Latn-ZZ */
+    static_cast<uint16_t>(0x03da), /* gwc-Arab-ZZ */
+    static_cast<uint16_t>(0x351d), /* gwi-Latn-CA */
+    static_cast<uint16_t>(0x03da), /* gwt-Arab-ZZ */
+    static_cast<uint16_t>(0x35da), /* gyi-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* hag-Latn-ZZ */
+    static_cast<uint16_t>(0x2226), /* hak-Hans-CN */
+    static_cast<uint16_t>(0x35da), /* ham-Latn-ZZ */
+    static_cast<uint16_t>(0x35c9), /* haw-Latn-US */
+    static_cast<uint16_t>(0x0301), /* haz-Arab-AF */
+    static_cast<uint16_t>(0x35da), /* hbb-Latn-ZZ */
+    static_cast<uint16_t>(0x18da), /* hdy-Ethi-ZZ */
+    static_cast<uint16_t>(0x35da), /* hhy-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* hia-Latn-ZZ */
+    static_cast<uint16_t>(0x353c), /* hif-Latn-FJ */
+    static_cast<uint16_t>(0x35da), /* hig-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* hih-Latn-ZZ */
+    static_cast<uint16_t>(0x3599), /* hil-Latn-PH */
+    static_cast<uint16_t>(0x35da), /* hla-Latn-ZZ */
+    static_cast<uint16_t>(0x26c2), /* hlu-Hluw-TR */
+    static_cast<uint16_t>(0x5426), /* hmd-Plrd-CN */
+    static_cast<uint16_t>(0x35da), /* hmt-Latn-ZZ */
+    static_cast<uint16_t>(0x039a), /* hnd-Arab-PK */
+    static_cast<uint16_t>(0x155b), /* hne-Deva-IN */
+    static_cast<uint16_t>(0x276e), /* hnj-Hmng-LA */
+    static_cast<uint16_t>(0x3599), /* hnn-Latn-PH */
+    static_cast<uint16_t>(0x039a), /* hno-Arab-PK */
+    static_cast<uint16_t>(0x155b), /* hoc-Deva-IN */
+    static_cast<uint16_t>(0x155b), /* hoj-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* hot-Latn-ZZ */
+    static_cast<uint16_t>(0x352e), /* hsb-Latn-DE */
+    static_cast<uint16_t>(0x2226), /* hsn-Hans-CN */
+    static_cast<uint16_t>(0x35da), /* hui-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ian-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* iar-Latn-ZZ */
+    static_cast<uint16_t>(0x3588), /* iba-Latn-MY */
+    static_cast<uint16_t>(0x358d), /* ibb-Latn-NG */
+    static_cast<uint16_t>(0x35da), /* iby-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ica-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ich-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* idd-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* idi-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* idu-Latn-ZZ */
+    static_cast<uint16_t>(0x35ba), /* ife-Latn-TG */
+    static_cast<uint16_t>(0x35da), /* igb-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ige-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ijj-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ikk-Latn-ZZ */
+    static_cast<uint16_t>(0x351d), /* ikt-Latn-CA */
+    static_cast<uint16_t>(0x35da), /* ikw-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ikx-Latn-ZZ */
+    static_cast<uint16_t>(0x3599), /* ilo-Latn-PH */
+    static_cast<uint16_t>(0x35da), /* imo-Latn-ZZ */
+    static_cast<uint16_t>(0x14a4), /* inh-Cyrl-RU */
+    static_cast<uint16_t>(0x35da), /* iou-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* iri-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* iwm-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* iws-Latn-ZZ */
+    static_cast<uint16_t>(0x35a4), /* izh-Latn-RU */
+    static_cast<uint16_t>(0x35da), /* izi-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* jab-Latn-ZZ */
+    static_cast<uint16_t>(0x3562), /* jam-Latn-JM */
+    static_cast<uint16_t>(0x35da), /* jar-Latn-ZZ */
+    static_cast<uint16_t>(0x35db), /* jbo-Latn-001 */
+    static_cast<uint16_t>(0x35da), /* jbu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* jen-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* jgk-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* jgo-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* jib-Latn-ZZ */
+    static_cast<uint16_t>(0x35c6), /* jmc-Latn-TZ */
+    static_cast<uint16_t>(0x1591), /* jml-Deva-NP */
+    static_cast<uint16_t>(0x35da), /* jra-Latn-ZZ */
+    static_cast<uint16_t>(0x3530), /* jut-Latn-DK */
+    static_cast<uint16_t>(0x14cb), /* kaa-Cyrl-UZ */
+    static_cast<uint16_t>(0x3533), /* kab-Latn-DZ */
+    static_cast<uint16_t>(0x357f), /* kac-Latn-MM */
+    static_cast<uint16_t>(0x35da), /* kad-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kai-Latn-ZZ */
+    static_cast<uint16_t>(0x358d), /* kaj-Latn-NG */
+    static_cast<uint16_t>(0x3565), /* kam-Latn-KE */
+    static_cast<uint16_t>(0x357e), /* kao-Latn-ML */
+    static_cast<uint16_t>(0x14a4), /* kbd-Cyrl-RU */
+    static_cast<uint16_t>(0x35da), /* kbm-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kbp-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kbq-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kbx-Latn-ZZ */
+    static_cast<uint16_t>(0x038b), /* kby-Arab-NE */
+    static_cast<uint16_t>(0x358d), /* kcg-Latn-NG */
+    static_cast<uint16_t>(0x35d9), /* kck-Latn-ZW */
+    static_cast<uint16_t>(0x35da), /* kcl-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kct-Latn-ZZ */
+    static_cast<uint16_t>(0x35c6), /* kde-Latn-TZ */
+    static_cast<uint16_t>(0x03ba), /* kdh-Arab-TG */
+    static_cast<uint16_t>(0x35da), /* kdl-Latn-ZZ */
+    static_cast<uint16_t>(0x6abb), /* kdt-Thai-TH */
+    static_cast<uint16_t>(0x352a), /* kea-Latn-CV */
+    static_cast<uint16_t>(0x3525), /* ken-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* kez-Latn-ZZ */
+    static_cast<uint16_t>(0x3522), /* kfo-Latn-CI */
+    static_cast<uint16_t>(0x155b), /* kfr-Deva-IN */
+    static_cast<uint16_t>(0x155b), /* kfy-Deva-IN */
+    static_cast<uint16_t>(0x3557), /* kge-Latn-ID */
+    static_cast<uint16_t>(0x35da), /* kgf-Latn-ZZ */
+    static_cast<uint16_t>(0x3517), /* kgp-Latn-BR */
+    static_cast<uint16_t>(0x355b), /* kha-Latn-IN */
+    static_cast<uint16_t>(0x6326), /* khb-Talu-CN */
+    static_cast<uint16_t>(0x155b), /* khn-Deva-IN */
+    static_cast<uint16_t>(0x357e), /* khq-Latn-ML */
+    static_cast<uint16_t>(0x35da), /* khs-Latn-ZZ */
+    static_cast<uint16_t>(0x455b), /* kht-Mymr-IN */
+    static_cast<uint16_t>(0x039a), /* khw-Arab-PK */
+    static_cast<uint16_t>(0x35da), /* khz-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kij-Latn-ZZ */
+    static_cast<uint16_t>(0x35c2), /* kiu-Latn-TR */
+    static_cast<uint16_t>(0x35da), /* kiw-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kjd-Latn-ZZ */
+    static_cast<uint16_t>(0x346e), /* kjg-Laoo-LA */
+    static_cast<uint16_t>(0x35da), /* kjs-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kjy-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kkc-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* kkj-Latn-CM */
+    static_cast<uint16_t>(0x3565), /* kln-Latn-KE */
+    static_cast<uint16_t>(0x35da), /* klq-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* klt-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* klx-Latn-ZZ */
+    static_cast<uint16_t>(0x3506), /* kmb-Latn-AO */
+    static_cast<uint16_t>(0x35da), /* kmh-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kmo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kms-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kmu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kmw-Latn-ZZ */
+    static_cast<uint16_t>(0x3550), /* knf-Latn-GW */
+    static_cast<uint16_t>(0x35da), /* knp-Latn-ZZ */
+    static_cast<uint16_t>(0x14a4), /* koi-Cyrl-RU */
+    static_cast<uint16_t>(0x155b), /* kok-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* kol-Latn-ZZ */
+    static_cast<uint16_t>(0x353e), /* kos-Latn-FM */
+    static_cast<uint16_t>(0x35da), /* koz-Latn-ZZ */
+    static_cast<uint16_t>(0x3572), /* kpe-Latn-LR */
+    static_cast<uint16_t>(0x35da), /* kpf-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kpo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kpr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kpx-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kqb-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kqf-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kqs-Latn-ZZ */
+    static_cast<uint16_t>(0x18da), /* kqy-Ethi-ZZ */
+    static_cast<uint16_t>(0x14a4), /* krc-Cyrl-RU */
+    static_cast<uint16_t>(0x35af), /* kri-Latn-SL */
+    static_cast<uint16_t>(0x3599), /* krj-Latn-PH */
+    static_cast<uint16_t>(0x35a4), /* krl-Latn-RU */
+    static_cast<uint16_t>(0x35da), /* krs-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* kru-Deva-IN */
+    static_cast<uint16_t>(0x35c6), /* ksb-Latn-TZ */
+    static_cast<uint16_t>(0x35da), /* ksd-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* ksf-Latn-CM */
+    static_cast<uint16_t>(0x352e), /* ksh-Latn-DE */
+    static_cast<uint16_t>(0x35da), /* ksj-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ksr-Latn-ZZ */
+    static_cast<uint16_t>(0x18da), /* ktb-Ethi-ZZ */
+    static_cast<uint16_t>(0x35da), /* ktm-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kto-Latn-ZZ */
+    static_cast<uint16_t>(0x3588), /* ktr-Latn-MY */
+    static_cast<uint16_t>(0x35da), /* kub-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kud-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kue-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kuj-Latn-ZZ */
+    static_cast<uint16_t>(0x14a4), /* kum-Cyrl-RU */
+    static_cast<uint16_t>(0x35da), /* kun-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kup-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kus-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kvg-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* kvr-Latn-ID */
+    static_cast<uint16_t>(0x039a), /* kvx-Arab-PK */
+    static_cast<uint16_t>(0x35da), /* kwj-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kwo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kwq-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kxa-Latn-ZZ */
+    static_cast<uint16_t>(0x18da), /* kxc-Ethi-ZZ */
+    static_cast<uint16_t>(0x35da), /* kxe-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* kxl-Deva-IN */
+    static_cast<uint16_t>(0x6abb), /* kxm-Thai-TH */
+    static_cast<uint16_t>(0x039a), /* kxp-Arab-PK */
+    static_cast<uint16_t>(0x35da), /* kxw-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kxz-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kye-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* kyx-Latn-ZZ */
+    static_cast<uint16_t>(0x03da), /* kzh-Arab-ZZ */
+    static_cast<uint16_t>(0x3588), /* kzj-Latn-MY */
+    static_cast<uint16_t>(0x35da), /* kzr-Latn-ZZ */
+    static_cast<uint16_t>(0x3588), /* kzt-Latn-MY */
+    static_cast<uint16_t>(0x384d), /* lab-Lina-GR */
+    static_cast<uint16_t>(0x2559), /* lad-Hebr-IL */
+    static_cast<uint16_t>(0x35c6), /* lag-Latn-TZ */
+    static_cast<uint16_t>(0x039a), /* lah-Arab-PK */
+    static_cast<uint16_t>(0x35c8), /* laj-Latn-UG */
+    static_cast<uint16_t>(0x35da), /* las-Latn-ZZ */
+    static_cast<uint16_t>(0x14a4), /* lbe-Cyrl-RU */
+    static_cast<uint16_t>(0x35da), /* lbu-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* lbw-Latn-ID */
+    static_cast<uint16_t>(0x35da), /* lcm-Latn-ZZ */
+    static_cast<uint16_t>(0x6a26), /* lcp-Thai-CN */
+    static_cast<uint16_t>(0x35da), /* ldb-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* led-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* lee-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* lem-Latn-ZZ */
+    static_cast<uint16_t>(0x365b), /* lep-Lepc-IN */
+    static_cast<uint16_t>(0x35da), /* leq-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* leu-Latn-ZZ */
+    static_cast<uint16_t>(0x14a4), /* lez-Cyrl-RU */
+    static_cast<uint16_t>(0x35da), /* lgg-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* lia-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* lid-Latn-ZZ */
+    static_cast<uint16_t>(0x1591), /* lif-Deva-NP */
+    static_cast<uint16_t>(0x35da), /* lig-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* lih-Latn-ZZ */
+    static_cast<uint16_t>(0x3560), /* lij-Latn-IT */
+    static_cast<uint16_t>(0x3a26), /* lis-Lisu-CN */
+    static_cast<uint16_t>(0x3557), /* ljp-Latn-ID */
+    static_cast<uint16_t>(0x035e), /* lki-Arab-IR */
+    static_cast<uint16_t>(0x35c9), /* lkt-Latn-US */
+    static_cast<uint16_t>(0x35da), /* lle-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* lln-Latn-ZZ */
+    static_cast<uint16_t>(0x675b), /* lmn-Telu-IN */
+    static_cast<uint16_t>(0x3560), /* lmo-Latn-IT */
+    static_cast<uint16_t>(0x35da), /* lmp-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* lns-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* lnu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* loj-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* lok-Latn-ZZ */
+    static_cast<uint16_t>(0x351f), /* lol-Latn-CD */
+    static_cast<uint16_t>(0x35da), /* lor-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* los-Latn-ZZ */
+    static_cast<uint16_t>(0x35d8), /* loz-Latn-ZM */
+    static_cast<uint16_t>(0x035e), /* lrc-Arab-IR */
+    static_cast<uint16_t>(0x3576), /* ltg-Latn-LV */
+    static_cast<uint16_t>(0x351f), /* lua-Latn-CD */
+    static_cast<uint16_t>(0x3565), /* luo-Latn-KE */
+    static_cast<uint16_t>(0x3565), /* luy-Latn-KE */
+    static_cast<uint16_t>(0x035e), /* luz-Arab-IR */
+    static_cast<uint16_t>(0x6abb), /* lwl-Thai-TH */
+    static_cast<uint16_t>(0x2226), /* lzh-Hans-CN */
+    static_cast<uint16_t>(0x35c2), /* lzz-Latn-TR */
+    static_cast<uint16_t>(0x3557), /* mad-Latn-ID */
+    static_cast<uint16_t>(0x3525), /* maf-Latn-CM */
+    static_cast<uint16_t>(0x155b), /* mag-Deva-IN */
+    static_cast<uint16_t>(0x155b), /* mai-Deva-IN */
+    static_cast<uint16_t>(0x3557), /* mak-Latn-ID */
+    static_cast<uint16_t>(0x354a), /* man-Latn-GM */
+    static_cast<uint16_t>(0x3565), /* mas-Latn-KE */
+    static_cast<uint16_t>(0x35da), /* maw-Latn-ZZ */
+    static_cast<uint16_t>(0x3587), /* maz-Latn-MX */
+    static_cast<uint16_t>(0x35da), /* mbh-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mbo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mbq-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mbu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mbw-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mci-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mcp-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mcq-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mcr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mcu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mda-Latn-ZZ */
+    static_cast<uint16_t>(0x03da), /* mde-Arab-ZZ */
+    static_cast<uint16_t>(0x14a4), /* mdf-Cyrl-RU */
+    static_cast<uint16_t>(0x3599), /* mdh-Latn-PH */
+    static_cast<uint16_t>(0x35da), /* mdj-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* mdr-Latn-ID */
+    static_cast<uint16_t>(0x18da), /* mdx-Ethi-ZZ */
+    static_cast<uint16_t>(0x35da), /* med-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mee-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mek-Latn-ZZ */
+    static_cast<uint16_t>(0x35af), /* men-Latn-SL */
+    static_cast<uint16_t>(0x3565), /* mer-Latn-KE */
+    static_cast<uint16_t>(0x35da), /* met-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* meu-Latn-ZZ */
+    static_cast<uint16_t>(0x03bb), /* mfa-Arab-TH */
+    static_cast<uint16_t>(0x3584), /* mfe-Latn-MU */
+    static_cast<uint16_t>(0x35da), /* mfn-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mfo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mfq-Latn-ZZ */
+    static_cast<uint16_t>(0x3589), /* mgh-Latn-MZ */
+    static_cast<uint16_t>(0x35da), /* mgl-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* mgo-Latn-CM */
+    static_cast<uint16_t>(0x1591), /* mgp-Deva-NP */
+    static_cast<uint16_t>(0x35c6), /* mgy-Latn-TZ */
+    static_cast<uint16_t>(0x35da), /* mhi-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mhl-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mif-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* min-Latn-ID */
+    static_cast<uint16_t>(0x245d), /* mis-Hatr-IQ */
+    static_cast<uint16_t>(0x35da), /* miw-Latn-ZZ */
+    static_cast<uint16_t>(0x03da), /* mki-Arab-ZZ */
+    static_cast<uint16_t>(0x35da), /* mkl-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mkp-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mkw-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mle-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mlp-Latn-ZZ */
+    static_cast<uint16_t>(0x35a9), /* mls-Latn-SD */
+    static_cast<uint16_t>(0x35da), /* mmo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mmu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mmx-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mna-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mnf-Latn-ZZ */
+    static_cast<uint16_t>(0x095b), /* mni-Beng-IN */
+    static_cast<uint16_t>(0x457f), /* mnw-Mymr-MM */
+    static_cast<uint16_t>(0x35da), /* moa-Latn-ZZ */
+    static_cast<uint16_t>(0x351d), /* moe-Latn-CA */
+    static_cast<uint16_t>(0x351d), /* moh-Latn-CA */
+    static_cast<uint16_t>(0x3510), /* mos-Latn-BF */
+    static_cast<uint16_t>(0x35da), /* mox-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mpp-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mps-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mpt-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mpx-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mql-Latn-ZZ */
+    static_cast<uint16_t>(0x1591), /* mrd-Deva-NP */
+    static_cast<uint16_t>(0x14a4), /* mrj-Cyrl-RU */
+    static_cast<uint16_t>(0x430e), /* mro-Mroo-BD */
+    static_cast<uint16_t>(0x35da), /* mtc-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mtf-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mti-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* mtr-Deva-IN */
+    static_cast<uint16_t>(0x3525), /* mua-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* mur-Latn-ZZ */
+    static_cast<uint16_t>(0x35c9), /* mus-Latn-US */
+    static_cast<uint16_t>(0x35da), /* mva-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mvn-Latn-ZZ */
+    static_cast<uint16_t>(0x039a), /* mvy-Arab-PK */
+    static_cast<uint16_t>(0x357e), /* mwk-Latn-ML */
+    static_cast<uint16_t>(0x155b), /* mwr-Deva-IN */
+    static_cast<uint16_t>(0x3557), /* mwv-Latn-ID */
+    static_cast<uint16_t>(0x28c9), /* mww-Hmnp-US */
+    static_cast<uint16_t>(0x35d9), /* mxc-Latn-ZW */
+    static_cast<uint16_t>(0x35da), /* mxm-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* myk-Latn-ZZ */
+    static_cast<uint16_t>(0x18da), /* mym-Ethi-ZZ */
+    static_cast<uint16_t>(0x14a4), /* myv-Cyrl-RU */
+    static_cast<uint16_t>(0x35da), /* myw-Latn-ZZ */
+    static_cast<uint16_t>(0x35c8), /* myx-Latn-UG */
+    static_cast<uint16_t>(0x3d5e), /* myz-Mand-IR */
+    static_cast<uint16_t>(0x35da), /* mzk-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mzm-Latn-ZZ */
+    static_cast<uint16_t>(0x035e), /* mzn-Arab-IR */
+    static_cast<uint16_t>(0x35da), /* mzp-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mzw-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* mzz-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nac-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* naf-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nak-Latn-ZZ */
+    static_cast<uint16_t>(0x2226), /* nan-Hans-CN */
+    static_cast<uint16_t>(0x3560), /* nap-Latn-IT */
+    static_cast<uint16_t>(0x358a), /* naq-Latn-NA */
+    static_cast<uint16_t>(0x35da), /* nas-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nca-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nce-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ncf-Latn-ZZ */
+    static_cast<uint16_t>(0x3587), /* nch-Latn-MX */
+    static_cast<uint16_t>(0x35da), /* nco-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ncu-Latn-ZZ */
+    static_cast<uint16_t>(0x3589), /* ndc-Latn-MZ */
+    static_cast<uint16_t>(0x352e), /* nds-Latn-DE */
+    static_cast<uint16_t>(0x35da), /* neb-Latn-ZZ */
+    static_cast<uint16_t>(0x1591), /* new-Deva-NP */
+    static_cast<uint16_t>(0x35da), /* nex-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nfr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nga-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ngb-Latn-ZZ */
+    static_cast<uint16_t>(0x3589), /* ngl-Latn-MZ */
+    static_cast<uint16_t>(0x35da), /* nhb-Latn-ZZ */
+    static_cast<uint16_t>(0x3587), /* nhe-Latn-MX */
+    static_cast<uint16_t>(0x3587), /* nhw-Latn-MX */
+    static_cast<uint16_t>(0x35da), /* nif-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nii-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* nij-Latn-ID */
+    static_cast<uint16_t>(0x35da), /* nin-Latn-ZZ */
+    static_cast<uint16_t>(0x3593), /* niu-Latn-NU */
+    static_cast<uint16_t>(0x35da), /* niy-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* niz-Latn-ZZ */
+    static_cast<uint16_t>(0x355b), /* njo-Latn-IN */
+    static_cast<uint16_t>(0x35da), /* nkg-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nko-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* nmg-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* nmz-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nnf-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* nnh-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* nnk-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nnm-Latn-ZZ */
+    static_cast<uint16_t>(0x6e5b), /* nnp-Wcho-IN */
+    static_cast<uint16_t>(0x33bb), /* nod-Lana-TH */
+    static_cast<uint16_t>(0x155b), /* noe-Deva-IN */
+    static_cast<uint16_t>(0x56aa), /* non-Runr-SE */
+    static_cast<uint16_t>(0x35da), /* nop-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nou-Latn-ZZ */
+    static_cast<uint16_t>(0x484b), /* nqo-Nkoo-GN */
+    static_cast<uint16_t>(0x35da), /* nrb-Latn-ZZ */
+    static_cast<uint16_t>(0x0d1d), /* nsk-Cans-CA */
+    static_cast<uint16_t>(0x35da), /* nsn-Latn-ZZ */
+    static_cast<uint16_t>(0x35d7), /* nso-Latn-ZA */
+    static_cast<uint16_t>(0x35da), /* nss-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ntm-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ntr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nui-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nup-Latn-ZZ */
+    static_cast<uint16_t>(0x35b3), /* nus-Latn-SS */
+    static_cast<uint16_t>(0x35da), /* nuv-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nux-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* nwb-Latn-ZZ */
+    static_cast<uint16_t>(0x3526), /* nxq-Latn-CN */
+    static_cast<uint16_t>(0x35da), /* nxr-Latn-ZZ */
+    static_cast<uint16_t>(0x35c6), /* nym-Latn-TZ */
+    static_cast<uint16_t>(0x35c8), /* nyn-Latn-UG */
+    static_cast<uint16_t>(0x3547), /* nzi-Latn-GH */
+    static_cast<uint16_t>(0x35da), /* ogc-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* okr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* okv-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ong-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* onn-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ons-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* opm-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* oro-Latn-ZZ */
+    static_cast<uint16_t>(0x03da), /* oru-Arab-ZZ */
+    static_cast<uint16_t>(0x4ec9), /* osa-Osge-US */
+    static_cast<uint16_t>(0x03da), /* ota-Arab-ZZ */
+    static_cast<uint16_t>(0x4c80), /* otk-Orkh-MN */
+    static_cast<uint16_t>(0x35da), /* ozm-Latn-ZZ */
+    static_cast<uint16_t>(0x3599), /* pag-Latn-PH */
+    static_cast<uint16_t>(0x515e), /* pal-Phli-IR */
+    static_cast<uint16_t>(0x3599), /* pam-Latn-PH */
+    static_cast<uint16_t>(0x350a), /* pap-Latn-AW */
+    static_cast<uint16_t>(0x359f), /* pau-Latn-PW */
+    static_cast<uint16_t>(0x35da), /* pbi-Latn-ZZ */
+    static_cast<uint16_t>(0x3540), /* pcd-Latn-FR */
+    static_cast<uint16_t>(0x358d), /* pcm-Latn-NG */
+    static_cast<uint16_t>(0x35c9), /* pdc-Latn-US */
+    static_cast<uint16_t>(0x351d), /* pdt-Latn-CA */
+    static_cast<uint16_t>(0x35da), /* ped-Latn-ZZ */
+    static_cast<uint16_t>(0x6f5e), /* peo-Xpeo-IR */
+    static_cast<uint16_t>(0x35da), /* pex-Latn-ZZ */
+    static_cast<uint16_t>(0x352e), /* pfl-Latn-DE */
+    static_cast<uint16_t>(0x03da), /* phl-Arab-ZZ */
+    static_cast<uint16_t>(0x536f), /* phn-Phnx-LB */
+    static_cast<uint16_t>(0x35da), /* pil-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* pip-Latn-ZZ */
+    static_cast<uint16_t>(0x0b5b), /* pka-Brah-IN */
+    static_cast<uint16_t>(0x3565), /* pko-Latn-KE */
+    static_cast<uint16_t>(0x35da), /* pla-Latn-ZZ */
+    static_cast<uint16_t>(0x3560), /* pms-Latn-IT */
+    static_cast<uint16_t>(0x35da), /* png-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* pnn-Latn-ZZ */
+    static_cast<uint16_t>(0x1e4d), /* pnt-Grek-GR */
+    static_cast<uint16_t>(0x353e), /* pon-Latn-FM */
+    static_cast<uint16_t>(0x155b), /* ppa-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* ppo-Latn-ZZ */
+    static_cast<uint16_t>(0x2d9a), /* pra-Khar-PK */
+    static_cast<uint16_t>(0x035e), /* prd-Arab-IR */
+    static_cast<uint16_t>(0x35db), /* prg-Latn-001 */
+    static_cast<uint16_t>(0x35da), /* pss-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ptp-Latn-ZZ */
+    static_cast<uint16_t>(0x3541), /* puu-Latn-GA */
+    static_cast<uint16_t>(0x35da), /* pwa-Latn-ZZ */
+    static_cast<uint16_t>(0x354e), /* quc-Latn-GT */
+    static_cast<uint16_t>(0x3534), /* qug-Latn-EC */
+    static_cast<uint16_t>(0x35da), /* rai-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* raj-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* rao-Latn-ZZ */
+    static_cast<uint16_t>(0x35a1), /* rcf-Latn-RE */
+    static_cast<uint16_t>(0x3557), /* rej-Latn-ID */
+    static_cast<uint16_t>(0x35da), /* rel-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* res-Latn-ZZ */
+    static_cast<uint16_t>(0x3560), /* rgn-Latn-IT */
+    static_cast<uint16_t>(0x037f), /* rhg-Arab-MM */
+    static_cast<uint16_t>(0x355b), /* ria-Latn-IN */
+    static_cast<uint16_t>(0x6878), /* rif-Tfng-MA */
+    static_cast<uint16_t>(0x1591), /* rjs-Deva-NP */
+    static_cast<uint16_t>(0x090e), /* rkt-Beng-BD */
+    static_cast<uint16_t>(0x353b), /* rmf-Latn-FI */
+    static_cast<uint16_t>(0x3521), /* rmo-Latn-CH */
+    static_cast<uint16_t>(0x035e), /* rmt-Arab-IR */
+    static_cast<uint16_t>(0x35aa), /* rmu-Latn-SE */
+    static_cast<uint16_t>(0x35da), /* rna-Latn-ZZ */
+    static_cast<uint16_t>(0x3589), /* rng-Latn-MZ */
+    static_cast<uint16_t>(0x3557), /* rob-Latn-ID */
+    static_cast<uint16_t>(0x35c6), /* rof-Latn-TZ */
+    static_cast<uint16_t>(0x35da), /* roo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* rro-Latn-ZZ */
+    static_cast<uint16_t>(0x353c), /* rtm-Latn-FJ */
+    static_cast<uint16_t>(0x14c7), /* rue-Cyrl-UA */
+    static_cast<uint16_t>(0x35a7), /* rug-Latn-SB */
+    static_cast<uint16_t>(0x35c6), /* rwk-Latn-TZ */
+    static_cast<uint16_t>(0x35da), /* rwo-Latn-ZZ */
+    static_cast<uint16_t>(0x2c64), /* ryu-Kana-JP */
+    static_cast<uint16_t>(0x3547), /* saf-Latn-GH */
+    static_cast<uint16_t>(0x14a4), /* sah-Cyrl-RU */
+    static_cast<uint16_t>(0x3565), /* saq-Latn-KE */
+    static_cast<uint16_t>(0x3557), /* sas-Latn-ID */
+    static_cast<uint16_t>(0x4b5b), /* sat-Olck-IN */
+    static_cast<uint16_t>(0x35b0), /* sav-Latn-SN */
+    static_cast<uint16_t>(0x595b), /* saz-Saur-IN */
+    static_cast<uint16_t>(0x35da), /* sba-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* sbe-Latn-ZZ */
+    static_cast<uint16_t>(0x35c6), /* sbp-Latn-TZ */
+    static_cast<uint16_t>(0x155b), /* sck-Deva-IN */
+    static_cast<uint16_t>(0x03da), /* scl-Arab-ZZ */
+    static_cast<uint16_t>(0x3560), /* scn-Latn-IT */
+    static_cast<uint16_t>(0x3542), /* sco-Latn-GB */
+    static_cast<uint16_t>(0x351d), /* scs-Latn-CA */
+    static_cast<uint16_t>(0x3560), /* sdc-Latn-IT */
+    static_cast<uint16_t>(0x035e), /* sdh-Arab-IR */
+    static_cast<uint16_t>(0x3522), /* sef-Latn-CI */
+    static_cast<uint16_t>(0x3589), /* seh-Latn-MZ */
+    static_cast<uint16_t>(0x3587), /* sei-Latn-MX */
+    static_cast<uint16_t>(0x357e), /* ses-Latn-ML */
+    static_cast<uint16_t>(0x4a58), /* sga-Ogam-IE */
+    static_cast<uint16_t>(0x3574), /* sgs-Latn-LT */
+    static_cast<uint16_t>(0x18da), /* sgw-Ethi-ZZ */
+    static_cast<uint16_t>(0x35da), /* sgz-Latn-ZZ */
+    static_cast<uint16_t>(0x6878), /* shi-Tfng-MA */
+    static_cast<uint16_t>(0x35da), /* shk-Latn-ZZ */
+    static_cast<uint16_t>(0x457f), /* shn-Mymr-MM */
+    static_cast<uint16_t>(0x03da), /* shu-Arab-ZZ */
+    static_cast<uint16_t>(0x353a), /* sid-Latn-ET */
+    static_cast<uint16_t>(0x35da), /* sig-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* sil-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* sim-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* sjr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* skc-Latn-ZZ */
+    static_cast<uint16_t>(0x039a), /* skr-Arab-PK */
+    static_cast<uint16_t>(0x35da), /* sks-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* sld-Latn-ZZ */
+    static_cast<uint16_t>(0x359b), /* sli-Latn-PL */
+    static_cast<uint16_t>(0x35da), /* sll-Latn-ZZ */
+    static_cast<uint16_t>(0x3557), /* sly-Latn-ID */
+    static_cast<uint16_t>(0x35aa), /* sma-Latn-SE */
+    static_cast<uint16_t>(0x35aa), /* smj-Latn-SE */
+    static_cast<uint16_t>(0x353b), /* smn-Latn-FI */
+    static_cast<uint16_t>(0x5759), /* smp-Samr-IL */
+    static_cast<uint16_t>(0x35da), /* smq-Latn-ZZ */
+    static_cast<uint16_t>(0x353b), /* sms-Latn-FI */
+    static_cast<uint16_t>(0x35da), /* snc-Latn-ZZ */
+    static_cast<uint16_t>(0x357e), /* snk-Latn-ML */
+    static_cast<uint16_t>(0x35da), /* snp-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* snx-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* sny-Latn-ZZ */
+    static_cast<uint16_t>(0x5ecb), /* sog-Sogd-UZ */
+    static_cast<uint16_t>(0x35da), /* sok-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* soq-Latn-ZZ */
+    static_cast<uint16_t>(0x6abb), /* sou-Thai-TH */
+    static_cast<uint16_t>(0x35da), /* soy-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* spd-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* spl-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* sps-Latn-ZZ */
+    static_cast<uint16_t>(0x5f5b), /* srb-Sora-IN */
+    static_cast<uint16_t>(0x35b2), /* srn-Latn-SR */
+    static_cast<uint16_t>(0x35b0), /* srr-Latn-SN */
+    static_cast<uint16_t>(0x155b), /* srx-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* ssd-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ssg-Latn-ZZ */
+    static_cast<uint16_t>(0x3538), /* ssy-Latn-ER */
+    static_cast<uint16_t>(0x35da), /* stk-Latn-ZZ */
+    static_cast<uint16_t>(0x352e), /* stq-Latn-DE */
+    static_cast<uint16_t>(0x35da), /* sua-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* sue-Latn-ZZ */
+    static_cast<uint16_t>(0x35c6), /* suk-Latn-TZ */
+    static_cast<uint16_t>(0x35da), /* sur-Latn-ZZ */
+    static_cast<uint16_t>(0x354b), /* sus-Latn-GN */
+    static_cast<uint16_t>(0x03d6), /* swb-Arab-YT */
+    static_cast<uint16_t>(0x351f), /* swc-Latn-CD */
+    static_cast<uint16_t>(0x352e), /* swg-Latn-DE */
+    static_cast<uint16_t>(0x35da), /* swp-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* swv-Deva-IN */
+    static_cast<uint16_t>(0x3557), /* sxn-Latn-ID */
+    static_cast<uint16_t>(0x35da), /* sxw-Latn-ZZ */
+    static_cast<uint16_t>(0x090e), /* syl-Beng-BD */
+    static_cast<uint16_t>(0x615d), /* syr-Syrc-IQ */
+    static_cast<uint16_t>(0x359b), /* szl-Latn-PL */
+    static_cast<uint16_t>(0x1591), /* taj-Deva-NP */
+    static_cast<uint16_t>(0x35da), /* tal-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tan-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* taq-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tbc-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tbd-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tbf-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tbg-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tbo-Latn-ZZ */
+    static_cast<uint16_t>(0x3599), /* tbw-Latn-PH */
+    static_cast<uint16_t>(0x35da), /* tbz-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tci-Latn-ZZ */
+    static_cast<uint16_t>(0x315b), /* tcy-Knda-IN */
+    static_cast<uint16_t>(0x6226), /* tdd-Tale-CN */
+    static_cast<uint16_t>(0x1591), /* tdg-Deva-NP */
+    static_cast<uint16_t>(0x1591), /* tdh-Deva-NP */
+    static_cast<uint16_t>(0x3588), /* tdu-Latn-MY */
+    static_cast<uint16_t>(0x35da), /* ted-Latn-ZZ */
+    static_cast<uint16_t>(0x35af), /* tem-Latn-SL */
+    static_cast<uint16_t>(0x35c8), /* teo-Latn-UG */
+    static_cast<uint16_t>(0x35be), /* tet-Latn-TL */
+    static_cast<uint16_t>(0x35da), /* tfi-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tgc-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tgo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tgu-Latn-ZZ */
+    static_cast<uint16_t>(0x1591), /* thl-Deva-NP */
+    static_cast<uint16_t>(0x1591), /* thq-Deva-NP */
+    static_cast<uint16_t>(0x1591), /* thr-Deva-NP */
+    static_cast<uint16_t>(0x35da), /* tif-Latn-ZZ */
+    static_cast<uint16_t>(0x1838), /* tig-Ethi-ER */
+    static_cast<uint16_t>(0x35da), /* tik-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tim-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tio-Latn-ZZ */
+    static_cast<uint16_t>(0x358d), /* tiv-Latn-NG */
+    static_cast<uint16_t>(0x35bd), /* tkl-Latn-TK */
+    static_cast<uint16_t>(0x350b), /* tkr-Latn-AZ */
+    static_cast<uint16_t>(0x1591), /* tkt-Deva-NP */
+    static_cast<uint16_t>(0x35da), /* tlf-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tlx-Latn-ZZ */
+    static_cast<uint16_t>(0x350b), /* tly-Latn-AZ */
+    static_cast<uint16_t>(0x358b), /* tmh-Latn-NE */
+    static_cast<uint16_t>(0x35da), /* tmy-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tnh-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tof-Latn-ZZ */
+    static_cast<uint16_t>(0x3586), /* tog-Latn-MW */
+    static_cast<uint16_t>(0x35da), /* toq-Latn-ZZ */
+    static_cast<uint16_t>(0x3598), /* tpi-Latn-PG */
+    static_cast<uint16_t>(0x35da), /* tpm-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tpz-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tqo-Latn-ZZ */
+    static_cast<uint16_t>(0x35c2), /* tru-Latn-TR */
+    static_cast<uint16_t>(0x35c5), /* trv-Latn-TW */
+    static_cast<uint16_t>(0x039a), /* trw-Arab-PK */
+    static_cast<uint16_t>(0x1e4d), /* tsd-Grek-GR */
+    static_cast<uint16_t>(0x1591), /* tsf-Deva-NP */
+    static_cast<uint16_t>(0x3599), /* tsg-Latn-PH */
+    static_cast<uint16_t>(0x6b19), /* tsj-Tibt-BT */
+    static_cast<uint16_t>(0x35da), /* tsw-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ttd-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tte-Latn-ZZ */
+    static_cast<uint16_t>(0x35c8), /* ttj-Latn-UG */
+    static_cast<uint16_t>(0x35da), /* ttr-Latn-ZZ */
+    static_cast<uint16_t>(0x6abb), /* tts-Thai-TH */
+    static_cast<uint16_t>(0x350b), /* ttt-Latn-AZ */
+    static_cast<uint16_t>(0x35da), /* tuh-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tul-Latn-ZZ */
+    static_cast<uint16_t>(0x3586), /* tum-Latn-MW */
+    static_cast<uint16_t>(0x35da), /* tuq-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* tvd-Latn-ZZ */
+    static_cast<uint16_t>(0x35c4), /* tvl-Latn-TV */
+    static_cast<uint16_t>(0x35da), /* tvu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* twh-Latn-ZZ */
+    static_cast<uint16_t>(0x358b), /* twq-Latn-NE */
+    static_cast<uint16_t>(0x6526), /* txg-Tang-CN */
+    static_cast<uint16_t>(0x35da), /* tya-Latn-ZZ */
+    static_cast<uint16_t>(0x14a4), /* tyv-Cyrl-RU */
+    static_cast<uint16_t>(0x3578), /* tzm-Latn-MA */
+    static_cast<uint16_t>(0x35da), /* ubu-Latn-ZZ */
+    static_cast<uint16_t>(0x14a4), /* udm-Cyrl-RU */
+    static_cast<uint16_t>(0x6cb7), /* uga-Ugar-SY */
+    static_cast<uint16_t>(0x353e), /* uli-Latn-FM */
+    static_cast<uint16_t>(0x3506), /* umb-Latn-AO */
+    static_cast<uint16_t>(0x095b), /* unr-Beng-IN */
+    static_cast<uint16_t>(0x095b), /* unx-Beng-IN */
+    static_cast<uint16_t>(0x35da), /* uok-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* uri-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* urt-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* urw-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* usa-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* uth-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* utr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* uvh-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* uvl-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* vag-Latn-ZZ */
+    static_cast<uint16_t>(0x6d72), /* vai-Vaii-LR */
+    static_cast<uint16_t>(0x35da), /* van-Latn-ZZ */
+    static_cast<uint16_t>(0x3560), /* vec-Latn-IT */
+    static_cast<uint16_t>(0x35a4), /* vep-Latn-RU */
+    static_cast<uint16_t>(0x35b6), /* vic-Latn-SX */
+    static_cast<uint16_t>(0x35da), /* viv-Latn-ZZ */
+    static_cast<uint16_t>(0x350f), /* vls-Latn-BE */
+    static_cast<uint16_t>(0x352e), /* vmf-Latn-DE */
+    static_cast<uint16_t>(0x3589), /* vmw-Latn-MZ */
+    static_cast<uint16_t>(0x35a4), /* vot-Latn-RU */
+    static_cast<uint16_t>(0x3535), /* vro-Latn-EE */
+    static_cast<uint16_t>(0x35c6), /* vun-Latn-TZ */
+    static_cast<uint16_t>(0x35da), /* vut-Latn-ZZ */
+    static_cast<uint16_t>(0x3521), /* wae-Latn-CH */
+    static_cast<uint16_t>(0x35da), /* waj-Latn-ZZ */
+    static_cast<uint16_t>(0x183a), /* wal-Ethi-ET */
+    static_cast<uint16_t>(0x35da), /* wan-Latn-ZZ */
+    static_cast<uint16_t>(0x3599), /* war-Latn-PH */
+    static_cast<uint16_t>(0x3509), /* wbp-Latn-AU */
+    static_cast<uint16_t>(0x675b), /* wbq-Telu-IN */
+    static_cast<uint16_t>(0x155b), /* wbr-Deva-IN */
+    static_cast<uint16_t>(0x35da), /* wci-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wer-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wgi-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* whg-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wib-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wiu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wiv-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wja-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wji-Latn-ZZ */
+    static_cast<uint16_t>(0x35d2), /* wls-Latn-WF */
+    static_cast<uint16_t>(0x35da), /* wmo-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wnc-Latn-ZZ */
+    static_cast<uint16_t>(0x0369), /* wni-Arab-KM */
+    static_cast<uint16_t>(0x35da), /* wnu-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wob-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wos-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wrs-Latn-ZZ */
+    static_cast<uint16_t>(0x1b5b), /* wsg-Gong-IN */
+    static_cast<uint16_t>(0x35da), /* wsk-Latn-ZZ */
+    static_cast<uint16_t>(0x155b), /* wtm-Deva-IN */
+    static_cast<uint16_t>(0x2226), /* wuu-Hans-CN */
+    static_cast<uint16_t>(0x35da), /* wuv-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* wwa-Latn-ZZ */
+    static_cast<uint16_t>(0x3517), /* xav-Latn-BR */
+    static_cast<uint16_t>(0x35da), /* xbi-Latn-ZZ */
+    static_cast<uint16_t>(0x11cb), /* xco-Chrs-UZ */
+    static_cast<uint16_t>(0x0ec2), /* xcr-Cari-TR */
+    static_cast<uint16_t>(0x35da), /* xes-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* xla-Latn-ZZ */
+    static_cast<uint16_t>(0x3bc2), /* xlc-Lyci-TR */
+    static_cast<uint16_t>(0x3cc2), /* xld-Lydi-TR */
+    static_cast<uint16_t>(0x1944), /* xmf-Geor-GE */
+    static_cast<uint16_t>(0x3e26), /* xmn-Mani-CN */
+    static_cast<uint16_t>(0x40a9), /* xmr-Merc-SD */
+    static_cast<uint16_t>(0x46a6), /* xna-Narb-SA */
+    static_cast<uint16_t>(0x155b), /* xnr-Deva-IN */
+    static_cast<uint16_t>(0x35c8), /* xog-Latn-UG */
+    static_cast<uint16_t>(0x35da), /* xon-Latn-ZZ */
+    static_cast<uint16_t>(0x555e), /* xpr-Prti-IR */
+    static_cast<uint16_t>(0x35da), /* xrb-Latn-ZZ */
+    static_cast<uint16_t>(0x58d5), /* xsa-Sarb-YE */
+    static_cast<uint16_t>(0x35da), /* xsi-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* xsm-Latn-ZZ */
+    static_cast<uint16_t>(0x1591), /* xsr-Deva-NP */
+    static_cast<uint16_t>(0x35da), /* xwe-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yam-Latn-ZZ */
+    static_cast<uint16_t>(0x3589), /* yao-Latn-MZ */
+    static_cast<uint16_t>(0x353e), /* yap-Latn-FM */
+    static_cast<uint16_t>(0x35da), /* yas-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yat-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* yav-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* yay-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yaz-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yba-Latn-ZZ */
+    static_cast<uint16_t>(0x3525), /* ybb-Latn-CM */
+    static_cast<uint16_t>(0x35da), /* yby-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yer-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ygr-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ygw-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yko-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yle-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* ylg-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yll-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yml-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yon-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yrb-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yre-Latn-ZZ */
+    static_cast<uint16_t>(0x3517), /* yrl-Latn-BR */
+    static_cast<uint16_t>(0x35da), /* yss-Latn-ZZ */
+    static_cast<uint16_t>(0x3587), /* yua-Latn-MX */
+    static_cast<uint16_t>(0x2352), /* yue-Hant-HK */
+    static_cast<uint16_t>(0x35da), /* yuj-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yut-Latn-ZZ */
+    static_cast<uint16_t>(0x35da), /* yuw-Latn-ZZ */
+    static_cast<uint16_t>(0x35a9), /* zag-Latn-SD */
+    static_cast<uint16_t>(0x0369), /* zdj-Arab-KM */
+    static_cast<uint16_t>(0x358f), /* zea-Latn-NL */
+    static_cast<uint16_t>(0x6878), /* zgh-Tfng-MA */
+    static_cast<uint16_t>(0x4926), /* zhx-Nshu-CN */
+    static_cast<uint16_t>(0x35da), /* zia-Latn-ZZ */
+    static_cast<uint16_t>(0x3026), /* zkt-Kits-CN */
+    static_cast<uint16_t>(0x35ba), /* zlm-Latn-TG */
+    static_cast<uint16_t>(0x3588), /* zmi-Latn-MY */
+    static_cast<uint16_t>(0x35da), /* zne-Latn-ZZ */
+    static_cast<uint16_t>(0x35c2), /* zza-Latn-TR */
+};
+// sorted packed locale, likely subtags of a language with script or region
+constexpr uint32_t LIKELY_TAGS_LOCALE_KEY[] = {
+    static_cast<uint32_t>(0x617a005d), /* az-IQ */
+    static_cast<uint32_t>(0x617a005e), /* az-IR */
+    static_cast<uint32_t>(0x617a00a4), /* az-RU */
+    static_cast<uint32_t>(0x617a0300), /* az-Arab */
+    static_cast<uint32_t>(0x63751a00), /* cu-Glag */
+    static_cast<uint32_t>(0x656e5b00), /* en-Shaw */
+    static_cast<uint32_t>(0x66660100), /* ff-Adlm */
+    static_cast<uint32_t>(0x68610025), /* ha-CM */
+    static_cast<uint32_t>(0x686100a9), /* ha-SD */
+    static_cast<uint32_t>(0x6b6b0001), /* kk-AF */
+    static_cast<uint32_t>(0x6b6b0026), /* kk-CN */
+    static_cast<uint32_t>(0x6b6b005e), /* kk-IR */
+    static_cast<uint32_t>(0x6b6b0080), /* kk-MN */
+    static_cast<uint32_t>(0x6b6b0300), /* kk-Arab */
+    static_cast<uint32_t>(0x6b75006f), /* ku-LB */
+    static_cast<uint32_t>(0x6b750300), /* ku-Arab */
+    static_cast<uint32_t>(0x6b757100), /* ku-Yezi */
+    static_cast<uint32_t>(0x6b790026), /* ky-CN */
+    static_cast<uint32_t>(0x6b7900c2), /* ky-TR */
+    static_cast<uint32_t>(0x6b790300), /* ky-Arab */
+    static_cast<uint32_t>(0x6b793500), /* ky-Latn */
+    static_cast<uint32_t>(0x6d6e0026), /* mn-CN */
+    static_cast<uint32_t>(0x6d6e4200), /* mn-Mong */
+    static_cast<uint32_t>(0x6d73001e), /* ms-CC */
+    static_cast<uint32_t>(0x7061009a), /* pa-PK */
+    static_cast<uint32_t>(0x70610300), /* pa-Arab */
+    static_cast<uint32_t>(0x73641500), /* sd-Deva */
+    static_cast<uint32_t>(0x73642f00), /* sd-Khoj */
+    static_cast<uint32_t>(0x73645c00), /* sd-Sind */
+    static_cast<uint32_t>(0x7372007a), /* sr-ME */
+    static_cast<uint32_t>(0x737200a2), /* sr-RO */
+    static_cast<uint32_t>(0x737200a4), /* sr-RU */
+    static_cast<uint32_t>(0x737200c2), /* sr-TR */
+    static_cast<uint32_t>(0x7467009a), /* tg-PK */
+    static_cast<uint32_t>(0x74670300), /* tg-Arab */
+    static_cast<uint32_t>(0x7567006d), /* ug-KZ */
+    static_cast<uint32_t>(0x75670080), /* ug-MN */
+    static_cast<uint32_t>(0x75671400), /* ug-Cyrl */
+    static_cast<uint32_t>(0x757a0001), /* uz-AF */
+    static_cast<uint32_t>(0x757a0026), /* uz-CN */
+    static_cast<uint32_t>(0x757a0300), /* uz-Arab */
+    static_cast<uint32_t>(0x7a680009), /* zh-AU */
+    static_cast<uint32_t>(0x7a680015), /* zh-BN */
+    static_cast<uint32_t>(0x7a680042), /* zh-GB */
+    static_cast<uint32_t>(0x7a680045), /* zh-GF */
+    static_cast<uint32_t>(0x7a680052), /* zh-HK */
+    static_cast<uint32_t>(0x7a680057), /* zh-ID */
+    static_cast<uint32_t>(0x7a680081), /* zh-MO */
+    static_cast<uint32_t>(0x7a680095), /* zh-PA */
+    static_cast<uint32_t>(0x7a680097), /* zh-PF */
+    static_cast<uint32_t>(0x7a680099), /* zh-PH */
+    static_cast<uint32_t>(0x7a6800b2), /* zh-SR */
+    static_cast<uint32_t>(0x7a6800bb), /* zh-TH */
+    static_cast<uint32_t>(0x7a6800c5), /* zh-TW */
+    static_cast<uint32_t>(0x7a6800c9), /* zh-US */
+    static_cast<uint32_t>(0x7a6800d0), /* zh-VN */
+    static_cast<uint32_t>(0x7a680a00), /* zh-Bopo */
+    static_cast<uint32_t>(0x7a682100), /* zh-Hanb */
+    static_cast<uint32_t>(0x7a682300), /* zh-Hant */
+    static_cast<uint32_t>(0x82224700), /* arc-Nbat */
+    static_cast<uint32_t>(0x82224f00), /* arc-Palm */
+    static_cast<uint32_t>(0x9a223900), /* grc-Linb */
+    static_cast<uint32_t>(0xad053700), /* lif-Limb */
+    static_cast<uint32_t>(0xb00d004b), /* man-GN */
+    static_cast<uint32_t>(0xb00d4800), /* man-Nkoo */
+    static_cast<uint32_t>(0xb1123f00), /* mis-Medf */
+    static_cast<uint32_t>(0xbc0b5200), /* pal-Phlp */
+    static_cast<uint32_t>(0xc505008f), /* rif-NL */
+    static_cast<uint32_t>(0xd1b10091), /* unr-NP */
+    static_cast<uint32_t>(0xd1b11500), /* unr-Deva */
+    static_cast<uint32_t>(0xe2840026), /* yue-CN */
+    static_cast<uint32_t>(0xe2842200), /* yue-Hans */
+};
+// packed subtags
+constexpr uint16_t LIKELY_TAGS_LOCALE_VALUE[] = {
+    static_cast<uint16_t>(0x035d), /* az-Arab-IQ */
+    static_cast<uint16_t>(0x035e), /* az-Arab-IR */
+    static_cast<uint16_t>(0x14a4), /* az-Cyrl-RU */
+    static_cast<uint16_t>(0x035e), /* az-Arab-IR */
+    static_cast<uint16_t>(0x1a11), /* cu-Glag-BG */
+    static_cast<uint16_t>(0x5b42), /* en-Shaw-GB */
+    static_cast<uint16_t>(0x014b), /* ff-Adlm-GN */
+    static_cast<uint16_t>(0x0325), /* ha-Arab-CM */
+    static_cast<uint16_t>(0x03a9), /* ha-Arab-SD */
+    static_cast<uint16_t>(0x0301), /* kk-Arab-AF */
+    static_cast<uint16_t>(0x0326), /* kk-Arab-CN */
+    static_cast<uint16_t>(0x035e), /* kk-Arab-IR */
+    static_cast<uint16_t>(0x0380), /* kk-Arab-MN */
+    static_cast<uint16_t>(0x0326), /* kk-Arab-CN */
+    static_cast<uint16_t>(0x036f), /* ku-Arab-LB */
+    static_cast<uint16_t>(0x035d), /* ku-Arab-IQ */
+    static_cast<uint16_t>(0x7144), /* ku-Yezi-GE */
+    static_cast<uint16_t>(0x0326), /* ky-Arab-CN */
+    static_cast<uint16_t>(0x35c2), /* ky-Latn-TR */
+    static_cast<uint16_t>(0x0326), /* ky-Arab-CN */
+    static_cast<uint16_t>(0x35c2), /* ky-Latn-TR */
+    static_cast<uint16_t>(0x4226), /* mn-Mong-CN */
+    static_cast<uint16_t>(0x4226), /* mn-Mong-CN */
+    static_cast<uint16_t>(0x031e), /* ms-Arab-CC */
+    static_cast<uint16_t>(0x039a), /* pa-Arab-PK */
+    static_cast<uint16_t>(0x039a), /* pa-Arab-PK */
+    static_cast<uint16_t>(0x155b), /* sd-Deva-IN */
+    static_cast<uint16_t>(0x2f5b), /* sd-Khoj-IN */
+    static_cast<uint16_t>(0x5c5b), /* sd-Sind-IN */
+    static_cast<uint16_t>(0x357a), /* sr-Latn-ME */
+    static_cast<uint16_t>(0x35a2), /* sr-Latn-RO */
+    static_cast<uint16_t>(0x35a4), /* sr-Latn-RU */
+    static_cast<uint16_t>(0x35c2), /* sr-Latn-TR */
+    static_cast<uint16_t>(0x039a), /* tg-Arab-PK */
+    static_cast<uint16_t>(0x039a), /* tg-Arab-PK */
+    static_cast<uint16_t>(0x146d), /* ug-Cyrl-KZ */
+    static_cast<uint16_t>(0x1480), /* ug-Cyrl-MN */
+    static_cast<uint16_t>(0x146d), /* ug-Cyrl-KZ */
+    static_cast<uint16_t>(0x0301), /* uz-Arab-AF */
+    static_cast<uint16_t>(0x1426), /* uz-Cyrl-CN */
+    static_cast<uint16_t>(0x0301), /* uz-Arab-AF */
+    static_cast<uint16_t>(0x2309), /* zh-Hant-AU */
+    static_cast<uint16_t>(0x2315), /* zh-Hant-BN */
+    static_cast<uint16_t>(0x2342), /* zh-Hant-GB */
+    static_cast<uint16_t>(0x2345), /* zh-Hant-GF */
+    static_cast<uint16_t>(0x2352), /* zh-Hant-HK */
+    static_cast<uint16_t>(0x2357), /* zh-Hant-ID */
+    static_cast<uint16_t>(0x2381), /* zh-Hant-MO */
+    static_cast<uint16_t>(0x2395), /* zh-Hant-PA */
+    static_cast<uint16_t>(0x2397), /* zh-Hant-PF */
+    static_cast<uint16_t>(0x2399), /* zh-Hant-PH */
+    static_cast<uint16_t>(0x23b2), /* zh-Hant-SR */
+    static_cast<uint16_t>(0x23bb), /* zh-Hant-TH */
+    static_cast<uint16_t>(0x23c5), /* zh-Hant-TW */
+    static_cast<uint16_t>(0x23c9), /* zh-Hant-US */
+    static_cast<uint16_t>(0x23d0), /* zh-Hant-VN */
+    static_cast<uint16_t>(0x0ac5), /* zh-Bopo-TW */
+    static_cast<uint16_t>(0x21c5), /* zh-Hanb-TW */
+    static_cast<uint16_t>(0x23c5), /* zh-Hant-TW */
+    static_cast<uint16_t>(0x4763), /* arc-Nbat-JO */
+    static_cast<uint16_t>(0x4fb7), /* arc-Palm-SY */
+    static_cast<uint16_t>(0x394d), /* grc-Linb-GR */
+    static_cast<uint16_t>(0x375b), /* lif-Limb-IN */
+    static_cast<uint16_t>(0x484b), /* man-Nkoo-GN */
+    static_cast<uint16_t>(0x484b), /* man-Nkoo-GN */
+    static_cast<uint16_t>(0x3f8d), /* mis-Medf-NG */
+    static_cast<uint16_t>(0x5226), /* pal-Phlp-CN */
+    static_cast<uint16_t>(0x358f), /* rif-Latn-NL */
+    static_cast<uint16_t>(0x1591), /* unr-Deva-NP */
+    static_cast<uint16_t>(0x1591), /* unr-Deva-NP */
+    static_cast<uint16_t>(0x2226), /* yue-Hans-CN */
+    static_cast<uint16_t>(0x2226), /* yue-Hans-CN */
+};
+// sorted packed locale
+constexpr uint32_t LOCALE_PARENTS_KEY[] = {
+    static_cast<uint32_t>(0x61720033), /* ar-DZ */
+    static_cast<uint32_t>(0x61720037), /* ar-EH */
+    static_cast<uint32_t>(0x61720077), /* ar-LY */
+    static_cast<uint32_t>(0x61720078), /* ar-MA */
+    static_cast<uint32_t>(0x617200c0), /* ar-TN */
+    static_cast<uint32_t>(0x617a0300), /* az-Arab */
+    static_cast<uint32_t>(0x617a1400), /* az-Cyrl */
+    static_cast<uint32_t>(0x626d4800), /* bm-Nkoo */
+    static_cast<uint32_t>(0x62731400), /* bs-Cyrl */
+    static_cast<uint32_t>(0x63751a00), /* cu-Glag */
+    static_cast<uint32_t>(0x656e0002), /* en-AG */
+    static_cast<uint32_t>(0x656e0003), /* en-AI */
+    static_cast<uint32_t>(0x656e0008), /* en-AT */
+    static_cast<uint32_t>(0x656e0009), /* en-AU */
+    static_cast<uint32_t>(0x656e000d), /* en-BB */
+    static_cast<uint32_t>(0x656e000f), /* en-BE */
+    static_cast<uint32_t>(0x656e0014), /* en-BM */
+    static_cast<uint32_t>(0x656e0018), /* en-BS */
+    static_cast<uint32_t>(0x656e001a), /* en-BW */
+    static_cast<uint32_t>(0x656e001c), /* en-BZ */
+    static_cast<uint32_t>(0x656e001e), /* en-CC */
+    static_cast<uint32_t>(0x656e0021), /* en-CH */
+    static_cast<uint32_t>(0x656e0023), /* en-CK */
+    static_cast<uint32_t>(0x656e0025), /* en-CM */
+    static_cast<uint32_t>(0x656e002b), /* en-CX */
+    static_cast<uint32_t>(0x656e002c), /* en-CY */
+    static_cast<uint32_t>(0x656e002e), /* en-DE */
+    static_cast<uint32_t>(0x656e002f), /* en-DG */
+    static_cast<uint32_t>(0x656e0030), /* en-DK */
+    static_cast<uint32_t>(0x656e0031), /* en-DM */
+    static_cast<uint32_t>(0x656e0038), /* en-ER */
+    static_cast<uint32_t>(0x656e003b), /* en-FI */
+    static_cast<uint32_t>(0x656e003c), /* en-FJ */
+    static_cast<uint32_t>(0x656e003d), /* en-FK */
+    static_cast<uint32_t>(0x656e003e), /* en-FM */
+    static_cast<uint32_t>(0x656e0042), /* en-GB */
+    static_cast<uint32_t>(0x656e0043), /* en-GD */
+    static_cast<uint32_t>(0x656e0046), /* en-GG */
+    static_cast<uint32_t>(0x656e0047), /* en-GH */
+    static_cast<uint32_t>(0x656e0048), /* en-GI */
+    static_cast<uint32_t>(0x656e004a), /* en-GM */
+    static_cast<uint32_t>(0x656e0051), /* en-GY */
+    static_cast<uint32_t>(0x656e0052), /* en-HK */
+    static_cast<uint32_t>(0x656e0058), /* en-IE */
+    static_cast<uint32_t>(0x656e0059), /* en-IL */
+    static_cast<uint32_t>(0x656e005a), /* en-IM */
+    static_cast<uint32_t>(0x656e005b), /* en-IN */
+    static_cast<uint32_t>(0x656e005c), /* en-IO */
+    static_cast<uint32_t>(0x656e0061), /* en-JE */
+    static_cast<uint32_t>(0x656e0062), /* en-JM */
+    static_cast<uint32_t>(0x656e0065), /* en-KE */
+    static_cast<uint32_t>(0x656e0068), /* en-KI */
+    static_cast<uint32_t>(0x656e006a), /* en-KN */
+    static_cast<uint32_t>(0x656e006c), /* en-KY */
+    static_cast<uint32_t>(0x656e0070), /* en-LC */
+    static_cast<uint32_t>(0x656e0072), /* en-LR */
+    static_cast<uint32_t>(0x656e0073), /* en-LS */
+    static_cast<uint32_t>(0x656e007b), /* en-MG */
+    static_cast<uint32_t>(0x656e0081), /* en-MO */
+    static_cast<uint32_t>(0x656e0082), /* en-MS */
+    static_cast<uint32_t>(0x656e0083), /* en-MT */
+    static_cast<uint32_t>(0x656e0084), /* en-MU */
+    static_cast<uint32_t>(0x656e0086), /* en-MW */
+    static_cast<uint32_t>(0x656e0088), /* en-MY */
+    static_cast<uint32_t>(0x656e008a), /* en-NA */
+    static_cast<uint32_t>(0x656e008c), /* en-NF */
+    static_cast<uint32_t>(0x656e008d), /* en-NG */
+    static_cast<uint32_t>(0x656e008f), /* en-NL */
+    static_cast<uint32_t>(0x656e0092), /* en-NR */
+    static_cast<uint32_t>(0x656e0093), /* en-NU */
+    static_cast<uint32_t>(0x656e0094), /* en-NZ */
+    static_cast<uint32_t>(0x656e0098), /* en-PG */
+    static_cast<uint32_t>(0x656e0099), /* en-PH */
+    static_cast<uint32_t>(0x656e009a), /* en-PK */
+    static_cast<uint32_t>(0x656e009c), /* en-PN */
+    static_cast<uint32_t>(0x656e009f), /* en-PW */
+    static_cast<uint32_t>(0x656e00a5), /* en-RW */
+    static_cast<uint32_t>(0x656e00a7), /* en-SB */
+    static_cast<uint32_t>(0x656e00a8), /* en-SC */
+    static_cast<uint32_t>(0x656e00a9), /* en-SD */
+    static_cast<uint32_t>(0x656e00aa), /* en-SE */
+    static_cast<uint32_t>(0x656e00ab), /* en-SG */
+    static_cast<uint32_t>(0x656e00ac), /* en-SH */
+    static_cast<uint32_t>(0x656e00ad), /* en-SI */
+    static_cast<uint32_t>(0x656e00af), /* en-SL */
+    static_cast<uint32_t>(0x656e00b3), /* en-SS */
+    static_cast<uint32_t>(0x656e00b6), /* en-SX */
+    static_cast<uint32_t>(0x656e00b8), /* en-SZ */
+    static_cast<uint32_t>(0x656e00b9), /* en-TC */
+    static_cast<uint32_t>(0x656e00bd), /* en-TK */
+    static_cast<uint32_t>(0x656e00c1), /* en-TO */
+    static_cast<uint32_t>(0x656e00c3), /* en-TT */
+    static_cast<uint32_t>(0x656e00c4), /* en-TV */
+    static_cast<uint32_t>(0x656e00c6), /* en-TZ */
+    static_cast<uint32_t>(0x656e00c8), /* en-UG */
+    static_cast<uint32_t>(0x656e00cd), /* en-VC */
+    static_cast<uint32_t>(0x656e00cf), /* en-VG */
+    static_cast<uint32_t>(0x656e00d1), /* en-VU */
+    static_cast<uint32_t>(0x656e00d3), /* en-WS */
+    static_cast<uint32_t>(0x656e00d7), /* en-ZA */
+    static_cast<uint32_t>(0x656e00d8), /* en-ZM */
+    static_cast<uint32_t>(0x656e00d9), /* en-ZW */
+    static_cast<uint32_t>(0x656e00dd), /* en-150 */
+    static_cast<uint32_t>(0x656e1600), /* en-Dsrt */
+    static_cast<uint32_t>(0x656e5b00), /* en-Shaw */
+    static_cast<uint32_t>(0x65730007), /* es-AR */
+    static_cast<uint32_t>(0x65730016), /* es-BO */
+    static_cast<uint32_t>(0x65730017), /* es-BR */
+    static_cast<uint32_t>(0x6573001c), /* es-BZ */
+    static_cast<uint32_t>(0x65730024), /* es-CL */
+    static_cast<uint32_t>(0x65730027), /* es-CO */
+    static_cast<uint32_t>(0x65730028), /* es-CR */
+    static_cast<uint32_t>(0x65730029), /* es-CU */
+    static_cast<uint32_t>(0x65730032), /* es-DO */
+    static_cast<uint32_t>(0x65730034), /* es-EC */
+    static_cast<uint32_t>(0x6573004e), /* es-GT */
+    static_cast<uint32_t>(0x65730053), /* es-HN */
+    static_cast<uint32_t>(0x65730087), /* es-MX */
+    static_cast<uint32_t>(0x6573008e), /* es-NI */
+    static_cast<uint32_t>(0x65730095), /* es-PA */
+    static_cast<uint32_t>(0x65730096), /* es-PE */
+    static_cast<uint32_t>(0x6573009d), /* es-PR */
+    static_cast<uint32_t>(0x657300a0), /* es-PY */
+    static_cast<uint32_t>(0x657300b5), /* es-SV */
+    static_cast<uint32_t>(0x657300c9), /* es-US */
+    static_cast<uint32_t>(0x657300ca), /* es-UY */
+    static_cast<uint32_t>(0x657300ce), /* es-VE */
+    static_cast<uint32_t>(0x66660100), /* ff-Adlm */
+    static_cast<uint32_t>(0x66660300), /* ff-Arab */
+    static_cast<uint32_t>(0x68610300), /* ha-Arab */
+    static_cast<uint32_t>(0x68693500), /* hi-Latn */
+    static_cast<uint32_t>(0x69753500), /* iu-Latn */
+    static_cast<uint32_t>(0x6b6b0300), /* kk-Arab */
+    static_cast<uint32_t>(0x6b731500), /* ks-Deva */
+    static_cast<uint32_t>(0x6b750300), /* ku-Arab */
+    static_cast<uint32_t>(0x6b790300), /* ky-Arab */
+    static_cast<uint32_t>(0x6b793500), /* ky-Latn */
+    static_cast<uint32_t>(0x6d6c0300), /* ml-Arab */
+    static_cast<uint32_t>(0x6d6e4200), /* mn-Mong */
+    static_cast<uint32_t>(0x6d730300), /* ms-Arab */
+    static_cast<uint32_t>(0x70610300), /* pa-Arab */
+    static_cast<uint32_t>(0x70740006), /* pt-AO */
+    static_cast<uint32_t>(0x70740021), /* pt-CH */
+    static_cast<uint32_t>(0x7074002a), /* pt-CV */
+    static_cast<uint32_t>(0x70740040), /* pt-FR */
+    static_cast<uint32_t>(0x7074004c), /* pt-GQ */
+    static_cast<uint32_t>(0x70740050), /* pt-GW */
+    static_cast<uint32_t>(0x70740075), /* pt-LU */
+    static_cast<uint32_t>(0x70740081), /* pt-MO */
+    static_cast<uint32_t>(0x70740089), /* pt-MZ */
+    static_cast<uint32_t>(0x707400b4), /* pt-ST */
+    static_cast<uint32_t>(0x707400be), /* pt-TL */
+    static_cast<uint32_t>(0x73641500), /* sd-Deva */
+    static_cast<uint32_t>(0x73642f00), /* sd-Khoj */
+    static_cast<uint32_t>(0x73645c00), /* sd-Sind */
+    static_cast<uint32_t>(0x736f0300), /* so-Arab */
+    static_cast<uint32_t>(0x73723500), /* sr-Latn */
+    static_cast<uint32_t>(0x73770300), /* sw-Arab */
+    static_cast<uint32_t>(0x74670300), /* tg-Arab */
+    static_cast<uint32_t>(0x75671400), /* ug-Cyrl */
+    static_cast<uint32_t>(0x757a0300), /* uz-Arab */
+    static_cast<uint32_t>(0x757a1400), /* uz-Cyrl */
+    static_cast<uint32_t>(0x776f0300), /* wo-Arab */
+    static_cast<uint32_t>(0x796f0300), /* yo-Arab */
+    static_cast<uint32_t>(0x7a682300), /* zh-Hant */
+    static_cast<uint32_t>(0x7a682381), /* zh-Hant-MO */
+    static_cast<uint32_t>(0x85733500), /* blt-Latn */
+    static_cast<uint32_t>(0x870d3500), /* byn-Latn */
+    static_cast<uint32_t>(0x8d240300), /* dje-Arab */
+    static_cast<uint32_t>(0x8f0e0300), /* dyo-Arab */
+    static_cast<uint32_t>(0xb1a84400), /* mni-Mtei */
+    static_cast<uint32_t>(0xc8131500), /* sat-Deva */
+    static_cast<uint32_t>(0xc8e83500), /* shi-Latn */
+    static_cast<uint32_t>(0xd4083500), /* vai-Latn */
+    static_cast<uint32_t>(0xe2842200), /* yue-Hans */
+};
+// packed locale
+constexpr uint32_t LOCALE_PARENTS_VALUE[] = {
+    static_cast<uint32_t>(0x617200dc), /* ar-015 */
+    static_cast<uint32_t>(0x617200dc), /* ar-015 */
+    static_cast<uint32_t>(0x617200dc), /* ar-015 */
+    static_cast<uint32_t>(0x617200dc), /* ar-015 */
+    static_cast<uint32_t>(0x617200dc), /* ar-015 */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00dd), /* en-150 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00dd), /* en-150 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00dd), /* en-150 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00dd), /* en-150 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00dd), /* en-150 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00dd), /* en-150 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00dd), /* en-150 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00dd), /* en-150 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00dd), /* en-150 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x656e00db), /* en-001 */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x657300de), /* es-419 */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x7074009e), /* pt-PT */
+    static_cast<uint32_t>(0x7074009e), /* pt-PT */
+    static_cast<uint32_t>(0x7074009e), /* pt-PT */
+    static_cast<uint32_t>(0x7074009e), /* pt-PT */
+    static_cast<uint32_t>(0x7074009e), /* pt-PT */
+    static_cast<uint32_t>(0x7074009e), /* pt-PT */
+    static_cast<uint32_t>(0x7074009e), /* pt-PT */
+    static_cast<uint32_t>(0x7074009e), /* pt-PT */
+    static_cast<uint32_t>(0x7074009e), /* pt-PT */
+    static_cast<uint32_t>(0x7074009e), /* pt-PT */
+    static_cast<uint32_t>(0x7074009e), /* pt-PT */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x7a682352), /* zh-Hant-HK */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+    static_cast<uint32_t>(0x00000000), /* root */
+};
+// sorted packed locale
+constexpr uint32_t TYPICAL_CODES_VALUE[] = {
+    static_cast<uint32_t>(0x6161353a), /* aa-Latn-ET */
+    static_cast<uint32_t>(0x61621444), /* ab-Cyrl-GE */
+    static_cast<uint32_t>(0x6165065e), /* ae-Avst-IR */
+    static_cast<uint32_t>(0x616635d7), /* af-Latn-ZA */
+    static_cast<uint32_t>(0x616b3547), /* ak-Latn-GH */
+    static_cast<uint32_t>(0x616d183a), /* am-Ethi-ET */
+    static_cast<uint32_t>(0x616e3539), /* an-Latn-ES */
+    static_cast<uint32_t>(0x61720336), /* ar-Arab-EG */
+    static_cast<uint32_t>(0x6173095b), /* as-Beng-IN */
+    static_cast<uint32_t>(0x617614a4), /* av-Cyrl-RU */
+    static_cast<uint32_t>(0x61793516), /* ay-Latn-BO */
+    static_cast<uint32_t>(0x617a035e), /* az-Arab-IR */
+    static_cast<uint32_t>(0x617a350b), /* az-Latn-AZ */
+    static_cast<uint32_t>(0x626114a4), /* ba-Cyrl-RU */
+    static_cast<uint32_t>(0x6265141b), /* be-Cyrl-BY */
+    static_cast<uint32_t>(0x62671411), /* bg-Cyrl-BG */
+    static_cast<uint32_t>(0x626935d1), /* bi-Latn-VU */
+    static_cast<uint32_t>(0x626d357e), /* bm-Latn-ML */
+    static_cast<uint32_t>(0x626e090e), /* bn-Beng-BD */
+    static_cast<uint32_t>(0x626f6b26), /* bo-Tibt-CN */
+    static_cast<uint32_t>(0x62723540), /* br-Latn-FR */
+    static_cast<uint32_t>(0x6273350c), /* bs-Latn-BA */
+    static_cast<uint32_t>(0x63613539), /* ca-Latn-ES */
+    static_cast<uint32_t>(0x636514a4), /* ce-Cyrl-RU */
+    static_cast<uint32_t>(0x6368354f), /* ch-Latn-GU */
+    static_cast<uint32_t>(0x636f3540), /* co-Latn-FR */
+    static_cast<uint32_t>(0x63720d1d), /* cr-Cans-CA */
+    static_cast<uint32_t>(0x6373352d), /* cs-Latn-CZ */
+    static_cast<uint32_t>(0x637514a4), /* cu-Cyrl-RU */
+    static_cast<uint32_t>(0x63751a11), /* cu-Glag-BG */
+    static_cast<uint32_t>(0x637614a4), /* cv-Cyrl-RU */
+    static_cast<uint32_t>(0x63793542), /* cy-Latn-GB */
+    static_cast<uint32_t>(0x64613530), /* da-Latn-DK */
+    static_cast<uint32_t>(0x6465352e), /* de-Latn-DE */
+    static_cast<uint32_t>(0x64766985), /* dv-Thaa-MV */
+    static_cast<uint32_t>(0x647a6b19), /* dz-Tibt-BT */
+    static_cast<uint32_t>(0x65653547), /* ee-Latn-GH */
+    static_cast<uint32_t>(0x656c1e4d), /* el-Grek-GR */
+    static_cast<uint32_t>(0x656e3542), /* en-Latn-GB */
+    static_cast<uint32_t>(0x656e35c9), /* en-Latn-US */
+    static_cast<uint32_t>(0x656e5b42), /* en-Shaw-GB */
+    static_cast<uint32_t>(0x65733539), /* es-Latn-ES */
+    static_cast<uint32_t>(0x65733587), /* es-Latn-MX */
+    static_cast<uint32_t>(0x657335c9), /* es-Latn-US */
+    static_cast<uint32_t>(0x65743535), /* et-Latn-EE */
+    static_cast<uint32_t>(0x65753539), /* eu-Latn-ES */
+    static_cast<uint32_t>(0x6661035e), /* fa-Arab-IR */
+    static_cast<uint32_t>(0x6666014b), /* ff-Adlm-GN */
+    static_cast<uint32_t>(0x666635b0), /* ff-Latn-SN */
+    static_cast<uint32_t>(0x6669353b), /* fi-Latn-FI */
+    static_cast<uint32_t>(0x666a353c), /* fj-Latn-FJ */
+    static_cast<uint32_t>(0x666f353f), /* fo-Latn-FO */
+    static_cast<uint32_t>(0x66723540), /* fr-Latn-FR */
+    static_cast<uint32_t>(0x6679358f), /* fy-Latn-NL */
+    static_cast<uint32_t>(0x67613558), /* ga-Latn-IE */
+    static_cast<uint32_t>(0x67643542), /* gd-Latn-GB */
+    static_cast<uint32_t>(0x676c3539), /* gl-Latn-ES */
+    static_cast<uint32_t>(0x676e35a0), /* gn-Latn-PY */
+    static_cast<uint32_t>(0x67751f5b), /* gu-Gujr-IN */
+    static_cast<uint32_t>(0x6776355a), /* gv-Latn-IM */
+    static_cast<uint32_t>(0x6861358d), /* ha-Latn-NG */
+    static_cast<uint32_t>(0x68652559), /* he-Hebr-IL */
+    static_cast<uint32_t>(0x6869155b), /* hi-Deva-IN */
+    static_cast<uint32_t>(0x686f3598), /* ho-Latn-PG */
+    static_cast<uint32_t>(0x68723554), /* hr-Latn-HR */
+    static_cast<uint32_t>(0x68743555), /* ht-Latn-HT */
+    static_cast<uint32_t>(0x68753556), /* hu-Latn-HU */
+    static_cast<uint32_t>(0x68790505), /* hy-Armn-AM */
+    static_cast<uint32_t>(0x687a358a), /* hz-Latn-NA */
+    static_cast<uint32_t>(0x69643557), /* id-Latn-ID */
+    static_cast<uint32_t>(0x6967358d), /* ig-Latn-NG */
+    static_cast<uint32_t>(0x69697226), /* ii-Yiii-CN */
+    static_cast<uint32_t>(0x696b35c9), /* ik-Latn-US */
+    static_cast<uint32_t>(0x696e3557), /* in-Latn-ID */
+    static_cast<uint32_t>(0x6973355f), /* is-Latn-IS */
+    static_cast<uint32_t>(0x69743560), /* it-Latn-IT */
+    static_cast<uint32_t>(0x69750d1d), /* iu-Cans-CA */
+    static_cast<uint32_t>(0x69772559), /* iw-Hebr-IL */
+    static_cast<uint32_t>(0x6a612a64), /* ja-Jpan-JP */
+    static_cast<uint32_t>(0x6a6925c7), /* ji-Hebr-UA */
+    static_cast<uint32_t>(0x6a763557), /* jv-Latn-ID */
+    static_cast<uint32_t>(0x6a773557), /* jw-Latn-ID */
+    static_cast<uint32_t>(0x6b611944), /* ka-Geor-GE */
+    static_cast<uint32_t>(0x6b67351f), /* kg-Latn-CD */
+    static_cast<uint32_t>(0x6b693565), /* ki-Latn-KE */
+    static_cast<uint32_t>(0x6b6a358a), /* kj-Latn-NA */
+    static_cast<uint32_t>(0x6b6b0326), /* kk-Arab-CN */
+    static_cast<uint32_t>(0x6b6b146d), /* kk-Cyrl-KZ */
+    static_cast<uint32_t>(0x6b6c3549), /* kl-Latn-GL */
+    static_cast<uint32_t>(0x6b6d2e67), /* km-Khmr-KH */
+    static_cast<uint32_t>(0x6b6e315b), /* kn-Knda-IN */
+    static_cast<uint32_t>(0x6b6f326b), /* ko-Kore-KR */
+    static_cast<uint32_t>(0x6b73035b), /* ks-Arab-IN */
+    static_cast<uint32_t>(0x6b75035d), /* ku-Arab-IQ */
+    static_cast<uint32_t>(0x6b7535c2), /* ku-Latn-TR */
+    static_cast<uint32_t>(0x6b757144), /* ku-Yezi-GE */
+    static_cast<uint32_t>(0x6b7614a4), /* kv-Cyrl-RU */
+    static_cast<uint32_t>(0x6b773542), /* kw-Latn-GB */
+    static_cast<uint32_t>(0x6b790326), /* ky-Arab-CN */
+    static_cast<uint32_t>(0x6b791466), /* ky-Cyrl-KG */
+    static_cast<uint32_t>(0x6b7935c2), /* ky-Latn-TR */
+    static_cast<uint32_t>(0x6c6135cc), /* la-Latn-VA */
+    static_cast<uint32_t>(0x6c623575), /* lb-Latn-LU */
+    static_cast<uint32_t>(0x6c6735c8), /* lg-Latn-UG */
+    static_cast<uint32_t>(0x6c69358f), /* li-Latn-NL */
+    static_cast<uint32_t>(0x6c6e351f), /* ln-Latn-CD */
+    static_cast<uint32_t>(0x6c6f346e), /* lo-Laoo-LA */
+    static_cast<uint32_t>(0x6c743574), /* lt-Latn-LT */
+    static_cast<uint32_t>(0x6c75351f), /* lu-Latn-CD */
+    static_cast<uint32_t>(0x6c763576), /* lv-Latn-LV */
+    static_cast<uint32_t>(0x6d67357b), /* mg-Latn-MG */
+    static_cast<uint32_t>(0x6d68357c), /* mh-Latn-MH */
+    static_cast<uint32_t>(0x6d693594), /* mi-Latn-NZ */
+    static_cast<uint32_t>(0x6d6b147d), /* mk-Cyrl-MK */
+    static_cast<uint32_t>(0x6d6c415b), /* ml-Mlym-IN */
+    static_cast<uint32_t>(0x6d6e1480), /* mn-Cyrl-MN */
+    static_cast<uint32_t>(0x6d6e4226), /* mn-Mong-CN */
+    static_cast<uint32_t>(0x6d6f35a2), /* mo-Latn-RO */
+    static_cast<uint32_t>(0x6d72155b), /* mr-Deva-IN */
+    static_cast<uint32_t>(0x6d733588), /* ms-Latn-MY */
+    static_cast<uint32_t>(0x6d743583), /* mt-Latn-MT */
+    static_cast<uint32_t>(0x6d79457f), /* my-Mymr-MM */
+    static_cast<uint32_t>(0x6e613592), /* na-Latn-NR */
+    static_cast<uint32_t>(0x6e623590), /* nb-Latn-NO */
+    static_cast<uint32_t>(0x6e6435d9), /* nd-Latn-ZW */
+    static_cast<uint32_t>(0x6e651591), /* ne-Deva-NP */
+    static_cast<uint32_t>(0x6e67358a), /* ng-Latn-NA */
+    static_cast<uint32_t>(0x6e6c358f), /* nl-Latn-NL */
+    static_cast<uint32_t>(0x6e6e3590), /* nn-Latn-NO */
+    static_cast<uint32_t>(0x6e6f3590), /* no-Latn-NO */
+    static_cast<uint32_t>(0x6e7235d7), /* nr-Latn-ZA */
+    static_cast<uint32_t>(0x6e7635c9), /* nv-Latn-US */
+    static_cast<uint32_t>(0x6e793586), /* ny-Latn-MW */
+    static_cast<uint32_t>(0x6f633540), /* oc-Latn-FR */
+    static_cast<uint32_t>(0x6f6d353a), /* om-Latn-ET */
+    static_cast<uint32_t>(0x6f724d5b), /* or-Orya-IN */
+    static_cast<uint32_t>(0x6f731444), /* os-Cyrl-GE */
+    static_cast<uint32_t>(0x7061039a), /* pa-Arab-PK */
+    static_cast<uint32_t>(0x7061205b), /* pa-Guru-IN */
+    static_cast<uint32_t>(0x706c359b), /* pl-Latn-PL */
+    static_cast<uint32_t>(0x70730301), /* ps-Arab-AF */
+    static_cast<uint32_t>(0x70743517), /* pt-Latn-BR */
+    static_cast<uint32_t>(0x71753596), /* qu-Latn-PE */
+    static_cast<uint32_t>(0x726d3521), /* rm-Latn-CH */
+    static_cast<uint32_t>(0x726e3512), /* rn-Latn-BI */
+    static_cast<uint32_t>(0x726f35a2), /* ro-Latn-RO */
+    static_cast<uint32_t>(0x727514a4), /* ru-Cyrl-RU */
+    static_cast<uint32_t>(0x727735a5), /* rw-Latn-RW */
+    static_cast<uint32_t>(0x7361155b), /* sa-Deva-IN */
+    static_cast<uint32_t>(0x73633560), /* sc-Latn-IT */
+    static_cast<uint32_t>(0x7364039a), /* sd-Arab-PK */
+    static_cast<uint32_t>(0x7364155b), /* sd-Deva-IN */
+    static_cast<uint32_t>(0x73642f5b), /* sd-Khoj-IN */
+    static_cast<uint32_t>(0x73645c5b), /* sd-Sind-IN */
+    static_cast<uint32_t>(0x73653590), /* se-Latn-NO */
+    static_cast<uint32_t>(0x73673520), /* sg-Latn-CF */
+    static_cast<uint32_t>(0x73695d71), /* si-Sinh-LK */
+    static_cast<uint32_t>(0x736b35ae), /* sk-Latn-SK */
+    static_cast<uint32_t>(0x736c35ad), /* sl-Latn-SI */
+    static_cast<uint32_t>(0x736d35d3), /* sm-Latn-WS */
+    static_cast<uint32_t>(0x736e35d9), /* sn-Latn-ZW */
+    static_cast<uint32_t>(0x736f35b1), /* so-Latn-SO */
+    static_cast<uint32_t>(0x73713504), /* sq-Latn-AL */
+    static_cast<uint32_t>(0x737214a3), /* sr-Cyrl-RS */
+    static_cast<uint32_t>(0x737335d7), /* ss-Latn-ZA */
+    static_cast<uint32_t>(0x737435d7), /* st-Latn-ZA */
+    static_cast<uint32_t>(0x73753557), /* su-Latn-ID */
+    static_cast<uint32_t>(0x737635aa), /* sv-Latn-SE */
+    static_cast<uint32_t>(0x737735c6), /* sw-Latn-TZ */
+    static_cast<uint32_t>(0x7461645b), /* ta-Taml-IN */
+    static_cast<uint32_t>(0x7465675b), /* te-Telu-IN */
+    static_cast<uint32_t>(0x7467039a), /* tg-Arab-PK */
+    static_cast<uint32_t>(0x746714bc), /* tg-Cyrl-TJ */
+    static_cast<uint32_t>(0x74686abb), /* th-Thai-TH */
+    static_cast<uint32_t>(0x7469183a), /* ti-Ethi-ET */
+    static_cast<uint32_t>(0x746b35bf), /* tk-Latn-TM */
+    static_cast<uint32_t>(0x746c3599), /* tl-Latn-PH */
+    static_cast<uint32_t>(0x746e35d7), /* tn-Latn-ZA */
+    static_cast<uint32_t>(0x746f35c1), /* to-Latn-TO */
+    static_cast<uint32_t>(0x747235c2), /* tr-Latn-TR */
+    static_cast<uint32_t>(0x747335d7), /* ts-Latn-ZA */
+    static_cast<uint32_t>(0x747414a4), /* tt-Cyrl-RU */
+    static_cast<uint32_t>(0x74793597), /* ty-Latn-PF */
+    static_cast<uint32_t>(0x75670326), /* ug-Arab-CN */
+    static_cast<uint32_t>(0x7567146d), /* ug-Cyrl-KZ */
+    static_cast<uint32_t>(0x756b14c7), /* uk-Cyrl-UA */
+    static_cast<uint32_t>(0x7572039a), /* ur-Arab-PK */
+    static_cast<uint32_t>(0x757a0301), /* uz-Arab-AF */
+    static_cast<uint32_t>(0x757a35cb), /* uz-Latn-UZ */
+    static_cast<uint32_t>(0x766535d7), /* ve-Latn-ZA */
+    static_cast<uint32_t>(0x766935d0), /* vi-Latn-VN */
+    static_cast<uint32_t>(0x7761350f), /* wa-Latn-BE */
+    static_cast<uint32_t>(0x776f35b0), /* wo-Latn-SN */
+    static_cast<uint32_t>(0x786835d7), /* xh-Latn-ZA */
+    static_cast<uint32_t>(0x796f358d), /* yo-Latn-NG */
+    static_cast<uint32_t>(0x7a613526), /* za-Latn-CN */
+    static_cast<uint32_t>(0x7a680ac5), /* zh-Bopo-TW */
+    static_cast<uint32_t>(0x7a6821c5), /* zh-Hanb-TW */
+    static_cast<uint32_t>(0x7a682226), /* zh-Hans-CN */
+    static_cast<uint32_t>(0x7a6823c5), /* zh-Hant-TW */
+    static_cast<uint32_t>(0x7a7535d7), /* zu-Latn-ZA */
+    static_cast<uint32_t>(0x80313547), /* abr-Latn-GH */
+    static_cast<uint32_t>(0x80443557), /* ace-Latn-ID */
+    static_cast<uint32_t>(0x804735c8), /* ach-Latn-UG */
+    static_cast<uint32_t>(0x80603547), /* ada-Latn-GH */
+    static_cast<uint32_t>(0x806f6b19), /* adp-Tibt-BT */
+    static_cast<uint32_t>(0x807814a4), /* ady-Cyrl-RU */
+    static_cast<uint32_t>(0x808103c0), /* aeb-Arab-TN */
+    static_cast<uint32_t>(0x80d03525), /* agq-Latn-CM */
+    static_cast<uint32_t>(0x80ee025b), /* aho-Ahom-IN */
+    static_cast<uint32_t>(0x814a705d), /* akk-Xsux-IQ */
+    static_cast<uint32_t>(0x816d35d4), /* aln-Latn-XK */
+    static_cast<uint32_t>(0x817314a4), /* alt-Cyrl-RU */
+    static_cast<uint32_t>(0x818e358d), /* amo-Latn-NG */
+    static_cast<uint32_t>(0x81d93557), /* aoz-Latn-ID */
+    static_cast<uint32_t>(0x81e303ba), /* apd-Arab-TG */
+    static_cast<uint32_t>(0x8222045e), /* arc-Armi-IR */
+    static_cast<uint32_t>(0x82224763), /* arc-Nbat-JO */
+    static_cast<uint32_t>(0x82224fb7), /* arc-Palm-SY */
+    static_cast<uint32_t>(0x822d3524), /* arn-Latn-CL */
+    static_cast<uint32_t>(0x822e3516), /* aro-Latn-BO */
+    static_cast<uint32_t>(0x82300333), /* arq-Arab-DZ */
+    static_cast<uint32_t>(0x823203a6), /* ars-Arab-SA */
+    static_cast<uint32_t>(0x82380378), /* ary-Arab-MA */
+    static_cast<uint32_t>(0x82390336), /* arz-Arab-EG */
+    static_cast<uint32_t>(0x824035c6), /* asa-Latn-TZ */
+    static_cast<uint32_t>(0x82445ac9), /* ase-Sgnw-US */
+    static_cast<uint32_t>(0x82533539), /* ast-Latn-ES */
+    static_cast<uint32_t>(0x8269351d), /* atj-Latn-CA */
+    static_cast<uint32_t>(0x82c0155b), /* awa-Deva-IN */
+    static_cast<uint32_t>(0x840b039a), /* bal-Arab-PK */
+    static_cast<uint32_t>(0x840d3557), /* ban-Latn-ID */
+    static_cast<uint32_t>(0x840f1591), /* bap-Deva-NP */
+    static_cast<uint32_t>(0x84113508), /* bar-Latn-AT */
+    static_cast<uint32_t>(0x84123525), /* bas-Latn-CM */
+    static_cast<uint32_t>(0x84170725), /* bax-Bamu-CM */
+    static_cast<uint32_t>(0x84223557), /* bbc-Latn-ID */
+    static_cast<uint32_t>(0x84293525), /* bbj-Latn-CM */
+    static_cast<uint32_t>(0x84483522), /* bci-Latn-CI */
+    static_cast<uint32_t>(0x848903a9), /* bej-Arab-SD */
+    static_cast<uint32_t>(0x848c35d8), /* bem-Latn-ZM */
+    static_cast<uint32_t>(0x84963557), /* bew-Latn-ID */
+    static_cast<uint32_t>(0x849935c6), /* bez-Latn-TZ */
+    static_cast<uint32_t>(0x84a33525), /* bfd-Latn-CM */
+    static_cast<uint32_t>(0x84b0645b), /* bfq-Taml-IN */
+    static_cast<uint32_t>(0x84b3039a), /* bft-Arab-PK */
+    static_cast<uint32_t>(0x84b8155b), /* bfy-Deva-IN */
+    static_cast<uint32_t>(0x84c2155b), /* bgc-Deva-IN */
+    static_cast<uint32_t>(0x84cd039a), /* bgn-Arab-PK */
+    static_cast<uint32_t>(0x84d71ec2), /* bgx-Grek-TR */
+    static_cast<uint32_t>(0x84e1155b), /* bhb-Deva-IN */
+    static_cast<uint32_t>(0x84e8155b), /* bhi-Deva-IN */
+    static_cast<uint32_t>(0x84ee155b), /* bho-Deva-IN */
+    static_cast<uint32_t>(0x850a3599), /* bik-Latn-PH */
+    static_cast<uint32_t>(0x850d358d), /* bin-Latn-NG */
+    static_cast<uint32_t>(0x8529155b), /* bjj-Deva-IN */
+    static_cast<uint32_t>(0x852d3557), /* bjn-Latn-ID */
+    static_cast<uint32_t>(0x853335b0), /* bjt-Latn-SN */
+    static_cast<uint32_t>(0x854c3525), /* bkm-Latn-CM */
+    static_cast<uint32_t>(0x85543599), /* bku-Latn-PH */
+    static_cast<uint32_t>(0x857366d0), /* blt-Tavt-VN */
+    static_cast<uint32_t>(0x8590357e), /* bmq-Latn-ML */
+    static_cast<uint32_t>(0x85f8095b), /* bpy-Beng-IN */
+    static_cast<uint32_t>(0x8608035e), /* bqi-Arab-IR */
+    static_cast<uint32_t>(0x86153522), /* bqv-Latn-CI */
+    static_cast<uint32_t>(0x8620155b), /* bra-Deva-IN */
+    static_cast<uint32_t>(0x8627039a), /* brh-Arab-PK */
+    static_cast<uint32_t>(0x8637155b), /* brx-Deva-IN */
+    static_cast<uint32_t>(0x86500872), /* bsq-Bass-LR */
+    static_cast<uint32_t>(0x86523525), /* bss-Latn-CM */
+    static_cast<uint32_t>(0x866e3599), /* bto-Latn-PH */
+    static_cast<uint32_t>(0x8675159a), /* btv-Deva-PK */
+    static_cast<uint32_t>(0x868014a4), /* bua-Cyrl-RU */
+    static_cast<uint32_t>(0x868235d6), /* buc-Latn-YT */
+    static_cast<uint32_t>(0x86863557), /* bug-Latn-ID */
+    static_cast<uint32_t>(0x868c3525), /* bum-Latn-CM */
+    static_cast<uint32_t>(0x86a1354c), /* bvb-Latn-GQ */
+    static_cast<uint32_t>(0x870d1838), /* byn-Ethi-ER */
+    static_cast<uint32_t>(0x87153525), /* byv-Latn-CM */
+    static_cast<uint32_t>(0x8724357e), /* bze-Latn-ML */
+    static_cast<uint32_t>(0x880335c9), /* cad-Latn-US */
+    static_cast<uint32_t>(0x8847358d), /* cch-Latn-NG */
+    static_cast<uint32_t>(0x884f0c0e), /* ccp-Cakm-BD */
+    static_cast<uint32_t>(0x88813599), /* ceb-Latn-PH */
+    static_cast<uint32_t>(0x88c635c8), /* cgg-Latn-UG */
+    static_cast<uint32_t>(0x88ea353e), /* chk-Latn-FM */
+    static_cast<uint32_t>(0x88ec14a4), /* chm-Cyrl-RU */
+    static_cast<uint32_t>(0x88ee35c9), /* cho-Latn-US */
+    static_cast<uint32_t>(0x88ef351d), /* chp-Latn-CA */
+    static_cast<uint32_t>(0x88f110c9), /* chr-Cher-US */
+    static_cast<uint32_t>(0x890235c9), /* cic-Latn-US */
+    static_cast<uint32_t>(0x89200367), /* cja-Arab-KH */
+    static_cast<uint32_t>(0x892c0fd0), /* cjm-Cham-VN */
+    static_cast<uint32_t>(0x8941035d), /* ckb-Arab-IQ */
+    static_cast<uint32_t>(0x89866080), /* cmg-Soyo-MN */
+    static_cast<uint32_t>(0x89cf1236), /* cop-Copt-EG */
+    static_cast<uint32_t>(0x89f23599), /* cps-Latn-PH */
+    static_cast<uint32_t>(0x8a2714c7), /* crh-Cyrl-UA */
+    static_cast<uint32_t>(0x8a290d1d), /* crj-Cans-CA */
+    static_cast<uint32_t>(0x8a2a0d1d), /* crk-Cans-CA */
+    static_cast<uint32_t>(0x8a2b0d1d), /* crl-Cans-CA */
+    static_cast<uint32_t>(0x8a2c0d1d), /* crm-Cans-CA */
+    static_cast<uint32_t>(0x8a3235a8), /* crs-Latn-SC */
+    static_cast<uint32_t>(0x8a41359b), /* csb-Latn-PL */
+    static_cast<uint32_t>(0x8a560d1d), /* csw-Cans-CA */
+    static_cast<uint32_t>(0x8a63507f), /* ctd-Pauc-MM */
+    static_cast<uint32_t>(0x8c053522), /* daf-Latn-CI */
+    static_cast<uint32_t>(0x8c0a35c9), /* dak-Latn-US */
+    static_cast<uint32_t>(0x8c1114a4), /* dar-Cyrl-RU */
+    static_cast<uint32_t>(0x8c153565), /* dav-Latn-KE */
+    static_cast<uint32_t>(0x8c42035b), /* dcc-Arab-IN */
+    static_cast<uint32_t>(0x8c8d351d), /* den-Latn-CA */
+    static_cast<uint32_t>(0x8cd1351d), /* dgr-Latn-CA */
+    static_cast<uint32_t>(0x8d24358b), /* dje-Latn-NE */
+    static_cast<uint32_t>(0x8da93522), /* dnj-Latn-CI */
+    static_cast<uint32_t>(0x8dc8155b), /* doi-Deva-IN */
+    static_cast<uint32_t>(0x8e274226), /* drh-Mong-CN */
+    static_cast<uint32_t>(0x8e41352e), /* dsb-Latn-DE */
+    static_cast<uint32_t>(0x8e6c357e), /* dtm-Latn-ML */
+    static_cast<uint32_t>(0x8e6f3588), /* dtp-Latn-MY */
+    static_cast<uint32_t>(0x8e781591), /* dty-Deva-NP */
+    static_cast<uint32_t>(0x8e803525), /* dua-Latn-CM */
+    static_cast<uint32_t>(0x8f0e35b0), /* dyo-Latn-SN */
+    static_cast<uint32_t>(0x8f143510), /* dyu-Latn-BF */
+    static_cast<uint32_t>(0x90343565), /* ebu-Latn-KE */
+    static_cast<uint32_t>(0x90a8358d), /* efi-Latn-NG */
+    static_cast<uint32_t>(0x90cb3560), /* egl-Latn-IT */
+    static_cast<uint32_t>(0x90d81736), /* egy-Egyp-EG */
+    static_cast<uint32_t>(0x91582b7f), /* eky-Kali-MM */
+    static_cast<uint32_t>(0x92461c5b), /* esg-Gonm-IN */
+    static_cast<uint32_t>(0x925435c9), /* esu-Latn-US */
+    static_cast<uint32_t>(0x92732960), /* ett-Ital-IT */
+    static_cast<uint32_t>(0x92ce3525), /* ewo-Latn-CM */
+    static_cast<uint32_t>(0x92f33539), /* ext-Latn-ES */
+    static_cast<uint32_t>(0x940d354c), /* fan-Latn-GQ */
+    static_cast<uint32_t>(0x94ac357e), /* ffm-Latn-ML */
+    static_cast<uint32_t>(0x950003a9), /* fia-Arab-SD */
+    static_cast<uint32_t>(0x950b3599), /* fil-Latn-PH */
+    static_cast<uint32_t>(0x951335aa), /* fit-Latn-SE */
+    static_cast<uint32_t>(0x95cd3513), /* fon-Latn-BJ */
+    static_cast<uint32_t>(0x962235c9), /* frc-Latn-US */
+    static_cast<uint32_t>(0x962f3540), /* frp-Latn-FR */
+    static_cast<uint32_t>(0x9631352e), /* frr-Latn-DE */
+    static_cast<uint32_t>(0x9632352e), /* frs-Latn-DE */
+    static_cast<uint32_t>(0x96810325), /* fub-Arab-CM */
+    static_cast<uint32_t>(0x968335d2), /* fud-Latn-WF */
+    static_cast<uint32_t>(0x9685354b), /* fuf-Latn-GN */
+    static_cast<uint32_t>(0x9690358b), /* fuq-Latn-NE */
+    static_cast<uint32_t>(0x96913560), /* fur-Latn-IT */
+    static_cast<uint32_t>(0x9695358d), /* fuv-Latn-NG */
+    static_cast<uint32_t>(0x96b135a9), /* fvr-Latn-SD */
+    static_cast<uint32_t>(0x98003547), /* gaa-Latn-GH */
+    static_cast<uint32_t>(0x98063579), /* gag-Latn-MD */
+    static_cast<uint32_t>(0x980d2226), /* gan-Hans-CN */
+    static_cast<uint32_t>(0x98183557), /* gay-Latn-ID */
+    static_cast<uint32_t>(0x982c155b), /* gbm-Deva-IN */
+    static_cast<uint32_t>(0x9839035e), /* gbz-Arab-IR */
+    static_cast<uint32_t>(0x98513545), /* gcr-Latn-GF */
+    static_cast<uint32_t>(0x9899183a), /* gez-Ethi-ET */
+    static_cast<uint32_t>(0x98cd1591), /* ggn-Deva-NP */
+    static_cast<uint32_t>(0x990b3568), /* gil-Latn-KI */
+    static_cast<uint32_t>(0x992a039a), /* gjk-Arab-PK */
+    static_cast<uint32_t>(0x9934039a), /* gju-Arab-PK */
+    static_cast<uint32_t>(0x996a035e), /* glk-Arab-IR */
+    static_cast<uint32_t>(0x99cc155b), /* gom-Deva-IN */
+    static_cast<uint32_t>(0x99cd675b), /* gon-Telu-IN */
+    static_cast<uint32_t>(0x99d13557), /* gor-Latn-ID */
+    static_cast<uint32_t>(0x99d2358f), /* gos-Latn-NL */
+    static_cast<uint32_t>(0x99d31dc7), /* got-Goth-UA */
+    static_cast<uint32_t>(0x9a22132c), /* grc-Cprt-CY */
+    static_cast<uint32_t>(0x9a22394d), /* grc-Linb-GR */
+    static_cast<uint32_t>(0x9a33095b), /* grt-Beng-IN */
+    static_cast<uint32_t>(0x9a563521), /* gsw-Latn-CH */
+    static_cast<uint32_t>(0x9a813517), /* gub-Latn-BR */
+    static_cast<uint32_t>(0x9a823527), /* guc-Latn-CO */
+    static_cast<uint32_t>(0x9a913547), /* gur-Latn-GH */
+    static_cast<uint32_t>(0x9a993565), /* guz-Latn-KE */
+    static_cast<uint32_t>(0x9ab11591), /* gvr-Deva-NP */
+    static_cast<uint32_t>(0x9ac8351d), /* gwi-Latn-CA */
+    static_cast<uint32_t>(0x9c0a2226), /* hak-Hans-CN */
+    static_cast<uint32_t>(0x9c1635c9), /* haw-Latn-US */
+    static_cast<uint32_t>(0x9c190301), /* haz-Arab-AF */
+    static_cast<uint32_t>(0x9d05353c), /* hif-Latn-FJ */
+    static_cast<uint32_t>(0x9d0b3599), /* hil-Latn-PH */
+    static_cast<uint32_t>(0x9d7426c2), /* hlu-Hluw-TR */
+    static_cast<uint32_t>(0x9d835426), /* hmd-Plrd-CN */
+    static_cast<uint32_t>(0x9da3039a), /* hnd-Arab-PK */
+    static_cast<uint32_t>(0x9da4155b), /* hne-Deva-IN */
+    static_cast<uint32_t>(0x9da9276e), /* hnj-Hmng-LA */
+    static_cast<uint32_t>(0x9dad3599), /* hnn-Latn-PH */
+    static_cast<uint32_t>(0x9dae039a), /* hno-Arab-PK */
+    static_cast<uint32_t>(0x9dc2155b), /* hoc-Deva-IN */
+    static_cast<uint32_t>(0x9dc9155b), /* hoj-Deva-IN */
+    static_cast<uint32_t>(0x9e41352e), /* hsb-Latn-DE */
+    static_cast<uint32_t>(0x9e4d2226), /* hsn-Hans-CN */
+    static_cast<uint32_t>(0xa0203588), /* iba-Latn-MY */
+    static_cast<uint32_t>(0xa021358d), /* ibb-Latn-NG */
+    static_cast<uint32_t>(0xa0a435ba), /* ife-Latn-TG */
+    static_cast<uint32_t>(0xa153351d), /* ikt-Latn-CA */
+    static_cast<uint32_t>(0xa16e3599), /* ilo-Latn-PH */
+    static_cast<uint32_t>(0xa1a714a4), /* inh-Cyrl-RU */
+    static_cast<uint32_t>(0xa32735a4), /* izh-Latn-RU */
+    static_cast<uint32_t>(0xa40c3562), /* jam-Latn-JM */
+    static_cast<uint32_t>(0xa4ce3525), /* jgo-Latn-CM */
+    static_cast<uint32_t>(0xa58235c6), /* jmc-Latn-TZ */
+    static_cast<uint32_t>(0xa58b1591), /* jml-Deva-NP */
+    static_cast<uint32_t>(0xa6933530), /* jut-Latn-DK */
+    static_cast<uint32_t>(0xa80014cb), /* kaa-Cyrl-UZ */
+    static_cast<uint32_t>(0xa8013533), /* kab-Latn-DZ */
+    static_cast<uint32_t>(0xa802357f), /* kac-Latn-MM */
+    static_cast<uint32_t>(0xa809358d), /* kaj-Latn-NG */
+    static_cast<uint32_t>(0xa80c3565), /* kam-Latn-KE */
+    static_cast<uint32_t>(0xa80e357e), /* kao-Latn-ML */
+    static_cast<uint32_t>(0xa82314a4), /* kbd-Cyrl-RU */
+    static_cast<uint32_t>(0xa838038b), /* kby-Arab-NE */
+    static_cast<uint32_t>(0xa846358d), /* kcg-Latn-NG */
+    static_cast<uint32_t>(0xa84a35d9), /* kck-Latn-ZW */
+    static_cast<uint32_t>(0xa86435c6), /* kde-Latn-TZ */
+    static_cast<uint32_t>(0xa86703ba), /* kdh-Arab-TG */
+    static_cast<uint32_t>(0xa8736abb), /* kdt-Thai-TH */
+    static_cast<uint32_t>(0xa880352a), /* kea-Latn-CV */
+    static_cast<uint32_t>(0xa88d3525), /* ken-Latn-CM */
+    static_cast<uint32_t>(0xa8ae3522), /* kfo-Latn-CI */
+    static_cast<uint32_t>(0xa8b1155b), /* kfr-Deva-IN */
+    static_cast<uint32_t>(0xa8b8155b), /* kfy-Deva-IN */
+    static_cast<uint32_t>(0xa8c43557), /* kge-Latn-ID */
+    static_cast<uint32_t>(0xa8cf3517), /* kgp-Latn-BR */
+    static_cast<uint32_t>(0xa8e0355b), /* kha-Latn-IN */
+    static_cast<uint32_t>(0xa8e16326), /* khb-Talu-CN */
+    static_cast<uint32_t>(0xa8ed155b), /* khn-Deva-IN */
+    static_cast<uint32_t>(0xa8f0357e), /* khq-Latn-ML */
+    static_cast<uint32_t>(0xa8f3455b), /* kht-Mymr-IN */
+    static_cast<uint32_t>(0xa8f6039a), /* khw-Arab-PK */
+    static_cast<uint32_t>(0xa91435c2), /* kiu-Latn-TR */
+    static_cast<uint32_t>(0xa926346e), /* kjg-Laoo-LA */
+    static_cast<uint32_t>(0xa9493525), /* kkj-Latn-CM */
+    static_cast<uint32_t>(0xa96d3565), /* kln-Latn-KE */
+    static_cast<uint32_t>(0xa9813506), /* kmb-Latn-AO */
+    static_cast<uint32_t>(0xa9a53550), /* knf-Latn-GW */
+    static_cast<uint32_t>(0xa9c814a4), /* koi-Cyrl-RU */
+    static_cast<uint32_t>(0xa9ca155b), /* kok-Deva-IN */
+    static_cast<uint32_t>(0xa9d2353e), /* kos-Latn-FM */
+    static_cast<uint32_t>(0xa9e43572), /* kpe-Latn-LR */
+    static_cast<uint32_t>(0xaa2214a4), /* krc-Cyrl-RU */
+    static_cast<uint32_t>(0xaa2835af), /* kri-Latn-SL */
+    static_cast<uint32_t>(0xaa293599), /* krj-Latn-PH */
+    static_cast<uint32_t>(0xaa2b35a4), /* krl-Latn-RU */
+    static_cast<uint32_t>(0xaa34155b), /* kru-Deva-IN */
+    static_cast<uint32_t>(0xaa4135c6), /* ksb-Latn-TZ */
+    static_cast<uint32_t>(0xaa453525), /* ksf-Latn-CM */
+    static_cast<uint32_t>(0xaa47352e), /* ksh-Latn-DE */
+    static_cast<uint32_t>(0xaa713588), /* ktr-Latn-MY */
+    static_cast<uint32_t>(0xaa8c14a4), /* kum-Cyrl-RU */
+    static_cast<uint32_t>(0xaab13557), /* kvr-Latn-ID */
+    static_cast<uint32_t>(0xaab7039a), /* kvx-Arab-PK */
+    static_cast<uint32_t>(0xaaeb155b), /* kxl-Deva-IN */
+    static_cast<uint32_t>(0xaaec6abb), /* kxm-Thai-TH */
+    static_cast<uint32_t>(0xaaef039a), /* kxp-Arab-PK */
+    static_cast<uint32_t>(0xab293588), /* kzj-Latn-MY */
+    static_cast<uint32_t>(0xab333588), /* kzt-Latn-MY */
+    static_cast<uint32_t>(0xac01384d), /* lab-Lina-GR */
+    static_cast<uint32_t>(0xac032559), /* lad-Hebr-IL */
+    static_cast<uint32_t>(0xac0635c6), /* lag-Latn-TZ */
+    static_cast<uint32_t>(0xac07039a), /* lah-Arab-PK */
+    static_cast<uint32_t>(0xac0935c8), /* laj-Latn-UG */
+    static_cast<uint32_t>(0xac2414a4), /* lbe-Cyrl-RU */
+    static_cast<uint32_t>(0xac363557), /* lbw-Latn-ID */
+    static_cast<uint32_t>(0xac4f6a26), /* lcp-Thai-CN */
+    static_cast<uint32_t>(0xac8f365b), /* lep-Lepc-IN */
+    static_cast<uint32_t>(0xac9914a4), /* lez-Cyrl-RU */
+    static_cast<uint32_t>(0xad051591), /* lif-Deva-NP */
+    static_cast<uint32_t>(0xad05375b), /* lif-Limb-IN */
+    static_cast<uint32_t>(0xad093560), /* lij-Latn-IT */
+    static_cast<uint32_t>(0xad123a26), /* lis-Lisu-CN */
+    static_cast<uint32_t>(0xad2f3557), /* ljp-Latn-ID */
+    static_cast<uint32_t>(0xad48035e), /* lki-Arab-IR */
+    static_cast<uint32_t>(0xad5335c9), /* lkt-Latn-US */
+    static_cast<uint32_t>(0xad8d675b), /* lmn-Telu-IN */
+    static_cast<uint32_t>(0xad8e3560), /* lmo-Latn-IT */
+    static_cast<uint32_t>(0xadcb351f), /* lol-Latn-CD */
+    static_cast<uint32_t>(0xadd935d8), /* loz-Latn-ZM */
+    static_cast<uint32_t>(0xae22035e), /* lrc-Arab-IR */
+    static_cast<uint32_t>(0xae663576), /* ltg-Latn-LV */
+    static_cast<uint32_t>(0xae80351f), /* lua-Latn-CD */
+    static_cast<uint32_t>(0xae8e3565), /* luo-Latn-KE */
+    static_cast<uint32_t>(0xae983565), /* luy-Latn-KE */
+    static_cast<uint32_t>(0xae99035e), /* luz-Arab-IR */
+    static_cast<uint32_t>(0xaecb6abb), /* lwl-Thai-TH */
+    static_cast<uint32_t>(0xaf272226), /* lzh-Hans-CN */
+    static_cast<uint32_t>(0xaf3935c2), /* lzz-Latn-TR */
+    static_cast<uint32_t>(0xb0033557), /* mad-Latn-ID */
+    static_cast<uint32_t>(0xb0053525), /* maf-Latn-CM */
+    static_cast<uint32_t>(0xb006155b), /* mag-Deva-IN */
+    static_cast<uint32_t>(0xb008155b), /* mai-Deva-IN */
+    static_cast<uint32_t>(0xb00a3557), /* mak-Latn-ID */
+    static_cast<uint32_t>(0xb00d354a), /* man-Latn-GM */
+    static_cast<uint32_t>(0xb00d484b), /* man-Nkoo-GN */
+    static_cast<uint32_t>(0xb0123565), /* mas-Latn-KE */
+    static_cast<uint32_t>(0xb0193587), /* maz-Latn-MX */
+    static_cast<uint32_t>(0xb06514a4), /* mdf-Cyrl-RU */
+    static_cast<uint32_t>(0xb0673599), /* mdh-Latn-PH */
+    static_cast<uint32_t>(0xb0713557), /* mdr-Latn-ID */
+    static_cast<uint32_t>(0xb08d35af), /* men-Latn-SL */
+    static_cast<uint32_t>(0xb0913565), /* mer-Latn-KE */
+    static_cast<uint32_t>(0xb0a003bb), /* mfa-Arab-TH */
+    static_cast<uint32_t>(0xb0a43584), /* mfe-Latn-MU */
+    static_cast<uint32_t>(0xb0c73589), /* mgh-Latn-MZ */
+    static_cast<uint32_t>(0xb0ce3525), /* mgo-Latn-CM */
+    static_cast<uint32_t>(0xb0cf1591), /* mgp-Deva-NP */
+    static_cast<uint32_t>(0xb0d835c6), /* mgy-Latn-TZ */
+    static_cast<uint32_t>(0xb10d3557), /* min-Latn-ID */
+    static_cast<uint32_t>(0xb112245d), /* mis-Hatr-IQ */
+    static_cast<uint32_t>(0xb1123f8d), /* mis-Medf-NG */
+    static_cast<uint32_t>(0xb17235a9), /* mls-Latn-SD */
+    static_cast<uint32_t>(0xb1a8095b), /* mni-Beng-IN */
+    static_cast<uint32_t>(0xb1b6457f), /* mnw-Mymr-MM */
+    static_cast<uint32_t>(0xb1c4351d), /* moe-Latn-CA */
+    static_cast<uint32_t>(0xb1c7351d), /* moh-Latn-CA */
+    static_cast<uint32_t>(0xb1d23510), /* mos-Latn-BF */
+    static_cast<uint32_t>(0xb2231591), /* mrd-Deva-NP */
+    static_cast<uint32_t>(0xb22914a4), /* mrj-Cyrl-RU */
+    static_cast<uint32_t>(0xb22e430e), /* mro-Mroo-BD */
+    static_cast<uint32_t>(0xb271155b), /* mtr-Deva-IN */
+    static_cast<uint32_t>(0xb2803525), /* mua-Latn-CM */
+    static_cast<uint32_t>(0xb29235c9), /* mus-Latn-US */
+    static_cast<uint32_t>(0xb2b8039a), /* mvy-Arab-PK */
+    static_cast<uint32_t>(0xb2ca357e), /* mwk-Latn-ML */
+    static_cast<uint32_t>(0xb2d1155b), /* mwr-Deva-IN */
+    static_cast<uint32_t>(0xb2d53557), /* mwv-Latn-ID */
+    static_cast<uint32_t>(0xb2d628c9), /* mww-Hmnp-US */
+    static_cast<uint32_t>(0xb2e235d9), /* mxc-Latn-ZW */
+    static_cast<uint32_t>(0xb31514a4), /* myv-Cyrl-RU */
+    static_cast<uint32_t>(0xb31735c8), /* myx-Latn-UG */
+    static_cast<uint32_t>(0xb3193d5e), /* myz-Mand-IR */
+    static_cast<uint32_t>(0xb32d035e), /* mzn-Arab-IR */
+    static_cast<uint32_t>(0xb40d2226), /* nan-Hans-CN */
+    static_cast<uint32_t>(0xb40f3560), /* nap-Latn-IT */
+    static_cast<uint32_t>(0xb410358a), /* naq-Latn-NA */
+    static_cast<uint32_t>(0xb4473587), /* nch-Latn-MX */
+    static_cast<uint32_t>(0xb4623589), /* ndc-Latn-MZ */
+    static_cast<uint32_t>(0xb472352e), /* nds-Latn-DE */
+    static_cast<uint32_t>(0xb4961591), /* new-Deva-NP */
+    static_cast<uint32_t>(0xb4cb3589), /* ngl-Latn-MZ */
+    static_cast<uint32_t>(0xb4e43587), /* nhe-Latn-MX */
+    static_cast<uint32_t>(0xb4f63587), /* nhw-Latn-MX */
+    static_cast<uint32_t>(0xb5093557), /* nij-Latn-ID */
+    static_cast<uint32_t>(0xb5143593), /* niu-Latn-NU */
+    static_cast<uint32_t>(0xb52e355b), /* njo-Latn-IN */
+    static_cast<uint32_t>(0xb5863525), /* nmg-Latn-CM */
+    static_cast<uint32_t>(0xb5a73525), /* nnh-Latn-CM */
+    static_cast<uint32_t>(0xb5af6e5b), /* nnp-Wcho-IN */
+    static_cast<uint32_t>(0xb5c333bb), /* nod-Lana-TH */
+    static_cast<uint32_t>(0xb5c4155b), /* noe-Deva-IN */
+    static_cast<uint32_t>(0xb5cd56aa), /* non-Runr-SE */
+    static_cast<uint32_t>(0xb60e484b), /* nqo-Nkoo-GN */
+    static_cast<uint32_t>(0xb64a0d1d), /* nsk-Cans-CA */
+    static_cast<uint32_t>(0xb64e35d7), /* nso-Latn-ZA */
+    static_cast<uint32_t>(0xb69235b3), /* nus-Latn-SS */
+    static_cast<uint32_t>(0xb6f03526), /* nxq-Latn-CN */
+    static_cast<uint32_t>(0xb70c35c6), /* nym-Latn-TZ */
+    static_cast<uint32_t>(0xb70d35c8), /* nyn-Latn-UG */
+    static_cast<uint32_t>(0xb7283547), /* nzi-Latn-GH */
+    static_cast<uint32_t>(0xba404ec9), /* osa-Osge-US */
+    static_cast<uint32_t>(0xba6a4c80), /* otk-Orkh-MN */
+    static_cast<uint32_t>(0xbc063599), /* pag-Latn-PH */
+    static_cast<uint32_t>(0xbc0b515e), /* pal-Phli-IR */
+    static_cast<uint32_t>(0xbc0b5226), /* pal-Phlp-CN */
+    static_cast<uint32_t>(0xbc0c3599), /* pam-Latn-PH */
+    static_cast<uint32_t>(0xbc0f350a), /* pap-Latn-AW */
+    static_cast<uint32_t>(0xbc14359f), /* pau-Latn-PW */
+    static_cast<uint32_t>(0xbc433540), /* pcd-Latn-FR */
+    static_cast<uint32_t>(0xbc4c358d), /* pcm-Latn-NG */
+    static_cast<uint32_t>(0xbc6235c9), /* pdc-Latn-US */
+    static_cast<uint32_t>(0xbc73351d), /* pdt-Latn-CA */
+    static_cast<uint32_t>(0xbc8e6f5e), /* peo-Xpeo-IR */
+    static_cast<uint32_t>(0xbcab352e), /* pfl-Latn-DE */
+    static_cast<uint32_t>(0xbced536f), /* phn-Phnx-LB */
+    static_cast<uint32_t>(0xbd400b5b), /* pka-Brah-IN */
+    static_cast<uint32_t>(0xbd4e3565), /* pko-Latn-KE */
+    static_cast<uint32_t>(0xbd923560), /* pms-Latn-IT */
+    static_cast<uint32_t>(0xbdb31e4d), /* pnt-Grek-GR */
+    static_cast<uint32_t>(0xbdcd353e), /* pon-Latn-FM */
+    static_cast<uint32_t>(0xbde0155b), /* ppa-Deva-IN */
+    static_cast<uint32_t>(0xbe202d9a), /* pra-Khar-PK */
+    static_cast<uint32_t>(0xbe23035e), /* prd-Arab-IR */
+    static_cast<uint32_t>(0xbe943541), /* puu-Latn-GA */
+    static_cast<uint32_t>(0xc282354e), /* quc-Latn-GT */
+    static_cast<uint32_t>(0xc2863534), /* qug-Latn-EC */
+    static_cast<uint32_t>(0xc409155b), /* raj-Deva-IN */
+    static_cast<uint32_t>(0xc44535a1), /* rcf-Latn-RE */
+    static_cast<uint32_t>(0xc4893557), /* rej-Latn-ID */
+    static_cast<uint32_t>(0xc4cd3560), /* rgn-Latn-IT */
+    static_cast<uint32_t>(0xc4e6037f), /* rhg-Arab-MM */
+    static_cast<uint32_t>(0xc500355b), /* ria-Latn-IN */
+    static_cast<uint32_t>(0xc5056878), /* rif-Tfng-MA */
+    static_cast<uint32_t>(0xc5321591), /* rjs-Deva-NP */
+    static_cast<uint32_t>(0xc553090e), /* rkt-Beng-BD */
+    static_cast<uint32_t>(0xc585353b), /* rmf-Latn-FI */
+    static_cast<uint32_t>(0xc58e3521), /* rmo-Latn-CH */
+    static_cast<uint32_t>(0xc593035e), /* rmt-Arab-IR */
+    static_cast<uint32_t>(0xc59435aa), /* rmu-Latn-SE */
+    static_cast<uint32_t>(0xc5a63589), /* rng-Latn-MZ */
+    static_cast<uint32_t>(0xc5c13557), /* rob-Latn-ID */
+    static_cast<uint32_t>(0xc5c535c6), /* rof-Latn-TZ */
+    static_cast<uint32_t>(0xc66c353c), /* rtm-Latn-FJ */
+    static_cast<uint32_t>(0xc68414c7), /* rue-Cyrl-UA */
+    static_cast<uint32_t>(0xc68635a7), /* rug-Latn-SB */
+    static_cast<uint32_t>(0xc6ca35c6), /* rwk-Latn-TZ */
+    static_cast<uint32_t>(0xc7142c64), /* ryu-Kana-JP */
+    static_cast<uint32_t>(0xc8053547), /* saf-Latn-GH */
+    static_cast<uint32_t>(0xc80714a4), /* sah-Cyrl-RU */
+    static_cast<uint32_t>(0xc8103565), /* saq-Latn-KE */
+    static_cast<uint32_t>(0xc8123557), /* sas-Latn-ID */
+    static_cast<uint32_t>(0xc8134b5b), /* sat-Olck-IN */
+    static_cast<uint32_t>(0xc81535b0), /* sav-Latn-SN */
+    static_cast<uint32_t>(0xc819595b), /* saz-Saur-IN */
+    static_cast<uint32_t>(0xc82f35c6), /* sbp-Latn-TZ */
+    static_cast<uint32_t>(0xc84a155b), /* sck-Deva-IN */
+    static_cast<uint32_t>(0xc84d3560), /* scn-Latn-IT */
+    static_cast<uint32_t>(0xc84e3542), /* sco-Latn-GB */
+    static_cast<uint32_t>(0xc852351d), /* scs-Latn-CA */
+    static_cast<uint32_t>(0xc8623560), /* sdc-Latn-IT */
+    static_cast<uint32_t>(0xc867035e), /* sdh-Arab-IR */
+    static_cast<uint32_t>(0xc8853522), /* sef-Latn-CI */
+    static_cast<uint32_t>(0xc8873589), /* seh-Latn-MZ */
+    static_cast<uint32_t>(0xc8883587), /* sei-Latn-MX */
+    static_cast<uint32_t>(0xc892357e), /* ses-Latn-ML */
+    static_cast<uint32_t>(0xc8c04a58), /* sga-Ogam-IE */
+    static_cast<uint32_t>(0xc8d23574), /* sgs-Latn-LT */
+    static_cast<uint32_t>(0xc8e86878), /* shi-Tfng-MA */
+    static_cast<uint32_t>(0xc8ed457f), /* shn-Mymr-MM */
+    static_cast<uint32_t>(0xc903353a), /* sid-Latn-ET */
+    static_cast<uint32_t>(0xc951039a), /* skr-Arab-PK */
+    static_cast<uint32_t>(0xc968359b), /* sli-Latn-PL */
+    static_cast<uint32_t>(0xc9783557), /* sly-Latn-ID */
+    static_cast<uint32_t>(0xc98035aa), /* sma-Latn-SE */
+    static_cast<uint32_t>(0xc98935aa), /* smj-Latn-SE */
+    static_cast<uint32_t>(0xc98d353b), /* smn-Latn-FI */
+    static_cast<uint32_t>(0xc98f5759), /* smp-Samr-IL */
+    static_cast<uint32_t>(0xc992353b), /* sms-Latn-FI */
+    static_cast<uint32_t>(0xc9aa357e), /* snk-Latn-ML */
+    static_cast<uint32_t>(0xc9c65ecb), /* sog-Sogd-UZ */
+    static_cast<uint32_t>(0xc9d46abb), /* sou-Thai-TH */
+    static_cast<uint32_t>(0xca215f5b), /* srb-Sora-IN */
+    static_cast<uint32_t>(0xca2d35b2), /* srn-Latn-SR */
+    static_cast<uint32_t>(0xca3135b0), /* srr-Latn-SN */
+    static_cast<uint32_t>(0xca37155b), /* srx-Deva-IN */
+    static_cast<uint32_t>(0xca583538), /* ssy-Latn-ER */
+    static_cast<uint32_t>(0xca70352e), /* stq-Latn-DE */
+    static_cast<uint32_t>(0xca8a35c6), /* suk-Latn-TZ */
+    static_cast<uint32_t>(0xca92354b), /* sus-Latn-GN */
+    static_cast<uint32_t>(0xcac103d6), /* swb-Arab-YT */
+    static_cast<uint32_t>(0xcac2351f), /* swc-Latn-CD */
+    static_cast<uint32_t>(0xcac6352e), /* swg-Latn-DE */
+    static_cast<uint32_t>(0xcad5155b), /* swv-Deva-IN */
+    static_cast<uint32_t>(0xcaed3557), /* sxn-Latn-ID */
+    static_cast<uint32_t>(0xcb0b090e), /* syl-Beng-BD */
+    static_cast<uint32_t>(0xcb11615d), /* syr-Syrc-IQ */
+    static_cast<uint32_t>(0xcb2b359b), /* szl-Latn-PL */
+    static_cast<uint32_t>(0xcc091591), /* taj-Deva-NP */
+    static_cast<uint32_t>(0xcc363599), /* tbw-Latn-PH */
+    static_cast<uint32_t>(0xcc58315b), /* tcy-Knda-IN */
+    static_cast<uint32_t>(0xcc636226), /* tdd-Tale-CN */
+    static_cast<uint32_t>(0xcc661591), /* tdg-Deva-NP */
+    static_cast<uint32_t>(0xcc671591), /* tdh-Deva-NP */
+    static_cast<uint32_t>(0xcc743588), /* tdu-Latn-MY */
+    static_cast<uint32_t>(0xcc8c35af), /* tem-Latn-SL */
+    static_cast<uint32_t>(0xcc8e35c8), /* teo-Latn-UG */
+    static_cast<uint32_t>(0xcc9335be), /* tet-Latn-TL */
+    static_cast<uint32_t>(0xcceb1591), /* thl-Deva-NP */
+    static_cast<uint32_t>(0xccf01591), /* thq-Deva-NP */
+    static_cast<uint32_t>(0xccf11591), /* thr-Deva-NP */
+    static_cast<uint32_t>(0xcd061838), /* tig-Ethi-ER */
+    static_cast<uint32_t>(0xcd15358d), /* tiv-Latn-NG */
+    static_cast<uint32_t>(0xcd4b35bd), /* tkl-Latn-TK */
+    static_cast<uint32_t>(0xcd51350b), /* tkr-Latn-AZ */
+    static_cast<uint32_t>(0xcd531591), /* tkt-Deva-NP */
+    static_cast<uint32_t>(0xcd78350b), /* tly-Latn-AZ */
+    static_cast<uint32_t>(0xcd87358b), /* tmh-Latn-NE */
+    static_cast<uint32_t>(0xcdc63586), /* tog-Latn-MW */
+    static_cast<uint32_t>(0xcde83598), /* tpi-Latn-PG */
+    static_cast<uint32_t>(0xce3435c2), /* tru-Latn-TR */
+    static_cast<uint32_t>(0xce3535c5), /* trv-Latn-TW */
+    static_cast<uint32_t>(0xce36039a), /* trw-Arab-PK */
+    static_cast<uint32_t>(0xce431e4d), /* tsd-Grek-GR */
+    static_cast<uint32_t>(0xce451591), /* tsf-Deva-NP */
+    static_cast<uint32_t>(0xce463599), /* tsg-Latn-PH */
+    static_cast<uint32_t>(0xce496b19), /* tsj-Tibt-BT */
+    static_cast<uint32_t>(0xce6935c8), /* ttj-Latn-UG */
+    static_cast<uint32_t>(0xce726abb), /* tts-Thai-TH */
+    static_cast<uint32_t>(0xce73350b), /* ttt-Latn-AZ */
+    static_cast<uint32_t>(0xce8c3586), /* tum-Latn-MW */
+    static_cast<uint32_t>(0xceab35c4), /* tvl-Latn-TV */
+    static_cast<uint32_t>(0xced0358b), /* twq-Latn-NE */
+    static_cast<uint32_t>(0xcee66526), /* txg-Tang-CN */
+    static_cast<uint32_t>(0xcf1514a4), /* tyv-Cyrl-RU */
+    static_cast<uint32_t>(0xcf2c3578), /* tzm-Latn-MA */
+    static_cast<uint32_t>(0xd06c14a4), /* udm-Cyrl-RU */
+    static_cast<uint32_t>(0xd0c06cb7), /* uga-Ugar-SY */
+    static_cast<uint32_t>(0xd168353e), /* uli-Latn-FM */
+    static_cast<uint32_t>(0xd1813506), /* umb-Latn-AO */
+    static_cast<uint32_t>(0xd1b1095b), /* unr-Beng-IN */
+    static_cast<uint32_t>(0xd1b11591), /* unr-Deva-NP */
+    static_cast<uint32_t>(0xd1b7095b), /* unx-Beng-IN */
+    static_cast<uint32_t>(0xd4086d72), /* vai-Vaii-LR */
+    static_cast<uint32_t>(0xd4823560), /* vec-Latn-IT */
+    static_cast<uint32_t>(0xd48f35a4), /* vep-Latn-RU */
+    static_cast<uint32_t>(0xd50235b6), /* vic-Latn-SX */
+    static_cast<uint32_t>(0xd572350f), /* vls-Latn-BE */
+    static_cast<uint32_t>(0xd585352e), /* vmf-Latn-DE */
+    static_cast<uint32_t>(0xd5963589), /* vmw-Latn-MZ */
+    static_cast<uint32_t>(0xd5d335a4), /* vot-Latn-RU */
+    static_cast<uint32_t>(0xd62e3535), /* vro-Latn-EE */
+    static_cast<uint32_t>(0xd68d35c6), /* vun-Latn-TZ */
+    static_cast<uint32_t>(0xd8043521), /* wae-Latn-CH */
+    static_cast<uint32_t>(0xd80b183a), /* wal-Ethi-ET */
+    static_cast<uint32_t>(0xd8113599), /* war-Latn-PH */
+    static_cast<uint32_t>(0xd82f3509), /* wbp-Latn-AU */
+    static_cast<uint32_t>(0xd830675b), /* wbq-Telu-IN */
+    static_cast<uint32_t>(0xd831155b), /* wbr-Deva-IN */
+    static_cast<uint32_t>(0xd97235d2), /* wls-Latn-WF */
+    static_cast<uint32_t>(0xd9a80369), /* wni-Arab-KM */
+    static_cast<uint32_t>(0xda461b5b), /* wsg-Gong-IN */
+    static_cast<uint32_t>(0xda6c155b), /* wtm-Deva-IN */
+    static_cast<uint32_t>(0xda942226), /* wuu-Hans-CN */
+    static_cast<uint32_t>(0xdc153517), /* xav-Latn-BR */
+    static_cast<uint32_t>(0xdc4e11cb), /* xco-Chrs-UZ */
+    static_cast<uint32_t>(0xdc510ec2), /* xcr-Cari-TR */
+    static_cast<uint32_t>(0xdd623bc2), /* xlc-Lyci-TR */
+    static_cast<uint32_t>(0xdd633cc2), /* xld-Lydi-TR */
+    static_cast<uint32_t>(0xdd851944), /* xmf-Geor-GE */
+    static_cast<uint32_t>(0xdd8d3e26), /* xmn-Mani-CN */
+    static_cast<uint32_t>(0xdd9140a9), /* xmr-Merc-SD */
+    static_cast<uint32_t>(0xdda046a6), /* xna-Narb-SA */
+    static_cast<uint32_t>(0xddb1155b), /* xnr-Deva-IN */
+    static_cast<uint32_t>(0xddc635c8), /* xog-Latn-UG */
+    static_cast<uint32_t>(0xddf1555e), /* xpr-Prti-IR */
+    static_cast<uint32_t>(0xde4058d5), /* xsa-Sarb-YE */
+    static_cast<uint32_t>(0xde511591), /* xsr-Deva-NP */
+    static_cast<uint32_t>(0xe00e3589), /* yao-Latn-MZ */
+    static_cast<uint32_t>(0xe00f353e), /* yap-Latn-FM */
+    static_cast<uint32_t>(0xe0153525), /* yav-Latn-CM */
+    static_cast<uint32_t>(0xe0213525), /* ybb-Latn-CM */
+    static_cast<uint32_t>(0xe22b3517), /* yrl-Latn-BR */
+    static_cast<uint32_t>(0xe2803587), /* yua-Latn-MX */
+    static_cast<uint32_t>(0xe2842226), /* yue-Hans-CN */
+    static_cast<uint32_t>(0xe2842352), /* yue-Hant-HK */
+    static_cast<uint32_t>(0xe40635a9), /* zag-Latn-SD */
+    static_cast<uint32_t>(0xe4690369), /* zdj-Arab-KM */
+    static_cast<uint32_t>(0xe480358f), /* zea-Latn-NL */
+    static_cast<uint32_t>(0xe4c76878), /* zgh-Tfng-MA */
+    static_cast<uint32_t>(0xe4f74926), /* zhx-Nshu-CN */
+    static_cast<uint32_t>(0xe5533026), /* zkt-Kits-CN */
+    static_cast<uint32_t>(0xe56c35ba), /* zlm-Latn-TG */
+    static_cast<uint32_t>(0xe5883588), /* zmi-Latn-MY */
+    static_cast<uint32_t>(0xe72035c2), /* zza-Latn-TR */
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
+#endif
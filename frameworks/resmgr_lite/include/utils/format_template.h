@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OHOS_RESOURCE_MANAGER_FORMAT_TEMPLATE_H
+#define OHOS_RESOURCE_MANAGER_FORMAT_TEMPLATE_H
+
+#include <cstdarg>
+#include <string>
+#include <vector>
+
+#include "res_common.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+/**
+ * A printf format string split once into literal and placeholder segments.
+ * Format appends the segments to the caller's string, so a reused string is not reallocated.
+ */
+class FormatTemplate {
+public:
+    /**
+     * Parse the format string
+     * @param fmt the printf format string
+     */
+    explicit FormatTemplate(const std::string &fmt);
+
+    /**
+     * Format with varargs, a template with %n, '*' width or positional placeholders falls back to vsnprintf
+     * @param outValue the result write to, it is cleared first
+     * @param args the arguments of the placeholders
+     */
+    void Format(std::string &outValue, va_list args) const;
+
+    /**
+     * Format with typed arguments, positional placeholders like %1$s are supported
+     * @param outValue the result write to, it is cleared first
+     * @param args the arguments of the placeholders
+     * @return false if an argument is missing or its type does not match its placeholder
+     */
+    bool Format(std::string &outValue, const std::vector<FormatArg> &args) const;
+
+    inline size_t GetPlaceholderCount() const
+    {
+        return placeholderCount_;
+    }
+
+private:
+    enum LengthModifier {
+        NONE,
+        CHAR,
+        SHORT,
+        LONG,
+        LONG_LONG,
+        SIZE,
+        OTHER,
+    };
+
+    struct Segment {
+        // 0 for a literal of fmt_, else the conversion of a placeholder
+        char conversion_;
+        LengthModifier lengthModifier_;
+        // no flag, width or precision, so it is formatted without snprintf
+        bool simple_;
+        // index in args, -1 for a literal
+        int argIndex_;
+        size_t offset_;
+        size_t length_;
+        // the placeholder without the position, for snprintf
+        std::string spec_;
+    };
+
+    void AddLiteral(size_t offset, size_t length);
+
+    // parse the placeholder at fmt_[start], return its end, 0 if it is not supported
+    size_t ParsePlaceholder(size_t start, int &nextArg, Segment &segment);
+
+    void AppendLiteral(std::string &outValue, size_t offset, size_t length) const;
+
+    bool AppendArg(std::string &outValue, const Segment &segment, const FormatArg &arg) const;
+
+    std::string fmt_;
+
+    std::vector<Segment> segments_;
+
+    size_t placeholderCount_;
+
+    // the format needs vsnprintf for varargs
+    bool varargsFallback_;
+
+    // the format can not be parsed, typed arguments fail
+    bool invalid_;
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
+#endif
@@ -16,12 +16,35 @@
 #define OHOS_RESOURCE_MANAGER_UTILS_H
 #include <cstddef>
 #include <cstdint>
+#include <ctime>
 #include "res_locale.h"
 #include "rstate.h"
 
 namespace OHOS {
 namespace Global {
 namespace Resource {
+/**
+ * The version of a file, it changes when the file is written, even twice within one second, or replaced by rename
+ */
+struct FileStamp {
+    // last modification time, seconds and nanoseconds
+    int64_t modTimeSec;
+    int64_t modTimeNsec;
+    int64_t size;
+    uint64_t inode;
+
+    inline bool operator==(const FileStamp &other) const
+    {
+        return modTimeSec == other.modTimeSec && modTimeNsec == other.modTimeNsec && size == other.size &&
+            inode == other.inode;
+    }
+
+    inline bool operator!=(const FileStamp &other) const
+    {
+        return !(*this == other);
+    }
+};
+
 class Utils {
 public:
     static bool IsAlphaString(const char *s, int32_t len);
@@ -42,6 +65,20 @@ public:
 
     static void DecodeScript(uint32_t encodeScript, char *outValue);
 
+    /**
+     * Decode a language encoded by EncodeLanguage
+     * @param encodedLanguage the language encode
+     * @param outValue at least LANGUAGE_ARRAY_LEN chars, the null terminated language, empty for NULL_LANGUAGE
+     */
+    static void DecodeLanguage(uint16_t encodedLanguage, char *outValue);
+
+    /**
+     * Decode a region encoded by EncodeRegion
+     * @param encodedRegion the region encode
+     * @param outValue at least REGION_ARRAY_LEN chars, the null terminated region, empty for NULL_REGION
+     */
+    static void DecodeRegion(uint16_t encodedRegion, char *outValue);
+
     static uint16_t EncodeRegion(const char *region);
 
     static uint16_t EncodeRegionByResLocale(const ResLocale *locale);
@@ -50,12 +87,30 @@ public:
                                  const char *script,
                                  const char *region);
 
+    /**
+     * Compose a locale encode from its already encoded tags
+     * @param encodedLanguage the language encode, see EncodeLanguage
+     * @param encodedScript the script encode, see EncodeScript
+     * @param encodedRegion the region encode, see EncodeRegion
+     * @return the locale encode, same as EncodeLocale of the tags
+     */
+    static uint64_t EncodeLocale(uint16_t encodedLanguage, uint32_t encodedScript, uint16_t encodedRegion);
+
     static RState ConvertColorToUInt32(const char *s, uint32_t &outValue);
 
+    /**
+     * Get the stamp of file
+     * @param path the file path
+     * @return the stamp, all zero if the file can not be accessed
+     */
+    static FileStamp GetFileStamp(const char *path);
+
 private:
 
     static uint16_t EncodeLanguageOrRegion(const char *str, char base);
 
+    static void DecodeLanguageOrRegion(uint16_t encoded, char base, char *outValue);
+
     static bool StrCompare(const char *left, const char *right, size_t len, bool isCaseSensitive);
     static constexpr uint64_t ROOT_LOCALE = 0x0;
     static constexpr uint16_t NULL_LANGUAGE = 0x00;
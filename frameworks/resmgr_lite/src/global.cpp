@@ -170,7 +170,8 @@ int32_t GLOBAL_GetValueById(uint32_t id, const char *path, char **value)
         return SYS_ERROR;
     }
 
-    auto idItem = hapManager.FindResourceById(id);
+    HapManager::SnapshotGuard snapshot(&hapManager);
+    auto idItem = snapshot->FindResourceById(id);
     if (idItem == nullptr) {
         return OBJ_NOT_FOUND;
     }
@@ -203,9 +204,10 @@ int32_t GLOBAL_GetValueByName(const char *name, const char *path, char **value)
         return SYS_ERROR;
     }
 
+    HapManager::SnapshotGuard snapshot(&hapManager);
     const IdItem *idItem = nullptr;
     for (int i = 0; i < ResType::MAX_RES_TYPE; ++i) {
-        idItem = hapManager.FindResourceByName(name, (ResType)i);
+        idItem = snapshot->FindResourceByName(name, (ResType)i);
         if (idItem != nullptr) {
             break;
         }
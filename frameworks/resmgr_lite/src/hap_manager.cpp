@@ -15,90 +15,240 @@
 #include "hap_manager.h"
 
 #include <algorithm>
+#include <chrono>
+#include <functional>
+#include <unordered_set>
 #include <types.h>
 
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
 #include "auto_mutex.h"
 #include "hilog_wrapper.h"
 #include "locale_matcher.h"
+#include "utils/common.h"
+#include "utils/utils.h"
 
 namespace OHOS {
 namespace Global {
 namespace Resource {
-constexpr uint32_t PLURAL_CACHE_MAX_COUNT = 3;
+constexpr size_t MAX_LOADER_COUNT = 4;
 
-HapManager::HapManager(ResConfigImpl *resConfig)
-    : resConfig_(resConfig)
+constexpr uint32_t DEFAULT_WATCH_INTERVAL_MS = 1000;
+
+// bits of name filter per name, with 2 probes about 5% of absent names pass the filter
+constexpr size_t NAME_FILTER_BITS_PER_NAME = 8;
+
+constexpr size_t NAME_FILTER_WORD_BITS = 64;
+
+constexpr uint32_t NAME_FILTER_PROBE_SHIFT = 32;
+
+constexpr uint64_t US_PER_SECOND = 1000000;
+
+// the last epoch given to a snapshot, shared by every HapManager so a ResHandle never matches another one
+static std::atomic<uint32_t> g_lastEpoch(0);
+
+namespace {
+// the state of a LoadInParallel shared with the loaders, it outlives the call when a loader starts late
+struct ParallelLoad {
+    ParallelLoad(const std::vector<std::string> &paths, const std::shared_ptr<ResConfigImpl> &resConfig)
+        : paths_(paths), resConfig_(resConfig), results_(paths.size(), nullptr), next_(0), doneCount_(0)
+    {}
+
+    // parse the paths nobody has taken yet
+    void Run()
+    {
+        for (size_t i = next_.fetch_add(1); i < paths_.size(); i = next_.fetch_add(1)) {
+            results_[i] = HapResource::LoadFromIndex(paths_[i].c_str(), resConfig_.get());
+            AutoMutex mutex(this->lock_);
+            if (++doneCount_ == paths_.size()) {
+                done_.notify_all();
+            }
+        }
+    }
+
+    // wait until every path is parsed
+    void Wait()
+    {
+        AutoMutex mutex(this->lock_);
+        while (doneCount_ < paths_.size()) {
+            done_.wait(lock_);
+        }
+    }
+
+    const std::vector<std::string> paths_;
+
+    const std::shared_ptr<ResConfigImpl> resConfig_;
+
+    std::vector<const HapResource *> results_;
+
+    std::atomic<size_t> next_;
+
+    // must hold lock_
+    size_t doneCount_;
+
+    Lock lock_;
+
+    std::condition_variable_any done_;
+};
+} // namespace
+
+HapManager::HapStub::HapStub(const HapResource *hapResource)
+    : lastUse_(0), indexPath_(hapResource->GetIndexPath()), dataSize_(hapResource->GetDataSize()),
+      fileStamp_(hapResource->GetFileStamp()), minId_(1), maxId_(0)
+{
+    const std::map<uint32_t, HapResource::IdValues *> &idValuesMap = hapResource->GetIdValuesMap();
+    if (!idValuesMap.empty()) {
+        minId_ = idValuesMap.begin()->first;
+        maxId_ = idValuesMap.rbegin()->first;
+    }
+    std::vector<const std::map<std::string, HapResource::IdValues *> *> nameMaps;
+    size_t nameCount = 0;
+    for (int i = 0; i < ResType::MAX_RES_TYPE; ++i) {
+        auto nameMap = hapResource->GetIdValuesNameMap(static_cast<ResType>(i));
+        nameMaps.push_back(nameMap);
+        nameCount += (nameMap == nullptr) ? 0 : nameMap->size();
+    }
+    size_t wordCount = (nameCount * NAME_FILTER_BITS_PER_NAME + NAME_FILTER_WORD_BITS - 1) / NAME_FILTER_WORD_BITS;
+    nameFilter_.assign((wordCount > 0) ? wordCount : 1, 0);
+    size_t bitCount = nameFilter_.size() * NAME_FILTER_WORD_BITS;
+    for (int i = 0; i < ResType::MAX_RES_TYPE; ++i) {
+        if (nameMaps[i] == nullptr) {
+            continue;
+        }
+        for (auto iter = nameMaps[i]->begin(); iter != nameMaps[i]->end(); ++iter) {
+            uint64_t hash = HashName(iter->first, static_cast<ResType>(i));
+            size_t bit = hash % bitCount;
+            nameFilter_[bit / NAME_FILTER_WORD_BITS] |= (1ULL << (bit % NAME_FILTER_WORD_BITS));
+            bit = (hash >> NAME_FILTER_PROBE_SHIFT) % bitCount;
+            nameFilter_[bit / NAME_FILTER_WORD_BITS] |= (1ULL << (bit % NAME_FILTER_WORD_BITS));
+        }
+    }
+}
+
+bool HapManager::HapStub::MayContainName(const std::string &name, const ResType resType) const
 {
+    return MayContainHash(HashName(name, resType));
 }
 
-std::string ConvertToPluralStr(int idxRet)
+bool HapManager::HapStub::MayContainHash(uint64_t hash) const
 {
-    switch (idxRet) {
-        case OHOS::I18N::PluralRuleType::ZERO:
-            return "zero";
-        case OHOS::I18N::PluralRuleType::ONE:
-            return "one";
-        case OHOS::I18N::PluralRuleType::TWO:
-            return "two";
-        case OHOS::I18N::PluralRuleType::FEW:
-            return "few";
-        case OHOS::I18N::PluralRuleType::MANY:
-            return "many";
-        case OHOS::I18N::PluralRuleType::OTHER:
-        default:
-            return "other";
+    size_t bitCount = nameFilter_.size() * NAME_FILTER_WORD_BITS;
+    size_t bit = hash % bitCount;
+    if ((nameFilter_[bit / NAME_FILTER_WORD_BITS] & (1ULL << (bit % NAME_FILTER_WORD_BITS))) == 0) {
+        return false;
     }
+    bit = (hash >> NAME_FILTER_PROBE_SHIFT) % bitCount;
+    return (nameFilter_[bit / NAME_FILTER_WORD_BITS] & (1ULL << (bit % NAME_FILTER_WORD_BITS))) != 0;
 }
 
-std::string HapManager::GetPluralRulesAndSelect(int quantity)
+uint64_t HapManager::HapStub::HashName(const std::string &name, const ResType resType)
 {
-    AutoMutex mutex(this->lock_);
-    std::string defaultRet("other");
-    if (this->resConfig_ == nullptr || this->resConfig_->GetResLocale() == nullptr ||
-        this->resConfig_->GetResLocale()->GetLanguage() == nullptr) {
-        HILOG_ERROR("GetPluralRules language is null!");
-        return defaultRet;
-    }
-    std::string language = this->resConfig_->GetResLocale()->GetLanguage();
-
-    OHOS::I18N::PluralFormat *pluralFormat = nullptr;
-    for (uint32_t i = 0; i < plurRulesCache_.size(); i++) {
-        auto pair = plurRulesCache_[i];
-        if (language == pair.first) {
-            // cache hit
-            pluralFormat = pair.second;
-            break;
-        }
+    // same hash as the ResName of the generated ResourceTable header
+    return HashResName(name.c_str(), resType);
+}
+
+HapManager::PluralRules::PluralRules(const std::string &language, OHOS::I18N::PluralFormat *pluralFormat)
+    : language_(language), pluralFormat_(pluralFormat)
+{
+    OHOS::I18N::I18nStatus status = OHOS::I18N::I18nStatus::ISUCCESS;
+    for (int quantity = 0; quantity < MEMO_SIZE; ++quantity) {
+        memo_[quantity] = static_cast<uint8_t>(pluralFormat_->GetPluralRuleIndex(quantity, status));
     }
+}
 
+HapManager::PluralRules::~PluralRules()
+{
+    delete (pluralFormat_);
+}
+
+OHOS::I18N::PluralRuleType HapManager::PluralRules::Select(int quantity) const
+{
+    if (quantity >= 0 && quantity < MEMO_SIZE) {
+        return static_cast<OHOS::I18N::PluralRuleType>(memo_[quantity]);
+    }
+    AutoMutex mutex(this->lock_);
     OHOS::I18N::I18nStatus status = OHOS::I18N::I18nStatus::ISUCCESS;
-    if (pluralFormat == nullptr) {
-        // no cache hit
-        OHOS::I18N::LocaleInfo locale(language.c_str(), "", "");
-        pluralFormat = new(std::nothrow) OHOS::I18N::PluralFormat(locale, status);
-        if (pluralFormat == nullptr) {
-            HILOG_ERROR("new PluralFormat failed");
-            return defaultRet;
-        }
-        if (status != OHOS::I18N::I18nStatus::ISUCCESS) {
-            HILOG_ERROR("PluralFormat init failed");
-            delete pluralFormat;
-            return defaultRet;
-        }
-        // after pluralFormat created, we add it to cache, if > 3 delete oldest one
-        if (plurRulesCache_.size() >= PLURAL_CACHE_MAX_COUNT) {
-            HILOG_DEBUG("cache rotate delete plurRulesMap_ %s", plurRulesCache_[0].first.c_str());
-            delete (plurRulesCache_[0].second);
-            plurRulesCache_.erase(plurRulesCache_.begin());
+    return static_cast<OHOS::I18N::PluralRuleType>(pluralFormat_->GetPluralRuleIndex(quantity, status));
+}
+
+HapManager::LoaderPool::LoaderPool(size_t threadCount)
+    : threadCount_(threadCount), idleCount_(0), stopping_(false)
+{}
+
+HapManager::LoaderPool::~LoaderPool()
+{
+    Stop();
+}
+
+bool HapManager::LoaderPool::Post(const std::function<void()> &task)
+{
+    AutoMutex mutex(this->lock_);
+    if (stopping_) {
+        return false;
+    }
+    tasks_.push_back(task);
+    if (idleCount_ == 0 && threads_.size() < threadCount_) {
+        threads_.push_back(std::thread(&HapManager::LoaderPool::Run, this));
+    } else {
+        ready_.notify_one();
+    }
+    return true;
+}
+
+void HapManager::LoaderPool::Stop()
+{
+    std::vector<std::thread> threads;
+    {
+        AutoMutex mutex(this->lock_);
+        stopping_ = true;
+        threads.swap(threads_);
+        ready_.notify_all();
+    }
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i].join();
+    }
+}
+
+void HapManager::LoaderPool::Run()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            AutoMutex mutex(this->lock_);
+            while (tasks_.empty() && !stopping_) {
+                idleCount_++;
+                ready_.wait(lock_);
+                idleCount_--;
+            }
+            if (tasks_.empty()) {
+                return;
+            }
+            task.swap(tasks_.front());
+            tasks_.pop_front();
         }
-        auto plPair = std::make_pair(language, pluralFormat);
-        plurRulesCache_.push_back(plPair);
+        task();
     }
-    int idxRet = pluralFormat->GetPluralRuleIndex(quantity, status);
-    return ConvertToPluralStr(idxRet);
 }
 
-const IdItem *HapManager::FindResourceById(uint32_t id)
+HapManager::Snapshot::Snapshot(HapManager *hapManager, const std::shared_ptr<ResConfigImpl> &resConfig,
+    uint32_t epoch) : hapManager_(hapManager), resConfig_(resConfig), epoch_(epoch), pendingHapCount_(0),
+      pluralRules_(nullptr)
+{
+    QualifierMatcher::MakeRequest(resConfig.get(), request_);
+}
+
+HapManager::Snapshot::~Snapshot()
+{
+    for (size_t i = 0; i < reloadedHaps_.size(); ++i) {
+        delete (reloadedHaps_[i].load(std::memory_order_acquire));
+    }
+}
+
+const IdItem *HapManager::Snapshot::FindResourceById(uint32_t id) const
 {
     auto qualifierValue = FindQualifierValueById(id);
     if (qualifierValue == nullptr) {
@@ -107,7 +257,7 @@ const IdItem *HapManager::FindResourceById(uint32_t id)
     return qualifierValue->GetIdItem();
 }
 
-const IdItem *HapManager::FindResourceByName(const char *name, const ResType resType)
+const IdItem *HapManager::Snapshot::FindResourceByName(const char *name, const ResType resType) const
 {
     auto qualifierValue = FindQualifierValueByName(name, resType);
     if (qualifierValue == nullptr) {
@@ -116,76 +266,411 @@ const IdItem *HapManager::FindResourceByName(const char *name, const ResType res
     return qualifierValue->GetIdItem();
 }
 
-const HapResource::ValueUnderQualifierDir *HapManager::FindQualifierValueByName(
-    const char *name, const ResType resType)
+const HapResource::ValueUnderQualifierDir *HapManager::Snapshot::FindQualifierValueByName(
+    const char *name, const ResType resType, size_t *hapIndex) const
+{
+    return GetBestQualifierValue(this->GetResourceListByName(name, resType, hapIndex));
+}
+
+const IdItem *HapManager::Snapshot::FindResourceByName(const ResName &name) const
+{
+    auto qualifierValue = FindQualifierValueByName(name);
+    if (qualifierValue == nullptr) {
+        return nullptr;
+    }
+    return qualifierValue->GetIdItem();
+}
+
+const HapResource::ValueUnderQualifierDir *HapManager::Snapshot::FindQualifierValueByName(
+    const ResName &name, size_t *hapIndex) const
+{
+    return GetBestQualifierValue(this->GetResourceListByName(name, hapIndex));
+}
+
+const HapResource::ValueUnderQualifierDir *HapManager::Snapshot::FindQualifierValueById(uint32_t id,
+    size_t *hapIndex) const
+{
+    return GetBestQualifierValue(this->GetResourceList(id, hapIndex));
+}
+
+const HapResource::ValueUnderQualifierDir *HapManager::Snapshot::GetBestQualifierValue(
+    const HapResource::IdValues *idValues) const
 {
-    const HapResource::IdValues *idValues = this->GetResourceListByName(name, resType);
     if (idValues == nullptr) {
         return nullptr;
     }
-    const std::vector<HapResource::ValueUnderQualifierDir *> paths = idValues->GetLimitPathsConst();
+    const std::vector<HapResource::ValueUnderQualifierDir *> &paths = idValues->GetLimitPathsConst();
+    const QualifierMatcher &matcher = idValues->GetQualifierMatcher();
 
     size_t len = paths.size();
-    size_t i = 0;
-    size_t bestIndex = -1;
+    const HapResource::ValueUnderQualifierDir *bestPath = nullptr;
     const ResConfigImpl *bestResConfig = nullptr;
-    const ResConfigImpl *currentResConfig = this->resConfig_;
-    for (i = 0; i < len; i++) {
-        HapResource::ValueUnderQualifierDir *path = paths[i];
-        const ResConfigImpl *resConfig = path->GetResConfig();
-        if (!this->resConfig_->Match(resConfig)) {
+    const ResConfigImpl *currentResConfig = this->resConfig_.get();
+    // the matcher filters a block of paths at once, only the matched ones are compared in order
+    for (size_t begin = 0; begin < len; begin += QualifierMatcher::BLOCK_SIZE) {
+        uint64_t matched = matcher.Match(request_, begin);
+        while (matched != 0) {
+            size_t i = begin + static_cast<size_t>(__builtin_ctzll(matched));
+            matched &= matched - 1;
+            HapResource::ValueUnderQualifierDir *path = paths[i];
+            const ResConfigImpl *resConfig = path->GetResConfig();
+            if (bestResConfig == nullptr) {
+                bestPath = path;
+                bestResConfig = resConfig;
+                continue;
+            }
+            if (!bestResConfig->IsMoreSuitable(resConfig, currentResConfig)) {
+                bestResConfig = resConfig;
+                bestPath = path;
+            }
+        }
+    }
+    return bestPath;
+}
+
+const HapResource *HapManager::Snapshot::GetHapResource(size_t index) const
+{
+    const HapResource *hapResource = hapResources_[index].get();
+    if (hapResource == nullptr) {
+        const std::shared_ptr<const HapResource> *reloaded = reloadedHaps_[index].load(std::memory_order_acquire);
+        if (reloaded == nullptr) {
+            return hapManager_->ReloadEvicted(this, index);
+        }
+        hapResource = reloaded->get();
+    }
+    TouchHap(index);
+    return hapResource;
+}
+
+void HapManager::Snapshot::TouchHap(size_t index) const
+{
+    if (hapManager_->memoryBudget_.load(std::memory_order_relaxed) > 0) {
+        uint64_t now = hapManager_->accessClock_.fetch_add(1, std::memory_order_relaxed) + 1;
+        hapStubs_[index]->lastUse_.store(now, std::memory_order_relaxed);
+    }
+}
+
+std::shared_ptr<const HapResource> HapManager::Snapshot::GetResidentHap(size_t index) const
+{
+    if (hapResources_[index] != nullptr || index >= reloadedHaps_.size()) {
+        return hapResources_[index];
+    }
+    const std::shared_ptr<const HapResource> *reloaded = reloadedHaps_[index].load(std::memory_order_acquire);
+    return (reloaded == nullptr) ? nullptr : *reloaded;
+}
+
+const HapResource::IdValues *HapManager::Snapshot::GetResourceList(uint32_t ident, size_t *hapIndex) const
+{
+    // one id only exit in one hap
+    for (size_t i = 0; i < hapResources_.size(); ++i) {
+        if (!hapStubs_[i]->MayContainId(ident)) {
             continue;
         }
-        if (bestResConfig == nullptr) {
-            bestIndex = i;
-            bestResConfig = resConfig;
+        const HapResource *hapResource = GetHapResource(i);
+        if (hapResource == nullptr) {
             continue;
         }
-        if (!bestResConfig->IsMoreSuitable(resConfig, currentResConfig)) {
-            bestResConfig = resConfig;
-            bestIndex = i;
+        const HapResource::IdValues *out = hapResource->GetIdValues(ident);
+        if (out != nullptr) {
+            if (hapIndex != nullptr) {
+                *hapIndex = i;
+            }
+            return out;
         }
     }
-    return paths[bestIndex];
+    return nullptr;
 }
 
-const HapResource::ValueUnderQualifierDir *HapManager::FindQualifierValueById(uint32_t id)
+const HapResource::IdValues *HapManager::Snapshot::GetResourceListByName(const char *name,
+    const ResType resType, size_t *hapIndex) const
 {
-    const HapResource::IdValues *idValues = this->GetResourceList(id);
-    if (idValues == nullptr) {
-        return nullptr;
+    std::string sName(name);
+    // first match will return
+    for (size_t i = 0; i < hapResources_.size(); ++i) {
+        if (!hapStubs_[i]->MayContainName(sName, resType)) {
+            continue;
+        }
+        const HapResource *hapResource = GetHapResource(i);
+        if (hapResource == nullptr) {
+            continue;
+        }
+        const HapResource::IdValues *out = hapResource->GetIdValuesByName(sName, resType);
+        if (out != nullptr) {
+            if (hapIndex != nullptr) {
+                *hapIndex = i;
+            }
+            return out;
+        }
     }
-    const std::vector<HapResource::ValueUnderQualifierDir *> paths = idValues->GetLimitPathsConst();
+    return nullptr;
+}
 
-    size_t len = paths.size();
-    size_t i = 0;
-    size_t bestIndex = -1;
-    const ResConfigImpl *bestResConfig = nullptr;
-    const ResConfigImpl *currentResConfig = this->resConfig_;
-    for (i = 0; i < len; i++) {
-        HapResource::ValueUnderQualifierDir *path = paths[i];
-        const ResConfigImpl *resConfig = path->GetResConfig();
-        if (!this->resConfig_->Match(resConfig)) {
+const HapResource::IdValues *HapManager::Snapshot::GetResourceListByName(const ResName &name,
+    size_t *hapIndex) const
+{
+    // first match will return
+    for (size_t i = 0; i < hapResources_.size(); ++i) {
+        if (!hapStubs_[i]->MayContainHash(name.hash)) {
             continue;
         }
-        if (bestResConfig == nullptr) {
-            bestIndex = i;
-            bestResConfig = resConfig;
+        const HapResource *hapResource = GetHapResource(i);
+        if (hapResource == nullptr) {
             continue;
         }
-        if (!bestResConfig->IsMoreSuitable(resConfig, currentResConfig)) {
-            bestResConfig = resConfig;
-            bestIndex = i;
+        const HapResource::IdValues *out = hapResource->GetIdValuesByName(name);
+        if (out != nullptr) {
+            if (hapIndex != nullptr) {
+                *hapIndex = i;
+            }
+            return out;
+        }
+    }
+    return nullptr;
+}
+
+const IdItem *HapManager::Snapshot::ResolveReference(const IdItem::ValueRef &ref) const
+{
+    if (IdItem::IsArrayOfType(ref.resType_)) {
+        HILOG_ERROR("ref %u can't be array", ref.id_);
+        return nullptr;
+    }
+    const ResolvedRef *resolved = resolvedRefs_.Find(ref.id_);
+    ResolvedRef followed;
+    if (resolved == nullptr) {
+        // followed out of any lock, when another reader followed it meanwhile, both get the same end
+        followed = FollowReference(ref.id_);
+        resolved = resolvedRefs_.Insert(ref.id_, followed);
+        if (resolved == nullptr) {
+            resolved = &followed;
+        }
+    }
+    // unless compile bug
+    if (resolved->target_ != nullptr && resolved->resType_ != ref.resType_) {
+        HILOG_ERROR("impossible. ref %u type mismatch, found type: %d", ref.id_, resolved->resType_);
+        return nullptr;
+    }
+    return resolved->target_;
+}
+
+HapManager::Snapshot::ResolvedRef HapManager::Snapshot::FollowReference(uint32_t id) const
+{
+    ResolvedRef resolved = { ResType::MAX_RES_TYPE, nullptr };
+    const IdItem *idItem = FindResourceById(id);
+    if (idItem == nullptr) {
+        HILOG_ERROR("ref %u id not found", id);
+        return resolved;
+    }
+    resolved.resType_ = idItem->resType_;
+    int count = 0;
+    while (idItem->valueRef_.id_ != 0) {
+        const IdItem::ValueRef &next = idItem->valueRef_;
+        if (IdItem::IsArrayOfType(next.resType_)) {
+            HILOG_ERROR("ref %u can't be array", next.id_);
+            return resolved;
+        }
+        if (++count > MAX_DEPTH_REF_SEARCH) {
+            // a cycle ends here too, it is reported once per snapshot
+            HILOG_ERROR("ref %u has re-ref too much", id);
+            return resolved;
+        }
+        const IdItem *nextItem = FindResourceById(next.id_);
+        if (nextItem == nullptr) {
+            HILOG_ERROR("ref %u id not found", next.id_);
+            return resolved;
+        }
+        if (nextItem->resType_ != next.resType_) {
+            HILOG_ERROR("impossible. ref %u type mismatch, found type: %d", next.id_, nextItem->resType_);
+            return resolved;
+        }
+        idItem = nextItem;
+    }
+    resolved.target_ = idItem;
+    return resolved;
+}
+
+std::shared_ptr<const std::map<std::string, std::string>> HapManager::Snapshot::GetFlattenedMap(
+    const IdItem *idItem) const
+{
+    auto cached = flattenedMaps_.Find(reinterpret_cast<uintptr_t>(idItem));
+    if (cached == nullptr) {
+        return nullptr;
+    }
+    return *cached;
+}
+
+std::shared_ptr<const std::map<std::string, std::string>> HapManager::Snapshot::PutFlattenedMap(
+    const IdItem *idItem, const std::shared_ptr<const std::map<std::string, std::string>> &flattened) const
+{
+    auto cached = flattenedMaps_.Insert(reinterpret_cast<uintptr_t>(idItem), flattened);
+    if (cached == nullptr) {
+        HILOG_ERROR("no memory to cache the flattened map");
+        return flattened;
+    }
+    return *cached;
+}
+
+std::shared_ptr<const FormatTemplate> HapManager::Snapshot::GetFormatTemplate(const std::string *value) const
+{
+    auto cached = formatTemplates_.Find(reinterpret_cast<uintptr_t>(value));
+    if (cached != nullptr) {
+        return *cached;
+    }
+    // when another reader parsed it meanwhile, both get the one cached first
+    std::shared_ptr<const FormatTemplate> formatTemplate(new (std::nothrow) FormatTemplate(*value));
+    if (formatTemplate == nullptr) {
+        HILOG_ERROR("new FormatTemplate failed");
+        return nullptr;
+    }
+    cached = formatTemplates_.Insert(reinterpret_cast<uintptr_t>(value), formatTemplate);
+    if (cached == nullptr) {
+        HILOG_ERROR("no memory to cache the format template");
+        return formatTemplate;
+    }
+    return *cached;
+}
+
+constexpr size_t HapManager::READER_SLOT_COUNT;
+
+HapManager::SnapshotGuard::SnapshotGuard(HapManager *hapManager)
+    : hapManager_(hapManager), snapshot_(nullptr), slot_(READER_SLOT_COUNT)
+{
+    const Snapshot *snapshot = hapManager_->snapshot_.load(std::memory_order_seq_cst);
+    // threads start at different slots, so they seldom race for one
+    size_t start = std::hash<std::thread::id>()(std::this_thread::get_id()) % READER_SLOT_COUNT;
+    for (size_t i = 0; i < READER_SLOT_COUNT; ++i) {
+        size_t slot = (start + i) % READER_SLOT_COUNT;
+        const Snapshot *expected = nullptr;
+        if (hapManager_->readerSlots_[slot].compare_exchange_strong(expected, snapshot,
+            std::memory_order_seq_cst)) {
+            slot_ = slot;
+            break;
+        }
+    }
+    if (slot_ == READER_SLOT_COUNT) {
+        // count the reader before loading, so a writer that sees no overflow reader knows none holds a retired one
+        hapManager_->overflowReaders_.fetch_add(1, std::memory_order_seq_cst);
+        snapshot_ = hapManager_->snapshot_.load(std::memory_order_seq_cst);
+        return;
+    }
+    // the snapshot may be retired before the slot is set, it is safe to read only if it is still the current one
+    for (;;) {
+        const Snapshot *current = hapManager_->snapshot_.load(std::memory_order_seq_cst);
+        if (current == snapshot) {
+            break;
+        }
+        snapshot = current;
+        hapManager_->readerSlots_[slot_].store(snapshot, std::memory_order_seq_cst);
+    }
+    snapshot_ = snapshot;
+}
+
+HapManager::SnapshotGuard::~SnapshotGuard()
+{
+    if (slot_ < READER_SLOT_COUNT) {
+        hapManager_->readerSlots_[slot_].store(nullptr, std::memory_order_release);
+    } else {
+        hapManager_->overflowReaders_.fetch_sub(1, std::memory_order_release);
+    }
+    // the last reader of a replaced snapshot frees it
+    if (snapshot_ != hapManager_->snapshot_.load(std::memory_order_acquire)) {
+        hapManager_->TryReclaimRetiredSnapshots();
+    }
+}
+
+void HapManager::PinSnapshots()
+{
+    // a snapshot published after this is not reclaimed until the pin is released
+    pinCount_.fetch_add(1, std::memory_order_seq_cst);
+}
+
+void HapManager::UnpinSnapshots()
+{
+    if (pinCount_.fetch_sub(1, std::memory_order_release) == 1) {
+        this->TryReclaimRetiredSnapshots();
+    }
+}
+
+uint32_t HapManager::NextEpoch()
+{
+    return g_lastEpoch.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+HapManager::HapManager(ResConfigImpl *resConfig)
+    : initialSnapshot_(this, std::shared_ptr<ResConfigImpl>(resConfig), NextEpoch()), snapshot_(&initialSnapshot_),
+      overflowReaders_(0), pinCount_(0), loaders_(MAX_LOADER_COUNT), watching_(false), changed_(false),
+      watchIntervalMs_(DEFAULT_WATCH_INTERVAL_MS),
+      memoryBudget_(0), accessClock_(0), evictionCount_(0), reloadCount_(0), reloadTimeUs_(0)
+{
+    for (size_t i = 0; i < READER_SLOT_COUNT; ++i) {
+        readerSlots_[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+OHOS::I18N::PluralRuleType HapManager::GetPluralRule(const Snapshot *snapshot, int quantity)
+{
+    const PluralRules *pluralRules = snapshot->pluralRules_.load(std::memory_order_acquire);
+    if (pluralRules == nullptr) {
+        const ResConfigImpl *resConfig = snapshot->GetResConfig();
+        if (resConfig == nullptr || resConfig->GetResLocale() == nullptr ||
+            resConfig->GetResLocale()->GetLanguage() == nullptr) {
+            HILOG_ERROR("GetPluralRules language is null!");
+            return OHOS::I18N::PluralRuleType::OTHER;
+        }
+        pluralRules = GetPluralRules(resConfig->GetResLocale()->GetLanguage());
+        if (pluralRules == nullptr) {
+            return OHOS::I18N::PluralRuleType::OTHER;
+        }
+        // racing readers store the same rules, the registry returns one per language
+        snapshot->pluralRules_.store(pluralRules, std::memory_order_release);
+    }
+    return pluralRules->Select(quantity);
+}
+
+const HapManager::PluralRules *HapManager::GetPluralRules(const std::string &language)
+{
+    AutoMutex mutex(this->pluralLock_);
+    for (size_t i = 0; i < pluralRulesCache_.size(); ++i) {
+        if (pluralRulesCache_[i]->GetLanguage() == language) {
+            return pluralRulesCache_[i];
         }
     }
-    return paths[bestIndex];
+
+    OHOS::I18N::I18nStatus status = OHOS::I18N::I18nStatus::ISUCCESS;
+    OHOS::I18N::LocaleInfo locale(language.c_str(), "", "");
+    OHOS::I18N::PluralFormat *pluralFormat = new(std::nothrow) OHOS::I18N::PluralFormat(locale, status);
+    if (pluralFormat == nullptr) {
+        HILOG_ERROR("new PluralFormat failed");
+        return nullptr;
+    }
+    if (status != OHOS::I18N::I18nStatus::ISUCCESS) {
+        HILOG_ERROR("PluralFormat init failed");
+        delete pluralFormat;
+        return nullptr;
+    }
+    PluralRules *pluralRules = new (std::nothrow) PluralRules(language, pluralFormat);
+    if (pluralRules == nullptr) {
+        HILOG_ERROR("new PluralRules failed");
+        delete pluralFormat;
+        return nullptr;
+    }
+    pluralRulesCache_.push_back(pluralRules);
+    return pluralRules;
 }
 
 RState HapManager::UpdateResConfig(ResConfig &resConfig)
 {
     AutoMutex mutex(this->lock_);
-    this->resConfig_->Copy(resConfig);
-    RState rState = this->ReloadAll();
+    std::shared_ptr<ResConfigImpl> newConfig(new (std::nothrow) ResConfigImpl);
+    if (newConfig == nullptr || !newConfig->Copy(resConfig)) {
+        HILOG_ERROR("copy ResConfig failed when UpdateResConfig!");
+        return NOT_ENOUGH_MEM;
+    }
+    // the haps are parsed for the config, an unchanged config keeps the published snapshot and its haps
+    const ResConfigImpl *currentConfig = snapshot_.load()->GetResConfig();
+    if (currentConfig != nullptr && newConfig->GetKey() == currentConfig->GetKey()) {
+        return SUCCESS;
+    }
+    RState rState = this->ReloadAll(newConfig);
     if (rState != SUCCESS) {
         HILOG_ERROR("ReloadAll() failed when UpdateResConfig!");
     }
@@ -195,8 +680,8 @@ RState HapManager::UpdateResConfig(ResConfig &resConfig)
 
 void HapManager::GetResConfig(ResConfig &resConfig)
 {
-    AutoMutex mutex(this->lock_);
-    resConfig.Copy(*(this->resConfig_));
+    SnapshotGuard snapshot(this);
+    resConfig.Copy(*(snapshot->resConfig_));
 }
 
 bool HapManager::AddResource(const char *path)
@@ -205,88 +690,592 @@ bool HapManager::AddResource(const char *path)
     return this->AddResourcePath(path);
 }
 
-HapManager::~HapManager()
+bool HapManager::AddResources(const std::vector<std::string> &paths)
 {
-    for (size_t i = 0; i < hapResources_.size(); ++i) {
-        auto ptr = hapResources_[i];
-        delete (ptr);
+    if (paths.empty()) {
+        return true;
+    }
+    std::shared_ptr<ResConfigImpl> resConfig;
+    {
+        AutoMutex mutex(this->lock_);
+        if (!AreNewHapPaths(paths)) {
+            return false;
+        }
+        resConfig = snapshot_.load()->resConfig_;
+    }
+    std::vector<const HapResource *> results(paths.size(), nullptr);
+    while (true) {
+        // parse without lock_, readers and other writers go on meanwhile
+        LoadInParallel(paths, resConfig, results);
+
+        AutoMutex mutex(this->lock_);
+        bool ret = AreNewHapPaths(paths);
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (results[i] == nullptr) {
+                HILOG_ERROR("load %s failed when AddResources", paths[i].c_str());
+                ret = false;
+            }
+        }
+        const Snapshot *current = snapshot_.load();
+        if (ret && current->resConfig_ != resConfig) {
+            // resConfig was updated while parsing, parse again to keep all haps under the same resConfig
+            for (size_t i = 0; i < results.size(); ++i) {
+                delete (results[i]);
+                results[i] = nullptr;
+            }
+            resConfig = current->resConfig_;
+            continue;
+        }
+        Snapshot *snapshot = ret ? CloneSnapshot() : nullptr;
+        if (ret && snapshot == nullptr) {
+            HILOG_ERROR("new Snapshot failed when AddResources");
+        }
+        size_t putCount = 0;
+        while (snapshot != nullptr && putCount < results.size()) {
+            // PutHap deletes the hap it fails to put
+            if (!PutHap(snapshot, snapshot->HapSize(), results[putCount++])) {
+                delete (snapshot);
+                snapshot = nullptr;
+                break;
+            }
+            snapshot->loadedHapPaths_.push_back(paths[putCount - 1]);
+        }
+        if (snapshot == nullptr) {
+            // all or nothing, the haps not put are deleted
+            for (size_t i = putCount; i < results.size(); ++i) {
+                delete (results[i]);
+            }
+            return false;
+        }
+        this->Publish(snapshot);
+        return true;
     }
-    delete resConfig_;
+}
 
-    auto iter = plurRulesCache_.begin();
-    for (; iter != plurRulesCache_.end(); iter++) {
-        HILOG_DEBUG("delete plurRulesMap_ %s", iter->first.c_str());
-        auto ptr = iter->second;
-        delete (ptr);
+void HapManager::LoadInParallel(const std::vector<std::string> &paths,
+    const std::shared_ptr<ResConfigImpl> &resConfig, std::vector<const HapResource *> &results)
+{
+    std::shared_ptr<ParallelLoad> load(new (std::nothrow) ParallelLoad(paths, resConfig));
+    if (load == nullptr) {
+        HILOG_ERROR("new ParallelLoad failed when LoadInParallel");
+        return;
+    }
+    size_t helperCount = std::min(paths.size(), MAX_LOADER_COUNT);
+    size_t cpuCount = std::thread::hardware_concurrency();
+    if (cpuCount > 0) {
+        helperCount = std::min(helperCount, cpuCount);
     }
+    // the calling thread is one of the loaders, it parses alone if the pool is busy
+    for (size_t i = 1; i < helperCount; ++i) {
+        loaders_.Post([load]() { load->Run(); });
+    }
+    load->Run();
+    load->Wait();
+    results.swap(load->results_);
 }
 
-const HapResource::IdValues *HapManager::GetResourceList(uint32_t ident) const
+std::shared_future<bool> HapManager::AddResourceAsync(const char *path)
 {
-    // one id only exit in one hap
-    for (size_t i = 0; i < hapResources_.size(); ++i) {
-        HapResource *pResource = hapResources_[i];
-        const HapResource::IdValues *out = pResource->GetIdValues(ident);
-        if (out != nullptr) {
-            return out;
+    std::promise<bool> rejected;
+    rejected.set_value(false);
+    if (path == nullptr) {
+        HILOG_ERROR("path is null when AddResourceAsync");
+        return rejected.get_future().share();
+    }
+    AutoMutex mutex(this->lock_);
+    std::string sPath(path);
+    if (IsHapPathKnown(sPath)) {
+        HILOG_ERROR(" %s has already been loaded!", path);
+        return rejected.get_future().share();
+    }
+    std::shared_ptr<std::packaged_task<bool()>> task(new (std::nothrow) std::packaged_task<bool()>(
+        std::bind(&HapManager::LoadPendingResource, this, sPath)));
+    if (task == nullptr) {
+        HILOG_ERROR("new task failed when AddResourceAsync");
+        return rejected.get_future().share();
+    }
+    // publish the pending count first, so lookups from now on can tell NOT_READY from NOT_FOUND
+    pendingHapPaths_.push_back(sPath);
+    Snapshot *snapshot = CloneSnapshot();
+    if (snapshot == nullptr) {
+        HILOG_ERROR("new Snapshot failed when AddResourceAsync");
+        pendingHapPaths_.pop_back();
+        return rejected.get_future().share();
+    }
+    this->Publish(snapshot);
+
+    std::shared_future<bool> result = task->get_future().share();
+    if (!loaders_.Post([task]() { (*task)(); })) {
+        // only while HapManager is destructed, nobody is left to wait for the result
+        HILOG_ERROR("loaders stopped when AddResourceAsync");
+    }
+    return result;
+}
+
+bool HapManager::LoadPendingResource(const std::string &path)
+{
+    std::shared_ptr<ResConfigImpl> resConfig;
+    {
+        SnapshotGuard snapshot(this);
+        resConfig = snapshot->resConfig_;
+    }
+    while (true) {
+        // parse without lock_, readers and other writers go on meanwhile
+        const HapResource *pResource = HapResource::LoadFromIndex(path.c_str(), resConfig.get());
+
+        AutoMutex mutex(this->lock_);
+        const Snapshot *current = snapshot_.load();
+        if (pResource != nullptr && current->resConfig_ != resConfig) {
+            // resConfig was updated while parsing, parse again to keep all haps under the same resConfig
+            delete (pResource);
+            resConfig = current->resConfig_;
+            continue;
+        }
+        pendingHapPaths_.erase(std::find(pendingHapPaths_.begin(), pendingHapPaths_.end(), path));
+        Snapshot *snapshot = CloneSnapshot();
+        if (snapshot == nullptr) {
+            // the pending count is taken from pendingHapPaths_, so the next snapshot published drops this one
+            HILOG_ERROR("new Snapshot failed when LoadPendingResource");
+            delete (pResource);
+            return false;
         }
+        bool ret = (pResource != nullptr) && PutHap(snapshot, snapshot->HapSize(), pResource);
+        if (ret) {
+            snapshot->loadedHapPaths_.push_back(path);
+        }
+        this->Publish(snapshot);
+        return ret;
     }
-    return nullptr;
 }
 
-const HapResource::IdValues *HapManager::GetResourceListByName(const char *name, const ResType resType) const
+RState HapManager::Refresh()
 {
-    // first match will return
-    for (size_t i = 0; i < hapResources_.size(); ++i) {
-        HapResource *pResource = hapResources_[i];
-        const HapResource::IdValues *out = pResource->GetIdValuesByName(std::string(name), resType);
-        if (out != nullptr) {
-            return out;
+    if (watching_.load() && !changed_.load()) {
+        return SUCCESS;
+    }
+    AutoMutex mutex(this->lock_);
+    return this->ReloadChanged();
+}
+
+RState HapManager::ReloadChanged()
+{
+    changed_.store(false);
+    const Snapshot *current = snapshot_.load();
+    Snapshot *snapshot = nullptr;
+    RState rState = SUCCESS;
+    for (size_t i = 0; i < current->hapStubs_.size(); ++i) {
+        const std::string &indexPath = current->hapStubs_[i]->GetIndexPath();
+        if (Utils::GetFileStamp(indexPath.c_str()) == current->hapStubs_[i]->GetFileStamp()) {
+            continue;
+        }
+        const HapResource *pResource = HapResource::LoadFromIndex(indexPath.c_str(), current->resConfig_.get());
+        if (pResource == nullptr) {
+            // maybe it is being written, keep the old one and try again next time
+            HILOG_ERROR("reload %s failed when ReloadChanged", indexPath.c_str());
+            rState = HAP_INIT_FAILED;
+            continue;
+        }
+        if (snapshot == nullptr) {
+            snapshot = CloneSnapshot();
+            if (snapshot == nullptr) {
+                HILOG_ERROR("new Snapshot failed when ReloadChanged");
+                delete (pResource);
+                return NOT_ENOUGH_MEM;
+            }
+        }
+        if (!PutHap(snapshot, i, pResource)) {
+            rState = NOT_ENOUGH_MEM;
         }
     }
-    return nullptr;
+    if (snapshot != nullptr) {
+        this->Publish(snapshot);
+    }
+    return rState;
+}
+
+bool HapManager::StartWatch(uint32_t intervalMs)
+{
+    AutoMutex mutex(this->lock_);
+    if (watching_.load() || watcher_.joinable()) {
+        return false;
+    }
+    watchIntervalMs_ = (intervalMs > 0) ? intervalMs : DEFAULT_WATCH_INTERVAL_MS;
+    watching_.store(true);
+    // changes before the watcher starts are picked up by the first Refresh
+    changed_.store(true);
+    watcher_ = std::thread(&HapManager::WatchLoop, this);
+    return true;
+}
+
+void HapManager::StopWatch()
+{
+    {
+        AutoMutex mutex(this->lock_);
+        if (!watching_.load()) {
+            return;
+        }
+        watching_.store(false);
+    }
+    watcher_.join();
+}
+
+void HapManager::WatchLoop()
+{
+#if defined(__linux__)
+    int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) {
+        HILOG_WARN("inotify_init1 failed, poll file stamps instead");
+    }
+#else
+    int fd = -1;
+#endif
+    std::vector<std::string> watchedDirs;
+    while (watching_.load()) {
+        // without inotify, check the file stamps every interval
+        bool changed = (fd < 0);
+#if defined(__linux__)
+        if (fd >= 0) {
+            {
+                // watch the directory, a resources.index replaced by rename is still seen
+                SnapshotGuard snapshot(this);
+                for (size_t i = 0; i < snapshot->loadedHapPaths_.size(); ++i) {
+                    const std::string &path = snapshot->loadedHapPaths_[i];
+                    std::string dir = path.substr(0, path.rfind('/') + 1);
+                    if (std::find(watchedDirs.begin(), watchedDirs.end(), dir) != watchedDirs.end()) {
+                        continue;
+                    }
+                    if (inotify_add_watch(fd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) >= 0) {
+                        watchedDirs.push_back(dir);
+                    }
+                }
+            }
+            struct pollfd pfd = { fd, POLLIN, 0 };
+            if (poll(&pfd, 1, static_cast<int>(watchIntervalMs_)) > 0) {
+                char buf[1024];
+                while (read(fd, buf, sizeof(buf)) > 0) {
+                }
+                changed = true;
+            }
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(watchIntervalMs_));
+        }
+#else
+        std::this_thread::sleep_for(std::chrono::milliseconds(watchIntervalMs_));
+#endif
+        if (changed && watching_.load()) {
+            changed_.store(true);
+            AutoMutex mutex(this->lock_);
+            this->ReloadChanged();
+        }
+    }
+#if defined(__linux__)
+    if (fd >= 0) {
+        close(fd);
+    }
+#endif
+}
+
+bool HapManager::IsHapPathKnown(const std::string &path) const
+{
+    const Snapshot *current = snapshot_.load();
+    if (std::find(current->loadedHapPaths_.begin(), current->loadedHapPaths_.end(), path) !=
+        current->loadedHapPaths_.end()) {
+        return true;
+    }
+    return std::find(pendingHapPaths_.begin(), pendingHapPaths_.end(), path) != pendingHapPaths_.end();
+}
+
+bool HapManager::AreNewHapPaths(const std::vector<std::string> &paths) const
+{
+    std::unordered_set<std::string> newPaths;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (!newPaths.insert(paths[i]).second || IsHapPathKnown(paths[i])) {
+            HILOG_ERROR(" %s has already been loaded!", paths[i].c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+HapManager::Snapshot *HapManager::CloneSnapshot() const
+{
+    const Snapshot *current = snapshot_.load();
+    Snapshot *snapshot = new (std::nothrow) Snapshot(current->hapManager_, current->resConfig_, NextEpoch());
+    if (snapshot == nullptr) {
+        return nullptr;
+    }
+    // a hap reloaded into current is resident in the copy
+    for (size_t i = 0; i < current->hapResources_.size(); ++i) {
+        snapshot->hapResources_.push_back(current->GetResidentHap(i));
+    }
+    snapshot->hapStubs_ = current->hapStubs_;
+    snapshot->loadedHapPaths_ = current->loadedHapPaths_;
+    snapshot->pendingHapCount_ = static_cast<uint32_t>(pendingHapPaths_.size());
+    // same resConfig_, so the same language
+    snapshot->pluralRules_.store(current->pluralRules_.load(std::memory_order_acquire), std::memory_order_relaxed);
+    return snapshot;
+}
+
+HapManager::~HapManager()
+{
+    StopWatch();
+    // the queued loads publish into the snapshots, so they end first
+    loaders_.Stop();
+    Snapshot *current = snapshot_.load();
+    if (current != &initialSnapshot_) {
+        delete (current);
+    }
+    for (size_t i = 0; i < retiredSnapshots_.size(); ++i) {
+        delete (retiredSnapshots_[i]);
+    }
+
+    for (size_t i = 0; i < pluralRulesCache_.size(); ++i) {
+        HILOG_DEBUG("delete pluralRules %s", pluralRulesCache_[i]->GetLanguage().c_str());
+        delete (pluralRulesCache_[i]);
+    }
 }
 
 bool HapManager::AddResourcePath(const char *path)
 {
     std::string sPath(path);
-    std::vector<std::string>::iterator it = std::find(loadedHapPaths_.begin(),
-        loadedHapPaths_.end(), sPath);
-    if (it != loadedHapPaths_.end()) {
+    if (IsHapPathKnown(sPath)) {
         HILOG_ERROR(" %s has already been loaded!", path);
         return false;
     }
-    const HapResource *pResource = HapResource::LoadFromIndex(path, resConfig_);
+    const HapResource *pResource = HapResource::LoadFromIndex(path, snapshot_.load()->resConfig_.get());
     if (pResource == nullptr) {
         return false;
     }
-    this->hapResources_.push_back(const_cast<HapResource *>(pResource));
-    this->loadedHapPaths_.push_back(sPath);
+    Snapshot *snapshot = CloneSnapshot();
+    if (snapshot == nullptr) {
+        HILOG_ERROR("new Snapshot failed when AddResourcePath");
+        delete (pResource);
+        return false;
+    }
+    if (!PutHap(snapshot, snapshot->HapSize(), pResource)) {
+        delete (snapshot);
+        return false;
+    }
+    snapshot->loadedHapPaths_.push_back(sPath);
+    this->Publish(snapshot);
     return true;
 }
 
-RState HapManager::ReloadAll()
+RState HapManager::ReloadAll(const std::shared_ptr<ResConfigImpl> &resConfig)
 {
-    if (hapResources_.size() == 0) {
-        return SUCCESS;
+    const Snapshot *current = snapshot_.load();
+    Snapshot *snapshot = new (std::nothrow) Snapshot(this, resConfig, NextEpoch());
+    if (snapshot == nullptr) {
+        HILOG_ERROR("new Snapshot failed when ReloadAll");
+        return NOT_ENOUGH_MEM;
     }
-    std::vector<HapResource *> newResources;
-    for (size_t i = 0; i < hapResources_.size(); ++i) {
-        const HapResource *pResource = HapResource::LoadFromIndex(hapResources_[i]->GetIndexPath().c_str(), resConfig_);
+    for (size_t i = 0; i < current->hapStubs_.size(); ++i) {
+        const HapResource *pResource =
+            HapResource::LoadFromIndex(current->hapStubs_[i]->GetIndexPath().c_str(), resConfig.get());
         if (pResource == nullptr) {
-            for (size_t j = 0; j < newResources.size(); ++j) {
-                delete (newResources[j]);
-            }
+            // the published snapshot is untouched, so readers keep the old config and haps
+            delete (snapshot);
             return HAP_INIT_FAILED;
         }
-        newResources.push_back(const_cast<HapResource *>(pResource));
-    }
-    for (size_t i = 0; i < hapResources_.size(); ++i) {
-        delete (hapResources_[i]);
+        if (!PutHap(snapshot, i, pResource)) {
+            delete (snapshot);
+            return NOT_ENOUGH_MEM;
+        }
+        if (current->GetResidentHap(i) == nullptr) {
+            // the ids and names depend on resConfig, so only the stub is rebuilt for an evicted hap
+            snapshot->hapStubs_[i]->lastUse_.store(current->hapStubs_[i]->lastUse_.load());
+            snapshot->hapResources_[i] = nullptr;
+        }
     }
-    hapResources_ = newResources;
+    snapshot->loadedHapPaths_ = current->loadedHapPaths_;
+    snapshot->pendingHapCount_ = static_cast<uint32_t>(pendingHapPaths_.size());
+    this->Publish(snapshot);
     return SUCCESS;
 }
+
+void HapManager::SetMemoryBudget(size_t budget)
+{
+    AutoMutex mutex(this->lock_);
+    memoryBudget_.store(budget);
+    Snapshot *snapshot = CloneSnapshot();
+    if (snapshot == nullptr) {
+        HILOG_ERROR("new Snapshot failed when SetMemoryBudget");
+        return;
+    }
+    this->Publish(snapshot);
+}
+
+void HapManager::GetResidencyStats(ResidencyStats &stats)
+{
+    AutoMutex mutex(this->lock_);
+    const Snapshot *current = snapshot_.load();
+    stats.memoryBudget = memoryBudget_.load();
+    stats.residentSize = 0;
+    stats.residentHapCount = 0;
+    stats.evictedHapCount = 0;
+    for (size_t i = 0; i < current->hapResources_.size(); ++i) {
+        if (current->GetResidentHap(i) == nullptr) {
+            stats.evictedHapCount++;
+            continue;
+        }
+        stats.residentHapCount++;
+        stats.residentSize += current->hapStubs_[i]->GetDataSize();
+    }
+    stats.evictionCount = evictionCount_.load();
+    stats.reloadCount = reloadCount_.load();
+    stats.reloadTimeUs = reloadTimeUs_.load();
+}
+
+bool HapManager::PutHap(Snapshot *snapshot, size_t index, const HapResource *hapResource)
+{
+    std::shared_ptr<HapStub> hapStub(new (std::nothrow) HapStub(hapResource));
+    if (hapStub == nullptr) {
+        HILOG_ERROR("new HapStub failed when PutHap");
+        delete (hapResource);
+        return false;
+    }
+    hapStub->lastUse_.store(accessClock_.fetch_add(1) + 1);
+    if (index == snapshot->hapResources_.size()) {
+        snapshot->hapResources_.push_back(std::shared_ptr<const HapResource>(hapResource));
+        snapshot->hapStubs_.push_back(hapStub);
+    } else {
+        snapshot->hapResources_[index] = std::shared_ptr<const HapResource>(hapResource);
+        snapshot->hapStubs_[index] = hapStub;
+    }
+    return true;
+}
+
+void HapManager::EvictColdHaps(Snapshot *snapshot)
+{
+    size_t budget = memoryBudget_.load();
+    if (budget == 0) {
+        return;
+    }
+    size_t residentSize = 0;
+    size_t residentCount = 0;
+    for (size_t i = 0; i < snapshot->hapResources_.size(); ++i) {
+        if (snapshot->hapResources_[i] != nullptr) {
+            residentSize += snapshot->hapStubs_[i]->GetDataSize();
+            residentCount++;
+        }
+    }
+    // keep the most recently used hap resident, even if it exceeds the budget alone
+    while (residentSize > budget && residentCount > 1) {
+        size_t coldest = snapshot->hapResources_.size();
+        uint64_t coldestUse = UINT64_MAX;
+        for (size_t i = 0; i < snapshot->hapResources_.size(); ++i) {
+            uint64_t lastUse = snapshot->hapStubs_[i]->lastUse_.load(std::memory_order_relaxed);
+            if (snapshot->hapResources_[i] != nullptr && lastUse < coldestUse) {
+                coldest = i;
+                coldestUse = lastUse;
+            }
+        }
+        HILOG_DEBUG("evict %s", snapshot->hapStubs_[coldest]->GetIndexPath().c_str());
+        // it is freed after the snapshots sharing it are reclaimed
+        snapshot->hapResources_[coldest] = nullptr;
+        residentSize -= snapshot->hapStubs_[coldest]->GetDataSize();
+        residentCount--;
+        evictionCount_++;
+    }
+}
+
+const HapResource *HapManager::ReloadEvicted(const Snapshot *snapshot, size_t index)
+{
+    // parse without lock_, readers of other haps and writers go on meanwhile
+    const HapStub *hapStub = snapshot->hapStubs_[index].get();
+    auto start = std::chrono::steady_clock::now();
+    const HapResource *pResource = HapResource::LoadFromIndex(hapStub->GetIndexPath().c_str(),
+        snapshot->resConfig_.get());
+    reloadCount_.fetch_add(1);
+    reloadTimeUs_.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count()));
+    if (pResource == nullptr) {
+        HILOG_ERROR("reload evicted %s failed", hapStub->GetIndexPath().c_str());
+        return nullptr;
+    }
+    std::shared_ptr<const HapResource> *reloaded =
+        new (std::nothrow) std::shared_ptr<const HapResource>(pResource);
+    if (reloaded == nullptr) {
+        HILOG_ERROR("new shared_ptr failed when ReloadEvicted");
+        delete (pResource);
+        return nullptr;
+    }
+    const std::shared_ptr<const HapResource> *expected = nullptr;
+    if (!snapshot->reloadedHaps_[index].compare_exchange_strong(expected, reloaded, std::memory_order_acq_rel,
+        std::memory_order_acquire)) {
+        // another reader of this snapshot reloaded it meanwhile
+        delete (reloaded);
+        return expected->get();
+    }
+    hapStub->lastUse_.store(accessClock_.fetch_add(1) + 1);
+    this->PublishReloaded(snapshot);
+    return pResource;
+}
+
+void HapManager::PublishReloaded(const Snapshot *snapshot)
+{
+    if (!lock_.try_lock()) {
+        return;
+    }
+    // an outdated snapshot keeps its reloaded hap until it is reclaimed
+    if (snapshot_.load() == snapshot) {
+        Snapshot *copy = CloneSnapshot();
+        if (copy != nullptr) {
+            this->Publish(copy);
+        } else {
+            HILOG_ERROR("new Snapshot failed when PublishReloaded");
+        }
+    }
+    lock_.unlock();
+}
+
+void HapManager::Publish(Snapshot *snapshot)
+{
+    this->EvictColdHaps(snapshot);
+    std::vector<std::atomic<const std::shared_ptr<const HapResource> *>>(snapshot->HapSize()).swap(
+        snapshot->reloadedHaps_);
+    Snapshot *old = snapshot_.exchange(snapshot, std::memory_order_seq_cst);
+    if (old != &initialSnapshot_) {
+        retiredSnapshots_.push_back(old);
+    }
+    this->ReclaimRetiredSnapshots();
+}
+
+void HapManager::ReclaimRetiredSnapshots()
+{
+    // a reader that takes a slot or pins after these loads sees the current snapshot, so it holds no retired one
+    if (retiredSnapshots_.empty() || pinCount_.load(std::memory_order_seq_cst) != 0 ||
+        overflowReaders_.load(std::memory_order_seq_cst) != 0) {
+        return;
+    }
+    const Snapshot *held[READER_SLOT_COUNT];
+    size_t heldCount = 0;
+    for (size_t i = 0; i < READER_SLOT_COUNT; ++i) {
+        const Snapshot *snapshot = readerSlots_[i].load(std::memory_order_seq_cst);
+        if (snapshot != nullptr) {
+            held[heldCount++] = snapshot;
+        }
+    }
+    size_t keptCount = 0;
+    for (size_t i = 0; i < retiredSnapshots_.size(); ++i) {
+        if (std::find(held, held + heldCount, retiredSnapshots_[i]) != held + heldCount) {
+            retiredSnapshots_[keptCount++] = retiredSnapshots_[i];
+            continue;
+        }
+        delete (retiredSnapshots_[i]);
+    }
+    retiredSnapshots_.resize(keptCount);
+}
+
+void HapManager::TryReclaimRetiredSnapshots()
+{
+    if (!lock_.try_lock()) {
+        // the next publish or release of an outdated guard reclaims them
+        return;
+    }
+    this->ReclaimRetiredSnapshots();
+    lock_.unlock();
+}
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
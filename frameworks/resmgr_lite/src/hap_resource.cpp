@@ -15,6 +15,7 @@
 
 #include "hap_resource.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 
@@ -23,6 +24,7 @@
 #include "locale_matcher.h"
 #include "utils/errors.h"
 #include "utils/string_utils.h"
+#include "utils/utils.h"
 
 #if defined(__linux__)
 #include <malloc.h>
@@ -61,8 +63,9 @@ HapResource::IdValues::~IdValues()
 }
 
 // HapResource
-HapResource::HapResource(const std::string path, time_t lastModTime, const ResConfig *defaultConfig, ResDesc *resDes)
-    : indexPath_(path), lastModTime_(lastModTime), resDesc_(resDes), defaultConfig_(defaultConfig)
+HapResource::HapResource(const std::string path, const FileStamp &fileStamp, const ResConfig *defaultConfig,
+    ResDesc *resDes)
+    : indexPath_(path), fileStamp_(fileStamp), dataSize_(0), resDesc_(resDes), defaultConfig_(defaultConfig)
 {
 }
 
@@ -78,13 +81,14 @@ HapResource::~HapResource()
     for (size_t i = 0; i < idValuesNameMap_.size(); ++i) {
         delete (idValuesNameMap_[i]);
     }
-    lastModTime_ = 0;
     // defaultConfig_ was passed by constructor, we do not delete it here
     defaultConfig_ = nullptr;
 }
 
 const HapResource *HapResource::LoadFromIndex(const char *path, const ResConfigImpl *defaultConfig, bool system)
 {
+    // take the stamp before reading, so a write after it is detected by the next Refresh
+    FileStamp fileStamp = Utils::GetFileStamp(path);
     std::ifstream inFile(path, std::ios::binary | std::ios::in);
     if (!inFile.good()) {
         return nullptr;
@@ -105,6 +109,12 @@ const HapResource *HapResource::LoadFromIndex(const char *path, const ResConfigI
     inFile.seekg(0, std::ios::beg);
     inFile.read(static_cast<char *>(buf), bufLen);
     inFile.close();
+    if (Utils::GetFileStamp(path) != fileStamp) {
+        // the data may be torn, the caller keeps the old hap and tries again later
+        HILOG_ERROR("%s changed while loading", path);
+        free(buf);
+        return nullptr;
+    }
 
     HILOG_DEBUG("extract success, bufLen:%d", bufLen);
 
@@ -125,7 +135,7 @@ const HapResource *HapResource::LoadFromIndex(const char *path, const ResConfigI
     }
     free(buf);
 
-    HapResource *pResource = new (std::nothrow) HapResource(std::string(path), 0, defaultConfig, resDesc);
+    HapResource *pResource = new (std::nothrow) HapResource(std::string(path), fileStamp, defaultConfig, resDesc);
     if (pResource == nullptr) {
         HILOG_ERROR("new HapResource failed when LoadFromIndex");
         delete (resDesc);
@@ -135,6 +145,7 @@ const HapResource *HapResource::LoadFromIndex(const char *path, const ResConfigI
         delete (pResource);
         return nullptr;
     }
+    pResource->dataSize_ = static_cast<size_t>(bufLen);
     return pResource;
 }
 
@@ -159,7 +170,11 @@ bool HapResource::Init()
         }
         idValuesNameMap_.push_back(mptr);
     }
-    return InitIdList();
+    if (!InitIdList()) {
+        return false;
+    }
+    InitNameHashIndex();
+    return true;
 }
 
 bool HapResource::InitIdList()
@@ -207,6 +222,23 @@ bool HapResource::InitIdList()
     return true;
 };
 
+void HapResource::InitNameHashIndex()
+{
+    size_t count = 0;
+    for (size_t i = 0; i < idValuesNameMap_.size(); ++i) {
+        count += idValuesNameMap_[i]->size();
+    }
+    nameHashIndex_.reserve(count);
+    for (size_t i = 0; i < idValuesNameMap_.size(); ++i) {
+        std::map<std::string, IdValues *>::const_iterator iter;
+        for (iter = idValuesNameMap_[i]->begin(); iter != idValuesNameMap_[i]->end(); ++iter) {
+            uint64_t hash = HashResName(iter->first.c_str(), static_cast<ResType>(i));
+            nameHashIndex_.push_back(std::make_pair(hash, iter->second));
+        }
+    }
+    std::sort(nameHashIndex_.begin(), nameHashIndex_.end());
+}
+
 const HapResource::IdValues *HapResource::GetIdValues(const uint32_t id) const
 {
     uint32_t uid = id;
@@ -230,6 +262,27 @@ const HapResource::IdValues *HapResource::GetIdValuesByName(
     return iter->second;
 }
 
+const HapResource::IdValues *HapResource::GetIdValuesByName(const ResName &name) const
+{
+    if (name.name == nullptr) {
+        return nullptr;
+    }
+    std::vector<std::pair<uint64_t, IdValues *>>::const_iterator iter = std::lower_bound(nameHashIndex_.begin(),
+        nameHashIndex_.end(), std::make_pair(name.hash, static_cast<IdValues *>(nullptr)));
+    // hashes may collide, so the name is compared
+    for (; iter != nameHashIndex_.end() && iter->first == name.hash; ++iter) {
+        if (iter->second->GetLimitPathsConst().empty()) {
+            HILOG_ERROR("limitPaths empty");
+            continue;
+        }
+        const IdItem *idItem = iter->second->GetLimitPathsConst()[0]->GetIdItem();
+        if (idItem->resType_ == name.resType && idItem->name_ == name.name) {
+            return iter->second;
+        }
+    }
+    return nullptr;
+}
+
 int HapResource::GetIdByName(const char *name, const ResType resType) const
 {
     if (name == nullptr) {
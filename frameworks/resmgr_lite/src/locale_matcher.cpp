@@ -16,10 +16,9 @@
 
 #include <cstring>
 #include <new>
-#include "likely_subtags_key_data.cpp"
-#include "likely_subtags_value_data.cpp"
 
 #include "utils/common.h"
+#include "utils/compact_locale_data.h"
 #include "utils/locale_data.h"
 #include "utils/utils.h"
 
@@ -30,9 +29,125 @@ namespace Resource {
 uint64_t LocaleMatcher::EN_US_ENCODE = Utils::EncodeLocale("en", nullptr, "US");
 uint64_t LocaleMatcher::EN_GB_ENCODE = Utils::EncodeLocale("en", nullptr, "GB");
 uint64_t LocaleMatcher::EN_QAAG_ENCODE = Utils::EncodeLocale("en", "Qaag", nullptr);
+uint64_t LocaleMatcher::EN_LATN_ENCODE = Utils::EncodeLocale("en", "Latn", nullptr);
+uint64_t LocaleMatcher::EN_ENCODE = Utils::EncodeLocale("en", nullptr, nullptr);
+uint64_t LocaleMatcher::EN_001_ENCODE = Utils::EncodeLocale("en", nullptr, "001");
 uint64_t LocaleMatcher::ZH_HANT_MO_ENCODE = Utils::EncodeLocale("zh", "Hant", "MO");
 uint64_t LocaleMatcher::ZH_HK_ENCODE = Utils::EncodeLocale("zh", nullptr, "HK");
 uint32_t LocaleMatcher::HANT_ENCODE = Utils::EncodeScript("Hant");
+uint16_t LocaleMatcher::EN_LANGUAGE_ENCODE = Utils::EncodeLanguage("en");
+uint16_t LocaleMatcher::US_REGION_ENCODE = Utils::EncodeRegion("US");
+
+/**
+ * @brief check table[begin, end) is strictly ascending, it halves the range so the recursion stays shallow.
+ *
+ * @param table
+ * @param begin
+ * @param end
+ * @return true if sorted without duplicates
+ */
+template<typename T>
+constexpr bool IsStrictlySorted(const T *table, size_t begin, size_t end)
+{
+    return (end - begin < 2) ? true : (table[begin + (end - begin) / 2 - 1] < table[begin + (end - begin) / 2] &&
+        IsStrictlySorted(table, begin, begin + (end - begin) / 2) &&
+        IsStrictlySorted(table, begin + (end - begin) / 2, end));
+}
+
+#define TABLE_LEN(table) (sizeof(table) / sizeof((table)[0]))
+
+// compact_locale_data.h is generated by tools/locale_data_gen.cpp, these guard hand edits
+static_assert(SCRIPT_CODES[0] == 0 && TABLE_LEN(SCRIPT_CODES) <= 256, "SCRIPT_CODES must fit a packed locale");
+static_assert(REGION_CODES[0] == 0 && TABLE_LEN(REGION_CODES) <= 256, "REGION_CODES must fit a packed locale");
+static_assert(IsStrictlySorted(SCRIPT_CODES, 0, TABLE_LEN(SCRIPT_CODES)), "SCRIPT_CODES must be sorted");
+static_assert(IsStrictlySorted(REGION_CODES, 0, TABLE_LEN(REGION_CODES)), "REGION_CODES must be sorted");
+static_assert(IsStrictlySorted(LIKELY_TAGS_LANGUAGE_KEY, 0, TABLE_LEN(LIKELY_TAGS_LANGUAGE_KEY)),
+    "LIKELY_TAGS_LANGUAGE_KEY must be sorted");
+static_assert(TABLE_LEN(LIKELY_TAGS_LANGUAGE_KEY) == TABLE_LEN(LIKELY_TAGS_LANGUAGE_VALUE),
+    "LIKELY_TAGS_LANGUAGE_KEY and LIKELY_TAGS_LANGUAGE_VALUE must be parallel");
+static_assert(IsStrictlySorted(LIKELY_TAGS_LOCALE_KEY, 0, TABLE_LEN(LIKELY_TAGS_LOCALE_KEY)),
+    "LIKELY_TAGS_LOCALE_KEY must be sorted");
+static_assert(TABLE_LEN(LIKELY_TAGS_LOCALE_KEY) == TABLE_LEN(LIKELY_TAGS_LOCALE_VALUE),
+    "LIKELY_TAGS_LOCALE_KEY and LIKELY_TAGS_LOCALE_VALUE must be parallel");
+static_assert(IsStrictlySorted(LOCALE_PARENTS_KEY, 0, TABLE_LEN(LOCALE_PARENTS_KEY)),
+    "LOCALE_PARENTS_KEY must be sorted");
+static_assert(TABLE_LEN(LOCALE_PARENTS_KEY) == TABLE_LEN(LOCALE_PARENTS_VALUE),
+    "LOCALE_PARENTS_KEY and LOCALE_PARENTS_VALUE must be parallel");
+static_assert(IsStrictlySorted(TYPICAL_CODES_VALUE, 0, TABLE_LEN(TYPICAL_CODES_VALUE)),
+    "TYPICAL_CODES_VALUE must be sorted");
+
+/**
+ * @brief binary search key in a sorted table, the loop has no data dependent branch.
+ *
+ * @param table
+ * @param len
+ * @param key
+ * @return index of key, -1 if not found
+ */
+template<typename T>
+int32_t SearchSortedTable(const T *table, size_t len, T key)
+{
+    if (len == 0) {
+        return -1;
+    }
+    const T *base = table;
+    size_t n = len;
+    while (n > 1) {
+        size_t half = n / 2;
+        base = (base[half] <= key) ? base + half : base;
+        n -= half;
+    }
+    return (*base == key) ? static_cast<int32_t>(base - table) : -1;
+}
+
+/**
+ * @brief pack encoded locale as language << 16 | script index << 8 | region index, see compact_locale_data.h.
+ *
+ * @param encodedLocale
+ * @param packedLocale
+ * @return false if its script or region is in no locale table, so neither is the locale
+ */
+bool PackLocale(uint64_t encodedLocale, uint32_t &packedLocale)
+{
+    uint32_t script = static_cast<uint32_t>((encodedLocale & 0x0000ffffffff0000) >> 16);
+    uint16_t region = static_cast<uint16_t>(encodedLocale & 0x000000000000ffff);
+    int32_t scriptIndex = (script == 0) ? 0 : SearchSortedTable(SCRIPT_CODES, TABLE_LEN(SCRIPT_CODES), script);
+    int32_t regionIndex = (region == 0) ? 0 : SearchSortedTable(REGION_CODES, TABLE_LEN(REGION_CODES), region);
+    if (scriptIndex < 0 || regionIndex < 0) {
+        return false;
+    }
+    packedLocale = (static_cast<uint32_t>(encodedLocale >> 48) << 16) | (static_cast<uint32_t>(scriptIndex) << 8) |
+        static_cast<uint32_t>(regionIndex);
+    return true;
+}
+
+uint64_t UnpackLocale(uint32_t packedLocale)
+{
+    return (static_cast<uint64_t>(packedLocale >> 16) << 48) |
+        (static_cast<uint64_t>(SCRIPT_CODES[(packedLocale >> 8) & 0xff]) << 16) | REGION_CODES[packedLocale & 0xff];
+}
+
+/**
+ * @brief find the likely subtags of encoded locale.
+ *
+ * @param encodedLocale
+ * @return packed subtags, script index << 8 | region index, -1 if not found
+ */
+int32_t FindLikelySubtags(uint64_t encodedLocale)
+{
+    int32_t i;
+    if ((encodedLocale & 0x0000ffffffffffff) == 0) {
+        uint16_t language = static_cast<uint16_t>(encodedLocale >> 48);
+        i = SearchSortedTable(LIKELY_TAGS_LANGUAGE_KEY, TABLE_LEN(LIKELY_TAGS_LANGUAGE_KEY), language);
+        return (i < 0) ? -1 : LIKELY_TAGS_LANGUAGE_VALUE[i];
+    }
+    uint32_t packedLocale = 0;
+    if (!PackLocale(encodedLocale, packedLocale)) {
+        return -1;
+    }
+    i = SearchSortedTable(LIKELY_TAGS_LOCALE_KEY, TABLE_LEN(LIKELY_TAGS_LOCALE_KEY), packedLocale);
+    return (i < 0) ? -1 : LIKELY_TAGS_LOCALE_VALUE[i];
+}
 
 bool IsContainRegion(uint64_t encodedLocale)
 {
@@ -66,11 +181,11 @@ uint64_t SearchParentLocale(uint64_t encodedLocale, const ResLocale *request)
         }
     }
     if (IsContainRegion(encodedLocale)) {
-        size_t len = sizeof(LOCALE_PARENTS_KEY) / sizeof(LOCALE_PARENTS_KEY[0]);
-        for (size_t i = 0; i < len; i++) {
-            if (LOCALE_PARENTS_KEY[i] == tempEncodedLocale) {
-                return LOCALE_PARENTS_VALUE[i];
-            }
+        uint32_t packedLocale = 0;
+        int32_t i = PackLocale(tempEncodedLocale, packedLocale) ?
+            SearchSortedTable(LOCALE_PARENTS_KEY, TABLE_LEN(LOCALE_PARENTS_KEY), packedLocale) : -1;
+        if (i >= 0) {
+            return UnpackLocale(LOCALE_PARENTS_VALUE[i]);
         }
         return ClearRegion(encodedLocale);
     }
@@ -98,6 +213,46 @@ void FindTrackPath(const ResLocale *request, size_t len, uint64_t encodedLocale,
     }
 }
 
+const size_t TRACK_PATH_CACHE_SIZE = 16;
+
+struct TrackPathCacheEntry {
+    bool valid;
+    bool isHant;
+    uint64_t encodedLocale;
+    uint64_t path[LocaleMatcher::TRACKPATH_ARRAY_SIZE];
+};
+
+// per thread so that matching needs no lock, the tables never change so an entry never goes stale
+thread_local TrackPathCacheEntry g_trackPathCache[TRACK_PATH_CACHE_SIZE];
+
+/**
+ * @brief FindTrackPath memoised in a small direct mapped table of this thread.
+ * the track path depends only on encodedLocale and whether the request script is Hant.
+ *
+ * @param request
+ * @param encodedLocale
+ * @param result TRACKPATH_ARRAY_SIZE entries, unused ones are ROOT_LOCALE
+ */
+void FindTrackPathCached(const ResLocale *request, uint64_t encodedLocale, uint64_t *result)
+{
+    bool isHant = Utils::EncodeScriptByResLocale(request) == LocaleMatcher::HANT_ENCODE;
+    size_t index = static_cast<size_t>((encodedLocale >> 48) * 31 + (encodedLocale & 0xffff) + (isHant ? 1 : 0)) %
+        TRACK_PATH_CACHE_SIZE;
+    TrackPathCacheEntry &entry = g_trackPathCache[index];
+    if (!entry.valid || entry.encodedLocale != encodedLocale || entry.isHant != isHant) {
+        for (size_t i = 0; i < LocaleMatcher::TRACKPATH_ARRAY_SIZE; ++i) {
+            entry.path[i] = LocaleMatcher::ROOT_LOCALE;
+        }
+        FindTrackPath(request, LocaleMatcher::TRACKPATH_ARRAY_SIZE, encodedLocale, entry.path);
+        entry.encodedLocale = encodedLocale;
+        entry.isHant = isHant;
+        entry.valid = true;
+    }
+    for (size_t i = 0; i < LocaleMatcher::TRACKPATH_ARRAY_SIZE; ++i) {
+        result[i] = entry.path[i];
+    }
+}
+
 /**
  * @brief find encodedLocale pos is in trackpath list.
  *
@@ -129,19 +284,15 @@ int8_t SearchTrackPathDistance(const uint64_t *paths, size_t len, uint64_t encod
  * @return true
  * @return false
  */
-bool IsDefaultLocale(const char *language, const char *script, const char *region)
+bool IsDefaultLocale(uint16_t language, uint32_t script, uint16_t region)
 {
     uint64_t encodedLocale = Utils::EncodeLocale(language, script, region);
     if (ClearRegion(encodedLocale) == LocaleMatcher::EN_QAAG_ENCODE) {
-        encodedLocale = Utils::EncodeLocale("en", "Latn", region);
+        encodedLocale = LocaleMatcher::EN_LATN_ENCODE | region;
     }
-    size_t len = sizeof(TYPICAL_CODES_VALUE) / sizeof(TYPICAL_CODES_VALUE[0]);
-    for (size_t i = 0; i < len; i++) {
-        if (TYPICAL_CODES_VALUE[i] == encodedLocale) {
-            return true;
-        }
-    }
-    return false;
+    uint32_t packedLocale = 0;
+    return PackLocale(encodedLocale, packedLocale) &&
+        SearchSortedTable(TYPICAL_CODES_VALUE, TABLE_LEN(TYPICAL_CODES_VALUE), packedLocale) >= 0;
 }
 
 /**
@@ -153,22 +304,15 @@ bool IsDefaultLocale(const char *language, const char *script, const char *regio
  * @param region
  * @return uint32_t
  */
-uint32_t FindDefaultScriptEncode(const char *language, const char *region)
+uint32_t FindDefaultScriptEncode(uint16_t language, uint16_t region)
 {
-    uint64_t encodedLocale = Utils::EncodeLocale(language, nullptr, region);
-    size_t len = sizeof(LIKELY_TAGS_CODES_KEY) / sizeof(LIKELY_TAGS_CODES_KEY[0]);
-    for (size_t i = 0; i < len; i++) {
-        if (LIKELY_TAGS_CODES_KEY[i] == encodedLocale) {
-            return static_cast<uint32_t>((LIKELY_TAGS_CODES_VALUE[i] & 0x0000ffffffff0000) >> 16);
-        }
+    uint64_t encodedLocale = Utils::EncodeLocale(language, LocaleMatcher::NULL_SCRIPT, region);
+    int32_t subtags = FindLikelySubtags(encodedLocale);
+    if (subtags < 0 && region != LocaleMatcher::NULL_REGION) {
+        subtags = FindLikelySubtags(ClearRegion(encodedLocale));
     }
-    if (region != nullptr) {
-        encodedLocale = Utils::EncodeLocale(language, nullptr, nullptr);
-        for (size_t i = 0; i < len; i++) {
-            if (LIKELY_TAGS_CODES_KEY[i] == encodedLocale) {
-                return static_cast<uint32_t>((LIKELY_TAGS_CODES_VALUE[i] & 0x0000ffffffff0000) >> 16);
-            }
-        }
+    if (subtags >= 0) {
+        return SCRIPT_CODES[subtags >> 8];
     }
     return LocaleMatcher::NULL_SCRIPT;
 }
@@ -182,27 +326,21 @@ uint32_t FindDefaultScriptEncode(const char *language, const char *region)
  * @param script
  * @return uint16_t
  */
-uint16_t FindDefaultRegionEncode(const char *language, const char *script)
+uint16_t FindDefaultRegionEncode(uint16_t language, uint32_t script)
 {
     /* first try language and script */
-    uint64_t encodedLocale = Utils::EncodeLocale(language, script, nullptr);
-    if (encodedLocale == Utils::EncodeLocale("en", "Qaag", nullptr)) {
-        encodedLocale = Utils::EncodeLocale("en", "Latn", nullptr);
-    }
-    size_t len = sizeof(LIKELY_TAGS_CODES_KEY) / sizeof(LIKELY_TAGS_CODES_KEY[0]);
-    for (size_t i = 0; i < len; i++) {
-        if (LIKELY_TAGS_CODES_KEY[i] == encodedLocale) {
-            return static_cast<uint16_t>((LIKELY_TAGS_CODES_VALUE[i] & 0x000000000000ffff));
-        }
+    uint64_t encodedLocale = Utils::EncodeLocale(language, script, LocaleMatcher::NULL_REGION);
+    if (encodedLocale == LocaleMatcher::EN_QAAG_ENCODE) {
+        encodedLocale = LocaleMatcher::EN_LATN_ENCODE;
     }
+    int32_t subtags = FindLikelySubtags(encodedLocale);
     /* if not found and script is not null,try language */
-    if (script != nullptr) {
-        encodedLocale = Utils::EncodeLocale(language, nullptr, nullptr);
-        for (size_t i = 0; i < len; i++) {
-            if (LIKELY_TAGS_CODES_KEY[i] == encodedLocale) {
-                return static_cast<uint16_t>((LIKELY_TAGS_CODES_VALUE[i] & 0x000000000000ffff));
-            }
-        }
+    if (subtags < 0 && script != LocaleMatcher::NULL_SCRIPT) {
+        subtags = FindLikelySubtags(Utils::EncodeLocale(language, LocaleMatcher::NULL_SCRIPT,
+            LocaleMatcher::NULL_REGION));
+    }
+    if (subtags >= 0) {
+        return REGION_CODES[subtags & 0xff];
     }
     return LocaleMatcher::NULL_REGION;
 };
@@ -239,14 +377,14 @@ int8_t CompareRegionWhenQaag(const ResLocale *current,
     const ResLocale *other,
     const ResLocale *request)
 {
-    if ((request != nullptr) && (Utils::EncodeLocale(request->GetLanguage(), request->GetScript(),
-        nullptr) == LocaleMatcher::EN_QAAG_ENCODE)) {
-        if ((current != nullptr) && (Utils::EncodeLocale(current->GetLanguage(), nullptr,
-            current->GetRegion()) == LocaleMatcher::EN_GB_ENCODE)) {
+    if ((request != nullptr) && (Utils::EncodeLocale(request->GetEncodedLanguage(), request->GetEncodedScript(),
+        LocaleMatcher::NULL_REGION) == LocaleMatcher::EN_QAAG_ENCODE)) {
+        if ((current != nullptr) && (Utils::EncodeLocale(current->GetEncodedLanguage(), LocaleMatcher::NULL_SCRIPT,
+            current->GetEncodedRegion()) == LocaleMatcher::EN_GB_ENCODE)) {
             return 1;
         }
-        if ((other != nullptr) && (Utils::EncodeLocale(other->GetLanguage(), nullptr, other->GetRegion()) ==
-            LocaleMatcher::EN_GB_ENCODE)) {
+        if ((other != nullptr) && (Utils::EncodeLocale(other->GetEncodedLanguage(), LocaleMatcher::NULL_SCRIPT,
+            other->GetEncodedRegion()) == LocaleMatcher::EN_GB_ENCODE)) {
             return -1;
         }
     }
@@ -297,24 +435,22 @@ bool CompareScript(const ResLocale *current, const ResLocale *other)
 {
     uint32_t currentEncodedScript = 0;
     uint32_t otherEncodedScript = 0;
-    if ((current != nullptr) && (current->GetScript() == nullptr)) {
-        currentEncodedScript = FindDefaultScriptEncode(current->GetLanguage(),
-            current->GetRegion());
+    if ((current != nullptr) && (current->GetEncodedScript() == LocaleMatcher::NULL_SCRIPT)) {
+        currentEncodedScript = FindDefaultScriptEncode(current->GetEncodedLanguage(), current->GetEncodedRegion());
     } else {
         currentEncodedScript = Utils::EncodeScriptByResLocale(current);
     }
-    if ((other != nullptr) && (other->GetScript() == nullptr)) {
-        otherEncodedScript = FindDefaultScriptEncode(other->GetLanguage(),
-            other->GetRegion());
+    if ((other != nullptr) && (other->GetEncodedScript() == LocaleMatcher::NULL_SCRIPT)) {
+        otherEncodedScript = FindDefaultScriptEncode(other->GetEncodedLanguage(), other->GetEncodedRegion());
     } else {
         otherEncodedScript = Utils::EncodeScriptByResLocale(other);
     }
     if (current != nullptr && other != nullptr) {
         // when current locale is en-Qaag is equal en-Latn
-        if (Utils::EncodeLocale(current->GetLanguage(), current->GetScript(), nullptr) ==
-            Utils::EncodeLocale("en", "Qaag", nullptr)) {
-            if (Utils::EncodeLocale(other->GetLanguage(), other->GetScript(), nullptr) ==
-                Utils::EncodeLocale("en", "Latn", nullptr)) {
+        if (Utils::EncodeLocale(current->GetEncodedLanguage(), current->GetEncodedScript(),
+            LocaleMatcher::NULL_REGION) == LocaleMatcher::EN_QAAG_ENCODE) {
+            if (Utils::EncodeLocale(other->GetEncodedLanguage(), other->GetEncodedScript(),
+                LocaleMatcher::NULL_REGION) == LocaleMatcher::EN_LATN_ENCODE) {
                 return true;
             }
         }
@@ -340,21 +476,21 @@ int8_t AlphabeticallyCompare(const ResLocale *current,
     if (currentEncodedLocale == otherEncodedLocale) {
         return 0;
     }
-    if (current == nullptr || current->GetRegion() == nullptr) {
+    if (current == nullptr || current->GetEncodedRegion() == LocaleMatcher::NULL_REGION) {
         return -1;
     }
-    if (other == nullptr || other->GetRegion() == nullptr) {
+    if (other == nullptr || other->GetEncodedRegion() == LocaleMatcher::NULL_REGION) {
         return 1;
     }
-    // be here region is not null
-    char currentFirstChar = (current->GetRegion())[0];
-    char otherFirstChar = (other->GetRegion())[0];
-    if (currentFirstChar >= '0' && currentFirstChar <= '9') {
-        if (otherFirstChar < '0' || otherFirstChar > '9') {
+    // be here region is not null, only a three digit region has the high bit of its encode set
+    bool isCurrentNumeric = (current->GetEncodedRegion() & 0x8000) != 0;
+    bool isOtherNumeric = (other->GetEncodedRegion() & 0x8000) != 0;
+    if (isCurrentNumeric) {
+        if (!isOtherNumeric) {
             return -1;
         }
     } else {
-        if (otherFirstChar >= '0' && otherFirstChar <= '9') {
+        if (isOtherNumeric) {
             return 1;
         }
     }
@@ -372,10 +508,10 @@ int8_t CompareWhenRegionIsNull(uint16_t currentEncodedRegion, uint16_t otherEnco
     const ResLocale *other,
     const ResLocale *request)
 {
-    if (current == nullptr || current->GetRegion() == nullptr) {
+    if (current == nullptr || current->GetEncodedRegion() == LocaleMatcher::NULL_REGION) {
         return 1;
     }
-    if (other == nullptr || other->GetRegion() == nullptr) {
+    if (other == nullptr || other->GetEncodedRegion() == LocaleMatcher::NULL_REGION) {
         return -1;
     }
     int8_t qaagResult = CompareRegionWhenQaag(current, other, request);
@@ -383,9 +519,9 @@ int8_t CompareWhenRegionIsNull(uint16_t currentEncodedRegion, uint16_t otherEnco
         return qaagResult;
     }
     // get request default region
+    uint16_t requestEncodedLanguage = Utils::EncodeLanguageByResLocale(request);
     uint16_t requestDefaultRegion =
-        FindDefaultRegionEncode((request == nullptr) ? nullptr : request->GetLanguage(),
-            (request == nullptr) ? nullptr : request->GetScript());
+        FindDefaultRegionEncode(requestEncodedLanguage, Utils::EncodeScriptByResLocale(request));
     if (requestDefaultRegion == currentEncodedRegion) {
         return 1;
     }
@@ -393,20 +529,20 @@ int8_t CompareWhenRegionIsNull(uint16_t currentEncodedRegion, uint16_t otherEnco
         return -1;
     }
     // current and other region is not null.alphabetically
-    uint64_t currentEncodedLocale = Utils::EncodeLocale((request == nullptr) ? nullptr : request->GetLanguage(),
-        nullptr, (current == nullptr) ? nullptr : current->GetRegion());
-    uint64_t otherEncodedLocale = Utils::EncodeLocale(
-        (request == nullptr) ? nullptr : request->GetLanguage(), nullptr, other->GetRegion());
+    uint64_t currentEncodedLocale = Utils::EncodeLocale(requestEncodedLanguage, LocaleMatcher::NULL_SCRIPT,
+        currentEncodedRegion);
+    uint64_t otherEncodedLocale = Utils::EncodeLocale(requestEncodedLanguage, LocaleMatcher::NULL_SCRIPT,
+        otherEncodedRegion);
     return AlphabeticallyCompare(current, currentEncodedLocale, other, otherEncodedLocale);
 }
 
 int8_t CompareDistance(uint64_t currentEncodedLocale, uint64_t otherEncodedLocale,
     const uint64_t *requestEncodedTrackPath, const ResLocale *request)
 {
-    uint64_t currentEncodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE] = {0, 0, 0, 0, 0};
-    FindTrackPath(request, LocaleMatcher::TRACKPATH_ARRAY_SIZE, currentEncodedLocale, currentEncodedTrackPath);
-    uint64_t otherEncodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE] = {0, 0, 0, 0, 0};
-    FindTrackPath(request, LocaleMatcher::TRACKPATH_ARRAY_SIZE, otherEncodedLocale, otherEncodedTrackPath);
+    uint64_t currentEncodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE];
+    FindTrackPathCached(request, currentEncodedLocale, currentEncodedTrackPath);
+    uint64_t otherEncodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE];
+    FindTrackPathCached(request, otherEncodedLocale, otherEncodedTrackPath);
     const size_t currentDistance = ComputeTrackPathDistance(
         requestEncodedTrackPath, currentEncodedTrackPath, LocaleMatcher::TRACKPATH_ARRAY_SIZE);
     const size_t targetDistance = ComputeTrackPathDistance(
@@ -428,11 +564,12 @@ int8_t CompareDefaultRegion(const ResLocale *current,
     if (qaagResult != 0) {
         return qaagResult;
     } else {
-        bool isCurrentDefaultRegion = IsDefaultLocale((request == nullptr) ? nullptr : request->GetLanguage(),
-            (request == nullptr) ? nullptr : request->GetScript(),
-            (current == nullptr) ? nullptr : current->GetRegion());
-        bool isOtherDefaultRegion = IsDefaultLocale((request == nullptr) ? nullptr : request->GetLanguage(),
-            (request == nullptr) ? nullptr : request->GetScript(), (other == nullptr) ? nullptr : other->GetRegion());
+        uint16_t requestEncodedLanguage = Utils::EncodeLanguageByResLocale(request);
+        uint32_t requestEncodedScript = Utils::EncodeScriptByResLocale(request);
+        bool isCurrentDefaultRegion = IsDefaultLocale(requestEncodedLanguage, requestEncodedScript,
+            Utils::EncodeRegionByResLocale(current));
+        bool isOtherDefaultRegion = IsDefaultLocale(requestEncodedLanguage, requestEncodedScript,
+            Utils::EncodeRegionByResLocale(other));
         if (isCurrentDefaultRegion != isOtherDefaultRegion) {
             if (isCurrentDefaultRegion) {
                 return 1;
@@ -458,17 +595,18 @@ int8_t CompareRegion(const ResLocale *current,
 {
     uint16_t currentEncodedRegion = Utils::EncodeRegionByResLocale(current);
     uint16_t otherEncodedRegion = Utils::EncodeRegionByResLocale(other);
-    if (request == nullptr || request->GetRegion() == nullptr) {
+    if (request == nullptr || request->GetEncodedRegion() == LocaleMatcher::NULL_REGION) {
         return CompareWhenRegionIsNull(currentEncodedRegion, otherEncodedRegion, current, other, request);
     }
-    uint64_t requestEncodedLocale = Utils::EncodeLocale(
-        request->GetLanguage(), nullptr, request->GetRegion());
-    uint64_t requestEncodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE] = {0, 0, 0, 0, 0};
-    FindTrackPath(request, LocaleMatcher::TRACKPATH_ARRAY_SIZE, requestEncodedLocale, requestEncodedTrackPath);
-    uint64_t currentEncodedLocale = Utils::EncodeLocale(
-        request->GetLanguage(), nullptr, (current == nullptr) ? nullptr : current->GetRegion());
-    uint64_t otherEncodedLocale = Utils::EncodeLocale(
-        request->GetLanguage(), nullptr, (other == nullptr) ? nullptr : other->GetRegion());
+    uint16_t requestEncodedLanguage = request->GetEncodedLanguage();
+    uint64_t requestEncodedLocale = Utils::EncodeLocale(requestEncodedLanguage, LocaleMatcher::NULL_SCRIPT,
+        request->GetEncodedRegion());
+    uint64_t requestEncodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE];
+    FindTrackPathCached(request, requestEncodedLocale, requestEncodedTrackPath);
+    uint64_t currentEncodedLocale = Utils::EncodeLocale(requestEncodedLanguage, LocaleMatcher::NULL_SCRIPT,
+        currentEncodedRegion);
+    uint64_t otherEncodedLocale = Utils::EncodeLocale(requestEncodedLanguage, LocaleMatcher::NULL_SCRIPT,
+        otherEncodedRegion);
     int8_t currentMatchDistance = SearchTrackPathDistance(
         requestEncodedTrackPath,
         LocaleMatcher::TRACKPATH_ARRAY_SIZE,
@@ -492,7 +630,7 @@ int8_t CompareRegion(const ResLocale *current,
         return result;
     }
     uint16_t requestDefaultRegion =
-        FindDefaultRegionEncode(request->GetLanguage(), request->GetScript());
+        FindDefaultRegionEncode(requestEncodedLanguage, request->GetEncodedScript());
     if (requestDefaultRegion == currentEncodedRegion) {
         return 1;
     }
@@ -520,21 +658,17 @@ bool LocaleMatcher::Normalize(ResLocale *localeInfo)
     if (localeInfo == nullptr) {
         return true;
     }
-    if (!Utils::IsStrEmpty(localeInfo->GetScript())) {
+    if (localeInfo->GetEncodedScript() != LocaleMatcher::NULL_SCRIPT) {
         return true;
     }
-    uint32_t encodedScript = FindDefaultScriptEncode(localeInfo->GetLanguage(),
-                                                     localeInfo->GetRegion());
+    uint32_t encodedScript = FindDefaultScriptEncode(localeInfo->GetEncodedLanguage(),
+                                                     localeInfo->GetEncodedRegion());
     if (encodedScript == LocaleMatcher::NULL_SCRIPT) {
         return true;
     }
-    char *tempScript = new(std::nothrow) char[SCRIPT_ARRAY_LEN];
-    if (tempScript == nullptr) {
-        return false;
-    }
-    tempScript[SCRIPT_LEN] = '\0';
-    Utils::DecodeScript(encodedScript, tempScript);
-    localeInfo->script_ = tempScript;
+    Utils::DecodeScript(encodedScript, localeInfo->script_);
+    localeInfo->script_[SCRIPT_LEN] = '\0';
+    localeInfo->encodedScript_ = encodedScript;
     return true;
 }
 
@@ -554,16 +688,15 @@ int8_t CompareLanguageIgnoreOldNewCode(const ResLocale *current, const ResLocale
 
 bool IsSimilarToUsEnglish(const ResLocale *localeInfo)
 {
-    uint64_t localeEncode = Utils::EncodeLocale("en", nullptr,
-        (localeInfo == nullptr) ? nullptr : localeInfo->GetRegion());
-    uint64_t loclaeEncodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE] = {0, 0, 0, 0, 0};
-    FindTrackPath(nullptr, LocaleMatcher::TRACKPATH_ARRAY_SIZE, localeEncode, loclaeEncodedTrackPath);
+    uint64_t localeEncode = LocaleMatcher::EN_ENCODE | Utils::EncodeRegionByResLocale(localeInfo);
+    uint64_t loclaeEncodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE];
+    FindTrackPathCached(nullptr, localeEncode, loclaeEncodedTrackPath);
     uint8_t len = LocaleMatcher::TRACKPATH_ARRAY_SIZE;
     for (uint8_t i = 0; i < len; ++i) {
-        if (loclaeEncodedTrackPath[i] == Utils::EncodeLocale("en", nullptr, nullptr)) {
+        if (loclaeEncodedTrackPath[i] == LocaleMatcher::EN_ENCODE) {
             return true;
         }
-        if (loclaeEncodedTrackPath[i] == Utils::EncodeLocale("en", nullptr, "001")) {
+        if (loclaeEncodedTrackPath[i] == LocaleMatcher::EN_001_ENCODE) {
             return false;
         }
     }
@@ -577,15 +710,15 @@ bool CompareRegionWhenLangIsNotEqual(const ResLocale *current,
     if (qaagResult != 0) {
         return qaagResult;
     }
-    if (request != nullptr && (Utils::EncodeLanguage(request->GetLanguage())) == Utils::EncodeLanguage("en")) {
+    if (request != nullptr && request->GetEncodedLanguage() == LocaleMatcher::EN_LANGUAGE_ENCODE) {
         // when request is en-us,empty region is better
-        if ((Utils::EncodeRegion(request->GetRegion())) == Utils::EncodeRegion("US")) {
+        if (request->GetEncodedRegion() == LocaleMatcher::US_REGION_ENCODE) {
             if (current != nullptr) {
-                return (current->GetRegion() == nullptr) ||
-                            ((Utils::EncodeRegion(current->GetRegion())) == Utils::EncodeRegion("US"));
+                return (current->GetEncodedRegion() == LocaleMatcher::NULL_REGION) ||
+                            (current->GetEncodedRegion() == LocaleMatcher::US_REGION_ENCODE);
             } else {
-                return !(other->GetRegion() == nullptr ||
-                            ((Utils::EncodeRegion(other->GetRegion())) == Utils::EncodeRegion("US")));
+                return !(other->GetEncodedRegion() == LocaleMatcher::NULL_REGION ||
+                            (other->GetEncodedRegion() == LocaleMatcher::US_REGION_ENCODE));
             }
         } else if (IsSimilarToUsEnglish(request)) {
             if (current != nullptr) {
@@ -637,6 +770,62 @@ int8_t LocaleMatcher::IsMoreSuitable(const ResLocale *current,
     return isRegionEqual;
 };
 
+// the fields of a suitability score, from the most significant one, see LocaleMatcher::ComputeSuitability
+const uint32_t SUITABILITY_PATH_POS_SHIFT = 26;
+const uint32_t SUITABILITY_PATH_DISTANCE_SHIFT = 21;
+const uint32_t SUITABILITY_QAAG_GB_SHIFT = 20;
+const uint32_t SUITABILITY_DEFAULT_LOCALE_SHIFT = 19;
+const uint32_t SUITABILITY_DEFAULT_REGION_SHIFT = 18;
+const uint32_t SUITABILITY_REGION_ORDER_SHIFT = 1;
+const uint32_t SUITABILITY_NULL_REGION_ORDER = 0x10000;
+static_assert(LocaleMatcher::TRACKPATH_ARRAY_SIZE < (1 << (32 - SUITABILITY_PATH_POS_SHIFT)),
+    "the track path position must fit its field");
+static_assert(LocaleMatcher::TRACKPATH_ARRAY_SIZE * 2 <
+    (1 << (SUITABILITY_PATH_POS_SHIFT - SUITABILITY_PATH_DISTANCE_SHIFT)),
+    "the track path distance must fit its field");
+
+uint32_t LocaleMatcher::ComputeSuitability(const ResLocale *candidate, const ResLocale *request)
+{
+    if (candidate == nullptr || request == nullptr) {
+        return 0;
+    }
+    const uint32_t len = LocaleMatcher::TRACKPATH_ARRAY_SIZE;
+    uint16_t requestEncodedLanguage = request->GetEncodedLanguage();
+    uint16_t requestEncodedRegion = request->GetEncodedRegion();
+    uint16_t encodedRegion = candidate->GetEncodedRegion();
+    uint64_t encodedLocale = Utils::EncodeLocale(requestEncodedLanguage, LocaleMatcher::NULL_SCRIPT, encodedRegion);
+    uint32_t pathPos = (encodedRegion == requestEncodedRegion) ? 0 : 1;
+    uint32_t pathDistance = 0;
+    bool isDefaultLocale = false;
+    if (requestEncodedRegion != LocaleMatcher::NULL_REGION) {
+        // the keys of CompareRegion
+        uint64_t requestEncodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE];
+        FindTrackPathCached(request, Utils::EncodeLocale(requestEncodedLanguage, LocaleMatcher::NULL_SCRIPT,
+            requestEncodedRegion), requestEncodedTrackPath);
+        pathPos = SearchTrackPathDistance(requestEncodedTrackPath, len, encodedLocale);
+        uint64_t encodedTrackPath[LocaleMatcher::TRACKPATH_ARRAY_SIZE];
+        FindTrackPathCached(request, encodedLocale, encodedTrackPath);
+        pathDistance = ComputeTrackPathDistance(requestEncodedTrackPath, encodedTrackPath, len);
+        isDefaultLocale = IsDefaultLocale(requestEncodedLanguage, request->GetEncodedScript(), encodedRegion);
+    }
+    bool isQaagGb = Utils::EncodeLocale(requestEncodedLanguage, request->GetEncodedScript(),
+        LocaleMatcher::NULL_REGION) == LocaleMatcher::EN_QAAG_ENCODE &&
+        Utils::EncodeLocale(candidate->GetEncodedLanguage(), LocaleMatcher::NULL_SCRIPT, encodedRegion) ==
+        LocaleMatcher::EN_GB_ENCODE;
+    bool isDefaultRegion =
+        encodedRegion == FindDefaultRegionEncode(requestEncodedLanguage, request->GetEncodedScript());
+    // AlphabeticallyCompare, letters before digits before no region, each ascending
+    uint32_t regionOrder = (encodedRegion == LocaleMatcher::NULL_REGION) ? SUITABILITY_NULL_REGION_ORDER :
+        encodedRegion;
+    return ((len - pathPos) << SUITABILITY_PATH_POS_SHIFT) |
+        ((len * 2 - pathDistance) << SUITABILITY_PATH_DISTANCE_SHIFT) |
+        (static_cast<uint32_t>(isQaagGb) << SUITABILITY_QAAG_GB_SHIFT) |
+        (static_cast<uint32_t>(isDefaultLocale) << SUITABILITY_DEFAULT_LOCALE_SHIFT) |
+        (static_cast<uint32_t>(isDefaultRegion) << SUITABILITY_DEFAULT_REGION_SHIFT) |
+        ((SUITABILITY_NULL_REGION_ORDER - regionOrder) << SUITABILITY_REGION_ORDER_SHIFT) |
+        static_cast<uint32_t>(candidate->GetEncodedLanguage() == requestEncodedLanguage);
+}
+
 /**
  * @brief language tag is 2 or 3 letters
  *
@@ -712,13 +901,13 @@ int8_t LocaleMatcher::IsMoreSpecificThan(const ResLocale *current, const ResLoca
         return -1;
     }
     // here language is equal,compare region
-    if (current->GetRegion() == other->GetRegion()) {
+    if (current->GetEncodedRegion() == other->GetEncodedRegion()) {
         return 0;
     }
-    if (current->GetRegion() == nullptr) {
+    if (current->GetEncodedRegion() == LocaleMatcher::NULL_REGION) {
         return -1;
     }
-    if (other->GetRegion() == nullptr) {
+    if (other->GetEncodedRegion() == LocaleMatcher::NULL_REGION) {
         return 1;
     }
     return 0;
@@ -36,6 +36,11 @@ bool Lock::unlock()
     this->mtx_->unlock();
     return true;
 }
+
+bool Lock::try_lock()
+{
+    return this->mtx_->try_lock();
+}
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
\ No newline at end of file
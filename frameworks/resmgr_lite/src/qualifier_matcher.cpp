@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "qualifier_matcher.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include "locale_matcher.h"
+#include "res_locale.h"
+#include "utils/locale_data.h"
+#include "utils/utils.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+namespace {
+// fields of a qualifiers_ entry, direction and device type are truncated to one byte
+const uint32_t VALUE_MASK = 0xff;
+const uint32_t DIRECTION_MASK = VALUE_MASK;
+const uint32_t DEVICE_TYPE_SHIFT = 8;
+const uint32_t DEVICE_TYPE_MASK = VALUE_MASK << DEVICE_TYPE_SHIFT;
+// the candidate is en-Latn, which en-Qaag matches whatever the region
+const uint32_t EN_LATN_FLAG = 0x00010000;
+// a padding entry or a candidate without config
+const uint32_t NEVER_MATCH_FLAG = 0x00020000;
+// DIRECTION_NOT_SET and DEVICE_NOT_SET truncated to one byte
+const uint32_t NOT_SET_VALUE = VALUE_MASK;
+const uint32_t ALL_LANES = 0xffffffff;
+// arrays are padded to this, the widest lane count
+const size_t PADDING = 4;
+
+#if defined(__SSE2__)
+using Lanes = __m128i;
+const size_t LANE_COUNT = 4;
+
+inline Lanes Load(const uint32_t *values)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(values));
+}
+
+inline Lanes Splat(uint32_t value)
+{
+    return _mm_set1_epi32(static_cast<int>(value));
+}
+
+inline Lanes Equal(Lanes left, Lanes right)
+{
+    return _mm_cmpeq_epi32(left, right);
+}
+
+inline Lanes And(Lanes left, Lanes right)
+{
+    return _mm_and_si128(left, right);
+}
+
+inline Lanes Or(Lanes left, Lanes right)
+{
+    return _mm_or_si128(left, right);
+}
+
+// left & ~right
+inline Lanes AndNot(Lanes left, Lanes right)
+{
+    return _mm_andnot_si128(right, left);
+}
+
+inline uint32_t ToBits(Lanes lanes)
+{
+    return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(lanes)));
+}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+using Lanes = uint32x4_t;
+const size_t LANE_COUNT = 4;
+
+inline Lanes Load(const uint32_t *values)
+{
+    return vld1q_u32(values);
+}
+
+inline Lanes Splat(uint32_t value)
+{
+    return vdupq_n_u32(value);
+}
+
+inline Lanes Equal(Lanes left, Lanes right)
+{
+    return vceqq_u32(left, right);
+}
+
+inline Lanes And(Lanes left, Lanes right)
+{
+    return vandq_u32(left, right);
+}
+
+inline Lanes Or(Lanes left, Lanes right)
+{
+    return vorrq_u32(left, right);
+}
+
+// left & ~right
+inline Lanes AndNot(Lanes left, Lanes right)
+{
+    return vbicq_u32(left, right);
+}
+
+inline uint32_t ToBits(Lanes lanes)
+{
+    const uint32_t weights[LANE_COUNT] = { 1, 2, 4, 8 };
+    Lanes bits = vandq_u32(lanes, vld1q_u32(weights));
+    uint32x2_t half = vorr_u32(vget_low_u32(bits), vget_high_u32(bits));
+    return vget_lane_u32(half, 0) | vget_lane_u32(half, 1);
+}
+#else
+using Lanes = uint32_t;
+const size_t LANE_COUNT = 1;
+
+inline Lanes Load(const uint32_t *values)
+{
+    return *values;
+}
+
+inline Lanes Splat(uint32_t value)
+{
+    return value;
+}
+
+inline Lanes Equal(Lanes left, Lanes right)
+{
+    return (left == right) ? ALL_LANES : 0;
+}
+
+inline Lanes And(Lanes left, Lanes right)
+{
+    return left & right;
+}
+
+inline Lanes Or(Lanes left, Lanes right)
+{
+    return left | right;
+}
+
+// left & ~right
+inline Lanes AndNot(Lanes left, Lanes right)
+{
+    return left & ~right;
+}
+
+inline uint32_t ToBits(Lanes lanes)
+{
+    return lanes & 1;
+}
+#endif
+
+inline uint32_t ToLaneMask(bool value)
+{
+    return value ? ALL_LANES : 0;
+}
+
+uint16_t GetLanguageAlias(uint16_t language)
+{
+    const size_t len = sizeof(NEW_LANGUAGES_CODES) / sizeof(NEW_LANGUAGES_CODES[0]);
+    for (size_t i = 0; i < len; ++i) {
+        if (language == NEW_LANGUAGES_CODES[i]) {
+            return OLD_LANGUAGES_CODES[i];
+        }
+        if (language == OLD_LANGUAGES_CODES[i]) {
+            return NEW_LANGUAGES_CODES[i];
+        }
+    }
+    return language;
+}
+
+// the script CompareScript compares, the default one if the script is not set
+uint32_t GetMatchScript(const ResLocale &resLocale)
+{
+    ResLocale normalized = resLocale;
+    LocaleMatcher::Normalize(&normalized);
+    return normalized.GetEncodedScript();
+}
+} // namespace
+
+constexpr size_t QualifierMatcher::BLOCK_SIZE;
+
+void QualifierMatcher::MakeRequest(const ResConfigImpl *resConfig, Request &request)
+{
+    const ResLocale *resLocale = (resConfig == nullptr) ? nullptr : resConfig->GetResLocale();
+    request.hasLocale = resLocale != nullptr;
+    request.isEnQaag = false;
+    request.language = LocaleMatcher::NULL_LANGUAGE;
+    request.languageAlias = LocaleMatcher::NULL_LANGUAGE;
+    request.script = LocaleMatcher::NULL_SCRIPT;
+    request.region = LocaleMatcher::NULL_REGION;
+    if (resLocale != nullptr) {
+        request.isEnQaag = Utils::EncodeLocale(resLocale->GetEncodedLanguage(), resLocale->GetEncodedScript(),
+            LocaleMatcher::NULL_REGION) == LocaleMatcher::EN_QAAG_ENCODE;
+        request.language = resLocale->GetEncodedLanguage();
+        request.languageAlias = GetLanguageAlias(resLocale->GetEncodedLanguage());
+        request.script = GetMatchScript(*resLocale);
+        request.region = resLocale->GetEncodedRegion();
+    }
+    request.direction = (resConfig == nullptr) ? NOT_SET_VALUE :
+        (static_cast<uint32_t>(resConfig->GetDirection()) & VALUE_MASK);
+    request.deviceType = (resConfig == nullptr) ? NOT_SET_VALUE :
+        (static_cast<uint32_t>(resConfig->GetDeviceType()) & VALUE_MASK);
+}
+
+QualifierMatcher::QualifierMatcher() : count_(0)
+{
+}
+
+void QualifierMatcher::Add(const ResConfigImpl *resConfig)
+{
+    if (count_ == languages_.size()) {
+        languages_.resize(count_ + PADDING, LocaleMatcher::NULL_LANGUAGE);
+        scripts_.resize(count_ + PADDING, LocaleMatcher::NULL_SCRIPT);
+        regions_.resize(count_ + PADDING, LocaleMatcher::NULL_REGION);
+        qualifiers_.resize(count_ + PADDING, NEVER_MATCH_FLAG);
+    }
+    size_t i = count_++;
+    if (resConfig == nullptr) {
+        return;
+    }
+    const ResLocale *resLocale = resConfig->GetResLocale();
+    uint32_t flags = 0;
+    if (resLocale != nullptr) {
+        languages_[i] = resLocale->GetEncodedLanguage();
+        scripts_[i] = GetMatchScript(*resLocale);
+        regions_[i] = resLocale->GetEncodedRegion();
+        if (Utils::EncodeLocale(resLocale->GetEncodedLanguage(), resLocale->GetEncodedScript(),
+            LocaleMatcher::NULL_REGION) == LocaleMatcher::EN_LATN_ENCODE) {
+            flags |= EN_LATN_FLAG;
+        }
+    }
+    qualifiers_[i] = (static_cast<uint32_t>(resConfig->GetDirection()) & DIRECTION_MASK) |
+        ((static_cast<uint32_t>(resConfig->GetDeviceType()) << DEVICE_TYPE_SHIFT) & DEVICE_TYPE_MASK) | flags;
+}
+
+uint64_t QualifierMatcher::Match(const Request &request, size_t begin) const
+{
+    if (begin >= count_) {
+        return 0;
+    }
+    size_t end = (count_ - begin < BLOCK_SIZE) ? count_ : begin + BLOCK_SIZE;
+    // the request side of every condition of ResConfigImpl::Match, see LocaleMatcher::Match
+    const Lanes anyLocale = Splat(ToLaneMask(!request.hasLocale));
+    const Lanes isEnQaag = Splat(ToLaneMask(request.isEnQaag));
+    const Lanes language = Splat(request.language);
+    const Lanes languageAlias = Splat(request.languageAlias);
+    const Lanes script = Splat(request.script);
+    const Lanes hasNoScript = Splat(ToLaneMask(request.script == LocaleMatcher::NULL_SCRIPT));
+    const Lanes region = Splat(request.region);
+    const Lanes anyDirection = Splat(ToLaneMask(request.direction == NOT_SET_VALUE));
+    const Lanes direction = Splat(request.direction);
+    const Lanes anyDeviceType = Splat(ToLaneMask(request.deviceType == NOT_SET_VALUE));
+    const Lanes deviceType = Splat(request.deviceType << DEVICE_TYPE_SHIFT);
+    const Lanes zero = Splat(0);
+    const Lanes directionMask = Splat(DIRECTION_MASK);
+    const Lanes deviceTypeMask = Splat(DEVICE_TYPE_MASK);
+    const Lanes notSetDirection = Splat(NOT_SET_VALUE);
+    const Lanes notSetDeviceType = Splat(NOT_SET_VALUE << DEVICE_TYPE_SHIFT);
+    const Lanes enLatnFlag = Splat(EN_LATN_FLAG);
+    const Lanes neverMatchFlag = Splat(NEVER_MATCH_FLAG);
+    uint64_t result = 0;
+    for (size_t i = begin; i < end; i += LANE_COUNT) {
+        Lanes candidateLanguage = Load(&languages_[i]);
+        Lanes candidateScript = Load(&scripts_[i]);
+        Lanes candidateRegion = Load(&regions_[i]);
+        Lanes qualifiers = Load(&qualifiers_[i]);
+
+        Lanes languageMatch = Or(Equal(candidateLanguage, language), Equal(candidateLanguage, languageAlias));
+        // without script on either side the region must be the same or not set
+        Lanes regionMatch = Or(Equal(candidateRegion, zero), Equal(candidateRegion, region));
+        Lanes noScript = Or(hasNoScript, Equal(candidateScript, zero));
+        Lanes scriptMatch = Or(And(noScript, regionMatch), AndNot(Equal(candidateScript, script), noScript));
+        scriptMatch = Or(scriptMatch, And(isEnQaag, Equal(And(qualifiers, enLatnFlag), enLatnFlag)));
+        Lanes localeMatch = Or(Or(anyLocale, Equal(candidateLanguage, zero)), And(languageMatch, scriptMatch));
+
+        Lanes candidateDirection = And(qualifiers, directionMask);
+        Lanes directionMatch = Or(anyDirection,
+            Or(Equal(candidateDirection, direction), Equal(candidateDirection, notSetDirection)));
+        Lanes candidateDeviceType = And(qualifiers, deviceTypeMask);
+        Lanes deviceTypeMatch = Or(anyDeviceType,
+            Or(Equal(candidateDeviceType, deviceType), Equal(candidateDeviceType, notSetDeviceType)));
+
+        Lanes match = AndNot(And(localeMatch, And(directionMatch, deviceTypeMatch)),
+            Equal(And(qualifiers, neverMatchFlag), neverMatchFlag));
+        result |= static_cast<uint64_t>(ToBits(match)) << (i - begin);
+    }
+    // the last lanes may be past end when end is not the end of the arrays
+    if (end - begin < BLOCK_SIZE) {
+        result &= (static_cast<uint64_t>(1) << (end - begin)) - 1;
+    }
+    return result;
+}
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
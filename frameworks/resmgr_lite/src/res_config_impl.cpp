@@ -22,8 +22,132 @@
 namespace OHOS {
 namespace Global {
 namespace Resource {
+namespace {
+// fields of ResConfigKey::qualifiers_
+const uint32_t SCREEN_DENSITY_SHIFT = 0;
+const uint32_t SCREEN_DENSITY_MASK = 0xffff;
+const uint32_t DIRECTION_SHIFT = 16;
+const uint32_t DIRECTION_MASK = 0xff;
+const uint32_t DEVICE_TYPE_SHIFT = 24;
+const uint32_t DEVICE_TYPE_MASK = 0xff;
+const uint32_t NIGHT_MODE_SHIFT = 32;
+const uint32_t NIGHT_MODE_MASK = 0xff;
+const uint32_t MCC_SHIFT = 40;
+const uint32_t MCC_MASK = 0xfff;
+const uint32_t MNC_SHIFT = 52;
+const uint32_t MNC_MASK = 0xfff;
+} // namespace
+
+static_assert(sizeof(ResConfigKey) == 16, "ResConfigKey must stay packed in 16 bytes");
+
+const int32_t ResConfigKey::NOT_SET;
+
+ResConfigKey::ResConfigKey() : locale_(0), qualifiers_(0)
+{
+    this->SetDirection(DIRECTION_NOT_SET);
+    this->SetDeviceType(DEVICE_NOT_SET);
+    this->SetScreenDensity(SCREEN_DENSITY_NOT_SET);
+    this->SetNightMode(NOT_SET);
+    this->SetMcc(NOT_SET);
+    this->SetMnc(NOT_SET);
+}
+
+uint32_t ResConfigKey::GetField(uint32_t shift, uint32_t mask) const
+{
+    return static_cast<uint32_t>(qualifiers_ >> shift) & mask;
+}
+
+void ResConfigKey::SetField(uint32_t shift, uint32_t mask, uint32_t value)
+{
+    qualifiers_ = (qualifiers_ & ~(static_cast<uint64_t>(mask) << shift)) |
+        (static_cast<uint64_t>(value & mask) << shift);
+}
+
+int32_t ResConfigKey::GetOptionalField(uint32_t shift, uint32_t mask) const
+{
+    uint32_t value = this->GetField(shift, mask);
+    return (value == mask) ? NOT_SET : static_cast<int32_t>(value);
+}
+
+void ResConfigKey::SetOptionalField(uint32_t shift, uint32_t mask, int32_t value)
+{
+    // a value out of the field is not set
+    bool isSet = value >= 0 && static_cast<uint32_t>(value) < mask;
+    this->SetField(shift, mask, isSet ? static_cast<uint32_t>(value) : mask);
+}
+
+Direction ResConfigKey::GetDirection() const
+{
+    return static_cast<Direction>(this->GetOptionalField(DIRECTION_SHIFT, DIRECTION_MASK));
+}
+
+void ResConfigKey::SetDirection(Direction direction)
+{
+    this->SetOptionalField(DIRECTION_SHIFT, DIRECTION_MASK, direction);
+}
+
+DeviceType ResConfigKey::GetDeviceType() const
+{
+    return static_cast<DeviceType>(this->GetOptionalField(DEVICE_TYPE_SHIFT, DEVICE_TYPE_MASK));
+}
+
+void ResConfigKey::SetDeviceType(DeviceType deviceType)
+{
+    this->SetOptionalField(DEVICE_TYPE_SHIFT, DEVICE_TYPE_MASK, deviceType);
+}
+
+ScreenDensity ResConfigKey::GetScreenDensity() const
+{
+    return static_cast<ScreenDensity>(this->GetField(SCREEN_DENSITY_SHIFT, SCREEN_DENSITY_MASK));
+}
+
+void ResConfigKey::SetScreenDensity(ScreenDensity screenDensity)
+{
+    this->SetField(SCREEN_DENSITY_SHIFT, SCREEN_DENSITY_MASK, static_cast<uint32_t>(screenDensity));
+}
+
+int32_t ResConfigKey::GetNightMode() const
+{
+    return this->GetOptionalField(NIGHT_MODE_SHIFT, NIGHT_MODE_MASK);
+}
+
+void ResConfigKey::SetNightMode(int32_t nightMode)
+{
+    this->SetOptionalField(NIGHT_MODE_SHIFT, NIGHT_MODE_MASK, nightMode);
+}
+
+int32_t ResConfigKey::GetMcc() const
+{
+    return this->GetOptionalField(MCC_SHIFT, MCC_MASK);
+}
+
+void ResConfigKey::SetMcc(int32_t mcc)
+{
+    this->SetOptionalField(MCC_SHIFT, MCC_MASK, mcc);
+}
+
+int32_t ResConfigKey::GetMnc() const
+{
+    return this->GetOptionalField(MNC_SHIFT, MNC_MASK);
+}
+
+void ResConfigKey::SetMnc(int32_t mnc)
+{
+    this->SetOptionalField(MNC_SHIFT, MNC_MASK, mnc);
+}
+
+size_t ResConfigKey::Hash::operator()(const ResConfigKey &key) const
+{
+    // mix the two words so that configs differing in one qualifier spread over the buckets
+    uint64_t hash = key.locale_ ^ (key.qualifiers_ * 0x9e3779b97f4a7c15ULL);
+    hash ^= hash >> 32;
+    hash *= 0xd6e8feb86659fd93ULL;
+    hash ^= hash >> 32;
+    return static_cast<size_t>(hash);
+}
+
 ResConfigImpl::ResConfigImpl()
-    : resLocale_(nullptr),
+    : resLocale_(),
       direction_(DIRECTION_NOT_SET),
       screenDensity_(SCREEN_DENSITY_NOT_SET),
       deviceType_(DEVICE_NOT_SET),
@@ -41,40 +165,30 @@ RState ResConfigImpl::SetLocaleInfo(const char *language,
 {
     RState state = SUCCESS;
     if (Utils::IsStrEmpty(language)) {
-        delete this->resLocale_;
-        delete this->localeInfo_;
-        this->resLocale_ = nullptr;
-        this->localeInfo_ = nullptr;
+        this->ClearLocale();
         return state;
     }
-    ResLocale *resLocale =
-        ResLocale::BuildFromParts(language, script, region, state);
+    ResLocale resLocale;
+    state = ResLocale::BuildFromParts(language, script, region, resLocale);
     if (state == SUCCESS) {
         this->isCompletedScript_ = false;
         if (script == nullptr || script[0] == '\0') {
-            if (LocaleMatcher::Normalize(resLocale)) {
-                this->isCompletedScript_ = true;
-            } else {
-                delete resLocale;
-                return NOT_ENOUGH_MEM;
-            }
+            LocaleMatcher::Normalize(&resLocale);
+            this->isCompletedScript_ = true;
         }
-        LocaleInfo *tempLocale = new(std::nothrow) LocaleInfo(resLocale->GetLanguage(),
-            resLocale->GetScript(), resLocale->GetRegion());
-        if (tempLocale == nullptr) {
-            state = NOT_ENOUGH_MEM;
-            delete resLocale;
-            return state;
-        }
-        delete resLocale_;
-        delete localeInfo_;
-        resLocale_ = resLocale;
-        localeInfo_ = tempLocale;
+        this->ClearLocale();
+        this->resLocale_ = resLocale;
     }
 
     return state;
 }
 
+void ResConfigImpl::ClearLocale()
+{
+    this->resLocale_ = ResLocale();
+    delete this->localeInfo_.exchange(nullptr);
+}
+
 void ResConfigImpl::SetDeviceType(DeviceType deviceType)
 {
     this->deviceType_ = deviceType;
@@ -92,12 +206,26 @@ void ResConfigImpl::SetScreenDensity(ScreenDensity screenDensity)
 
 const LocaleInfo *ResConfigImpl::GetLocaleInfo() const
 {
-    return localeInfo_;
+    LocaleInfo *localeInfo = this->localeInfo_.load(std::memory_order_acquire);
+    if (localeInfo != nullptr || this->GetResLocale() == nullptr) {
+        return localeInfo;
+    }
+    LocaleInfo *temp = new(std::nothrow) LocaleInfo(this->resLocale_.GetLanguage(), this->resLocale_.GetScript(),
+        this->resLocale_.GetRegion());
+    if (temp == nullptr) {
+        return nullptr;
+    }
+    // a concurrent reader of a shared resConfig may have built it first, keep that one
+    if (!this->localeInfo_.compare_exchange_strong(localeInfo, temp, std::memory_order_acq_rel)) {
+        delete temp;
+        return localeInfo;
+    }
+    return temp;
 }
 
 const ResLocale *ResConfigImpl::GetResLocale() const
 {
-    return this->resLocale_;
+    return (this->resLocale_.GetEncodedLanguage() == 0) ? nullptr : &this->resLocale_;
 }
 
 Direction ResConfigImpl::GetDirection() const
@@ -116,51 +244,24 @@ DeviceType ResConfigImpl::GetDeviceType() const
 }
 bool ResConfigImpl::CopyLocale(ResConfig &other)
 {
-    bool needCopy = false;
-    if (this->GetLocaleInfo() == nullptr && other.GetLocaleInfo() != nullptr) {
-        needCopy = true;
-    }
-    if (this->GetLocaleInfo() != nullptr && other.GetLocaleInfo() == nullptr) {
-        delete this->resLocale_;
-        delete this->localeInfo_;
-        this->resLocale_ = nullptr;
-        this->localeInfo_ = nullptr;
+    const LocaleInfo *otherLocaleInfo = other.GetLocaleInfo();
+    if (otherLocaleInfo == nullptr) {
+        this->ClearLocale();
         return true;
     }
-    if (this->GetResLocale() != nullptr && other.GetLocaleInfo() != nullptr) {
-        uint64_t encodedLocale = Utils::EncodeLocale(
-            this->GetResLocale()->GetLanguage(),
-            this->GetResLocale()->GetScript(), this->GetResLocale()->GetRegion());
-        uint64_t otherEncodedLocale = Utils::EncodeLocale(
-            other.GetLocaleInfo()->GetLanguage(),
-            other.GetLocaleInfo()->GetScript(), other.GetLocaleInfo()->GetRegion());
-        if (encodedLocale != otherEncodedLocale) {
-            needCopy = true;
-        }
+    if (this->GetResLocale() != nullptr && this->GetResLocale()->GetEncodedLocale() == Utils::EncodeLocale(
+        otherLocaleInfo->GetLanguage(), otherLocaleInfo->GetScript(), otherLocaleInfo->GetRegion())) {
+        return true;
     }
-    if (needCopy) {
-        ResLocale *temp = new(std::nothrow) ResLocale;
-        if (temp == nullptr) {
-            return false;
-        }
-        RState rs = temp->CopyFromLocaleInfo(other.GetLocaleInfo());
-        if (rs != SUCCESS) {
-            delete temp;
-            return false;
-        }
-        LocaleInfo *tempLocale = new(std::nothrow) LocaleInfo(*other.GetLocaleInfo());
-        if (tempLocale == nullptr) {
-            delete tempLocale;
-            delete temp;
-            return false;
-        }
-        delete this->resLocale_;
-        delete this->localeInfo_;
-        this->resLocale_ = temp;
-        this->localeInfo_ = tempLocale;
+    ResLocale temp;
+    if (temp.CopyFromLocaleInfo(otherLocaleInfo) != SUCCESS) {
+        return false;
     }
+    this->ClearLocale();
+    this->resLocale_ = temp;
     return true;
 }
+
 bool ResConfigImpl::Copy(ResConfig &other)
 {
     bool isSuccess = this->CopyLocale(other);
@@ -184,7 +285,7 @@ bool ResConfigImpl::Match(const ResConfigImpl *other) const
     if (other == nullptr) {
         return false;
     }
-    if (!(LocaleMatcher::Match(this->resLocale_, other->GetResLocale()))) {
+    if (!(LocaleMatcher::Match(this->GetResLocale(), other->GetResLocale()))) {
         return false;
     }
     if (this->direction_ != DIRECTION_NOT_SET &&
@@ -256,8 +357,7 @@ bool ResConfigImpl::IsMoreSuitable(const ResConfigImpl *other,
 
 ResConfigImpl::~ResConfigImpl()
 {
-    delete resLocale_;
-    delete localeInfo_;
+    delete localeInfo_.load();
 }
 
 void ResConfigImpl::CompleteScript()
@@ -265,7 +365,7 @@ void ResConfigImpl::CompleteScript()
     if (isCompletedScript_) {
         return;
     }
-    if (LocaleMatcher::Normalize(this->resLocale_)) {
+    if (LocaleMatcher::Normalize(&this->resLocale_)) {
         isCompletedScript_ = true;
     }
 }
@@ -275,6 +375,44 @@ bool ResConfigImpl::IsCompletedScript() const
     return isCompletedScript_;
 }
 
+ResConfigKey ResConfigImpl::GetKey() const
+{
+    ResConfigKey key;
+    key.SetEncodedLocale((this->GetResLocale() == nullptr) ? 0 : this->resLocale_.GetEncodedLocale());
+    key.SetDirection(this->direction_);
+    key.SetDeviceType(this->deviceType_);
+    key.SetScreenDensity(this->screenDensity_);
+    return key;
+}
+
+RState ResConfigImpl::SetKey(const ResConfigKey &key)
+{
+    uint64_t encodedLocale = key.GetEncodedLocale();
+    if (encodedLocale == 0) {
+        this->ClearLocale();
+    } else if (this->GetResLocale() == nullptr || this->resLocale_.GetEncodedLocale() != encodedLocale) {
+        char language[LANGUAGE_ARRAY_LEN];
+        char script[SCRIPT_ARRAY_LEN] = { 0 };
+        char region[REGION_ARRAY_LEN];
+        Utils::DecodeLanguage(static_cast<uint16_t>(encodedLocale >> 48), language);
+        Utils::DecodeScript(static_cast<uint32_t>(encodedLocale >> 16), script);
+        Utils::DecodeRegion(static_cast<uint16_t>(encodedLocale), region);
+        // the script is kept as it is, so the locale is not normalized again
+        ResLocale resLocale;
+        RState state = ResLocale::BuildFromParts(language, script, region, resLocale);
+        if (state != SUCCESS) {
+            return state;
+        }
+        this->ClearLocale();
+        this->resLocale_ = resLocale;
+        this->isCompletedScript_ = false;
+    }
+    this->direction_ = key.GetDirection();
+    this->deviceType_ = key.GetDeviceType();
+    this->screenDensity_ = key.GetScreenDensity();
+    return SUCCESS;
+}
+
 bool ResConfigImpl::IsMoreSpecificThan(const ResConfigImpl *other) const
 {
     if (other == nullptr) {
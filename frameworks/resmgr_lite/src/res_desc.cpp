@@ -13,10 +13,14 @@
  * limitations under the License.
  */
 #include "res_desc.h"
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
 #include "hilog_wrapper.h"
 #include "securec.h"
 #include "utils/common.h"
 #include "utils/string_utils.h"
+#include "utils/utils.h"
 
 namespace OHOS {
 namespace Global {
@@ -152,9 +156,7 @@ bool IdItem::HaveParent() const
 
 bool IdItem::IsRef(const std::string &value, ResType &resType, int &id)
 {
-    const char *it = value.c_str();
-    const char *st = it;
-    if (*st != '$') {
+    if (value.empty() || value[0] != '$') {
         return false;
     }
     auto index = value.find(":");
@@ -162,22 +164,18 @@ bool IdItem::IsRef(const std::string &value, ResType &resType, int &id)
     if (index == std::string::npos || index < 2) {
         return false;
     }
-    std::string typeStr;
-    std::string idStr;
-    typeStr.assign(it + 1, index - 1);
-    idStr.assign(it + index + 1, value.size() - index);
 
-    int idd = atoi(idStr.c_str());
+    int idd = atoi(value.c_str() + index + 1);
     if (idd <= 0) {
         return false;
     }
 
+    // compare the type in place, no substring is built
+    size_t typeLen = index - 1;
     for (auto iit = resTypeStrList.begin(); iit != resTypeStrList.end(); ++iit) {
-        auto tValue = iit->second;
-        auto type = iit->first;
-        if (typeStr == tValue) {
+        if (iit->second.size() == typeLen && value.compare(1, typeLen, iit->second) == 0) {
             id = idd;
-            resType = type;
+            resType = iit->first;
             return true;
         }
     }
@@ -185,6 +183,122 @@ bool IdItem::IsRef(const std::string &value, ResType &resType, int &id)
     return false;
 }
 
+void IdItem::InitValueRefs()
+{
+    int id;
+    ResType resType;
+    if (IsRef(value_, resType, id)) {
+        valueRef_.resType_ = resType;
+        valueRef_.id_ = static_cast<uint32_t>(id);
+    }
+    for (size_t i = 0; i < values_.size(); ++i) {
+        if (!IsRef(values_[i], resType, id)) {
+            continue;
+        }
+        if (valueRefs_.empty()) {
+            ValueRef literal = { ResType::VALUES, 0 };
+            valueRefs_.assign(values_.size(), literal);
+        }
+        valueRefs_[i].resType_ = resType;
+        valueRefs_[i].id_ = static_cast<uint32_t>(id);
+    }
+}
+
+const IdItem::ValueRef &IdItem::GetValueRef(size_t index) const
+{
+    static const ValueRef literal = { ResType::VALUES, 0 };
+    if (index >= valueRefs_.size()) {
+        return literal;
+    }
+    return valueRefs_[index];
+}
+
+RState IdItem::DecodeValue(ResType type, const std::string &value, TypedValue &typedValue)
+{
+    switch (type) {
+        case ResType::INTEGER: {
+            char *end = nullptr;
+            errno = 0;
+            long result = strtol(value.c_str(), &end, 10); // 10 means decimal
+            // like stoi, trailing characters are ignored
+            if (end == value.c_str() || errno == ERANGE || result < INT_MIN || result > INT_MAX) {
+                return ERROR;
+            }
+            typedValue.intValue_ = static_cast<int>(result);
+            return SUCCESS;
+        }
+        case ResType::FLOAT:
+            typedValue.floatValue_ = strtof(value.c_str(), nullptr);
+            return SUCCESS;
+        case ResType::BOOLEAN:
+            if (value == "true") {
+                typedValue.boolValue_ = true;
+                return SUCCESS;
+            }
+            if (value == "false") {
+                typedValue.boolValue_ = false;
+                return SUCCESS;
+            }
+            return ERROR;
+        case ResType::COLOR:
+            return Utils::ConvertColorToUInt32(value.c_str(), typedValue.colorValue_);
+        default:
+            return ERROR;
+    }
+}
+
+void IdItem::DecodeValues()
+{
+    if (resType_ == ResType::INTARRAY) {
+        if (!valueRefs_.empty()) {
+            return;
+        }
+        intValues_.reserve(values_.size());
+        for (size_t i = 0; i < values_.size(); ++i) {
+            TypedValue typedValue;
+            if (DecodeValue(ResType::INTEGER, values_[i], typedValue) != SUCCESS) {
+                HILOG_ERROR("invalid value '%s' of intarray %u", values_[i].c_str(), id_);
+                intValues_.clear();
+                return;
+            }
+            intValues_.push_back(typedValue.intValue_);
+        }
+        return;
+    }
+    if (!(resType_ == ResType::INTEGER || resType_ == ResType::FLOAT || resType_ == ResType::BOOLEAN ||
+        resType_ == ResType::COLOR) || valueRef_.id_ != 0) {
+        return;
+    }
+    decodeState_ = DecodeValue(resType_, value_, typedValue_);
+    if (decodeState_ != SUCCESS) {
+        HILOG_ERROR("invalid value '%s' of %u, type %d", value_.c_str(), id_, resType_);
+    }
+}
+
+void IdItem::InitPluralForms()
+{
+    static const char *categories[PLURAL_CATEGORY_COUNT] = { "zero", "one", "two", "few", "many", "other" };
+    // 2 means key and value appear in pairs
+    for (size_t i = 0; i + 1 < values_.size(); i += 2) {
+        for (int category = 0; category < PLURAL_CATEGORY_COUNT; ++category) {
+            // the first one wins when a category appears twice
+            if (pluralForms_[category] < 0 && values_[i] == categories[category]) {
+                pluralForms_[category] = static_cast<int32_t>(i + 1);
+                break;
+            }
+        }
+    }
+}
+
+int32_t IdItem::GetPluralIndex(int category) const
+{
+    const int other = PLURAL_CATEGORY_COUNT - 1;
+    if (category < 0 || category >= PLURAL_CATEGORY_COUNT || pluralForms_[category] < 0) {
+        category = other;
+    }
+    return pluralForms_[category];
+}
+
 std::string IdItem::ToString() const
 {
     std::string ret = FormatString(
@@ -15,10 +15,12 @@
 
 #include "res_locale.h"
 
+#include <algorithm>
 #include <cctype>
 #include <cstdint>
 #include <cstring>
 #include <new>
+#include <type_traits>
 
 #include "auto_mutex.h"
 #include "hilog_wrapper.h"
@@ -31,80 +33,52 @@
 namespace OHOS {
 namespace Global {
 namespace Resource {
-LocaleInfo *ResLocale::defaultLocale_ = nullptr;
+std::atomic<const LocaleInfo *> ResLocale::defaultLocale_(nullptr);
+std::vector<LocaleInfo *> ResLocale::defaultLocales_;
 Lock ResLocale::lock_;
 
-ResLocale::ResLocale() : language_(nullptr), region_(nullptr), script_(nullptr)
+static_assert(std::is_trivially_copyable<ResLocale>::value, "ResLocale must stay trivially copyable");
+
+ResLocale::ResLocale() : language_(), region_(), script_(), encodedLanguage_(0), encodedScript_(0), encodedRegion_(0)
 {
 }
 
 RState ResLocale::SetLanguage(const char *language, size_t len)
 {
-    if (len == 0) {
-        delete this->language_;
-        this->language_ = nullptr;
-        return SUCCESS;
+    if (len > LANGUAGE_MAX_LEN) {
+        return INVALID_BCP47_LANGUAGE_SUBTAG;
     }
-    char *temp = new(std::nothrow) char[len + 1];
-    if (temp == nullptr) {
-        return NOT_ENOUGH_MEM;
+    for (size_t i = 0; i < len; ++i) {
+        this->language_[i] = tolower(language[i]);
     }
-    delete this->language_;
-    this->language_ = temp;
-    size_t i = 0;
-    while (i < len) {
-        *(temp + i) = tolower(*(language + i));
-        ++i;
-    }
-    *(temp + len) = '\0';
+    this->language_[len] = '\0';
+    this->encodedLanguage_ = (len == 0) ? 0 : Utils::EncodeLanguage(this->language_);
     return SUCCESS;
 }
 
 RState ResLocale::SetRegion(const char *region, size_t len)
 {
-    if (len == 0) {
-        delete this->region_;
-        this->region_ = nullptr;
-        return SUCCESS;
+    if (len > REGION_MAX_LEN) {
+        return INVALID_BCP47_REGION_SUBTAG;
     }
-    char *temp = new(std::nothrow) char[len + 1];
-    if (temp == nullptr) {
-        return NOT_ENOUGH_MEM;
-    }
-    delete this->region_;
-    this->region_ = temp;
-    size_t i = 0;
-    while (i < len) {
-        *(temp + i) = toupper(*(region + i));
-        ++i;
+    for (size_t i = 0; i < len; ++i) {
+        this->region_[i] = toupper(region[i]);
     }
-    *(temp + len) = '\0';
+    this->region_[len] = '\0';
+    this->encodedRegion_ = (len == 0) ? 0 : Utils::EncodeRegion(this->region_);
     return SUCCESS;
 }
 
 RState ResLocale::SetScript(const char *script, size_t len)
 {
-    if (len == 0) {
-        delete this->script_;
-        this->script_ = nullptr;
-        return SUCCESS;
+    if (len > SCRIPT_LEN) {
+        return INVALID_BCP47_SCRIPT_SUBTAG;
     }
-    char *temp = new(std::nothrow) char[len + 1];
-    if (temp == nullptr) {
-        return NOT_ENOUGH_MEM;
-    }
-    delete this->script_;
-    this->script_ = temp;
-    size_t i = 0;
-    while (i < len) {
-        if (i == 0) {
-            *(temp + i) = toupper(*(script + i));
-        } else {
-            *(temp + i) = tolower(*(script + i));
-        }
-        ++i;
+    for (size_t i = 0; i < len; ++i) {
+        this->script_[i] = (i == 0) ? toupper(script[i]) : tolower(script[i]);
     }
-    *(temp + len) = '\0';
+    this->script_[len] = '\0';
+    this->encodedScript_ = (len == 0) ? 0 : Utils::EncodeScript(this->script_);
     return SUCCESS;
 }
 
@@ -140,23 +114,28 @@ RState ResLocale::Copy(const ResLocale *other)
     if (other == nullptr) {
         return ERROR;
     }
-    return this->Init(other->GetLanguage(), Utils::StrLen(other->GetLanguage()), other->GetScript(),
-        Utils::StrLen(other->GetScript()), other->GetRegion(), Utils::StrLen(other->GetRegion()));
+    *this = *other;
+    return SUCCESS;
 }
 
 const char *ResLocale::GetLanguage() const
 {
-    return this->language_;
+    return (this->language_[0] == '\0') ? nullptr : this->language_;
 }
 
 const char *ResLocale::GetRegion() const
 {
-    return this->region_;
+    return (this->region_[0] == '\0') ? nullptr : this->region_;
 }
 
 const char *ResLocale::GetScript() const
 {
-    return this->script_;
+    return (this->script_[0] == '\0') ? nullptr : this->script_;
+}
+
+uint64_t ResLocale::GetEncodedLocale() const
+{
+    return Utils::EncodeLocale(this->encodedLanguage_, this->encodedScript_, this->encodedRegion_);
 }
 
 RState ProcessSubtag(const char *curPos, int32_t subTagLen, uint16_t &nextType, ParseResult &r)
@@ -190,24 +169,20 @@ void CheckArg(char sep, RState &rState)
     }
 }
 
-ResLocale *ResLocale::CreateResLocale(ParseResult &r, RState &rState)
+RState ResLocale::CreateResLocale(ParseResult &r, ResLocale &outValue)
 {
-    ResLocale *resLocale = new(std::nothrow) ResLocale;
-    if (resLocale == nullptr) {
-        rState = NOT_ENOUGH_MEM;
-        return nullptr;
-    }
-    rState = resLocale->Init(r.tempLanguage, r.languageTagLen, r.tempScript, r.scriptTagLen,
+    ResLocale temp;
+    RState rState = temp.Init(r.tempLanguage, r.languageTagLen, r.tempScript, r.scriptTagLen,
         r.tempRegion, r.regionTagLen);
     if (rState == SUCCESS) {
-        return resLocale;
+        outValue = temp;
     }
-    delete resLocale;
-    return nullptr;
+    return rState;
 }
 
-ResLocale *ResLocale::DoParse(const char *str, char sep, RState &rState)
+RState ResLocale::DoParse(const char *str, char sep, ResLocale &outValue)
 {
+    RState rState = SUCCESS;
     uint16_t nextType = LANG_TYPE;
     const char *nextPos = str;
     const char *curPos = nextPos;
@@ -231,40 +206,53 @@ ResLocale *ResLocale::DoParse(const char *str, char sep, RState &rState)
             if (rState == SUCCESS) {
                 continue;
             }
-            rState = INVALID_BCP47_LANGUAGE_SUBTAG;
-            return nullptr;
+            return INVALID_BCP47_LANGUAGE_SUBTAG;
         }
         if (nextType & SCRIPT_TYPE) {
             rState = ProcessSubtag(curPos, subTagLen, nextType, r);
             if (rState == SUCCESS) {
                 continue;
             }
-            rState = INVALID_BCP47_SCRIPT_SUBTAG;
-            return nullptr;
+            return INVALID_BCP47_SCRIPT_SUBTAG;
         }
         if (nextType & REGION_TYPE) {
             rState = ProcessSubtag(curPos, subTagLen, nextType, r);
             if (rState == SUCCESS) {
                 continue;
             }
-            rState = INVALID_BCP47_REGION_SUBTAG;
-            return nullptr;
+            return INVALID_BCP47_REGION_SUBTAG;
         }
     }
-    return CreateResLocale(r, rState);
+    return CreateResLocale(r, outValue);
 }
 
 ResLocale *ResLocale::BuildFromString(const char *str, char sep, RState &rState)
 {
+    ResLocale temp;
+    rState = BuildFromString(str, sep, temp);
+    if (rState != SUCCESS || temp.GetEncodedLanguage() == LocaleMatcher::NULL_LANGUAGE) {
+        return nullptr;
+    }
+    ResLocale *resLocale = new(std::nothrow) ResLocale(temp);
+    if (resLocale == nullptr) {
+        rState = NOT_ENOUGH_MEM;
+    }
+    return resLocale;
+}
+
+RState ResLocale::BuildFromString(const char *str, char sep, ResLocale &outValue)
+{
+    RState rState = SUCCESS;
     CheckArg(sep, rState);
     if (rState != SUCCESS) {
-        return nullptr;
+        return rState;
     }
     size_t strLen = Utils::StrLen(str);
     if (strLen == 0) {
-        return nullptr;
+        outValue = ResLocale();
+        return SUCCESS;
     }
-    return DoParse(str, sep, rState);
+    return DoParse(str, sep, outValue);
 } // end of ParseBCP47Tag
 
 ResLocale *ResLocale::BuildFromParts(const char *language,
@@ -272,110 +260,91 @@ ResLocale *ResLocale::BuildFromParts(const char *language,
     const char *region,
     RState &rState)
 {
-    size_t len = Utils::StrLen(language);
-    if (len == 0) {
-        rState = INVALID_BCP47_LANGUAGE_SUBTAG;
+    ResLocale temp;
+    rState = BuildFromParts(language, script, region, temp);
+    if (rState != SUCCESS) {
         return nullptr;
     }
-
-    const char *tempLanguage = nullptr;
-    const char *tempScript = nullptr;
-    const char *tempRegion = nullptr;
-    size_t languageTagLen = 0;
-    size_t scriptTagLen = 0;
-    size_t regionTagLen = 0;
-    if (LocaleMatcher::IsLanguageTag(language, len)) {
-        tempLanguage = language;
-        languageTagLen = len;
-    } else {
-        rState = INVALID_BCP47_LANGUAGE_SUBTAG;
-        return nullptr;
+    ResLocale *resLocale = new(std::nothrow) ResLocale(temp);
+    if (resLocale == nullptr) {
+        rState = NOT_ENOUGH_MEM;
     }
+    return resLocale;
+};
 
-    len = Utils::StrLen(script);
-    if (len > 0) {
-        if (LocaleMatcher::IsScriptTag(script, len)) {
-            tempScript = script;
-            scriptTagLen = len;
-        } else {
-            rState = INVALID_BCP47_SCRIPT_SUBTAG;
-            return nullptr;
-        }
+RState ResLocale::BuildFromParts(const char *language, const char *script, const char *region, ResLocale &outValue)
+{
+    size_t languageLen = Utils::StrLen(language);
+    if (languageLen == 0 || !LocaleMatcher::IsLanguageTag(language, languageLen)) {
+        return INVALID_BCP47_LANGUAGE_SUBTAG;
     }
-    len = Utils::StrLen(region);
-    if (len > 0) {
-        if (LocaleMatcher::IsRegionTag(region, len)) {
-            tempRegion = region;
-            regionTagLen = len;
-        } else {
-            rState = INVALID_BCP47_REGION_SUBTAG;
-            return nullptr;
-        }
+    size_t scriptLen = Utils::StrLen(script);
+    if (scriptLen > 0 && !LocaleMatcher::IsScriptTag(script, scriptLen)) {
+        return INVALID_BCP47_SCRIPT_SUBTAG;
     }
-    ResLocale *resLocale = new(std::nothrow) ResLocale;
-    if (resLocale == nullptr) {
-        rState = NOT_ENOUGH_MEM;
-        return nullptr;
+    size_t regionLen = Utils::StrLen(region);
+    if (regionLen > 0 && !LocaleMatcher::IsRegionTag(region, regionLen)) {
+        return INVALID_BCP47_REGION_SUBTAG;
     }
-    rState = resLocale->Init(tempLanguage, languageTagLen, tempScript, scriptTagLen, tempRegion, regionTagLen);
+    ResLocale temp;
+    RState rState = temp.Init(language, languageLen, script, scriptLen, region, regionLen);
     if (rState == SUCCESS) {
-        return resLocale;
+        outValue = temp;
     }
-    delete resLocale;
-    return nullptr;
-};
+    return rState;
+}
 
 const LocaleInfo *ResLocale::GetDefault()
 {
-    AutoMutex mutex(ResLocale::lock_);
-    return ResLocale::defaultLocale_;
+    return ResLocale::defaultLocale_.load(std::memory_order_acquire);
+}
+
+// a null tag and an empty one are the same
+bool IsSameTag(const char *left, const char *right)
+{
+    if (Utils::IsStrEmpty(left) || Utils::IsStrEmpty(right)) {
+        return Utils::IsStrEmpty(left) && Utils::IsStrEmpty(right);
+    }
+    return std::strcmp(left, right) == 0;
 }
 
 bool ResLocale::UpdateDefault(const LocaleInfo &localeInfo, bool needNotify)
 {
     AutoMutex mutex(ResLocale::lock_);
+    // a reader may still use any locale returned by GetDefault, so none is deleted, and the locales met before
+    // are reused so that switching between a few locales does not grow the list
+    for (size_t i = 0; i < ResLocale::defaultLocales_.size(); ++i) {
+        LocaleInfo *known = ResLocale::defaultLocales_[i];
+        if (IsSameTag(known->GetLanguage(), localeInfo.GetLanguage()) &&
+            IsSameTag(known->GetScript(), localeInfo.GetScript()) &&
+            IsSameTag(known->GetRegion(), localeInfo.GetRegion())) {
+            ResLocale::defaultLocale_.store(known, std::memory_order_release);
+            return true;
+        }
+    }
     LocaleInfo *temp = new(std::nothrow) LocaleInfo(localeInfo.GetLanguage(),
         localeInfo.GetScript(), localeInfo.GetRegion());
     if (temp == nullptr) {
         return false;
     }
-    delete ResLocale::defaultLocale_;
-    ResLocale::defaultLocale_ = temp;
+    ResLocale::defaultLocales_.push_back(temp);
+    ResLocale::defaultLocale_.store(temp, std::memory_order_release);
     return true;
 };
 
-ResLocale::~ResLocale()
-{
-    if (this->language_ != nullptr) {
-        delete[] this->language_;
-        this->language_ = nullptr;
-    }
-
-    if (this->script_ != nullptr) {
-        delete[] this->script_;
-        this->script_ = nullptr;
-    }
-
-    if (this->region_ != nullptr) {
-        delete[] this->region_;
-        this->region_ = nullptr;
-    }
-}
-
 LocaleInfo *BuildFromString(const char *str, char sep, RState &rState)
 {
-    ResLocale *resLocale = ResLocale::BuildFromString(str, sep, rState);
-    if (rState == SUCCESS) {
-        LocaleInfo *localeInfo = new(std::nothrow) LocaleInfo(resLocale->GetLanguage(),
-            resLocale->GetScript(), resLocale->GetRegion());
-        if (localeInfo == nullptr) {
-            delete resLocale;
-            rState = ERROR;
-            return nullptr;
-        }
-        return localeInfo;
+    ResLocale resLocale;
+    rState = ResLocale::BuildFromString(str, sep, resLocale);
+    if (rState != SUCCESS || resLocale.GetLanguage() == nullptr) {
+        return nullptr;
     }
-    return nullptr;
+    LocaleInfo *localeInfo = new(std::nothrow) LocaleInfo(resLocale.GetLanguage(), resLocale.GetScript(),
+        resLocale.GetRegion());
+    if (localeInfo == nullptr) {
+        rState = ERROR;
+    }
+    return localeInfo;
 };
 
 LocaleInfo *BuildFromParts(const char *language, const char *script, const char *region, RState &rState)
@@ -422,55 +391,108 @@ void UpdateSysDefault(const LocaleInfo &localeInfo, bool needNotify)
     ResLocale::UpdateDefault(localeInfo, needNotify);
 }
 
+struct LocaleCandidate {
+    ResLocale locale;
+    size_t index;
+    uint32_t suitability;
+};
+
+/**
+ * @brief sort the candidates matching the request by suitability and append their indexes to outValue.
+ * A candidate without language is ordered against the others with IsMoreSuitable, it is placed before the first
+ * candidate not more suitable than it, the others are ranked by LocaleMatcher::ComputeSuitability.
+ *
+ * @param request the normalized request, nullptr if there is none
+ * @param candidates the normalized candidates, in the input order
+ * @param outValue the indexes of the matching candidates, the most suitable first
+ */
+void SortLocaleCandidates(const ResLocale *request, std::vector<LocaleCandidate> &candidates,
+    std::vector<size_t> &outValue)
+{
+    std::vector<LocaleCandidate> matched;
+    std::vector<size_t> noLocaleIndexes;
+    matched.reserve(candidates.size());
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        LocaleCandidate &candidate = candidates[i];
+        if (candidate.locale.GetEncodedLanguage() == LocaleMatcher::NULL_LANGUAGE) {
+            noLocaleIndexes.push_back(candidate.index);
+            continue;
+        }
+        if (LocaleMatcher::Match(request, &candidate.locale)) {
+            candidate.suitability = LocaleMatcher::ComputeSuitability(&candidate.locale, request);
+            matched.push_back(candidate);
+        }
+    }
+    std::stable_sort(matched.begin(), matched.end(), [](const LocaleCandidate &left, const LocaleCandidate &right) {
+        return left.suitability > right.suitability;
+    });
+    size_t noLocalePos = 0;
+    if (!noLocaleIndexes.empty()) {
+        while (noLocalePos < matched.size() &&
+            LocaleMatcher::IsMoreSuitable(&matched[noLocalePos].locale, nullptr, request) > 0) {
+            ++noLocalePos;
+        }
+    }
+    outValue.reserve(outValue.size() + matched.size() + noLocaleIndexes.size());
+    for (size_t i = 0; i < matched.size(); ++i) {
+        if (i == noLocalePos) {
+            outValue.insert(outValue.end(), noLocaleIndexes.begin(), noLocaleIndexes.end());
+        }
+        outValue.push_back(matched[i].index);
+    }
+    if (noLocalePos == matched.size()) {
+        outValue.insert(outValue.end(), noLocaleIndexes.begin(), noLocaleIndexes.end());
+    }
+}
+
 void FindAndSort(const std::string localeStr, std::vector<std::string> &candidateLocale,
     std::vector<std::string> &outValue)
 {
     if (candidateLocale.size() == 0) {
         return;
     }
-    std::vector<ResLocale *> tempCandidate;
-    RState state = SUCCESS;
-    ResLocale *currentLocale = ResLocale::BuildFromString(localeStr.c_str(), DASH_SEP, state);
-    LocaleMatcher::Normalize(currentLocale);
-    std::vector<std::string>::const_iterator iter;
-    for (iter = candidateLocale.cbegin(); iter != candidateLocale.cend(); ++iter) {
-        ResLocale *resLocale = ResLocale::BuildFromString(iter->c_str(), DASH_SEP, state);
-        if (state == SUCCESS) {
-            LocaleMatcher::Normalize(resLocale);
-            bool isMatch = LocaleMatcher::Match(currentLocale, resLocale);
-            if (isMatch) {
-                tempCandidate.push_back(resLocale);
-                outValue.push_back(*iter);
-            } else {
-                delete resLocale;
-            }
-        } else {
-            delete resLocale;
+    ResLocale request;
+    RState state = ResLocale::BuildFromString(localeStr.c_str(), DASH_SEP, request);
+    LocaleMatcher::Normalize(&request);
+    std::vector<LocaleCandidate> candidates;
+    candidates.reserve(candidateLocale.size());
+    for (size_t i = 0; i < candidateLocale.size(); ++i) {
+        LocaleCandidate candidate = { ResLocale(), i, 0 };
+        if (ResLocale::BuildFromString(candidateLocale[i].c_str(), DASH_SEP, candidate.locale) == SUCCESS) {
+            LocaleMatcher::Normalize(&candidate.locale);
+            candidates.push_back(candidate);
         }
     }
-    // sort
-    std::size_t len = tempCandidate.size();
-    if (len == 0) {
-        delete currentLocale;
-        return;
-    }
-    for (std::size_t i = 0; i < len - 1; i++) {
-        for (std::size_t j = 0; j < len - 1 - i; j++) {
-            if (LocaleMatcher::IsMoreSuitable(tempCandidate.at(j), tempCandidate.at(j + 1), currentLocale) <= 0) {
-                ResLocale *temp = tempCandidate.at(j + 1);
-                tempCandidate.at(j + 1) = tempCandidate.at(j);
-                tempCandidate.at(j) = temp;
-                std::string tempStr = outValue.at(j + 1);
-                outValue.at(j + 1) = outValue.at(j);
-                outValue.at(j) = tempStr;
-            }
-        }
+    std::vector<size_t> indexes;
+    SortLocaleCandidates((state == SUCCESS && request.GetLanguage() != nullptr) ? &request : nullptr, candidates,
+        indexes);
+    outValue.reserve(outValue.size() + indexes.size());
+    for (size_t i = 0; i < indexes.size(); ++i) {
+        outValue.push_back(candidateLocale[indexes[i]]);
     }
+}
 
-    for (auto iter = tempCandidate.cbegin(); iter != tempCandidate.cend(); iter++) {
-        delete *iter;
+void FindAndSort(const LocaleInfo &localeInfo, const std::vector<LocaleInfo> &candidateLocale,
+    std::vector<size_t> &outValue)
+{
+    ResLocale request;
+    RState state = ResLocale::BuildFromParts(localeInfo.GetLanguage(), localeInfo.GetScript(),
+        localeInfo.GetRegion(), request);
+    LocaleMatcher::Normalize(&request);
+    std::vector<LocaleCandidate> candidates;
+    candidates.reserve(candidateLocale.size());
+    for (size_t i = 0; i < candidateLocale.size(); ++i) {
+        const LocaleInfo &other = candidateLocale[i];
+        LocaleCandidate candidate = { ResLocale(), i, 0 };
+        if (other.GetLanguage() == nullptr) {
+            candidates.push_back(candidate);
+        } else if (ResLocale::BuildFromParts(other.GetLanguage(), other.GetScript(), other.GetRegion(),
+            candidate.locale) == SUCCESS) {
+            LocaleMatcher::Normalize(&candidate.locale);
+            candidates.push_back(candidate);
+        }
     }
-    delete currentLocale;
+    SortLocaleCandidates((state == SUCCESS) ? &request : nullptr, candidates, outValue);
 }
 } // namespace Resource
 } // namespace Global
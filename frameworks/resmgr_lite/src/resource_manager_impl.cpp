@@ -70,245 +70,486 @@ bool ResourceManagerImpl::Init()
 
 RState ResourceManagerImpl::GetStringById(uint32_t id, std::string &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceById(id);
-    return GetString(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    return GetString(snapshot.Get(), idItem, outValue);
 }
 
 RState ResourceManagerImpl::GetStringByName(const char *name, std::string &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceByName(name, ResType::STRING);
-    return GetString(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::STRING);
+    return GetString(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetStringByName(const ResName &name, std::string &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name);
+    return GetString(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetStringViewById(uint32_t id, const std::string *&outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    return GetStringValue(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetStringViewByName(const char *name, const std::string *&outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::STRING);
+    return GetStringValue(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetStringViewByName(const ResName &name, const std::string *&outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name);
+    return GetStringValue(snapshot.Get(), idItem, outValue);
 }
 
 RState ResourceManagerImpl::GetStringFormatById(std::string &outValue, uint32_t id, ...)
 {
-    const IdItem *idItem = hapManager_->FindResourceById(id);
-    std::string temp;
-    RState rState = GetString(idItem, temp);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    const std::string *value = nullptr;
+    RState rState = GetStringValue(snapshot.Get(), idItem, value);
     if (rState != SUCCESS) {
         return rState;
     }
     va_list args;
     va_start(args, id);
-    outValue = FormatString(temp.c_str(), args);
+    rState = FormatValue(snapshot.Get(), value, outValue, args);
     va_end(args);
-    return SUCCESS;
+    return rState;
 }
 
 RState ResourceManagerImpl::GetStringFormatByName(std::string &outValue, const char *name, ...)
 {
-    const IdItem *idItem = hapManager_->FindResourceByName(name, ResType::STRING);
-    std::string temp;
-    RState rState = GetString(idItem, temp);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::STRING);
+    const std::string *value = nullptr;
+    RState rState = GetStringValue(snapshot.Get(), idItem, value);
     if (rState != SUCCESS) {
         return rState;
     }
     va_list args;
     va_start(args, name);
-    outValue = FormatString(temp.c_str(), args);
+    rState = FormatValue(snapshot.Get(), value, outValue, args);
     va_end(args);
+    return rState;
+}
+
+RState ResourceManagerImpl::GetStringFormatById(std::string &outValue, uint32_t id,
+    const std::vector<FormatArg> &args)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    const std::string *value = nullptr;
+    RState rState = GetStringValue(snapshot.Get(), idItem, value);
+    if (rState != SUCCESS) {
+        return rState;
+    }
+    return FormatValue(snapshot.Get(), value, outValue, args);
+}
+
+RState ResourceManagerImpl::GetStringFormatByName(std::string &outValue, const char *name,
+    const std::vector<FormatArg> &args)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::STRING);
+    const std::string *value = nullptr;
+    RState rState = GetStringValue(snapshot.Get(), idItem, value);
+    if (rState != SUCCESS) {
+        return rState;
+    }
+    return FormatValue(snapshot.Get(), value, outValue, args);
+}
+
+RState ResourceManagerImpl::FormatValue(const HapManager::Snapshot *snapshot, const std::string *value,
+    std::string &outValue, va_list args)
+{
+    std::shared_ptr<const FormatTemplate> formatTemplate = snapshot->GetFormatTemplate(value);
+    if (formatTemplate == nullptr) {
+        outValue = FormatString(value->c_str(), args);
+        return SUCCESS;
+    }
+    formatTemplate->Format(outValue, args);
     return SUCCESS;
 }
 
-RState ResourceManagerImpl::GetString(const IdItem *idItem, std::string &outValue)
+RState ResourceManagerImpl::FormatValue(const HapManager::Snapshot *snapshot, const std::string *value,
+    std::string &outValue, const std::vector<FormatArg> &args)
 {
-    // not found or type invalid
-    if (idItem == nullptr || idItem->resType_ != ResType::STRING) {
-        return NOT_FOUND;
+    std::shared_ptr<const FormatTemplate> formatTemplate = snapshot->GetFormatTemplate(value);
+    if (formatTemplate == nullptr) {
+        return NOT_ENOUGH_MEM;
     }
-    RState ret = ResolveReference(idItem->value_, outValue);
+    if (!formatTemplate->Format(outValue, args)) {
+        HILOG_ERROR("args do not match the format '%s'", value->c_str());
+        return ERROR;
+    }
+    return SUCCESS;
+}
+
+RState ResourceManagerImpl::GetString(const HapManager::Snapshot *snapshot, const IdItem *idItem, std::string &outValue)
+{
+    const std::string *value = nullptr;
+    RState ret = GetStringValue(snapshot, idItem, value);
     if (ret != SUCCESS) {
         return ret;
     }
+    outValue = *value;
     return SUCCESS;
 }
 
+RState ResourceManagerImpl::GetStringValue(const HapManager::Snapshot *snapshot, const IdItem *idItem,
+    const std::string *&outValue)
+{
+    // not found or type invalid
+    if (idItem == nullptr) {
+        return snapshot->GetMissState();
+    }
+    if (idItem->resType_ != ResType::STRING) {
+        return NOT_FOUND;
+    }
+    return ResolveValue(snapshot, idItem->value_, idItem->valueRef_, outValue);
+}
+
 RState ResourceManagerImpl::GetStringArrayById(uint32_t id, std::vector<std::string> &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceById(id);
-    return GetStringArray(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    return GetStringArray(snapshot.Get(), idItem, outValue);
 }
 
 RState ResourceManagerImpl::GetStringArrayByName(const char *name, std::vector<std::string> &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceByName(name, ResType::STRINGARRAY);
-    return GetStringArray(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::STRINGARRAY);
+    return GetStringArray(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetStringArrayByName(const ResName &name, std::vector<std::string> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name);
+    return GetStringArray(snapshot.Get(), idItem, outValue);
 }
 
-RState ResourceManagerImpl::GetStringArray(const IdItem *idItem, std::vector<std::string> &outValue)
+RState ResourceManagerImpl::GetStringArrayViewById(uint32_t id, std::vector<const std::string *> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    return GetStringArrayValue(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetStringArrayViewByName(const char *name, std::vector<const std::string *> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::STRINGARRAY);
+    return GetStringArrayValue(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetStringArray(const HapManager::Snapshot *snapshot,
+    const IdItem *idItem, std::vector<std::string> &outValue)
 {
     // not found or type invalid
-    if (idItem == nullptr || idItem->resType_ != ResType::STRINGARRAY) {
+    if (idItem == nullptr) {
+        return snapshot->GetMissState();
+    }
+    if (idItem->resType_ != ResType::STRINGARRAY) {
         return NOT_FOUND;
     }
-    outValue.clear();
+    // assign in place, so the strings of a reused vector keep their capacity
+    outValue.resize(idItem->values_.size());
+    for (size_t i = 0; i < idItem->values_.size(); ++i) {
+        const std::string *resolvedValue = nullptr;
+        RState rrRet = ResolveValue(snapshot, idItem->values_[i], idItem->GetValueRef(i), resolvedValue);
+        if (rrRet != SUCCESS) {
+            HILOG_ERROR("ResolveReference failed, value:%s", idItem->values_[i].c_str());
+            outValue.clear();
+            return ERROR;
+        }
+        outValue[i] = *resolvedValue;
+    }
+    return SUCCESS;
+}
 
+RState ResourceManagerImpl::GetStringArrayValue(const HapManager::Snapshot *snapshot,
+    const IdItem *idItem, std::vector<const std::string *> &outValue)
+{
+    // not found or type invalid
+    if (idItem == nullptr) {
+        return snapshot->GetMissState();
+    }
+    if (idItem->resType_ != ResType::STRINGARRAY) {
+        return NOT_FOUND;
+    }
+    outValue.resize(idItem->values_.size());
     for (size_t i = 0; i < idItem->values_.size(); ++i) {
-        std::string resolvedValue;
-        RState rrRet = ResolveReference(idItem->values_[i], resolvedValue);
+        RState rrRet = ResolveValue(snapshot, idItem->values_[i], idItem->GetValueRef(i), outValue[i]);
         if (rrRet != SUCCESS) {
             HILOG_ERROR("ResolveReference failed, value:%s", idItem->values_[i].c_str());
+            outValue.clear();
             return ERROR;
         }
-        outValue.push_back(resolvedValue);
     }
     return SUCCESS;
 }
 
 RState ResourceManagerImpl::GetPatternById(uint32_t id, std::map<std::string, std::string> &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceById(id);
-    return GetPattern(idItem, outValue);
+    std::shared_ptr<const std::map<std::string, std::string>> flattened;
+    RState state = GetPatternById(id, flattened);
+    if (state == SUCCESS) {
+        outValue = *flattened;
+    }
+    return state;
 }
 
 RState ResourceManagerImpl::GetPatternByName(const char *name, std::map<std::string, std::string> &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceByName(name, ResType::PATTERN);
-    return GetPattern(idItem, outValue);
+    std::shared_ptr<const std::map<std::string, std::string>> flattened;
+    RState state = GetPatternByName(name, flattened);
+    if (state == SUCCESS) {
+        outValue = *flattened;
+    }
+    return state;
+}
+
+RState ResourceManagerImpl::GetPatternById(uint32_t id,
+    std::shared_ptr<const std::map<std::string, std::string>> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    return GetPattern(snapshot.Get(), idItem, outValue);
 }
 
-RState ResourceManagerImpl::GetPattern(const IdItem *idItem, std::map<std::string, std::string> &outValue)
+RState ResourceManagerImpl::GetPatternByName(const char *name,
+    std::shared_ptr<const std::map<std::string, std::string>> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::PATTERN);
+    return GetPattern(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetPatternByName(const ResName &name,
+    std::shared_ptr<const std::map<std::string, std::string>> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name);
+    return GetPattern(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetPattern(const HapManager::Snapshot *snapshot,
+    const IdItem *idItem, std::shared_ptr<const std::map<std::string, std::string>> &outValue)
 {
     // not found or type invalid
-    if (idItem == nullptr || idItem->resType_ != ResType::PATTERN) {
+    if (idItem == nullptr) {
+        return snapshot->GetMissState();
+    }
+    if (idItem->resType_ != ResType::PATTERN) {
         return NOT_FOUND;
     }
-    return ResolveParentReference(idItem, outValue);
+    return GetFlattenedMap(snapshot, idItem, outValue);
 }
 
 RState ResourceManagerImpl::GetPluralStringById(uint32_t id, int quantity, std::string &outValue)
 {
-    const HapResource::ValueUnderQualifierDir *vuqd = hapManager_->FindQualifierValueById(id);
-    return GetPluralString(vuqd, quantity, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = snapshot->FindQualifierValueById(id);
+    return GetPluralString(snapshot.Get(), vuqd, quantity, outValue);
 }
 
 RState ResourceManagerImpl::GetPluralStringByName(const char *name, int quantity, std::string &outValue)
 {
+    HapManager::SnapshotGuard snapshot(hapManager_);
     const HapResource::ValueUnderQualifierDir *vuqd =
-        hapManager_->FindQualifierValueByName(name, ResType::PLURALS);
-    return GetPluralString(vuqd, quantity, outValue);
+        snapshot->FindQualifierValueByName(name, ResType::PLURALS);
+    return GetPluralString(snapshot.Get(), vuqd, quantity, outValue);
+}
+
+RState ResourceManagerImpl::GetPluralStringByName(const ResName &name, int quantity, std::string &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = snapshot->FindQualifierValueByName(name);
+    return GetPluralString(snapshot.Get(), vuqd, quantity, outValue);
 }
 
 RState ResourceManagerImpl::GetPluralStringByIdFormat(std::string &outValue, uint32_t id, int quantity, ...)
 {
-    const HapResource::ValueUnderQualifierDir *vuqd = hapManager_->FindQualifierValueById(id);
-    std::string temp;
-    RState rState = GetPluralString(vuqd, quantity, temp);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = snapshot->FindQualifierValueById(id);
+    const std::string *value = nullptr;
+    RState rState = GetPluralValue(snapshot.Get(), vuqd, quantity, value);
     if (rState != SUCCESS) {
         return rState;
     }
 
     va_list args;
     va_start(args, quantity);
-    outValue = FormatString(temp.c_str(), args);
+    rState = FormatValue(snapshot.Get(), value, outValue, args);
     va_end(args);
 
-    return SUCCESS;
+    return rState;
 }
 
 RState ResourceManagerImpl::GetPluralStringByNameFormat(std::string &outValue, const char *name, int quantity, ...)
 {
+    HapManager::SnapshotGuard snapshot(hapManager_);
     const HapResource::ValueUnderQualifierDir *vuqd =
-        hapManager_->FindQualifierValueByName(name, ResType::PLURALS);
-    std::string temp;
-    RState rState = GetPluralString(vuqd, quantity, temp);
+        snapshot->FindQualifierValueByName(name, ResType::PLURALS);
+    const std::string *value = nullptr;
+    RState rState = GetPluralValue(snapshot.Get(), vuqd, quantity, value);
     if (rState != SUCCESS) {
         return rState;
     }
 
     va_list args;
     va_start(args, quantity);
-    outValue = FormatString(temp.c_str(), args);
+    rState = FormatValue(snapshot.Get(), value, outValue, args);
     va_end(args);
 
+    return rState;
+}
+
+RState ResourceManagerImpl::GetPluralStringByIdFormat(std::string &outValue, uint32_t id, int quantity,
+    const std::vector<FormatArg> &args)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = snapshot->FindQualifierValueById(id);
+    const std::string *value = nullptr;
+    RState rState = GetPluralValue(snapshot.Get(), vuqd, quantity, value);
+    if (rState != SUCCESS) {
+        return rState;
+    }
+    return FormatValue(snapshot.Get(), value, outValue, args);
+}
+
+RState ResourceManagerImpl::GetPluralStringByNameFormat(std::string &outValue, const char *name, int quantity,
+    const std::vector<FormatArg> &args)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd =
+        snapshot->FindQualifierValueByName(name, ResType::PLURALS);
+    const std::string *value = nullptr;
+    RState rState = GetPluralValue(snapshot.Get(), vuqd, quantity, value);
+    if (rState != SUCCESS) {
+        return rState;
+    }
+    return FormatValue(snapshot.Get(), value, outValue, args);
+}
+
+RState ResourceManagerImpl::GetPluralString(const HapManager::Snapshot *snapshot,
+    const HapResource::ValueUnderQualifierDir *vuqd, int quantity, std::string &outValue)
+{
+    const std::string *value = nullptr;
+    RState rState = GetPluralValue(snapshot, vuqd, quantity, value);
+    if (rState != SUCCESS) {
+        return rState;
+    }
+    outValue = *value;
     return SUCCESS;
 }
 
-RState ResourceManagerImpl::GetPluralString(const HapResource::ValueUnderQualifierDir *vuqd,
-    int quantity, std::string &outValue)
+RState ResourceManagerImpl::GetPluralValue(const HapManager::Snapshot *snapshot,
+    const HapResource::ValueUnderQualifierDir *vuqd, int quantity, const std::string *&outValue)
 {
     // not found or type invalid
     if (vuqd == nullptr) {
-        return NOT_FOUND;
+        return snapshot->GetMissState();
     }
     auto idItem = vuqd->GetIdItem();
-    if (idItem == nullptr || idItem->resType_ != ResType::PLURALS) {
+    if (idItem == nullptr) {
+        return snapshot->GetMissState();
+    }
+    if (idItem->resType_ != ResType::PLURALS) {
         return NOT_FOUND;
     }
-    std::map<std::string, std::string> map;
-
-    size_t startIdx = 0;
-    size_t loop = idItem->values_.size() / 2;
-    for (size_t i = 0; i < loop; ++i) {
-        // 2 means key and value appear in pairs
-        std::string key(idItem->values_[startIdx + i * 2]);
-        std::string value(idItem->values_[startIdx + i * 2 + 1]);
-        auto iter = map.find(key);
-        if (iter == map.end()) {
-            std::string resolvedValue;
-            RState rrRet = ResolveReference(value, resolvedValue);
-            if (rrRet != SUCCESS) {
-                HILOG_ERROR("ResolveReference failed, value:%s", value.c_str());
-                return ERROR;
-            }
-            map[key] = resolvedValue;
-        }
+    int32_t index = idItem->GetPluralIndex(hapManager_->GetPluralRule(snapshot, quantity));
+    if (index < 0) {
+        return NOT_FOUND;
     }
-
-    std::string converted = hapManager_->GetPluralRulesAndSelect(quantity);
-    auto mapIter = map.find(converted);
-    if (mapIter == map.end()) {
-        mapIter = map.find("other");
-        if (mapIter == map.end()) {
-            return NOT_FOUND;
-        }
+    RState rrRet = ResolveValue(snapshot, idItem->values_[index], idItem->GetValueRef(index), outValue);
+    if (rrRet != SUCCESS) {
+        HILOG_ERROR("ResolveReference failed, value:%s", idItem->values_[index].c_str());
+        return ERROR;
     }
-    outValue = mapIter->second;
-
     return SUCCESS;
 }
 
-RState ResourceManagerImpl::ResolveReference(const std::string value, std::string &outValue)
+RState ResourceManagerImpl::ResolveReference(const std::string &value, std::string &outValue)
 {
-    int id;
-    ResType resType;
-    bool isRef = true;
-    int count = 0;
-    std::string refStr(value);
-    while (isRef) {
-        isRef = IdItem::IsRef(refStr, resType, id);
-        if (!isRef) {
-            outValue = refStr;
-            return SUCCESS;
-        }
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    return ResolveReference(snapshot.Get(), value, outValue);
+}
 
-        if (IdItem::IsArrayOfType(resType)) {
-            // can't be array
-            HILOG_ERROR("ref %s can't be array", refStr.c_str());
-            return ERROR;
-        }
-        const IdItem *idItem = hapManager_->FindResourceById(id);
-        if (idItem == nullptr) {
-            HILOG_ERROR("ref %s id not found", refStr.c_str());
-            return ERROR;
-        }
-        // unless compile bug
-        if (resType != idItem->resType_) {
-            HILOG_ERROR("impossible. ref %s type mismatch, found type: %d", refStr.c_str(), idItem->resType_);
-            return ERROR;
-        }
+RState ResourceManagerImpl::ResolveReference(const HapManager::Snapshot *snapshot,
+    const std::string &value, std::string &outValue)
+{
+    int id;
+    IdItem::ValueRef ref = { ResType::VALUES, 0 };
+    if (IdItem::IsRef(value, ref.resType_, id)) {
+        ref.id_ = static_cast<uint32_t>(id);
+    }
+    const std::string *resolvedValue = nullptr;
+    RState ret = ResolveValue(snapshot, value, ref, resolvedValue);
+    if (ret != SUCCESS) {
+        return ret;
+    }
+    outValue = *resolvedValue;
+    return SUCCESS;
+}
 
-        refStr = idItem->value_;
+RState ResourceManagerImpl::ResolveValue(const HapManager::Snapshot *snapshot, const std::string &value,
+    const IdItem::ValueRef &ref, const std::string *&outValue)
+{
+    if (ref.id_ == 0) {
+        outValue = &value;
+        return SUCCESS;
+    }
+    const IdItem *target = snapshot->ResolveReference(ref);
+    if (target == nullptr) {
+        HILOG_ERROR("ref %s can't be resolved", value.c_str());
+        return ERROR;
+    }
+    outValue = &target->value_;
+    return SUCCESS;
+}
 
-        if (++count > MAX_DEPTH_REF_SEARCH) {
-            HILOG_ERROR("ref %s has re-ref too much", value.c_str());
-            return ERROR;
-        }
+RState ResourceManagerImpl::GetFlattenedMap(const HapManager::Snapshot *snapshot,
+    const IdItem *idItem, std::shared_ptr<const std::map<std::string, std::string>> &outValue)
+{
+    outValue = snapshot->GetFlattenedMap(idItem);
+    if (outValue != nullptr) {
+        return SUCCESS;
     }
+    std::shared_ptr<std::map<std::string, std::string>> flattened(
+        new (std::nothrow) std::map<std::string, std::string>());
+    if (flattened == nullptr) {
+        HILOG_ERROR("new map failed when GetFlattenedMap");
+        return ERROR;
+    }
+    RState state = ResolveParentReference(snapshot, idItem, *flattened);
+    if (state != SUCCESS) {
+        return state;
+    }
+    // when another reader flattened it meanwhile, both get the map cached first
+    outValue = snapshot->PutFlattenedMap(idItem, flattened);
     return SUCCESS;
 }
 
 RState ResourceManagerImpl::ResolveParentReference(const IdItem *idItem, std::map<std::string, std::string> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    return ResolveParentReference(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::ResolveParentReference(const HapManager::Snapshot *snapshot,
+    const IdItem *idItem, std::map<std::string, std::string> &outValue)
 {
     // only pattern and theme
     // ref always at idx 0
@@ -333,30 +574,28 @@ RState ResourceManagerImpl::ResolveParentReference(const IdItem *idItem, std::ma
         size_t loop = currItem->values_.size() / 2;
         for (size_t i = 0; i < loop; ++i) {
             // 2 means key and value appear in pairs
-            std::string key(currItem->values_[startIdx + i * 2]);
-            std::string value(currItem->values_[startIdx + i * 2 + 1]);
-            auto iter = outValue.find(key);
-            if (iter != outValue.end()) {
+            size_t keyIdx = startIdx + i * 2;
+            const std::string &key = currItem->values_[keyIdx];
+            if (outValue.find(key) != outValue.end()) {
                 continue;
             }
-            std::string resolvedValue;
-            RState rrRet = ResolveReference(value, resolvedValue);
+            const std::string *resolvedValue = nullptr;
+            RState rrRet = ResolveValue(snapshot, currItem->values_[keyIdx + 1], currItem->GetValueRef(keyIdx + 1),
+                resolvedValue);
             if (rrRet != SUCCESS) {
-                HILOG_ERROR("ResolveReference failed, value:%s", value.c_str());
+                HILOG_ERROR("ResolveReference failed, value:%s", currItem->values_[keyIdx + 1].c_str());
                 return ERROR;
             }
-            outValue[key] = resolvedValue;
+            outValue[key] = *resolvedValue;
         }
         if (haveParent) {
-            // get parent
-            int id;
-            ResType resType;
-            bool isRef = IdItem::IsRef(currItem->values_[0], resType, id);
-            if (!isRef) {
+            // get parent, parsed at load
+            const IdItem::ValueRef &parentRef = currItem->GetValueRef(0);
+            if (parentRef.id_ == 0) {
                 HILOG_ERROR("something wrong, pls check HaveParent(). idItem: %s", idItem->ToString().c_str());
                 return ERROR;
             }
-            currItem = hapManager_->FindResourceById(id);
+            currItem = snapshot->FindResourceById(parentRef.id_);
             if (currItem == nullptr) {
                 HILOG_ERROR("ref %s id not found", idItem->values_[0].c_str());
                 return ERROR;
@@ -372,205 +611,552 @@ RState ResourceManagerImpl::ResolveParentReference(const IdItem *idItem, std::ma
     return SUCCESS;
 }
 
+RState ResourceManagerImpl::GetTypedValue(const HapManager::Snapshot *snapshot, const IdItem *idItem,
+    IdItem::TypedValue &outValue)
+{
+    const IdItem *target = idItem;
+    if (idItem->valueRef_.id_ != 0) {
+        target = snapshot->ResolveReference(idItem->valueRef_);
+        if (target == nullptr) {
+            HILOG_ERROR("ref %s can't be resolved", idItem->value_.c_str());
+            return ERROR;
+        }
+    }
+    if (target->resType_ == idItem->resType_) {
+        // decoded at load, an invalid value is reported there
+        if (target->decodeState_ == SUCCESS) {
+            outValue = target->typedValue_;
+        }
+        return target->decodeState_;
+    }
+    // a reference to another type, e.g. an integer which refers to a string
+    return IdItem::DecodeValue(idItem->resType_, target->value_, outValue);
+}
+
 RState ResourceManagerImpl::GetBooleanById(uint32_t id, bool &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceById(id);
-    return GetBoolean(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    return GetBoolean(snapshot.Get(), idItem, outValue);
 }
 
 RState ResourceManagerImpl::GetBooleanByName(const char *name, bool &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceByName(name, ResType::BOOLEAN);
-    return GetBoolean(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::BOOLEAN);
+    return GetBoolean(snapshot.Get(), idItem, outValue);
 }
 
-RState ResourceManagerImpl::GetBoolean(const IdItem *idItem, bool &outValue)
+RState ResourceManagerImpl::GetBooleanByName(const ResName &name, bool &outValue)
 {
-    if (idItem == nullptr || idItem->resType_ != ResType::BOOLEAN) {
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name);
+    return GetBoolean(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetBoolean(const HapManager::Snapshot *snapshot, const IdItem *idItem, bool &outValue)
+{
+    if (idItem == nullptr) {
+        return snapshot->GetMissState();
+    }
+    if (idItem->resType_ != ResType::BOOLEAN) {
         return NOT_FOUND;
     }
-    std::string temp;
-    RState state = ResolveReference(idItem->value_, temp);
+    IdItem::TypedValue typedValue;
+    RState state = GetTypedValue(snapshot, idItem, typedValue);
     if (state == SUCCESS) {
-        if (strcmp(temp.c_str(), "true") == 0) {
-            outValue = true;
-            return SUCCESS;
-        }
-        if (strcmp(temp.c_str(), "false") == 0) {
-            outValue = false;
-            return SUCCESS;
-        }
-        return ERROR;
+        outValue = typedValue.boolValue_;
     }
     return state;
 }
 
 RState ResourceManagerImpl::GetFloatById(uint32_t id, float &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceById(id);
-    return GetFloat(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    return GetFloat(snapshot.Get(), idItem, outValue);
 }
 
 RState ResourceManagerImpl::GetFloatByName(const char *name, float &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceByName(name, ResType::FLOAT);
-    return GetFloat(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::FLOAT);
+    return GetFloat(snapshot.Get(), idItem, outValue);
 }
 
-RState ResourceManagerImpl::GetFloat(const IdItem *idItem, float &outValue)
+RState ResourceManagerImpl::GetFloatByName(const ResName &name, float &outValue)
 {
-    if (idItem == nullptr || idItem->resType_ != ResType::FLOAT) {
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name);
+    return GetFloat(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetFloat(const HapManager::Snapshot *snapshot, const IdItem *idItem, float &outValue)
+{
+    if (idItem == nullptr) {
+        return snapshot->GetMissState();
+    }
+    if (idItem->resType_ != ResType::FLOAT) {
         return NOT_FOUND;
     }
-    std::string temp;
-    RState state = ResolveReference(idItem->value_, temp);
+    IdItem::TypedValue typedValue;
+    RState state = GetTypedValue(snapshot, idItem, typedValue);
     if (state == SUCCESS) {
-        outValue = strtof(temp.c_str(), nullptr);
-        return SUCCESS;
+        outValue = typedValue.floatValue_;
     }
     return state;
 }
 
 RState ResourceManagerImpl::GetIntegerById(uint32_t id, int &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceById(id);
-    return GetInteger(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    return GetInteger(snapshot.Get(), idItem, outValue);
 }
 
 RState ResourceManagerImpl::GetIntegerByName(const char *name, int &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceByName(name, ResType::INTEGER);
-    return GetInteger(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::INTEGER);
+    return GetInteger(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetIntegerByName(const ResName &name, int &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name);
+    return GetInteger(snapshot.Get(), idItem, outValue);
 }
 
-RState ResourceManagerImpl::GetInteger(const IdItem *idItem, int &outValue)
+RState ResourceManagerImpl::GetInteger(const HapManager::Snapshot *snapshot, const IdItem *idItem, int &outValue)
 {
-    if (idItem == nullptr || idItem->resType_ != ResType::INTEGER) {
+    if (idItem == nullptr) {
+        return snapshot->GetMissState();
+    }
+    if (idItem->resType_ != ResType::INTEGER) {
         return NOT_FOUND;
     }
-    std::string temp;
-    RState state = ResolveReference(idItem->value_, temp);
+    IdItem::TypedValue typedValue;
+    RState state = GetTypedValue(snapshot, idItem, typedValue);
     if (state == SUCCESS) {
-        outValue = stoi(temp);
-        return SUCCESS;
+        outValue = typedValue.intValue_;
     }
     return state;
 }
 
 RState ResourceManagerImpl::GetColorById(uint32_t id, uint32_t &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceById(id);
-    return GetColor(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    return GetColor(snapshot.Get(), idItem, outValue);
 }
 
 RState ResourceManagerImpl::GetColorByName(const char *name, uint32_t &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceByName(name, ResType::COLOR);
-    return GetColor(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::COLOR);
+    return GetColor(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetColorByName(const ResName &name, uint32_t &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name);
+    return GetColor(snapshot.Get(), idItem, outValue);
 }
 
-RState ResourceManagerImpl::GetColor(const IdItem *idItem, uint32_t &outValue)
+RState ResourceManagerImpl::GetColor(const HapManager::Snapshot *snapshot, const IdItem *idItem, uint32_t &outValue)
 {
-    if (idItem == nullptr || idItem->resType_ != ResType::COLOR) {
+    if (idItem == nullptr) {
+        return snapshot->GetMissState();
+    }
+    if (idItem->resType_ != ResType::COLOR) {
         return NOT_FOUND;
     }
-    std::string temp;
-    RState state = ResolveReference(idItem->value_, temp);
+    IdItem::TypedValue typedValue;
+    RState state = GetTypedValue(snapshot, idItem, typedValue);
     if (state == SUCCESS) {
-        return Utils::ConvertColorToUInt32(temp.c_str(), outValue);
+        outValue = typedValue.colorValue_;
     }
     return state;
 }
 
 RState ResourceManagerImpl::GetIntArrayById(uint32_t id, std::vector<int> &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceById(id);
-    return GetIntArray(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    return GetIntArray(snapshot.Get(), idItem, outValue);
 }
 
 RState ResourceManagerImpl::GetIntArrayByName(const char *name, std::vector<int> &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceByName(name, ResType::INTARRAY);
-    return GetIntArray(idItem, outValue);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::INTARRAY);
+    return GetIntArray(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetIntArrayByName(const ResName &name, std::vector<int> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name);
+    return GetIntArray(snapshot.Get(), idItem, outValue);
 }
 
-RState ResourceManagerImpl::GetIntArray(const IdItem *idItem, std::vector<int> &outValue)
+RState ResourceManagerImpl::GetIntArray(const HapManager::Snapshot *snapshot,
+    const IdItem *idItem, std::vector<int> &outValue)
 {
     // not found or type invalid
-    if (idItem == nullptr || idItem->resType_ != ResType::INTARRAY) {
+    if (idItem == nullptr) {
+        return snapshot->GetMissState();
+    }
+    if (idItem->resType_ != ResType::INTARRAY) {
         return NOT_FOUND;
     }
     outValue.clear();
 
+    if (idItem->intValues_.size() == idItem->values_.size()) {
+        // all literal, decoded at load
+        outValue.assign(idItem->intValues_.begin(), idItem->intValues_.end());
+        return SUCCESS;
+    }
+    if (idItem->valueRefs_.empty()) {
+        // the invalid value is reported at load
+        return ERROR;
+    }
+    outValue.reserve(idItem->values_.size());
     for (size_t i = 0; i < idItem->values_.size(); ++i) {
-        std::string resolvedValue;
-        RState rrRet = ResolveReference(idItem->values_[i], resolvedValue);
+        const std::string *resolvedValue = nullptr;
+        RState rrRet = ResolveValue(snapshot, idItem->values_[i], idItem->GetValueRef(i), resolvedValue);
         if (rrRet != SUCCESS) {
             HILOG_ERROR("ResolveReference failed, value:%s", idItem->values_[i].c_str());
             return ERROR;
         }
-        outValue.push_back(stoi(resolvedValue));
+        IdItem::TypedValue typedValue;
+        if (IdItem::DecodeValue(ResType::INTEGER, *resolvedValue, typedValue) != SUCCESS) {
+            HILOG_ERROR("invalid value '%s' of intarray %u", resolvedValue->c_str(), idItem->id_);
+            return ERROR;
+        }
+        outValue.push_back(typedValue.intValue_);
     }
     return SUCCESS;
 }
 
 RState ResourceManagerImpl::GetThemeById(uint32_t id, std::map<std::string, std::string> &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceById(id);
-    return GetTheme(idItem, outValue);
+    std::shared_ptr<const std::map<std::string, std::string>> flattened;
+    RState state = GetThemeById(id, flattened);
+    if (state == SUCCESS) {
+        outValue = *flattened;
+    }
+    return state;
 }
 
 RState ResourceManagerImpl::GetThemeByName(const char *name, std::map<std::string, std::string> &outValue)
 {
-    const IdItem *idItem = hapManager_->FindResourceByName(name, ResType::THEME);
-    return GetTheme(idItem, outValue);
+    std::shared_ptr<const std::map<std::string, std::string>> flattened;
+    RState state = GetThemeByName(name, flattened);
+    if (state == SUCCESS) {
+        outValue = *flattened;
+    }
+    return state;
+}
+
+RState ResourceManagerImpl::GetThemeById(uint32_t id,
+    std::shared_ptr<const std::map<std::string, std::string>> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceById(id);
+    return GetTheme(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetThemeByName(const char *name,
+    std::shared_ptr<const std::map<std::string, std::string>> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name, ResType::THEME);
+    return GetTheme(snapshot.Get(), idItem, outValue);
 }
 
-RState ResourceManagerImpl::GetTheme(const IdItem *idItem, std::map<std::string, std::string> &outValue)
+RState ResourceManagerImpl::GetThemeByName(const ResName &name,
+    std::shared_ptr<const std::map<std::string, std::string>> &outValue)
 {
-// not found or type invalid
-    if (idItem == nullptr || idItem->resType_ != ResType::THEME) {
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const IdItem *idItem = snapshot->FindResourceByName(name);
+    return GetTheme(snapshot.Get(), idItem, outValue);
+}
+
+RState ResourceManagerImpl::GetTheme(const HapManager::Snapshot *snapshot,
+    const IdItem *idItem, std::shared_ptr<const std::map<std::string, std::string>> &outValue)
+{
+    // not found or type invalid
+    if (idItem == nullptr) {
+        return snapshot->GetMissState();
+    }
+    if (idItem->resType_ != ResType::THEME) {
         return NOT_FOUND;
     }
-    return ResolveParentReference(idItem, outValue);
+    return GetFlattenedMap(snapshot, idItem, outValue);
 }
 
 RState ResourceManagerImpl::GetProfileById(uint32_t id, std::string &outValue)
 {
-    auto qd = hapManager_->FindQualifierValueById(id);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    auto qd = snapshot->FindQualifierValueById(id);
     if (qd == nullptr) {
-        return NOT_FOUND;
+        return snapshot->GetMissState();
     }
     return GetRawFile(qd, ResType::PROF, outValue);
 }
 
 RState ResourceManagerImpl::GetProfileByName(const char *name, std::string &outValue)
 {
-    auto qd = hapManager_->FindQualifierValueByName(name, ResType::PROF);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    auto qd = snapshot->FindQualifierValueByName(name, ResType::PROF);
     if (qd == nullptr) {
-        return NOT_FOUND;
+        return snapshot->GetMissState();
+    }
+    return GetRawFile(qd, ResType::PROF, outValue);
+}
+
+RState ResourceManagerImpl::GetProfileByName(const ResName &name, std::string &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    auto qd = snapshot->FindQualifierValueByName(name);
+    if (qd == nullptr) {
+        return snapshot->GetMissState();
     }
     return GetRawFile(qd, ResType::PROF, outValue);
 }
 
 RState ResourceManagerImpl::GetMediaById(uint32_t id, std::string &outValue)
 {
-    auto qd = hapManager_->FindQualifierValueById(id);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    auto qd = snapshot->FindQualifierValueById(id);
     if (qd == nullptr) {
-        return NOT_FOUND;
+        return snapshot->GetMissState();
     }
     return GetRawFile(qd, ResType::MEDIA, outValue);
 }
 
 RState ResourceManagerImpl::GetMediaByName(const char *name, std::string &outValue)
 {
-    auto qd = hapManager_->FindQualifierValueByName(name, ResType::MEDIA);
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    auto qd = snapshot->FindQualifierValueByName(name, ResType::MEDIA);
     if (qd == nullptr) {
-        return NOT_FOUND;
+        return snapshot->GetMissState();
     }
     return GetRawFile(qd, ResType::MEDIA, outValue);
 }
 
+RState ResourceManagerImpl::GetMediaByName(const ResName &name, std::string &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    auto qd = snapshot->FindQualifierValueByName(name);
+    if (qd == nullptr) {
+        return snapshot->GetMissState();
+    }
+    return GetRawFile(qd, ResType::MEDIA, outValue);
+}
+
+RState ResourceManagerImpl::GetStringsByIds(const uint32_t *ids, size_t count, std::string *outValues,
+    RState *outStates)
+{
+    if (count > 0 && (ids == nullptr || outValues == nullptr)) {
+        return ERROR;
+    }
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    RState result = SUCCESS;
+    for (size_t i = 0; i < count; ++i) {
+        const std::string *value = nullptr;
+        RState state = GetStringValue(snapshot.Get(), snapshot->FindResourceById(ids[i]), value);
+        if (state == SUCCESS) {
+            outValues[i] = *value;
+        } else if (result == SUCCESS) {
+            result = state;
+        }
+        if (outStates != nullptr) {
+            outStates[i] = state;
+        }
+    }
+    return result;
+}
+
+RState ResourceManagerImpl::GetStringViewsByIds(const uint32_t *ids, size_t count, const std::string **outValues,
+    RState *outStates)
+{
+    if (count > 0 && (ids == nullptr || outValues == nullptr)) {
+        return ERROR;
+    }
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    RState result = SUCCESS;
+    for (size_t i = 0; i < count; ++i) {
+        RState state = GetStringValue(snapshot.Get(), snapshot->FindResourceById(ids[i]), outValues[i]);
+        if (state != SUCCESS) {
+            outValues[i] = nullptr;
+            if (result == SUCCESS) {
+                result = state;
+            }
+        }
+        if (outStates != nullptr) {
+            outStates[i] = state;
+        }
+    }
+    return result;
+}
+
+RState ResourceManagerImpl::GetResourcesByIds(ResourceBatchItem *items, size_t count)
+{
+    if (count > 0 && items == nullptr) {
+        return ERROR;
+    }
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    RState result = SUCCESS;
+    for (size_t i = 0; i < count; ++i) {
+        items[i].state = GetBatchItem(snapshot.Get(), items[i]);
+        if (items[i].state != SUCCESS && result == SUCCESS) {
+            result = items[i].state;
+        }
+    }
+    return result;
+}
+
+RState ResourceManagerImpl::GetBatchItem(const HapManager::Snapshot *snapshot, ResourceBatchItem &item)
+{
+    switch (item.resType) {
+        case ResType::STRING:
+            item.stringValue = nullptr;
+            return GetStringValue(snapshot, snapshot->FindResourceById(item.id), item.stringValue);
+        case ResType::PLURALS:
+            item.stringValue = nullptr;
+            return GetPluralValue(snapshot, snapshot->FindQualifierValueById(item.id), item.quantity,
+                item.stringValue);
+        case ResType::INTEGER:
+            return GetInteger(snapshot, snapshot->FindResourceById(item.id), item.intValue);
+        case ResType::FLOAT:
+            return GetFloat(snapshot, snapshot->FindResourceById(item.id), item.floatValue);
+        case ResType::BOOLEAN:
+            return GetBoolean(snapshot, snapshot->FindResourceById(item.id), item.boolValue);
+        case ResType::COLOR:
+            return GetColor(snapshot, snapshot->FindResourceById(item.id), item.colorValue);
+        default:
+            HILOG_ERROR("resType %d is not supported in batch", item.resType);
+            return ERROR;
+    }
+}
+
+RState ResourceManagerImpl::Resolve(const char *name, const ResType resType, ResHandle &outHandle)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    size_t hapIndex = 0;
+    const HapResource::ValueUnderQualifierDir *vuqd = snapshot->FindQualifierValueByName(name, resType, &hapIndex);
+    if (vuqd == nullptr || vuqd->GetIdItem() == nullptr) {
+        return snapshot->GetMissState();
+    }
+    outHandle.id = vuqd->GetIdItem()->id_;
+    outHandle.epoch = snapshot->GetEpoch();
+    outHandle.binding = vuqd;
+    outHandle.hapIndex = static_cast<uint32_t>(hapIndex);
+    return SUCCESS;
+}
+
+RState ResourceManagerImpl::Resolve(const ResName &name, ResHandle &outHandle)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    size_t hapIndex = 0;
+    const HapResource::ValueUnderQualifierDir *vuqd = snapshot->FindQualifierValueByName(name, &hapIndex);
+    if (vuqd == nullptr || vuqd->GetIdItem() == nullptr) {
+        return snapshot->GetMissState();
+    }
+    outHandle.id = vuqd->GetIdItem()->id_;
+    outHandle.epoch = snapshot->GetEpoch();
+    outHandle.binding = vuqd;
+    outHandle.hapIndex = static_cast<uint32_t>(hapIndex);
+    return SUCCESS;
+}
+
+const HapResource::ValueUnderQualifierDir *ResourceManagerImpl::GetBinding(const HapManager::Snapshot *snapshot,
+    ResHandle &handle)
+{
+    // every published snapshot of the process has a new epoch, so the same epoch means the binding is in snapshot
+    if (handle.binding != nullptr && handle.epoch == snapshot->GetEpoch()) {
+        // the hap is read without a lookup, it must still look used to the memory budget
+        snapshot->TouchHap(handle.hapIndex);
+        return static_cast<const HapResource::ValueUnderQualifierDir *>(handle.binding);
+    }
+    if (handle.id == 0) {
+        return nullptr;
+    }
+    size_t hapIndex = 0;
+    const HapResource::ValueUnderQualifierDir *vuqd = snapshot->FindQualifierValueById(handle.id, &hapIndex);
+    handle.epoch = snapshot->GetEpoch();
+    handle.binding = vuqd;
+    handle.hapIndex = static_cast<uint32_t>(hapIndex);
+    return vuqd;
+}
+
+RState ResourceManagerImpl::GetStringByHandle(ResHandle &handle, std::string &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = GetBinding(snapshot.Get(), handle);
+    return GetString(snapshot.Get(), vuqd == nullptr ? nullptr : vuqd->GetIdItem(), outValue);
+}
+
+RState ResourceManagerImpl::GetStringViewByHandle(ResHandle &handle, const std::string *&outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = GetBinding(snapshot.Get(), handle);
+    return GetStringValue(snapshot.Get(), vuqd == nullptr ? nullptr : vuqd->GetIdItem(), outValue);
+}
+
+RState ResourceManagerImpl::GetStringArrayByHandle(ResHandle &handle, std::vector<std::string> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = GetBinding(snapshot.Get(), handle);
+    return GetStringArray(snapshot.Get(), vuqd == nullptr ? nullptr : vuqd->GetIdItem(), outValue);
+}
+
+RState ResourceManagerImpl::GetPluralStringByHandle(ResHandle &handle, int quantity, std::string &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = GetBinding(snapshot.Get(), handle);
+    return GetPluralString(snapshot.Get(), vuqd, quantity, outValue);
+}
+
+RState ResourceManagerImpl::GetBooleanByHandle(ResHandle &handle, bool &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = GetBinding(snapshot.Get(), handle);
+    return GetBoolean(snapshot.Get(), vuqd == nullptr ? nullptr : vuqd->GetIdItem(), outValue);
+}
+
+RState ResourceManagerImpl::GetIntegerByHandle(ResHandle &handle, int &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = GetBinding(snapshot.Get(), handle);
+    return GetInteger(snapshot.Get(), vuqd == nullptr ? nullptr : vuqd->GetIdItem(), outValue);
+}
+
+RState ResourceManagerImpl::GetFloatByHandle(ResHandle &handle, float &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = GetBinding(snapshot.Get(), handle);
+    return GetFloat(snapshot.Get(), vuqd == nullptr ? nullptr : vuqd->GetIdItem(), outValue);
+}
+
+RState ResourceManagerImpl::GetIntArrayByHandle(ResHandle &handle, std::vector<int> &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = GetBinding(snapshot.Get(), handle);
+    return GetIntArray(snapshot.Get(), vuqd == nullptr ? nullptr : vuqd->GetIdItem(), outValue);
+}
+
+RState ResourceManagerImpl::GetColorByHandle(ResHandle &handle, uint32_t &outValue)
+{
+    HapManager::SnapshotGuard snapshot(hapManager_);
+    const HapResource::ValueUnderQualifierDir *vuqd = GetBinding(snapshot.Get(), handle);
+    return GetColor(snapshot.Get(), vuqd == nullptr ? nullptr : vuqd->GetIdItem(), outValue);
+}
+
 RState ResourceManagerImpl::GetRawFile(const HapResource::ValueUnderQualifierDir *vuqd, const ResType resType,
     std::string &outValue)
 {
@@ -599,6 +1185,51 @@ bool ResourceManagerImpl::AddResource(const char *path)
     return this->hapManager_->AddResource(path);
 }
 
+bool ResourceManagerImpl::AddResources(const std::vector<std::string> &paths)
+{
+    return this->hapManager_->AddResources(paths);
+}
+
+RState ResourceManagerImpl::Refresh()
+{
+    return this->hapManager_->Refresh();
+}
+
+bool ResourceManagerImpl::StartWatch(uint32_t intervalMs)
+{
+    return this->hapManager_->StartWatch(intervalMs);
+}
+
+void ResourceManagerImpl::StopWatch()
+{
+    this->hapManager_->StopWatch();
+}
+
+void ResourceManagerImpl::SetMemoryBudget(size_t budget)
+{
+    this->hapManager_->SetMemoryBudget(budget);
+}
+
+void ResourceManagerImpl::GetResidencyStats(ResidencyStats &stats)
+{
+    this->hapManager_->GetResidencyStats(stats);
+}
+
+void ResourceManagerImpl::PinViews()
+{
+    this->hapManager_->PinSnapshots();
+}
+
+void ResourceManagerImpl::UnpinViews()
+{
+    this->hapManager_->UnpinSnapshots();
+}
+
+std::shared_future<bool> ResourceManagerImpl::AddResourceAsync(const char *path)
+{
+    return this->hapManager_->AddResourceAsync(path);
+}
+
 RState ResourceManagerImpl::UpdateResConfig(ResConfig &resConfig)
 {
     if (resConfig.GetLocaleInfo() == nullptr) {
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "utils/format_template.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "securec.h"
+#include "utils/string_utils.h"
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+// enough for a number with width and precision, longer results are formatted again into the string
+constexpr size_t SPEC_BUFFER_SIZE = 64;
+
+// enough for the decimal digits of an unsigned long long
+constexpr size_t DIGIT_BUFFER_SIZE = 24;
+
+constexpr unsigned int DECIMAL_BASE = 10;
+
+namespace {
+bool IsDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+bool IsIntegerConversion(char conversion)
+{
+    return strchr("diouxX", conversion) != nullptr;
+}
+
+void AppendUnsigned(std::string &outValue, unsigned long long value)
+{
+    char digits[DIGIT_BUFFER_SIZE];
+    size_t pos = DIGIT_BUFFER_SIZE;
+    do {
+        digits[--pos] = static_cast<char>('0' + value % DECIMAL_BASE);
+        value /= DECIMAL_BASE;
+    } while (value != 0);
+    outValue.append(digits + pos, DIGIT_BUFFER_SIZE - pos);
+}
+
+void AppendSigned(std::string &outValue, long long value)
+{
+    if (value < 0) {
+        outValue.push_back('-');
+        // negate in unsigned, so LLONG_MIN does not overflow
+        AppendUnsigned(outValue, 0ULL - static_cast<unsigned long long>(value));
+        return;
+    }
+    AppendUnsigned(outValue, static_cast<unsigned long long>(value));
+}
+
+template<typename T>
+void AppendSpec(std::string &outValue, const std::string &spec, T value)
+{
+    char buffer[SPEC_BUFFER_SIZE];
+    int length = snprintf_s(buffer, sizeof(buffer), sizeof(buffer) - 1, spec.c_str(), value);
+    if (length >= 0 && static_cast<size_t>(length) < sizeof(buffer)) {
+        outValue.append(buffer, length);
+        return;
+    }
+    // truncated, compute the length and format again into the string
+    length = snprintf(nullptr, 0, spec.c_str(), value);
+    if (length <= 0) {
+        return;
+    }
+    size_t start = outValue.size();
+    outValue.resize(start + length + 1);
+    int written = snprintf_s(&outValue[start], length + 1, length, spec.c_str(), value);
+    outValue.resize((written == length) ? (start + length) : start);
+}
+} // namespace
+
+FormatTemplate::FormatTemplate(const std::string &fmt)
+    : fmt_(fmt), placeholderCount_(0), varargsFallback_(false), invalid_(false)
+{
+    int nextArg = 0;
+    size_t literalStart = 0;
+    size_t i = 0;
+    while (i < fmt_.size()) {
+        if (fmt_[i] != '%') {
+            ++i;
+            continue;
+        }
+        if (i + 1 < fmt_.size() && fmt_[i + 1] == '%') {
+            // "%%" is a literal '%', keep the first one and skip the second
+            AddLiteral(literalStart, i + 1 - literalStart);
+            i += 2; // 2 means the length of "%%"
+            literalStart = i;
+            continue;
+        }
+        AddLiteral(literalStart, i - literalStart);
+        Segment segment;
+        size_t end = ParsePlaceholder(i, nextArg, segment);
+        if (end == 0) {
+            // such as %n or '*' width, only vsnprintf can format it
+            segments_.clear();
+            placeholderCount_ = 0;
+            varargsFallback_ = true;
+            invalid_ = true;
+            return;
+        }
+        segments_.push_back(segment);
+        ++placeholderCount_;
+        i = end;
+        literalStart = end;
+    }
+    AddLiteral(literalStart, fmt_.size() - literalStart);
+}
+
+void FormatTemplate::AddLiteral(size_t offset, size_t length)
+{
+    if (length == 0) {
+        return;
+    }
+    Segment segment;
+    segment.conversion_ = 0;
+    segment.lengthModifier_ = NONE;
+    segment.simple_ = true;
+    segment.argIndex_ = -1;
+    segment.offset_ = offset;
+    segment.length_ = length;
+    segments_.push_back(segment);
+}
+
+size_t FormatTemplate::ParsePlaceholder(size_t start, int &nextArg, Segment &segment)
+{
+    size_t size = fmt_.size();
+    size_t i = start + 1;
+    int argIndex = nextArg;
+    size_t digitsEnd = i;
+    while (digitsEnd < size && IsDigit(fmt_[digitsEnd])) {
+        ++digitsEnd;
+    }
+    if (digitsEnd > i && digitsEnd < size && fmt_[digitsEnd] == '$') {
+        // positional, such as %1$s
+        argIndex = atoi(fmt_.c_str() + i) - 1;
+        if (argIndex < 0) {
+            return 0;
+        }
+        varargsFallback_ = true;
+        i = digitsEnd + 1;
+    }
+
+    size_t specStart = i;
+    while (i < size && strchr("-+ #0", fmt_[i]) != nullptr && fmt_[i] != '\0') {
+        ++i;
+    }
+    if (i < size && fmt_[i] == '*') {
+        return 0;
+    }
+    while (i < size && IsDigit(fmt_[i])) {
+        ++i;
+    }
+    if (i < size && fmt_[i] == '.') {
+        ++i;
+        if (i < size && fmt_[i] == '*') {
+            return 0;
+        }
+        while (i < size && IsDigit(fmt_[i])) {
+            ++i;
+        }
+    }
+    size_t specEnd = i;
+
+    LengthModifier lengthModifier = NONE;
+    if (fmt_.compare(i, 2, "hh") == 0) { // 2 means the length of "hh"
+        lengthModifier = CHAR;
+        i += 2; // 2 means the length of "hh"
+    } else if (fmt_.compare(i, 2, "ll") == 0) { // 2 means the length of "ll"
+        lengthModifier = LONG_LONG;
+        i += 2; // 2 means the length of "ll"
+    } else if (i < size && fmt_[i] == 'h') {
+        lengthModifier = SHORT;
+        ++i;
+    } else if (i < size && fmt_[i] == 'l') {
+        lengthModifier = LONG;
+        ++i;
+    } else if (i < size && fmt_[i] == 'z') {
+        lengthModifier = SIZE;
+        ++i;
+    } else if (i < size && strchr("jtL", fmt_[i]) != nullptr && fmt_[i] != '\0') {
+        lengthModifier = OTHER;
+        ++i;
+    }
+    if (i >= size || lengthModifier == OTHER) {
+        return 0;
+    }
+    char conversion = fmt_[i];
+    if (strchr("diouxXcspfFeEgGaA", conversion) == nullptr || conversion == '\0') {
+        return 0;
+    }
+    if (!IsIntegerConversion(conversion) && lengthModifier != NONE) {
+        // wide char and string
+        return 0;
+    }
+
+    segment.conversion_ = conversion;
+    segment.lengthModifier_ = lengthModifier;
+    segment.simple_ = (specEnd == specStart);
+    segment.argIndex_ = argIndex;
+    segment.offset_ = start;
+    segment.length_ = i + 1 - start;
+    // integers are passed as long long after they are truncated by lengthModifier
+    segment.spec_ = "%" + fmt_.substr(specStart, specEnd - specStart) +
+        (IsIntegerConversion(conversion) ? "ll" : "") + conversion;
+    nextArg = argIndex + 1;
+    return i + 1;
+}
+
+void FormatTemplate::AppendLiteral(std::string &outValue, size_t offset, size_t length) const
+{
+    outValue.append(fmt_, offset, length);
+}
+
+bool FormatTemplate::AppendArg(std::string &outValue, const Segment &segment, const FormatArg &arg) const
+{
+    char conversion = segment.conversion_;
+    if (conversion == 'd' || conversion == 'i') {
+        if (arg.type != FormatArg::INT && arg.type != FormatArg::UINT) {
+            return false;
+        }
+        long long value = (arg.type == FormatArg::INT) ? arg.intValue : static_cast<long long>(arg.uintValue);
+        switch (segment.lengthModifier_) {
+            case CHAR:
+                value = static_cast<signed char>(value);
+                break;
+            case SHORT:
+                value = static_cast<short>(value);
+                break;
+            case NONE:
+                value = static_cast<int>(value);
+                break;
+            case LONG:
+                value = static_cast<long>(value);
+                break;
+            default:
+                break;
+        }
+        if (segment.simple_) {
+            AppendSigned(outValue, value);
+        } else {
+            AppendSpec(outValue, segment.spec_, value);
+        }
+        return true;
+    }
+    if (IsIntegerConversion(conversion) || conversion == 'c' || conversion == 'p') {
+        if (arg.type != FormatArg::INT && arg.type != FormatArg::UINT) {
+            return false;
+        }
+        unsigned long long value = (arg.type == FormatArg::UINT) ? arg.uintValue :
+            static_cast<unsigned long long>(arg.intValue);
+        if (conversion == 'c') {
+            AppendSpec(outValue, segment.spec_, static_cast<int>(value));
+            return true;
+        }
+        if (conversion == 'p') {
+            AppendSpec(outValue, segment.spec_, reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+            return true;
+        }
+        switch (segment.lengthModifier_) {
+            case CHAR:
+                value = static_cast<unsigned char>(value);
+                break;
+            case SHORT:
+                value = static_cast<unsigned short>(value);
+                break;
+            case NONE:
+                value = static_cast<unsigned int>(value);
+                break;
+            case LONG:
+                value = static_cast<unsigned long>(value);
+                break;
+            case SIZE:
+                value = static_cast<size_t>(value);
+                break;
+            default:
+                break;
+        }
+        if (segment.simple_ && conversion == 'u') {
+            AppendUnsigned(outValue, value);
+        } else {
+            AppendSpec(outValue, segment.spec_, value);
+        }
+        return true;
+    }
+    if (conversion == 's') {
+        if (arg.type != FormatArg::STRING) {
+            return false;
+        }
+        if (segment.simple_ && arg.strValue != nullptr) {
+            outValue.append(arg.strValue);
+        } else {
+            AppendSpec(outValue, segment.spec_, arg.strValue);
+        }
+        return true;
+    }
+    // float conversions
+    double value;
+    if (arg.type == FormatArg::DOUBLE) {
+        value = arg.doubleValue;
+    } else if (arg.type == FormatArg::INT) {
+        value = static_cast<double>(arg.intValue);
+    } else if (arg.type == FormatArg::UINT) {
+        value = static_cast<double>(arg.uintValue);
+    } else {
+        return false;
+    }
+    AppendSpec(outValue, segment.spec_, value);
+    return true;
+}
+
+void FormatTemplate::Format(std::string &outValue, va_list args) const
+{
+    if (varargsFallback_) {
+        outValue = FormatString(fmt_.c_str(), args);
+        return;
+    }
+    outValue.clear();
+    for (size_t i = 0; i < segments_.size(); ++i) {
+        const Segment &segment = segments_[i];
+        char conversion = segment.conversion_;
+        if (conversion == 0) {
+            AppendLiteral(outValue, segment.offset_, segment.length_);
+            continue;
+        }
+        // fetch the argument by the C type of the placeholder, as vsnprintf does
+        if (conversion == 'd' || conversion == 'i') {
+            long long value;
+            if (segment.lengthModifier_ == LONG) {
+                value = va_arg(args, long);
+            } else if (segment.lengthModifier_ == LONG_LONG) {
+                value = va_arg(args, long long);
+            } else if (segment.lengthModifier_ == SIZE) {
+                value = static_cast<long long>(va_arg(args, size_t));
+            } else {
+                value = va_arg(args, int);
+            }
+            AppendArg(outValue, segment, FormatArg(value));
+        } else if (IsIntegerConversion(conversion)) {
+            unsigned long long value;
+            if (segment.lengthModifier_ == LONG) {
+                value = va_arg(args, unsigned long);
+            } else if (segment.lengthModifier_ == LONG_LONG) {
+                value = va_arg(args, unsigned long long);
+            } else if (segment.lengthModifier_ == SIZE) {
+                value = va_arg(args, size_t);
+            } else {
+                value = va_arg(args, unsigned int);
+            }
+            AppendArg(outValue, segment, FormatArg(value));
+        } else if (conversion == 'c') {
+            AppendArg(outValue, segment, FormatArg(va_arg(args, int)));
+        } else if (conversion == 'p') {
+            unsigned long long value = reinterpret_cast<uintptr_t>(va_arg(args, void *));
+            AppendArg(outValue, segment, FormatArg(value));
+        } else if (conversion == 's') {
+            AppendArg(outValue, segment, FormatArg(va_arg(args, const char *)));
+        } else {
+            AppendArg(outValue, segment, FormatArg(va_arg(args, double)));
+        }
+    }
+}
+
+bool FormatTemplate::Format(std::string &outValue, const std::vector<FormatArg> &args) const
+{
+    if (invalid_) {
+        return false;
+    }
+    outValue.clear();
+    for (size_t i = 0; i < segments_.size(); ++i) {
+        const Segment &segment = segments_[i];
+        if (segment.conversion_ == 0) {
+            AppendLiteral(outValue, segment.offset_, segment.length_);
+            continue;
+        }
+        if (static_cast<size_t>(segment.argIndex_) >= args.size()) {
+            return false;
+        }
+        if (!AppendArg(outValue, segment, args[segment.argIndex_])) {
+            return false;
+        }
+    }
+    return true;
+}
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
@@ -226,6 +226,9 @@ int32_t ParseIdItem(const char *buffer, uint32_t &offset, IdItem *idItem)
         if (ret != OK) {
             return ret;
         }
+        if (idItem->resType_ == ResType::PLURALS) {
+            idItem->InitPluralForms();
+        }
     } else {
         std::string value;
         int32_t ret = ParseString(buffer, offset, value);
@@ -241,6 +244,8 @@ int32_t ParseIdItem(const char *buffer, uint32_t &offset, IdItem *idItem)
         return ret;
     }
     idItem->name_ = std::string(name);
+    idItem->InitValueRefs();
+    idItem->DecodeValues();
     return OK;
 }
 
@@ -17,6 +17,7 @@
 #include <cctype>
 #include <cstddef>
 #include <cstring>
+#include <sys/stat.h>
 
 #include "utils/common.h"
 
@@ -75,6 +76,17 @@ void Utils::DecodeScript(uint32_t encodeScript, char *outValue)
     outValue[3] = (encodeScript & 0x000000FF);
 }
 
+void Utils::DecodeLanguage(uint16_t encodedLanguage, char *outValue)
+{
+    Utils::DecodeLanguageOrRegion(encodedLanguage, 'a', outValue);
+}
+
+void Utils::DecodeRegion(uint16_t encodedRegion, char *outValue)
+{
+    // three chars regions are digits, see EncodeRegion
+    Utils::DecodeLanguageOrRegion(encodedRegion, '0', outValue);
+}
+
 bool Utils::IsStrEmpty(const char *s)
 {
     return (s == nullptr || *s == '\0');
@@ -111,12 +123,14 @@ uint64_t Utils::EncodeLocale(const char *language,
                              const char *script,
                              const char *region)
 {
-    uint16_t languageData = Utils::EncodeLanguage(language);
-    uint32_t scriptData = Utils::EncodeScript(script);
-    uint16_t regionData = Utils::EncodeRegion(region);
+    return Utils::EncodeLocale(Utils::EncodeLanguage(language), Utils::EncodeScript(script),
+        Utils::EncodeRegion(region));
+}
 
-    return (uint64_t)(0xffff000000000000 & (((uint64_t)languageData) << 48)) |
-           (0x0000ffffffff0000 & (((uint64_t)scriptData) << 16)) | (0x000000000000ffff & (uint64_t)(regionData));
+uint64_t Utils::EncodeLocale(uint16_t encodedLanguage, uint32_t encodedScript, uint16_t encodedRegion)
+{
+    return (uint64_t)(0xffff000000000000 & (((uint64_t)encodedLanguage) << 48)) |
+           (0x0000ffffffff0000 & (((uint64_t)encodedScript) << 16)) | (0x000000000000ffff & (uint64_t)(encodedRegion));
 }
 
 uint16_t Utils::EncodeRegionByResLocale(const ResLocale *locale)
@@ -124,7 +138,7 @@ uint16_t Utils::EncodeRegionByResLocale(const ResLocale *locale)
     if (locale == nullptr) {
         return NULL_REGION;
     }
-    return Utils::EncodeRegion(locale->GetRegion());
+    return locale->GetEncodedRegion();
 }
 
 uint16_t Utils::EncodeLanguageByResLocale(const ResLocale *locale)
@@ -132,7 +146,7 @@ uint16_t Utils::EncodeLanguageByResLocale(const ResLocale *locale)
     if (locale == nullptr) {
         return NULL_LANGUAGE;
     }
-    return Utils::EncodeLanguage(locale->GetLanguage());
+    return locale->GetEncodedLanguage();
 }
 
 uint32_t Utils::EncodeScriptByResLocale(const ResLocale *locale)
@@ -140,7 +154,7 @@ uint32_t Utils::EncodeScriptByResLocale(const ResLocale *locale)
     if (locale == nullptr) {
         return NULL_SCRIPT;
     }
-    return Utils::EncodeScript(locale->GetScript());
+    return locale->GetEncodedScript();
 }
 
 uint16_t Utils::EncodeRegion(const char *region)
@@ -204,6 +218,27 @@ uint16_t Utils::EncodeLanguageOrRegion(const char *str, char base)
     return ((0x80 | (first << 2) | (second >> 3)) << 8) | ((second << 5) | third);
 };
 
+void Utils::DecodeLanguageOrRegion(uint16_t encoded, char base, char *outValue)
+{
+    if (outValue == nullptr) {
+        return;
+    }
+    if (encoded == 0) {
+        outValue[0] = '\0';
+        return;
+    }
+    if ((encoded & 0x8000) == 0) {
+        outValue[0] = static_cast<char>(encoded >> 8);
+        outValue[1] = static_cast<char>(encoded & 0xff);
+        outValue[2] = '\0';
+        return;
+    }
+    outValue[0] = static_cast<char>(base + ((encoded >> 10) & 0x1f));
+    outValue[1] = static_cast<char>(base + ((encoded >> 5) & 0x1f));
+    outValue[2] = static_cast<char>(base + (encoded & 0x1f));
+    outValue[3] = '\0';
+}
+
 bool Utils::StrCompare(const char *left, const char *right, size_t len, bool isCaseSensitive)
 {
     if (left == nullptr && right == nullptr) {
@@ -323,6 +358,24 @@ RState Utils::ConvertColorToUInt32(const char *s, uint32_t &outValue)
     outValue = color;
     return parseState;
 }
+
+FileStamp Utils::GetFileStamp(const char *path)
+{
+    FileStamp stamp = { 0, 0, 0, 0 };
+    struct stat fileStat;
+    if (path == nullptr || stat(path, &fileStat) != 0) {
+        return stamp;
+    }
+    stamp.modTimeSec = static_cast<int64_t>(fileStat.st_mtime);
+#if defined(__APPLE__)
+    stamp.modTimeNsec = static_cast<int64_t>(fileStat.st_mtimespec.tv_nsec);
+#else
+    stamp.modTimeNsec = static_cast<int64_t>(fileStat.st_mtim.tv_nsec);
+#endif
+    stamp.size = static_cast<int64_t>(fileStat.st_size);
+    stamp.inode = static_cast<uint64_t>(fileStat.st_ino);
+    return stamp;
+}
 } // namespace Resource
 } // namespace Global
 } // namespace OHOS
@@ -15,7 +15,9 @@
 
 #include "hap_manager_test.h"
 
+#include <atomic>
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "test_common.h"
 #include "utils/string_utils.h"
@@ -75,13 +77,12 @@ HWTEST_F(HapManagerTest, HapManagerFuncTest001, TestSize.Level1)
     EXPECT_TRUE(ret);
 
     int id = 16777217;
-    const HapResource::IdValues *idValues = hapManager->GetResourceList(id);
-    if (idValues == nullptr) {
-        delete hapManager;
-        ASSERT_TRUE(false);
+    {
+        HapManager::SnapshotGuard snapshot(hapManager);
+        const HapResource::IdValues *idValues = snapshot->GetResourceList(id);
+        ASSERT_TRUE(idValues != nullptr);
+        PrintIdValues(idValues);
     }
-
-    PrintIdValues(idValues);
     delete hapManager;
 }
 
@@ -111,16 +112,14 @@ HWTEST_F(HapManagerTest, HapManagerFuncTest002, TestSize.Level1)
     EXPECT_TRUE(ret);
 
     int id = 16777228;
-    const HapResource::IdValues *idValues = hapManager->GetResourceList(id);
-    if (idValues == nullptr) {
-        delete (hapManager);
-        delete (rc);
-        ASSERT_TRUE(false);
+    {
+        HapManager::SnapshotGuard snapshot(hapManager);
+        const HapResource::IdValues *idValues = snapshot->GetResourceList(id);
+        ASSERT_TRUE(idValues != nullptr);
+        EXPECT_EQ(static_cast<size_t>(1), idValues->GetLimitPathsConst().size());
+        PrintIdValues(idValues);
     }
 
-    EXPECT_EQ(static_cast<size_t>(1), idValues->GetLimitPathsConst().size());
-    PrintIdValues(idValues);
-
     // reload
 
     ResConfig *rc2 = CreateResConfig();
@@ -133,7 +132,8 @@ HWTEST_F(HapManagerTest, HapManagerFuncTest002, TestSize.Level1)
     rc2->SetLocaleInfo("zh", nullptr, "CN");
     hapManager->UpdateResConfig(*rc2);
     do {
-        idValues = hapManager->GetResourceList(id);
+        HapManager::SnapshotGuard snapshot(hapManager);
+        const HapResource::IdValues *idValues = snapshot->GetResourceList(id);
         if (idValues == nullptr) {
             EXPECT_TRUE(false);
             break;
@@ -147,4 +147,290 @@ HWTEST_F(HapManagerTest, HapManagerFuncTest002, TestSize.Level1)
     delete (rc2);
     delete (rc);
 }
+
+/*
+ * this test shows a pinned snapshot outlives UpdateResConfig while readers run concurrently
+ * @tc.name: HapManagerFuncTest003
+ * @tc.desc: Test SnapshotGuard & UpdateResConfig function, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapManagerTest, HapManagerFuncTest003, TestSize.Level1)
+{
+    ResConfig *rcEn = CreateResConfig();
+    ResConfig *rcZh = CreateResConfig();
+    HapManager *hapManager = new HapManager(new ResConfigImpl);
+    if (rcEn == nullptr || rcZh == nullptr || hapManager == nullptr) {
+        delete (hapManager);
+        delete (rcZh);
+        delete (rcEn);
+        ASSERT_TRUE(false);
+    }
+    rcEn->SetLocaleInfo("en", nullptr, "US");
+    rcZh->SetLocaleInfo("zh", nullptr, "CN");
+    EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig(*rcEn));
+    EXPECT_TRUE(hapManager->AddResource(FormatFullPath(g_resFilePath).c_str()));
+
+    uint32_t id = 16777228;
+    {
+        HapManager::SnapshotGuard pinned(hapManager);
+        uint32_t epoch = pinned->GetEpoch();
+        const HapResource::IdValues *idValues = pinned->GetResourceList(id);
+        EXPECT_TRUE(idValues != nullptr);
+        EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig(*rcZh));
+        // the pinned snapshot is neither changed nor reclaimed by the update
+        EXPECT_EQ(epoch, pinned->GetEpoch());
+        EXPECT_EQ(idValues, pinned->GetResourceList(id));
+        EXPECT_EQ(std::string("en"), pinned->GetResConfig()->GetResLocale()->GetLanguage());
+
+        HapManager::SnapshotGuard current(hapManager);
+        EXPECT_EQ(epoch + 1, current->GetEpoch());
+        EXPECT_EQ(std::string("zh"), current->GetResConfig()->GetResLocale()->GetLanguage());
+    }
+    EXPECT_TRUE(hapManager->retiredSnapshots_.empty());
+
+    {
+        // a retired snapshot is freed when its last reader leaves, while readers of the current one go on
+        HapManager::SnapshotGuard *outdated = new HapManager::SnapshotGuard(hapManager);
+        EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig(*rcEn));
+        HapManager::SnapshotGuard current(hapManager);
+        EXPECT_EQ(static_cast<size_t>(1), hapManager->retiredSnapshots_.size());
+        delete (outdated);
+        EXPECT_TRUE(hapManager->retiredSnapshots_.empty());
+
+        // nothing is freed while pinned
+        hapManager->PinSnapshots();
+        EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig(*rcZh));
+        EXPECT_EQ(static_cast<size_t>(1), hapManager->retiredSnapshots_.size());
+        // and after the pin it is still held by current
+        hapManager->UnpinSnapshots();
+        EXPECT_EQ(static_cast<size_t>(1), hapManager->retiredSnapshots_.size());
+    }
+    EXPECT_TRUE(hapManager->retiredSnapshots_.empty());
+
+    std::atomic<bool> stop(false);
+    std::atomic<int> missCount(0);
+    std::thread reader([hapManager, id, &stop, &missCount]() {
+        while (!stop.load()) {
+            HapManager::SnapshotGuard snapshot(hapManager);
+            if (snapshot->FindResourceById(id) == nullptr) {
+                ++missCount;
+            }
+        }
+    });
+    for (int i = 0; i < 50; ++i) {
+        EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig((i % 2 == 0) ? *rcEn : *rcZh));
+    }
+    stop.store(true);
+    reader.join();
+    EXPECT_EQ(0, missCount.load());
+
+    delete (hapManager);
+    delete (rcZh);
+    delete (rcEn);
+}
+
+/*
+ * this test shows the least recently used hap is evicted under the memory budget and reloaded on access
+ * @tc.name: HapManagerFuncTest004
+ * @tc.desc: Test SetMemoryBudget & GetResidencyStats function, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapManagerTest, HapManagerFuncTest004, TestSize.Level1)
+{
+    HapManager *hapManager = new HapManager(new ResConfigImpl);
+    // the same hap under two paths
+    std::vector<std::string> paths;
+    paths.push_back(FormatFullPath(g_resFilePath));
+    paths.push_back(FormatFullPath("all/./assets/entry/resources.index"));
+    ASSERT_TRUE(hapManager->AddResources(paths));
+
+    ResidencyStats stats;
+    hapManager->SetMemoryBudget(1);
+    hapManager->GetResidencyStats(stats);
+    EXPECT_EQ(static_cast<uint32_t>(1), stats.residentHapCount);
+    EXPECT_EQ(static_cast<uint32_t>(1), stats.evictedHapCount);
+    EXPECT_EQ(static_cast<uint32_t>(1), stats.evictionCount);
+    EXPECT_TRUE(hapManager->snapshot_.load()->hapResources_[0] == nullptr);
+
+    // the first hap is evicted, so it is reloaded and the second one becomes the coldest
+    {
+        HapManager::SnapshotGuard snapshot(hapManager);
+        EXPECT_TRUE(snapshot->FindResourceById(16777217) != nullptr);
+    }
+    hapManager->GetResidencyStats(stats);
+    EXPECT_EQ(static_cast<uint32_t>(1), stats.reloadCount);
+    EXPECT_EQ(static_cast<uint32_t>(2), stats.evictionCount);
+    EXPECT_TRUE(hapManager->snapshot_.load()->hapResources_[1] == nullptr);
+
+    // resident hap hits and ids out of range of the evicted hap cause no reload
+    {
+        HapManager::SnapshotGuard snapshot(hapManager);
+        EXPECT_TRUE(snapshot->FindResourceByName("app_name", ResType::STRING) != nullptr);
+        EXPECT_TRUE(snapshot->FindResourceById(1) == nullptr);
+    }
+    hapManager->GetResidencyStats(stats);
+    EXPECT_EQ(static_cast<uint32_t>(1), stats.reloadCount);
+    EXPECT_EQ(stats.residentSize, hapManager->snapshot_.load()->hapStubs_[0]->GetDataSize());
+
+    {
+        // a reader of an outdated snapshot reloads an evicted hap into it once, nothing else is kept
+        HapManager::SnapshotGuard outdated(hapManager);
+        hapManager->SetMemoryBudget(1);
+        size_t retiredCount = hapManager->retiredSnapshots_.size();
+        const HapResource *reloaded = outdated->GetHapResource(1);
+        EXPECT_TRUE(reloaded != nullptr);
+        EXPECT_EQ(reloaded, outdated->GetHapResource(1));
+        hapManager->GetResidencyStats(stats);
+        EXPECT_EQ(static_cast<uint32_t>(2), stats.reloadCount);
+        EXPECT_EQ(retiredCount, hapManager->retiredSnapshots_.size());
+        EXPECT_TRUE(hapManager->snapshot_.load()->hapResources_[1] == nullptr);
+    }
+
+    hapManager->SetMemoryBudget(0);
+    hapManager->GetResidencyStats(stats);
+    EXPECT_EQ(static_cast<size_t>(0), stats.memoryBudget);
+    delete hapManager;
+}
+
+/*
+ * @tc.name: HapManagerFuncTest005
+ * @tc.desc: Test GetPluralRule function, the rules are shared per language and read by several threads
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapManagerTest, HapManagerFuncTest005, TestSize.Level1)
+{
+    ResConfig *rcEn = CreateResConfig();
+    ResConfig *rcPl = CreateResConfig();
+    HapManager *hapManager = new HapManager(new ResConfigImpl);
+    if (rcEn == nullptr || rcPl == nullptr || hapManager == nullptr) {
+        delete (hapManager);
+        delete (rcPl);
+        delete (rcEn);
+        ASSERT_TRUE(false);
+    }
+    rcEn->SetLocaleInfo("en", nullptr, "US");
+    rcPl->SetLocaleInfo("pl", nullptr, "PL");
+    EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig(*rcEn));
+    const HapManager::PluralRules *enRules = nullptr;
+    {
+        HapManager::SnapshotGuard snapshot(hapManager);
+        EXPECT_EQ(OHOS::I18N::PluralRuleType::ONE, hapManager->GetPluralRule(snapshot.Get(), 1));
+        EXPECT_EQ(OHOS::I18N::PluralRuleType::OTHER, hapManager->GetPluralRule(snapshot.Get(), 5));
+        // out of the memo
+        EXPECT_EQ(OHOS::I18N::PluralRuleType::OTHER, hapManager->GetPluralRule(snapshot.Get(), 100001));
+        enRules = snapshot->pluralRules_.load();
+        EXPECT_TRUE(enRules != nullptr);
+    }
+
+    EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig(*rcPl));
+    {
+        HapManager::SnapshotGuard snapshot(hapManager);
+        EXPECT_TRUE(snapshot->pluralRules_.load() == nullptr);
+        EXPECT_EQ(OHOS::I18N::PluralRuleType::FEW, hapManager->GetPluralRule(snapshot.Get(), 22));
+        EXPECT_EQ(OHOS::I18N::PluralRuleType::MANY, hapManager->GetPluralRule(snapshot.Get(), 12));
+    }
+
+    // the rules of a language met before are reused
+    EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig(*rcEn));
+    std::atomic<int> mismatchCount(0);
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i) {
+        readers.push_back(std::thread([hapManager, &mismatchCount]() {
+            for (int quantity = 0; quantity < 2000; ++quantity) {
+                HapManager::SnapshotGuard snapshot(hapManager);
+                OHOS::I18N::PluralRuleType expect = (quantity == 1) ? OHOS::I18N::PluralRuleType::ONE :
+                    OHOS::I18N::PluralRuleType::OTHER;
+                if (hapManager->GetPluralRule(snapshot.Get(), quantity) != expect) {
+                    ++mismatchCount;
+                }
+            }
+        }));
+    }
+    for (size_t i = 0; i < readers.size(); ++i) {
+        readers[i].join();
+    }
+    EXPECT_EQ(0, mismatchCount.load());
+    EXPECT_EQ(enRules, hapManager->snapshot_.load()->pluralRules_.load());
+    EXPECT_EQ(static_cast<size_t>(2), hapManager->pluralRulesCache_.size());
+
+    delete (hapManager);
+    delete (rcPl);
+    delete (rcEn);
+}
+
+/*
+ * @tc.name: HapManagerFuncTest006
+ * @tc.desc: Test UpdateResConfig with an unchanged config keeps the snapshot and its haps
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapManagerTest, HapManagerFuncTest006, TestSize.Level1)
+{
+    ResConfig *rc = CreateResConfig();
+    ResConfig *same = CreateResConfig();
+    HapManager *hapManager = new HapManager(new ResConfigImpl);
+    if (rc == nullptr || same == nullptr || hapManager == nullptr) {
+        delete (hapManager);
+        delete (same);
+        delete (rc);
+        ASSERT_TRUE(false);
+    }
+    rc->SetLocaleInfo("en", nullptr, "US");
+    rc->SetDirection(DIRECTION_VERTICAL);
+    same->SetLocaleInfo("en", nullptr, "US");
+    same->SetDirection(DIRECTION_VERTICAL);
+    EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig(*rc));
+    EXPECT_TRUE(hapManager->AddResource(FormatFullPath(g_resFilePath).c_str()));
+    const HapManager::Snapshot *snapshot = hapManager->snapshot_.load();
+
+    EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig(*same));
+    EXPECT_EQ(snapshot, hapManager->snapshot_.load());
+
+    // the replaced snapshot is freed at once, since no reader holds it
+    uint32_t epoch = snapshot->GetEpoch();
+    same->SetDirection(DIRECTION_HORIZONTAL);
+    EXPECT_EQ(SUCCESS, hapManager->UpdateResConfig(*same));
+    EXPECT_EQ(epoch + 1, hapManager->snapshot_.load()->GetEpoch());
+    EXPECT_EQ(DIRECTION_HORIZONTAL, hapManager->snapshot_.load()->GetResConfig()->GetDirection());
+
+    delete (hapManager);
+    delete (same);
+    delete (rc);
+}
+
+/*
+ * this test shows readers racing to cache a flattened map of one snapshot all get the map cached first
+ * @tc.name: HapManagerFuncTest007
+ * @tc.desc: Test GetFlattenedMap & PutFlattenedMap function, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(HapManagerTest, HapManagerFuncTest007, TestSize.Level1)
+{
+    HapManager *hapManager = new HapManager(new ResConfigImpl);
+    ASSERT_TRUE(hapManager->AddResource(FormatFullPath(g_resFilePath).c_str()));
+    {
+        HapManager::SnapshotGuard snapshot(hapManager);
+        const IdItem *idItem = snapshot->FindResourceByName("base", ResType::PATTERN);
+        ASSERT_TRUE(idItem != nullptr);
+        EXPECT_TRUE(snapshot->GetFlattenedMap(idItem) == nullptr);
+
+        const int threadCount = 4;
+        std::vector<std::shared_ptr<const std::map<std::string, std::string>>> results(threadCount);
+        std::vector<std::thread> threads;
+        for (int i = 0; i < threadCount; ++i) {
+            threads.push_back(std::thread([&snapshot, idItem, &results, i]() {
+                std::shared_ptr<const std::map<std::string, std::string>> flattened(
+                    new std::map<std::string, std::string>());
+                results[i] = snapshot->PutFlattenedMap(idItem, flattened);
+            }));
+        }
+        for (int i = 0; i < threadCount; ++i) {
+            threads[i].join();
+        }
+        for (int i = 0; i < threadCount; ++i) {
+            EXPECT_EQ(results[0], results[i]);
+        }
+        EXPECT_EQ(results[0], snapshot->GetFlattenedMap(idItem));
+    }
+    delete hapManager;
+}
 }
\ No newline at end of file
@@ -18,5 +18,10 @@
 
 int HapManagerFuncTest001(void);
 int HapManagerFuncTest002(void);
+int HapManagerFuncTest003(void);
+int HapManagerFuncTest004(void);
+int HapManagerFuncTest005(void);
+int HapManagerFuncTest006(void);
+int HapManagerFuncTest007(void);
 
 #endif
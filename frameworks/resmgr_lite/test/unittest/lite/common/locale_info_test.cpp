@@ -14,10 +14,12 @@
  */
 #include "locale_info_test.h"
 
+#include <atomic>
 #include <chrono>
 #include <climits>
 #include <cstring>
 #include <gtest/gtest.h>
+#include <thread>
 
 #include "hilog_wrapper.h"
 #include "locale_info.h"
@@ -164,6 +166,31 @@ HWTEST_F(LocaleInfoTest, LocaleInfoFindAndSortTest005, TestSize.Level1)
     EXPECT_TRUE(outValue.at(4) == "");
 }
 
+/*
+ * @tc.name: LocaleInfoFindAndSortTest006
+ * @tc.desc: Test FindAndSort of pre-parsed locales
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleInfoTest, LocaleInfoFindAndSortTest006, TestSize.Level1)
+{
+    std::vector<LocaleInfo> request;
+    std::vector<size_t> outValue;
+    request.push_back(LocaleInfo("en", nullptr));
+    request.push_back(LocaleInfo("en", "CN"));
+    request.push_back(LocaleInfo("zh", "CN"));
+    request.push_back(LocaleInfo("en", "US"));
+    request.push_back(LocaleInfo("en", "GB"));
+    request.push_back(LocaleInfo());
+    LocaleInfo current("en", "US");
+    FindAndSort(current, request, outValue);
+    ASSERT_EQ(5u, outValue.size());
+    EXPECT_EQ(3u, outValue.at(0));
+    EXPECT_EQ(0u, outValue.at(1));
+    EXPECT_EQ(5u, outValue.at(2));
+    EXPECT_EQ(1u, outValue.at(3));
+    EXPECT_EQ(4u, outValue.at(4));
+}
+
 /*
  * @tc.name: LocaleInfoGetSysDefaultTest001
  * @tc.desc: Test GetSysDefault
@@ -236,6 +263,45 @@ HWTEST_F(LocaleInfoTest, LocaleInfoUpdateSysDefaultTest001, TestSize.Level1)
     localeInfo = nullptr;
 }
 
+/*
+ * @tc.name: LocaleInfoUpdateSysDefaultTest002
+ * @tc.desc: Test GetSysDefault while UpdateSysDefault runs, a returned default stays valid and locales are reused
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleInfoTest, LocaleInfoUpdateSysDefaultTest002, TestSize.Level1)
+{
+    LocaleInfo zh("zh", "Hans", "CN");
+    LocaleInfo en("en", nullptr, "US");
+    UpdateSysDefault(zh, false);
+    const LocaleInfo *first = GetSysDefault();
+    ASSERT_TRUE(first != nullptr);
+
+    std::atomic<bool> stop(false);
+    std::atomic<int> badCount(0);
+    std::thread reader([&stop, &badCount]() {
+        while (!stop.load()) {
+            const LocaleInfo *current = GetSysDefault();
+            if (current == nullptr || (std::strcmp("zh", current->GetLanguage()) != 0 &&
+                std::strcmp("en", current->GetLanguage()) != 0)) {
+                ++badCount;
+            }
+        }
+    });
+    for (int i = 0; i < 1000; ++i) {
+        UpdateSysDefault((i % 2 == 0) ? en : zh, false);
+    }
+    stop.store(true);
+    reader.join();
+    EXPECT_EQ(0, badCount.load());
+
+    // the same locale is published again, and the first default is still readable
+    EXPECT_EQ(first, GetSysDefault());
+    EXPECT_TRUE(std::strcmp("CN", first->GetRegion()) == 0);
+    UpdateSysDefault(en, false);
+    EXPECT_TRUE(std::strcmp("US", GetSysDefault()->GetRegion()) == 0);
+    EXPECT_TRUE(std::strcmp("Hans", first->GetScript()) == 0);
+}
+
 /*
  * @tc.name: LocaleInfoGetLanguageTest001
  * @tc.desc: Test LocaleInfo GetLanguage
@@ -590,4 +656,33 @@ HWTEST_F(LocaleInfoTest, LocaleInfoPerformanceFuncTest001, TestSize.Level1)
     HILOG_DEBUG("avg cost FindAndSort: %f us", average);
     EXPECT_LT(average, 500);
 };
+
+/*
+ * @tc.name: LocaleInfoPerformanceFuncTest002
+ * @tc.desc: Test FindAndSort Performance of a long candidate list
+ * @tc.type: FUNC
+ */
+HWTEST_F(LocaleInfoTest, LocaleInfoPerformanceFuncTest002, TestSize.Level1)
+{
+    std::vector<std::string> request;
+    for (char first = 'A'; first <= 'Z' && request.size() < 300; ++first) {
+        for (char second = 'A'; second <= 'Z' && request.size() < 300; ++second) {
+            request.push_back(std::string("en-") + first + second);
+        }
+    }
+    unsigned long long total = 0;
+    double average = 0;
+    for (int k = 0; k < 100; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        std::vector<std::string> outValue;
+        FindAndSort("en-GB", request, outValue);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+        EXPECT_EQ(request.size(), outValue.size());
+        EXPECT_EQ("en-GB", outValue.at(0));
+    }
+    average = total / 100.0;
+    HILOG_DEBUG("avg cost FindAndSort of 300 candidates: %f us", average);
+    EXPECT_LT(average, 5000);
+};
 }
\ No newline at end of file
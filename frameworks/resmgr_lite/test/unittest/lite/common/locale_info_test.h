@@ -21,7 +21,9 @@ int LocaleInfoFindAndSortTest002(void);
 int LocaleInfoFindAndSortTest003(void);
 int LocaleInfoFindAndSortTest004(void);
 int LocaleInfoFindAndSortTest005(void);
+int LocaleInfoFindAndSortTest006(void);
 int LocaleInfoUpdateSysDefaultTest001(void);
+int LocaleInfoUpdateSysDefaultTest002(void);
 int LocaleInfoGetSysDefaultTest001(void);
 int LocaleInfoGetLanguageTest001(void);
 int LocaleInfoGetRegionTest001(void);
@@ -43,5 +45,6 @@ int LocaleInfoBuildFromStringTest008(void);
 int LocaleInfoBuildFromStringTest009(void);
 int LocaleInfoBuildFromStringTest0010(void);
 int LocaleInfoPerformanceFuncTest001(void);
+int LocaleInfoPerformanceFuncTest002(void);
 
 #endif // RESOURCE_MANAGER_LOCALE_INFO_TEST_H
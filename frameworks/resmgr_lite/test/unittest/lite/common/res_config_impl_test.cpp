@@ -17,9 +17,15 @@
 #include <climits>
 #include <cstring>
 #include <gtest/gtest.h>
+#include <string>
+#include <vector>
 
+#include "locale_matcher.h"
+#include "qualifier_matcher.h"
 #include "res_config_impl.h"
 #include "test_common.h"
+#include "utils/compact_locale_data.h"
+#include "utils/utils.h"
 
 using namespace OHOS::Global::Resource;
 using namespace testing::ext;
@@ -60,6 +66,88 @@ ResConfigImpl *CreateResConfigImpl(const char *language, const char *script, con
     return resConfigImpl;
 }
 
+std::string DecodeLanguageOrRegion(uint16_t code, char base)
+{
+    std::string out;
+    if ((code & 0x8000) == 0) {
+        out.push_back(static_cast<char>(code >> 8));
+        out.push_back(static_cast<char>(code & 0xff));
+        return out;
+    }
+    out.push_back(static_cast<char>(base + ((code >> 10) & 0x1f)));
+    out.push_back(static_cast<char>(base + ((code >> 5) & 0x1f)));
+    out.push_back(static_cast<char>(base + (code & 0x1f)));
+    return out;
+}
+
+// build the locale the way SetLocaleInfo does, skip it if it is invalid or already added
+void AddLocale(const std::string &language, const std::string &script, const std::string &region,
+    std::vector<ResLocale> &locales)
+{
+    ResLocale locale;
+    if (ResLocale::BuildFromParts(language.c_str(), script.c_str(), region.c_str(), locale) != SUCCESS) {
+        return;
+    }
+    LocaleMatcher::Normalize(&locale);
+    for (size_t i = 0; i < locales.size(); ++i) {
+        if (locales[i].GetEncodedLocale() == locale.GetEncodedLocale() &&
+            locales[i].GetEncodedLanguage() == locale.GetEncodedLanguage()) {
+            return;
+        }
+    }
+    locales.push_back(locale);
+}
+
+void AddPackedLocale(uint32_t packedLocale, std::vector<ResLocale> &locales)
+{
+    uint16_t language = static_cast<uint16_t>(packedLocale >> 16);
+    uint32_t script = SCRIPT_CODES[(packedLocale >> 8) & 0xff];
+    uint16_t region = REGION_CODES[packedLocale & 0xff];
+    if (language == 0) {
+        return;
+    }
+    std::string scriptStr;
+    if (script != 0) {
+        char temp[SCRIPT_ARRAY_LEN] = { 0 };
+        Utils::DecodeScript(script, temp);
+        scriptStr = temp;
+    }
+    std::string languageStr = DecodeLanguageOrRegion(language, 'a');
+    std::string regionStr = (region == 0) ? "" : DecodeLanguageOrRegion(region, '0');
+    AddLocale(languageStr, scriptStr, regionStr, locales);
+    // the language alone, and without the script to have it normalized
+    AddLocale(languageStr, "", "", locales);
+    AddLocale(languageStr, "", regionStr, locales);
+}
+
+// every locale of the locale matching tables
+void CollectTableLocales(std::vector<ResLocale> &locales)
+{
+    for (size_t i = 0; i < sizeof(LIKELY_TAGS_LANGUAGE_KEY) / sizeof(LIKELY_TAGS_LANGUAGE_KEY[0]); ++i) {
+        uint32_t language = static_cast<uint32_t>(LIKELY_TAGS_LANGUAGE_KEY[i]) << 16;
+        AddPackedLocale(language | LIKELY_TAGS_LANGUAGE_VALUE[i], locales);
+    }
+    for (size_t i = 0; i < sizeof(LIKELY_TAGS_LOCALE_KEY) / sizeof(LIKELY_TAGS_LOCALE_KEY[0]); ++i) {
+        AddPackedLocale(LIKELY_TAGS_LOCALE_KEY[i], locales);
+        AddPackedLocale((LIKELY_TAGS_LOCALE_KEY[i] & 0xffff0000) | LIKELY_TAGS_LOCALE_VALUE[i], locales);
+    }
+    for (size_t i = 0; i < sizeof(LOCALE_PARENTS_KEY) / sizeof(LOCALE_PARENTS_KEY[0]); ++i) {
+        AddPackedLocale(LOCALE_PARENTS_KEY[i], locales);
+        AddPackedLocale(LOCALE_PARENTS_VALUE[i], locales);
+    }
+    for (size_t i = 0; i < sizeof(TYPICAL_CODES_VALUE) / sizeof(TYPICAL_CODES_VALUE[0]); ++i) {
+        AddPackedLocale(TYPICAL_CODES_VALUE[i], locales);
+    }
+    // the special cases of IsMoreSuitable, and the old language codes
+    const char *extraLocales[][3] = {
+        { "en", "Qaag", "" }, { "en", "Qaag", "GB" }, { "en", "Qaag", "US" }, { "iw", "", "IL" }, { "tl", "", "PH" },
+        { "ji", "", "" }, { "jw", "", "ID" }, { "in", "", "ID" }, { "zh", "Hant", "MO" },
+    };
+    for (size_t i = 0; i < sizeof(extraLocales) / sizeof(extraLocales[0]); ++i) {
+        AddLocale(extraLocales[i][0], extraLocales[i][1], extraLocales[i][2], locales);
+    }
+}
+
 /*
  * @tc.name: ResConfigImplMatchTest001
  * @tc.desc: Test ResConfig Match
@@ -1393,4 +1481,217 @@ HWTEST_F(ResConfigImplTest, ResConfigImplIsMoreSuitableTest050, TestSize.Level1)
     delete current;
     delete other;
 }
-}
\ No newline at end of file
+
+/*
+ * @tc.name: ResConfigImplGetResLocaleTest001
+ * @tc.desc: Test the encoded tags of ResLocale follow the tags, including the script filled by Normalize
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResConfigImplTest, ResConfigImplGetResLocaleTest001, TestSize.Level1)
+{
+    ResConfigImpl *config = CreateResConfigImpl("zh", nullptr, "TW");
+    const ResLocale *resLocale = config->GetResLocale();
+    ASSERT_TRUE(resLocale != nullptr);
+    EXPECT_EQ(Utils::EncodeLanguage("zh"), resLocale->GetEncodedLanguage());
+    EXPECT_EQ(Utils::EncodeScript("Hant"), resLocale->GetEncodedScript());
+    EXPECT_EQ(Utils::EncodeRegion("TW"), resLocale->GetEncodedRegion());
+    EXPECT_EQ(Utils::EncodeLocale("zh", "Hant", "TW"), resLocale->GetEncodedLocale());
+
+    config->SetLocaleInfo("en", "Qaag", nullptr);
+    resLocale = config->GetResLocale();
+    ASSERT_TRUE(resLocale != nullptr);
+    EXPECT_EQ(Utils::EncodeLocale("en", "Qaag", nullptr), resLocale->GetEncodedLocale());
+    EXPECT_EQ(0, resLocale->GetEncodedRegion());
+    delete config;
+}
+
+/*
+ * @tc.name: ResConfigImplCopyLocaleTest001
+ * @tc.desc: Test the ResLocale is copied by value and the LocaleInfo follows the locale
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResConfigImplTest, ResConfigImplCopyLocaleTest001, TestSize.Level1)
+{
+    ResConfigImpl *config = CreateResConfigImpl("zh", nullptr, "TW");
+    ResLocale resLocale = *config->GetResLocale();
+    EXPECT_TRUE(std::strcmp("Hant", resLocale.GetScript()) == 0);
+    EXPECT_EQ(config->GetResLocale()->GetEncodedLocale(), resLocale.GetEncodedLocale());
+
+    ResConfigImpl *other = CreateResConfigImpl(nullptr, nullptr, nullptr);
+    EXPECT_TRUE(other->GetResLocale() == nullptr);
+    EXPECT_TRUE(other->GetLocaleInfo() == nullptr);
+    EXPECT_TRUE(other->Copy(*config));
+    EXPECT_EQ(resLocale.GetEncodedLocale(), other->GetResLocale()->GetEncodedLocale());
+    const LocaleInfo *localeInfo = other->GetLocaleInfo();
+    ASSERT_TRUE(localeInfo != nullptr);
+    EXPECT_TRUE(std::strcmp("zh", localeInfo->GetLanguage()) == 0);
+    EXPECT_TRUE(std::strcmp("Hant", localeInfo->GetScript()) == 0);
+    EXPECT_TRUE(std::strcmp("TW", localeInfo->GetRegion()) == 0);
+    EXPECT_EQ(localeInfo, other->GetLocaleInfo());
+
+    EXPECT_EQ(INVALID_BCP47_REGION_SUBTAG, config->SetLocaleInfo("en", nullptr, "USA"));
+    EXPECT_EQ(resLocale.GetEncodedLocale(), config->GetResLocale()->GetEncodedLocale());
+    config->SetLocaleInfo(nullptr, nullptr, nullptr);
+    EXPECT_TRUE(other->Copy(*config));
+    EXPECT_TRUE(other->GetResLocale() == nullptr);
+    EXPECT_TRUE(other->GetLocaleInfo() == nullptr);
+    delete other;
+    delete config;
+}
+
+/*
+ * @tc.name: ResConfigImplComputeSuitabilityTest001
+ * @tc.desc: Test the suitability scores order every pair of matching table locales as IsMoreSuitable does,
+ *           for every table locale as request
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResConfigImplTest, ResConfigImplComputeSuitabilityTest001, TestSize.Level1)
+{
+    std::vector<ResLocale> locales;
+    CollectTableLocales(locales);
+    size_t mismatchCount = 0;
+    size_t pairCount = 0;
+    std::vector<const ResLocale *> candidates;
+    std::vector<uint32_t> scores;
+    for (size_t r = 0; r < locales.size(); ++r) {
+        const ResLocale *request = &locales[r];
+        candidates.clear();
+        scores.clear();
+        for (size_t i = 0; i < locales.size(); ++i) {
+            if (LocaleMatcher::Match(request, &locales[i])) {
+                candidates.push_back(&locales[i]);
+                scores.push_back(LocaleMatcher::ComputeSuitability(&locales[i], request));
+            }
+        }
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            for (size_t j = i + 1; j < candidates.size(); ++j) {
+                int8_t expected = LocaleMatcher::IsMoreSuitable(candidates[i], candidates[j], request);
+                int8_t actual = (scores[i] > scores[j]) ? 1 : ((scores[i] < scores[j]) ? -1 : 0);
+                if (expected != actual && ++mismatchCount <= 10) {
+                    ADD_FAILURE() << "request " << request->GetLanguage() << "-" <<
+                        (request->GetScript() == nullptr ? "" : request->GetScript()) << "-" <<
+                        (request->GetRegion() == nullptr ? "" : request->GetRegion()) << ", candidates " <<
+                        i << ", " << j << ", IsMoreSuitable " << static_cast<int>(expected);
+                }
+                ++pairCount;
+            }
+        }
+    }
+    EXPECT_GT(pairCount, 0u);
+    EXPECT_EQ(0u, mismatchCount);
+}
+
+/*
+ * @tc.name: ResConfigImplQualifierMatcherTest001
+ * @tc.desc: Test QualifierMatcher matches the same candidates as ResConfigImpl::Match, for candidates with and
+ *           without locale, script, direction and device type, across several blocks
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResConfigImplTest, ResConfigImplQualifierMatcherTest001, TestSize.Level1)
+{
+    // xx and qq have no default script, iw and he, in and id are old and new codes of a language
+    const char *locales[][3] = {
+        { nullptr, nullptr, nullptr }, { "en", nullptr, nullptr }, { "en", nullptr, "US" }, { "en", nullptr, "GB" },
+        { "en", "Latn", nullptr }, { "en", "Qaag", nullptr }, { "en", "Qaag", "GB" }, { "en", "Cyrl", nullptr },
+        { "zh", nullptr, nullptr }, { "zh", nullptr, "TW" }, { "zh", "Hans", "CN" }, { "zh", "Hant", nullptr },
+        { "iw", nullptr, nullptr }, { "he", nullptr, "IL" }, { "in", nullptr, nullptr }, { "id", nullptr, "ID" },
+        { "xx", nullptr, nullptr }, { "xx", nullptr, "US" }, { "qq", nullptr, "GB" }, { "xx", "Latn", nullptr },
+        { "sr", "Latn", "RS" }, { "sr", nullptr, nullptr }, { "es", nullptr, "419" }, { "es", nullptr, nullptr },
+    };
+    const Direction directions[] = { DIRECTION_NOT_SET, DIRECTION_VERTICAL, DIRECTION_HORIZONTAL };
+    const DeviceType deviceTypes[] = { DEVICE_NOT_SET, DEVICE_PHONE, DEVICE_TV };
+    std::vector<ResConfigImpl *> configs;
+    for (size_t i = 0; i < sizeof(locales) / sizeof(locales[0]); ++i) {
+        for (size_t j = 0; j < sizeof(directions) / sizeof(directions[0]); ++j) {
+            ResConfigImpl *config = CreateResConfigImpl(locales[i][0], locales[i][1], locales[i][2]);
+            config->SetDirection(directions[j]);
+            config->SetDeviceType(deviceTypes[(i + j) % (sizeof(deviceTypes) / sizeof(deviceTypes[0]))]);
+            configs.push_back(config);
+        }
+    }
+    QualifierMatcher matcher;
+    for (size_t i = 0; i < configs.size(); ++i) {
+        matcher.Add(configs[i]);
+    }
+    matcher.Add(nullptr);
+    ASSERT_EQ(configs.size() + 1, matcher.Size());
+    ASSERT_GT(matcher.Size(), QualifierMatcher::BLOCK_SIZE);
+    size_t matchCount = 0;
+    for (size_t r = 0; r < configs.size(); ++r) {
+        QualifierMatcher::Request request;
+        QualifierMatcher::MakeRequest(configs[r], request);
+        for (size_t begin = 0; begin < matcher.Size(); begin += QualifierMatcher::BLOCK_SIZE) {
+            uint64_t matched = matcher.Match(request, begin);
+            for (size_t i = begin; i < begin + QualifierMatcher::BLOCK_SIZE; ++i) {
+                bool expected = (i < configs.size()) && configs[r]->Match(configs[i]);
+                bool actual = ((matched >> (i - begin)) & 1) != 0;
+                EXPECT_EQ(expected, actual) << "request " << r << ", candidate " << i;
+                matchCount += actual ? 1 : 0;
+            }
+        }
+    }
+    EXPECT_GT(matchCount, configs.size());
+    for (size_t i = 0; i < configs.size(); ++i) {
+        delete configs[i];
+    }
+}
+
+/*
+ * @tc.name: ResConfigImplKeyTest001
+ * @tc.desc: Test GetKey & SetKey function, keys are equal exactly when the qualifiers are
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResConfigImplTest, ResConfigImplKeyTest001, TestSize.Level1)
+{
+    ResConfigImpl *config = CreateResConfigImpl("zh", "Hant", "TW");
+    config->SetDirection(DIRECTION_HORIZONTAL);
+    config->SetDeviceType(DEVICE_TV);
+    config->SetScreenDensity(SCREEN_DENSITY_XXXLDPI);
+    ResConfigKey key = config->GetKey();
+    EXPECT_EQ(config->GetResLocale()->GetEncodedLocale(), key.GetEncodedLocale());
+    EXPECT_EQ(DIRECTION_HORIZONTAL, key.GetDirection());
+    EXPECT_EQ(DEVICE_TV, key.GetDeviceType());
+    EXPECT_EQ(SCREEN_DENSITY_XXXLDPI, key.GetScreenDensity());
+    EXPECT_EQ(ResConfigKey::NOT_SET, key.GetNightMode());
+    EXPECT_EQ(ResConfigKey::NOT_SET, key.GetMcc());
+    EXPECT_EQ(ResConfigKey::NOT_SET, key.GetMnc());
+
+    // three letters language and three digits region, without script
+    ResConfigImpl *other = CreateResConfigImpl("fil", nullptr, "419");
+    EXPECT_TRUE(key != other->GetKey());
+    ResConfigKey otherKey = other->GetKey();
+    EXPECT_EQ(SUCCESS, other->SetKey(key));
+    EXPECT_TRUE(key == other->GetKey());
+    EXPECT_EQ(std::string("zh"), other->GetResLocale()->GetLanguage());
+    EXPECT_EQ(std::string("Hant"), other->GetResLocale()->GetScript());
+    EXPECT_EQ(std::string("TW"), other->GetResLocale()->GetRegion());
+    EXPECT_EQ(std::string("zh"), other->GetLocaleInfo()->GetLanguage());
+    EXPECT_EQ(SUCCESS, config->SetKey(otherKey));
+    EXPECT_TRUE(otherKey == config->GetKey());
+    EXPECT_EQ(std::string("fil"), config->GetResLocale()->GetLanguage());
+    EXPECT_EQ(std::string("419"), config->GetResLocale()->GetRegion());
+    EXPECT_EQ(ResConfigKey::Hash()(otherKey), ResConfigKey::Hash()(config->GetKey()));
+
+    // one qualifier differs
+    other->SetScreenDensity(SCREEN_DENSITY_SDPI);
+    EXPECT_TRUE(key != other->GetKey());
+    ResConfigKey reserved = key;
+    reserved.SetNightMode(DARK);
+    reserved.SetMcc(460);
+    reserved.SetMnc(0);
+    EXPECT_TRUE(key != reserved);
+    EXPECT_EQ(DARK, reserved.GetNightMode());
+    EXPECT_EQ(460, reserved.GetMcc());
+    EXPECT_EQ(0, reserved.GetMnc());
+    EXPECT_EQ(key.GetEncodedLocale(), reserved.GetEncodedLocale());
+    EXPECT_EQ(DIRECTION_HORIZONTAL, reserved.GetDirection());
+
+    // no locale
+    EXPECT_EQ(SUCCESS, other->SetKey(ResConfigKey()));
+    EXPECT_TRUE(other->GetResLocale() == nullptr);
+    EXPECT_EQ(DIRECTION_NOT_SET, other->GetDirection());
+    EXPECT_TRUE(ResConfigImpl().GetKey() == ResConfigKey());
+    delete other;
+    delete config;
+}
+}
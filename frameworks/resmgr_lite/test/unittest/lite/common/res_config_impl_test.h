@@ -95,5 +95,10 @@ int ResConfigImplIsMoreSuitableTest047(void);
 int ResConfigImplIsMoreSuitableTest048(void);
 int ResConfigImplIsMoreSuitableTest049(void);
 int ResConfigImplIsMoreSuitableTest050(void);
+int ResConfigImplGetResLocaleTest001(void);
+int ResConfigImplCopyLocaleTest001(void);
+int ResConfigImplComputeSuitabilityTest001(void);
+int ResConfigImplQualifierMatcherTest001(void);
+int ResConfigImplKeyTest001(void);
 
 #endif
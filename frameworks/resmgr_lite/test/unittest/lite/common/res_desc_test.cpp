@@ -154,4 +154,111 @@ HWTEST_F(ResDescTest, ResDescFuncTest002, TestSize.Level1)
     TestKeyParam(KeyType::SCREEN_DENSITY, ScreenDensity::SCREEN_DENSITY_XXXLDPI, RE_640_STR);
     TestKeyParam(KeyType::SCREEN_DENSITY, ScreenDensity::SCREEN_DENSITY_NOT_SET, "not_screen_density");
 }
-}
\ No newline at end of file
+
+/*
+ * @tc.name: ResDescFuncTest003
+ * @tc.desc: Test InitPluralForms and GetPluralValue function, non file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResDescTest, ResDescFuncTest003, TestSize.Level1)
+{
+    IdItem idItem;
+    idItem.resType_ = ResType::PLURALS;
+    idItem.values_ = { "one", "%d apple", "few", "$string:123456", "one", "%d apples twice", "other", "%d apples" };
+    idItem.InitPluralForms();
+    // zero, one, two, few, many, other
+    EXPECT_EQ(7, idItem.GetPluralIndex(0));
+    EXPECT_EQ(1, idItem.GetPluralIndex(1));
+    EXPECT_EQ(7, idItem.GetPluralIndex(2));
+    EXPECT_EQ(3, idItem.GetPluralIndex(3));
+    EXPECT_EQ(7, idItem.GetPluralIndex(4));
+    EXPECT_EQ(7, idItem.GetPluralIndex(5));
+    EXPECT_EQ(7, idItem.GetPluralIndex(IdItem::PLURAL_CATEGORY_COUNT));
+
+    IdItem noOther;
+    noOther.resType_ = ResType::PLURALS;
+    noOther.values_ = { "one", "%d apple" };
+    noOther.InitPluralForms();
+    EXPECT_EQ(1, noOther.GetPluralIndex(1));
+    EXPECT_EQ(-1, noOther.GetPluralIndex(5));
+}
+
+/*
+ * @tc.name: ResDescFuncTest004
+ * @tc.desc: Test InitValueRefs function, non file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResDescTest, ResDescFuncTest004, TestSize.Level1)
+{
+    IdItem literal;
+    literal.value_ = "$abc:123456";
+    literal.values_ = { "abc", "$string:" };
+    literal.InitValueRefs();
+    EXPECT_EQ(static_cast<uint32_t>(0), literal.valueRef_.id_);
+    EXPECT_TRUE(literal.valueRefs_.empty());
+    EXPECT_EQ(static_cast<uint32_t>(0), literal.GetValueRef(1).id_);
+
+    IdItem ref;
+    ref.value_ = "$color:66666";
+    ref.values_ = { "$theme:99999", "abc", "$integer:2008168" };
+    ref.InitValueRefs();
+    EXPECT_EQ(ResType::COLOR, ref.valueRef_.resType_);
+    EXPECT_EQ(static_cast<uint32_t>(66666), ref.valueRef_.id_);
+    EXPECT_EQ(static_cast<size_t>(3), ref.valueRefs_.size());
+    EXPECT_EQ(ResType::THEME, ref.GetValueRef(0).resType_);
+    EXPECT_EQ(static_cast<uint32_t>(99999), ref.GetValueRef(0).id_);
+    EXPECT_EQ(static_cast<uint32_t>(0), ref.GetValueRef(1).id_);
+    EXPECT_EQ(ResType::INTEGER, ref.GetValueRef(2).resType_);
+    EXPECT_EQ(static_cast<uint32_t>(2008168), ref.GetValueRef(2).id_);
+    EXPECT_EQ(static_cast<uint32_t>(0), ref.GetValueRef(3).id_);
+}
+
+/*
+ * @tc.name: ResDescFuncTest005
+ * @tc.desc: Test DecodeValues function, non file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResDescTest, ResDescFuncTest005, TestSize.Level1)
+{
+    IdItem integer;
+    integer.resType_ = ResType::INTEGER;
+    integer.value_ = "-101";
+    integer.DecodeValues();
+    EXPECT_EQ(SUCCESS, integer.decodeState_);
+    EXPECT_EQ(-101, integer.typedValue_.intValue_);
+
+    IdItem color;
+    color.resType_ = ResType::COLOR;
+    color.value_ = "#F5F5F5";
+    color.DecodeValues();
+    EXPECT_EQ(SUCCESS, color.decodeState_);
+    EXPECT_EQ(static_cast<uint32_t>(0xFFF5F5F5), color.typedValue_.colorValue_);
+
+    IdItem boolean;
+    boolean.resType_ = ResType::BOOLEAN;
+    boolean.value_ = "yes";
+    boolean.DecodeValues();
+    EXPECT_NE(SUCCESS, boolean.decodeState_);
+
+    // a reference is decoded where it is resolved
+    IdItem ref;
+    ref.resType_ = ResType::FLOAT;
+    ref.value_ = "$float:100002";
+    ref.InitValueRefs();
+    ref.DecodeValues();
+    EXPECT_EQ(NOT_FOUND, ref.decodeState_);
+
+    IdItem intArray;
+    intArray.resType_ = ResType::INTARRAY;
+    intArray.values_ = { "1", "-2", "3" };
+    intArray.DecodeValues();
+    ASSERT_EQ(static_cast<size_t>(3), intArray.intValues_.size());
+    EXPECT_EQ(-2, intArray.intValues_[1]);
+
+    IdItem invalidArray;
+    invalidArray.resType_ = ResType::INTARRAY;
+    invalidArray.values_ = { "1", "abc" };
+    invalidArray.DecodeValues();
+    EXPECT_TRUE(invalidArray.intValues_.empty());
+}
+}
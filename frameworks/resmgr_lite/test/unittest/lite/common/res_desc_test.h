@@ -18,5 +18,8 @@
 
 int ResDescFuncTest001(void);
 int ResDescFuncTest002(void);
+int ResDescFuncTest003(void);
+int ResDescFuncTest004(void);
+int ResDescFuncTest005(void);
 
 #endif
@@ -60,7 +60,8 @@ public:
 
 int ResourceManagerPerformanceTest::GetResId(std::string name, ResType resType) const
 {
-    auto idv = ((ResourceManagerImpl *)rm)->hapManager_->GetResourceListByName(name.c_str(), resType);
+    HapManager::SnapshotGuard snapshot(((ResourceManagerImpl *)rm)->hapManager_);
+    auto idv = snapshot->GetResourceListByName(name.c_str(), resType);
     if (idv == nullptr) {
         return -1;
     }
@@ -164,7 +165,7 @@ int TestLoadFromIndex(const char *filePath)
             HILOG_DEBUG("ParseResHex success:\n%s", resDesc->ToString().c_str());
         }
 
-        HapResource *pResource = new(std::nothrow) HapResource(pstr, 0, nullptr, resDesc);
+        HapResource *pResource = new(std::nothrow) HapResource(pstr, FileStamp(), nullptr, resDesc);
         if (pResource == nullptr) {
             HILOG_ERROR("new HapResource failed when LoadFromIndex");
             delete (resDesc);
@@ -1086,4 +1087,171 @@ HWTEST_F(ResourceManagerPerformanceTest, ResourceManagerPerformanceFuncTest032,
     HILOG_DEBUG("avg cost 032: %f us", average);
     EXPECT_LT(average, 100);
 };
+
+/*
+ * @tc.name: ResourceManagerPerformanceFuncTest033
+ * @tc.desc: Test GetStringsByIds and GetResourcesByIds against single getters
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerPerformanceTest, ResourceManagerPerformanceFuncTest033, TestSize.Level1)
+{
+    if (rm == nullptr) {
+        ASSERT_TRUE(false);
+    }
+    const int count = 100;
+    string name[] = {"app_name", "title"};
+    uint32_t ids[count];
+    for (int i = 0; i < count; ++i) {
+        int id = GetResId(name[i % 2], ResType::STRING);
+        ASSERT_TRUE(id > 0);
+        ids[i] = static_cast<uint32_t>(id);
+    }
+    // the typed batch mixes every type it supports
+    const int typeCount = 5;
+    string typedName[typeCount] = {"app_name", "eat_apple", "integer_1", "boolean_1", "divider_color"};
+    ResType types[typeCount] = {ResType::STRING, ResType::PLURALS, ResType::INTEGER, ResType::BOOLEAN,
+        ResType::COLOR};
+    ResourceBatchItem items[count];
+    for (int i = 0; i < count; ++i) {
+        int id = GetResId(typedName[i % typeCount], types[i % typeCount]);
+        ASSERT_TRUE(id > 0);
+        items[i].id = static_cast<uint32_t>(id);
+        items[i].resType = types[i % typeCount];
+        items[i].quantity = 1;
+    }
+    unsigned long long singleTotal = 0;
+    unsigned long long batchTotal = 0;
+    unsigned long long viewTotal = 0;
+    unsigned long long typedSingleTotal = 0;
+    unsigned long long typedBatchTotal = 0;
+    std::string outValues[count];
+    const std::string *views[count];
+    int intValue = 0;
+    bool boolValue = false;
+    uint32_t colorValue = 0;
+    for (int k = 0; k < 1000; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < count; ++i) {
+            rm->GetStringById(ids[i], outValues[i]);
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        rm->GetStringsByIds(ids, count, outValues, nullptr);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        rm->GetStringViewsByIds(ids, count, views, nullptr);
+        auto t4 = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < count; ++i) {
+            switch (items[i].resType) {
+                case ResType::STRING:
+                    rm->GetStringById(items[i].id, outValues[i]);
+                    break;
+                case ResType::PLURALS:
+                    rm->GetPluralStringById(items[i].id, items[i].quantity, outValues[i]);
+                    break;
+                case ResType::INTEGER:
+                    rm->GetIntegerById(items[i].id, intValue);
+                    break;
+                case ResType::BOOLEAN:
+                    rm->GetBooleanById(items[i].id, boolValue);
+                    break;
+                default:
+                    rm->GetColorById(items[i].id, colorValue);
+                    break;
+            }
+        }
+        auto t5 = std::chrono::high_resolution_clock::now();
+        rm->GetResourcesByIds(items, count);
+        auto t6 = std::chrono::high_resolution_clock::now();
+        singleTotal += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+        batchTotal += std::chrono::duration_cast<std::chrono::nanoseconds>(t3 - t2).count();
+        viewTotal += std::chrono::duration_cast<std::chrono::nanoseconds>(t4 - t3).count();
+        typedSingleTotal += std::chrono::duration_cast<std::chrono::nanoseconds>(t5 - t4).count();
+        typedBatchTotal += std::chrono::duration_cast<std::chrono::nanoseconds>(t6 - t5).count();
+    }
+    for (int i = 0; i < count; ++i) {
+        ASSERT_EQ(SUCCESS, items[i].state);
+    }
+    double singleAverage = singleTotal / (1000.0 * count);
+    double batchAverage = batchTotal / (1000.0 * count);
+    double viewAverage = viewTotal / (1000.0 * count);
+    double typedSingleAverage = typedSingleTotal / (1000.0 * count);
+    double typedBatchAverage = typedBatchTotal / (1000.0 * count);
+    g_logLevel = LOG_DEBUG;
+    HILOG_DEBUG("avg cost per item 033: single %f ns, batch %f ns, batch view %f ns", singleAverage, batchAverage,
+        viewAverage);
+    HILOG_DEBUG("avg cost per item 033: typed single %f ns, typed batch %f ns", typedSingleAverage,
+        typedBatchAverage);
+    EXPECT_LT(batchAverage, 100000);
+    EXPECT_LT(viewAverage, 100000);
+    EXPECT_LT(typedBatchAverage, 100000);
+};
+
+/*
+ * @tc.name: ResourceManagerPerformanceFuncTest034
+ * @tc.desc: Test GetStringByHandle against GetStringByName
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerPerformanceTest, ResourceManagerPerformanceFuncTest034, TestSize.Level1)
+{
+    if (rm == nullptr) {
+        ASSERT_TRUE(false);
+    }
+    unsigned long long nameTotal = 0;
+    unsigned long long handleTotal = 0;
+    ResHandle handle;
+    ASSERT_EQ(SUCCESS, rm->Resolve("app_name", ResType::STRING, handle));
+    std::string outValue;
+    for (int k = 0; k < 1000; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        rm->GetStringByName("app_name", outValue);
+        auto t2 = std::chrono::high_resolution_clock::now();
+        rm->GetStringByHandle(handle, outValue);
+        auto t3 = std::chrono::high_resolution_clock::now();
+        nameTotal += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+        handleTotal += std::chrono::duration_cast<std::chrono::nanoseconds>(t3 - t2).count();
+    }
+    double nameAverage = nameTotal / 1000.0;
+    double handleAverage = handleTotal / 1000.0;
+    g_logLevel = LOG_DEBUG;
+    HILOG_DEBUG("avg cost 034: by name %f ns, by handle %f ns", nameAverage, handleAverage);
+    EXPECT_LT(handleAverage, 100000);
+};
+
+/*
+ * @tc.name: ResourceManagerPerformanceFuncTest035
+ * @tc.desc: Test ResConfig IsMoreSuitable, locale matching searches the likely subtags and parent locale tables
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerPerformanceTest, ResourceManagerPerformanceFuncTest035, TestSize.Level1)
+{
+    const char *locales[][3] = {
+        { "zh", nullptr, "CN" }, { "zh", "Hant", "TW" }, { "zh", nullptr, "HK" }, { "en", nullptr, "US" },
+        { "en", nullptr, "GB" }, { "en", nullptr, "AU" }, { "pt", nullptr, "PT" }, { "es", nullptr, "419" },
+        { "sr", "Latn", nullptr }, { "ar", nullptr, "EG" }, { "fr", nullptr, "CA" }, { "az", nullptr, "IR" },
+    };
+    const size_t count = sizeof(locales) / sizeof(locales[0]);
+    ResConfigImpl *configs[count];
+    for (size_t i = 0; i < count; ++i) {
+        configs[i] = new ResConfigImpl;
+        configs[i]->SetLocaleInfo(locales[i][0], locales[i][1], locales[i][2]);
+    }
+    unsigned long long total = 0;
+    int loop = 100;
+    for (int k = 0; k < loop; ++k) {
+        auto t1 = std::chrono::high_resolution_clock::now();
+        for (size_t r = 0; r < count; ++r) {
+            for (size_t i = 0; i + 1 < count; ++i) {
+                configs[i]->IsMoreSuitable(configs[i + 1], configs[r]);
+            }
+        }
+        auto t2 = std::chrono::high_resolution_clock::now();
+        total += std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count();
+    }
+    double average = total / (loop * count * (count - 1.0));
+    g_logLevel = LOG_DEBUG;
+    HILOG_DEBUG("avg cost 035: IsMoreSuitable %f ns", average);
+    for (size_t i = 0; i < count; ++i) {
+        delete configs[i];
+    }
+    EXPECT_LT(average, 100000);
+};
 }
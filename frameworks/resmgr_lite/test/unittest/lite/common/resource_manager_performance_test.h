@@ -48,5 +48,8 @@ int ResourceManagerPerformanceFuncTest029(void);
 int ResourceManagerPerformanceFuncTest030(void);
 int ResourceManagerPerformanceFuncTest031(void);
 int ResourceManagerPerformanceFuncTest032(void);
+int ResourceManagerPerformanceFuncTest033(void);
+int ResourceManagerPerformanceFuncTest034(void);
+int ResourceManagerPerformanceFuncTest035(void);
 
 #endif
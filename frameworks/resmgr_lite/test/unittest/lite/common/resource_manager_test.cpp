@@ -26,6 +26,7 @@
 #include "test_common.h"
 #include "utils/errors.h"
 #include "utils/string_utils.h"
+#include "utils/utils.h"
 
 using namespace OHOS::Global::Resource;
 using namespace testing::ext;
@@ -67,7 +68,8 @@ public:
 
 int ResourceManagerTest::GetResId(std::string name, ResType resType) const
 {
-    auto idv = ((ResourceManagerImpl *)rm)->hapManager_->GetResourceListByName(name.c_str(), resType);
+    HapManager::SnapshotGuard snapshot(((ResourceManagerImpl *)rm)->hapManager_);
+    auto idv = snapshot->GetResourceListByName(name.c_str(), resType);
     if (idv == nullptr) {
         return -1;
     }
@@ -206,6 +208,151 @@ HWTEST_F(ResourceManagerTest, ResourceManagerAddResourceTest003, TestSize.Level1
     ASSERT_TRUE(!ret);
 }
 
+/*
+ * @tc.name: ResourceManagerAddResourcesTest001
+ * @tc.desc: Test AddResources function, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerAddResourcesTest001, TestSize.Level1)
+{
+    std::vector<std::string> paths;
+    paths.push_back(FormatFullPath(g_resFilePath));
+    bool ret = rm->AddResources(paths);
+    ASSERT_TRUE(ret);
+    TestStringByName("app_name", "App Name");
+}
+
+/*
+ * @tc.name: ResourceManagerAddResourcesTest002
+ * @tc.desc: Test AddResources function, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerAddResourcesTest002, TestSize.Level1)
+{
+    // error cases, a duplicate or non exist path fails the whole call and nothing is added
+    HapManager *hapManager = ((ResourceManagerImpl *)rm)->hapManager_;
+    std::vector<std::string> paths;
+    paths.push_back(FormatFullPath(g_resFilePath));
+    paths.push_back(FormatFullPath(g_resFilePath));
+    bool ret = rm->AddResources(paths);
+    ASSERT_TRUE(!ret);
+    EXPECT_EQ(static_cast<size_t>(0), hapManager->snapshot_.load()->HapSize());
+
+    paths.pop_back();
+    paths.push_back("/data/test/do_not_exist.resources");
+    ret = rm->AddResources(paths);
+    ASSERT_TRUE(!ret);
+    EXPECT_EQ(static_cast<size_t>(0), hapManager->snapshot_.load()->HapSize());
+
+    paths.pop_back();
+    ret = rm->AddResources(paths);
+    ASSERT_TRUE(ret);
+    EXPECT_EQ(static_cast<size_t>(1), hapManager->snapshot_.load()->HapSize());
+    TestStringByName("app_name", "App Name");
+
+    ret = rm->AddResource(FormatFullPath(g_resFilePath).c_str());
+    ASSERT_TRUE(!ret);
+}
+
+/*
+ * @tc.name: ResourceManagerRefreshTest001
+ * @tc.desc: Test Refresh function, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerRefreshTest001, TestSize.Level1)
+{
+    AddResource("en", nullptr, "US");
+    HapManager *hapManager = ((ResourceManagerImpl *)rm)->hapManager_;
+    uint32_t epoch = hapManager->snapshot_.load()->GetEpoch();
+    const HapResource *hapResource = hapManager->snapshot_.load()->hapResources_[0].get();
+    EXPECT_TRUE(hapResource->GetFileStamp().modTimeSec > 0);
+
+    // nothing changed, nothing published
+    EXPECT_EQ(SUCCESS, rm->Refresh());
+    EXPECT_EQ(epoch, hapManager->snapshot_.load()->GetEpoch());
+
+    // pretend resources.index was modified after loading, within the same second
+    hapManager->snapshot_.load()->hapStubs_[0]->fileStamp_.modTimeNsec++;
+    EXPECT_EQ(SUCCESS, rm->Refresh());
+    EXPECT_EQ(epoch + 1, hapManager->snapshot_.load()->GetEpoch());
+    const HapManager::Snapshot *current = hapManager->snapshot_.load();
+    EXPECT_TRUE(current->hapResources_[0]->GetFileStamp() ==
+        Utils::GetFileStamp(current->hapStubs_[0]->GetIndexPath().c_str()));
+    TestStringByName("app_name", "App Name");
+}
+
+/*
+ * @tc.name: ResourceManagerRefreshTest002
+ * @tc.desc: Test StartWatch & StopWatch function, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerRefreshTest002, TestSize.Level1)
+{
+    AddResource("en", nullptr, "US");
+    ASSERT_TRUE(rm->StartWatch(10));
+    ASSERT_TRUE(!rm->StartWatch(10));
+    EXPECT_EQ(SUCCESS, rm->Refresh());
+    uint32_t epoch = ((ResourceManagerImpl *)rm)->hapManager_->snapshot_.load()->GetEpoch();
+    // the watcher saw no change, so Refresh returns without checking the haps
+    EXPECT_EQ(SUCCESS, rm->Refresh());
+    EXPECT_EQ(epoch, ((ResourceManagerImpl *)rm)->hapManager_->snapshot_.load()->GetEpoch());
+    rm->StopWatch();
+    ASSERT_TRUE(rm->StartWatch(0));
+    TestStringByName("app_name", "App Name");
+}
+
+/*
+ * @tc.name: ResourceManagerAddResourceAsyncTest001
+ * @tc.desc: Test AddResourceAsync function, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerAddResourceAsyncTest001, TestSize.Level1)
+{
+    std::shared_future<bool> loaded = rm->AddResourceAsync(FormatFullPath(g_resFilePath).c_str());
+    // the same path is rejected while it is still being parsed
+    std::shared_future<bool> again = rm->AddResourceAsync(FormatFullPath(g_resFilePath).c_str());
+    std::string outValue;
+    RState state = rm->GetStringByName("app_name", outValue);
+    EXPECT_TRUE(state == SUCCESS || state == NOT_READY);
+
+    ASSERT_TRUE(loaded.get());
+    ASSERT_TRUE(!again.get());
+    state = rm->GetStringByName("app_name", outValue);
+    EXPECT_EQ(SUCCESS, state);
+    state = rm->GetStringByName(g_nonExistName, outValue);
+    EXPECT_EQ(NOT_FOUND, state);
+}
+
+/*
+ * @tc.name: ResourceManagerAddResourceAsyncTest002
+ * @tc.desc: Test AddResourceAsync function, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerAddResourceAsyncTest002, TestSize.Level1)
+{
+    // error case, a failed load is not ready only until its future is ready
+    std::shared_future<bool> loaded = rm->AddResourceAsync("/data/test/do_not_exist.resources");
+    ASSERT_TRUE(!loaded.get());
+    std::string outValue;
+    RState state = rm->GetStringByName("app_name", outValue);
+    EXPECT_EQ(NOT_FOUND, state);
+
+    loaded = rm->AddResourceAsync(nullptr);
+    ASSERT_TRUE(!loaded.get());
+
+    // the loads share a fixed count of worker threads
+    const int loadCount = 16;
+    std::vector<std::shared_future<bool>> loads;
+    for (int i = 0; i < loadCount; ++i) {
+        loads.push_back(rm->AddResourceAsync(("/data/test/do_not_exist_" + std::to_string(i) + ".resources").c_str()));
+    }
+    for (int i = 0; i < loadCount; ++i) {
+        ASSERT_TRUE(!loads[i].get());
+    }
+    HapManager::LoaderPool &loaders = ((ResourceManagerImpl *)rm)->hapManager_->loaders_;
+    EXPECT_LE(loaders.threads_.size(), loaders.threadCount_);
+}
+
 /*
  * @tc.name: ResourceManagerUpdateResConfigTest001
  * @tc.desc: Test UpdateResConfig function
@@ -309,8 +456,11 @@ HWTEST_F(ResourceManagerTest, ResourceManagerUpdateResConfigTest005, TestSize.Le
     AddResource("zh", nullptr, nullptr);
 
     // make a fake hapResource, then reload will fail
-    HapResource *hapResource = new HapResource("/data/test/non_exist", 0, nullptr, nullptr);
-    ((ResourceManagerImpl *)rm)->hapManager_->hapResources_.push_back(hapResource);
+    std::shared_ptr<const HapResource> hapResource(
+        new HapResource("/data/test/non_exist", FileStamp(), nullptr, nullptr));
+    HapManager::Snapshot *snapshot = ((ResourceManagerImpl *)rm)->hapManager_->snapshot_.load();
+    snapshot->hapResources_.push_back(hapResource);
+    snapshot->hapStubs_.push_back(std::shared_ptr<HapManager::HapStub>(new HapManager::HapStub(hapResource.get())));
     RState state;
     ResConfig *rc = CreateResConfig();
     if (rc == nullptr) {
@@ -465,6 +615,145 @@ HWTEST_F(ResourceManagerTest, ResourceManagerGetStringByNameTest003, TestSize.Le
     ASSERT_EQ(NOT_FOUND, state);
 }
 
+/*
+ * @tc.name: ResourceManagerGetStringByNameTest004
+ * @tc.desc: Test ResName overloads of the ByName getters, as used with the generated ResourceTable header
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetStringByNameTest004, TestSize.Level1)
+{
+    AddResource("zh", nullptr, "CN");
+
+    constexpr ResName appName = { "app_name", ResType::STRING, HashResName("app_name", ResType::STRING) };
+    constexpr ResName integer1 = { "integer_1", ResType::INTEGER, HashResName("integer_1", ResType::INTEGER) };
+    constexpr ResName eatApple = { "eat_apple", ResType::PLURALS, HashResName("eat_apple", ResType::PLURALS) };
+    std::string expect;
+    std::string outValue;
+    ASSERT_EQ(SUCCESS, rm->GetStringByName("app_name", expect));
+    RState state = rm->GetStringByName(appName, outValue);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(expect, outValue);
+
+    int intValue = 0;
+    state = rm->GetIntegerByName(integer1, intValue);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(101, intValue);
+
+    ASSERT_EQ(SUCCESS, rm->GetPluralStringByName("eat_apple", 1, expect));
+    state = rm->GetPluralStringByName(eatApple, 1, outValue);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(expect, outValue);
+
+    // the name of another type is not found
+    state = rm->GetStringByName(integer1, outValue);
+    ASSERT_EQ(NOT_FOUND, state);
+
+    // a hash that matches but a name that does not is not found
+    constexpr ResName collided = { "app_name_x", ResType::STRING, HashResName("app_name", ResType::STRING) };
+    state = rm->GetStringByName(collided, outValue);
+    ASSERT_EQ(NOT_FOUND, state);
+
+    constexpr ResName nonExist = { "non_exist", ResType::STRING, HashResName("non_exist", ResType::STRING) };
+    state = rm->GetStringByName(nonExist, outValue);
+    ASSERT_EQ(NOT_FOUND, state);
+
+    // a null name is not found even if its hash matches
+    constexpr ResName nullName = { nullptr, ResType::STRING, HashResName("app_name", ResType::STRING) };
+    state = rm->GetStringByName(nullName, outValue);
+    ASSERT_EQ(NOT_FOUND, state);
+}
+
+/*
+ * @tc.name: ResourceManagerResolveTest001
+ * @tc.desc: Test Resolve and the getters by handle, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerResolveTest001, TestSize.Level1)
+{
+    AddResource("zh", nullptr, nullptr);
+
+    ResHandle handle;
+    RState state = rm->Resolve("app_name", ResType::STRING, handle);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(static_cast<uint32_t>(GetResId("app_name", ResType::STRING)), handle.id);
+    std::string outValue;
+    state = rm->GetStringByHandle(handle, outValue);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ("应用名称", outValue);
+
+    // the binding is kept while resources and config are unchanged
+    const void *binding = handle.binding;
+    uint32_t epoch = handle.epoch;
+    state = rm->GetStringByHandle(handle, outValue);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(binding, handle.binding);
+    ASSERT_EQ(epoch, handle.epoch);
+
+    // a new config rebinds the handle
+    ResConfig *rc = CreateResConfig();
+    ASSERT_TRUE(rc != nullptr);
+    rc->SetLocaleInfo("en", nullptr, nullptr);
+    state = rm->UpdateResConfig(*rc);
+    delete rc;
+    ASSERT_EQ(SUCCESS, state);
+    state = rm->GetStringByHandle(handle, outValue);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ("App Name", outValue);
+    ASSERT_NE(epoch, handle.epoch);
+
+    constexpr ResName integer1 = { "integer_1", ResType::INTEGER, HashResName("integer_1", ResType::INTEGER) };
+    state = rm->Resolve(integer1, handle);
+    ASSERT_EQ(SUCCESS, state);
+    int intValue = 0;
+    state = rm->GetIntegerByHandle(handle, intValue);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(101, intValue);
+    // type mismatch
+    state = rm->GetStringByHandle(handle, outValue);
+    ASSERT_EQ(NOT_FOUND, state);
+
+    state = rm->Resolve(g_nonExistName, ResType::STRING, handle);
+    ASSERT_EQ(NOT_FOUND, state);
+    ResHandle empty = { 0, 0, nullptr };
+    state = rm->GetStringByHandle(empty, outValue);
+    ASSERT_EQ(NOT_FOUND, state);
+}
+
+/*
+ * @tc.name: ResourceManagerResolveTest002
+ * @tc.desc: Test handles under the memory budget and across resource managers
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerResolveTest002, TestSize.Level1)
+{
+    AddResource("zh", nullptr, nullptr);
+    HapManager *hapManager = ((ResourceManagerImpl *)rm)->hapManager_;
+
+    ResHandle handle;
+    RState state = rm->Resolve("app_name", ResType::STRING, handle);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(static_cast<uint32_t>(0), handle.hapIndex);
+
+    // a read through a current binding still marks its hap as used
+    hapManager->SetMemoryBudget(UINT32_MAX);
+    std::atomic<uint64_t> &lastUse = hapManager->snapshot_.load()->hapStubs_[0]->lastUse_;
+    uint64_t before = lastUse.load();
+    const void *binding = handle.binding;
+    std::string outValue;
+    state = rm->GetStringByHandle(handle, outValue);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(binding, handle.binding);
+    EXPECT_GT(lastUse.load(), before);
+
+    // epochs are unique in the process, so a handle of another resource manager never matches
+    ResourceManager *other = CreateResourceManager();
+    ASSERT_TRUE(other != nullptr);
+    EXPECT_NE(handle.epoch, ((ResourceManagerImpl *)other)->hapManager_->snapshot_.load()->GetEpoch());
+    state = other->GetStringByHandle(handle, outValue);
+    EXPECT_EQ(NOT_FOUND, state);
+    delete other;
+}
+
 /*
  * @tc.name: ResourceManagerGetStringFormatByIdTest001
  * @tc.desc: Test GetStringFormatById function
@@ -570,6 +859,120 @@ HWTEST_F(ResourceManagerTest, ResourceManagerGetStringArrayByIdTest002, TestSize
     ASSERT_EQ(NOT_FOUND, state);
 }
 
+/*
+ * @tc.name: ResourceManagerGetStringViewByIdTest001
+ * @tc.desc: Test GetStringViewById and GetStringArrayViewById function, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetStringViewByIdTest001, TestSize.Level1)
+{
+    AddResource("zh", nullptr, nullptr);
+
+    ResourceManager::ViewScope viewScope(*rm);
+    int id = GetResId("app_name", ResType::STRING);
+    ASSERT_TRUE(id > 0);
+    const std::string *view = nullptr;
+    RState state = rm->GetStringViewById(id, view);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ("应用名称", *view);
+
+    // no copy, the same value is returned every time
+    const std::string *viewByName = nullptr;
+    state = rm->GetStringViewByName("app_name", viewByName);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(view, viewByName);
+
+    std::vector<std::string> values;
+    std::vector<const std::string *> views;
+    id = GetResId("size", ResType::STRINGARRAY);
+    ASSERT_EQ(SUCCESS, rm->GetStringArrayById(id, values));
+    state = rm->GetStringArrayViewById(id, views);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(values.size(), views.size());
+    for (size_t i = 0; i < views.size(); ++i) {
+        ASSERT_EQ(values[i], *views[i]);
+    }
+    state = rm->GetStringArrayViewByName("size", views);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(values.size(), views.size());
+
+    state = rm->GetStringViewById(NON_EXIST_ID, view);
+    ASSERT_EQ(NOT_FOUND, state);
+    state = rm->GetStringArrayViewById(NON_EXIST_ID, views);
+    ASSERT_EQ(NOT_FOUND, state);
+}
+
+/*
+ * @tc.name: ResourceManagerGetResourcesByIdsTest001
+ * @tc.desc: Test GetStringsByIds, GetStringViewsByIds and GetResourcesByIds function, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetResourcesByIdsTest001, TestSize.Level1)
+{
+    AddResource("zh", nullptr, "CN");
+
+    uint32_t ids[] = { static_cast<uint32_t>(GetResId("app_name", ResType::STRING)), NON_EXIST_ID,
+        static_cast<uint32_t>(GetResId("string_ref", ResType::STRING)) };
+    std::string values[3];
+    RState states[3];
+    RState state = rm->GetStringsByIds(ids, 3, values, states);
+    ASSERT_EQ(NOT_FOUND, state);
+    ASSERT_EQ(SUCCESS, states[0]);
+    ASSERT_EQ(NOT_FOUND, states[1]);
+    ASSERT_EQ(SUCCESS, states[2]);
+    std::string single;
+    rm->GetStringById(ids[0], single);
+    ASSERT_EQ(single, values[0]);
+    rm->GetStringById(ids[2], single);
+    ASSERT_EQ(single, values[2]);
+
+    ResourceManager::ViewScope viewScope(*rm);
+    const std::string *views[3];
+    state = rm->GetStringViewsByIds(ids, 3, views, nullptr);
+    ASSERT_EQ(NOT_FOUND, state);
+    ASSERT_EQ(values[0], *views[0]);
+    ASSERT_TRUE(views[1] == nullptr);
+    ASSERT_EQ(values[2], *views[2]);
+
+    ResourceBatchItem items[6];
+    items[0].id = ids[0];
+    items[0].resType = ResType::STRING;
+    items[1].id = GetResId("eat_apple", ResType::PLURALS);
+    items[1].resType = ResType::PLURALS;
+    items[1].quantity = 1;
+    items[2].id = GetResId("integer_1", ResType::INTEGER);
+    items[2].resType = ResType::INTEGER;
+    items[3].id = GetResId("boolean_1", ResType::BOOLEAN);
+    items[3].resType = ResType::BOOLEAN;
+    items[4].id = GetResId("aboutPage_minHeight", ResType::FLOAT);
+    items[4].resType = ResType::FLOAT;
+    items[5].id = GetResId("divider_color", ResType::COLOR);
+    items[5].resType = ResType::COLOR;
+    state = rm->GetResourcesByIds(items, 6);
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ(values[0], *items[0].stringValue);
+    rm->GetPluralStringById(items[1].id, 1, single);
+    ASSERT_EQ(single, *items[1].stringValue);
+    ASSERT_EQ(101, items[2].intValue);
+    ASSERT_TRUE(items[3].boolValue);
+    float floatValue;
+    rm->GetFloatById(items[4].id, floatValue);
+    ASSERT_EQ(floatValue, items[4].floatValue);
+    uint32_t colorValue;
+    rm->GetColorById(items[5].id, colorValue);
+    ASSERT_EQ(colorValue, items[5].colorValue);
+
+    // type mismatch and unsupported type fail alone
+    items[2].resType = ResType::COLOR;
+    items[3].resType = ResType::THEME;
+    state = rm->GetResourcesByIds(items, 6);
+    ASSERT_EQ(NOT_FOUND, state);
+    ASSERT_EQ(SUCCESS, items[0].state);
+    ASSERT_EQ(NOT_FOUND, items[2].state);
+    ASSERT_EQ(ERROR, items[3].state);
+    ASSERT_EQ(SUCCESS, items[5].state);
+}
+
 /*
  * @tc.name: ResourceManagerGetStringArrayByNameTest001
  * @tc.desc: Test GetStringArrayByName function, file case.
@@ -911,6 +1314,34 @@ HWTEST_F(ResourceManagerTest, ResourceManagerGetPluralStringByIdFormatTest002, T
     ASSERT_EQ(NOT_FOUND, state);
 }
 
+/*
+ * @tc.name: ResourceManagerGetPluralStringByIdFormatTest003
+ * @tc.desc: Test GetPluralStringByIdFormat function with typed arguments, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetPluralStringByIdFormatTest003, TestSize.Level1)
+{
+    AddResource("zh", nullptr, "CN");
+
+    int id = GetResId("eat_apple", ResType::PLURALS);
+    ASSERT_TRUE(id > 0);
+    std::string outValue;
+    RState state = rm->GetPluralStringByIdFormat(outValue, id, 1, { 1 });
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ("1 apples", outValue);
+
+    // the cached template of the same value formats again into the reused string
+    state = rm->GetPluralStringByIdFormat(outValue, id, 101, { 101 });
+    ASSERT_EQ(SUCCESS, state);
+    ASSERT_EQ("101 apples", outValue);
+
+    state = rm->GetPluralStringByIdFormat(outValue, id, 1, { "one" });
+    ASSERT_EQ(ERROR, state);
+
+    state = rm->GetPluralStringByIdFormat(outValue, NON_EXIST_ID, 1, { 1 });
+    ASSERT_EQ(NOT_FOUND, state);
+}
+
 /*
  * @tc.name: ResourceManagerGetPluralStringByNameFormatTest001
  * @tc.desc: Test GetPluralStringByNameFormat function, file case.
@@ -1010,6 +1441,42 @@ HWTEST_F(ResourceManagerTest, ResourceManagerGetThemeByNameTest002, TestSize.Lev
     ASSERT_EQ(NOT_FOUND, state);
 }
 
+/*
+ * @tc.name: ResourceManagerGetThemeByNameTest003
+ * @tc.desc: Test GetThemeByName, the flattened map is shared until the config changes
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerGetThemeByNameTest003, TestSize.Level1)
+{
+    AddResource("zh", nullptr, "CN");
+
+    std::shared_ptr<const std::map<std::string, std::string>> first;
+    std::shared_ptr<const std::map<std::string, std::string>> second;
+    ASSERT_EQ(SUCCESS, rm->GetThemeByName("app_theme", first));
+    int id = GetResId("app_theme", ResType::THEME);
+    ASSERT_EQ(SUCCESS, rm->GetThemeById(id, second));
+    EXPECT_EQ(first.get(), second.get());
+
+    std::map<std::string, std::string> outValue;
+    ASSERT_EQ(SUCCESS, rm->GetThemeByName("app_theme", outValue));
+    EXPECT_TRUE(outValue == *first);
+
+    // a new config flattens again, the map held by the caller stays valid
+    ResConfig *rc = CreateResConfig();
+    if (rc == nullptr) {
+        ASSERT_TRUE(false);
+    }
+    rc->SetLocaleInfo("en", nullptr, "US");
+    EXPECT_EQ(SUCCESS, rm->UpdateResConfig(*rc));
+    delete rc;
+    ASSERT_EQ(SUCCESS, rm->GetThemeByName("app_theme", second));
+    EXPECT_NE(first.get(), second.get());
+    EXPECT_EQ(outValue.size(), first->size());
+
+    // type mismatch is not cached
+    ASSERT_EQ(NOT_FOUND, rm->GetPatternById(id, second));
+}
+
 /*
  * @tc.name: ResourceManagerGetBooleanByIdTest001
  * @tc.desc: Test GetBooleanById
@@ -1385,7 +1852,7 @@ HWTEST_F(ResourceManagerTest, ResourceManagerGetProfileByIdTest001, TestSize.Lev
 {
     AddResource("zh", nullptr, "CN");
 
-    HapResource *tmp = new HapResource(FormatFullPath(g_resFilePath).c_str(), 0, nullptr, nullptr);
+    HapResource *tmp = new HapResource(FormatFullPath(g_resFilePath).c_str(), FileStamp(), nullptr, nullptr);
     tmp->Init();
     std::string res = tmp->GetResourcePath();
     res.append("entry/resources/base/profile/test_common.h");
@@ -1424,7 +1891,7 @@ HWTEST_F(ResourceManagerTest, ResourceManagerGetProfileByNameTest001, TestSize.L
 {
     AddResource("zh", nullptr, "CN");
 
-    HapResource *tmp = new HapResource(FormatFullPath(g_resFilePath).c_str(), 0, nullptr, nullptr);
+    HapResource *tmp = new HapResource(FormatFullPath(g_resFilePath).c_str(), FileStamp(), nullptr, nullptr);
     tmp->Init();
     std::string res = tmp->GetResourcePath();
     res.append("entry/resources/base/profile/test_common.h");
@@ -1461,7 +1928,7 @@ HWTEST_F(ResourceManagerTest, ResourceManagerGetMediaByIdTest001, TestSize.Level
 {
     AddResource("zh", nullptr, "CN");
 
-    HapResource *tmp = new HapResource(FormatFullPath(g_resFilePath).c_str(), 0, nullptr, nullptr);
+    HapResource *tmp = new HapResource(FormatFullPath(g_resFilePath).c_str(), FileStamp(), nullptr, nullptr);
     tmp->Init();
     std::string res = tmp->GetResourcePath();
     res.append("entry/resources/base/media/icon.png");
@@ -1500,7 +1967,7 @@ HWTEST_F(ResourceManagerTest, ResourceManagerGetMediaByNameTest001, TestSize.Lev
 {
     AddResource("zh", nullptr, "CN");
 
-    HapResource *tmp = new HapResource(FormatFullPath(g_resFilePath).c_str(), 0, nullptr, nullptr);
+    HapResource *tmp = new HapResource(FormatFullPath(g_resFilePath).c_str(), FileStamp(), nullptr, nullptr);
     tmp->Init();
     std::string res = tmp->GetResourcePath();
     res.append("entry/resources/base/media/icon.png");
@@ -1616,6 +2083,40 @@ HWTEST_F(ResourceManagerTest, ResourceManagerResolveReferenceTest001, TestSize.L
     ASSERT_EQ(ERROR, ret);
 }
 
+/*
+ * @tc.name: ResourceManagerResolveReferenceTest002
+ * @tc.desc: Test a reference chain is followed once per snapshot, file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ResourceManagerTest, ResourceManagerResolveReferenceTest002, TestSize.Level1)
+{
+    AddResource("en", nullptr, "US");
+
+    std::string copyright("XXXXXX All rights reserved. ©2011-2019");
+    std::string outValue;
+    HapManager *hapManager = ((ResourceManagerImpl *)rm)->hapManager_;
+    ASSERT_EQ(SUCCESS, rm->GetStringByName("string_ref", outValue));
+    EXPECT_EQ(copyright, outValue);
+    const HapManager::Snapshot *snapshot = hapManager->snapshot_.load();
+    EXPECT_EQ(static_cast<size_t>(1), snapshot->resolvedRefs_.Size());
+    const IdItem *idItem = snapshot->FindResourceByName("string_ref", ResType::STRING);
+    ASSERT_TRUE(idItem != nullptr);
+    ASSERT_TRUE(snapshot->resolvedRefs_.Find(idItem->valueRef_.id_) != nullptr);
+    const IdItem *target = snapshot->resolvedRefs_.Find(idItem->valueRef_.id_)->target_;
+    ASSERT_TRUE(target != nullptr);
+    EXPECT_EQ(static_cast<uint32_t>(0), target->valueRef_.id_);
+
+    ASSERT_EQ(SUCCESS, rm->GetStringByName("string_ref", outValue));
+    EXPECT_EQ(copyright, outValue);
+    EXPECT_EQ(static_cast<size_t>(1), snapshot->resolvedRefs_.Size());
+
+    // a broken reference is reported once and stays broken
+    IdItem::ValueRef ref = { ResType::BOOLEAN, NON_EXIST_ID };
+    EXPECT_TRUE(snapshot->ResolveReference(ref) == nullptr);
+    EXPECT_TRUE(snapshot->ResolveReference(ref) == nullptr);
+    EXPECT_EQ(static_cast<size_t>(2), snapshot->resolvedRefs_.Size());
+}
+
 /*
  * @tc.name: ResourceManagerResolveParentReferenceTest001
  * @tc.desc: Test ResolveParentReference function, file case.
@@ -1628,10 +2129,12 @@ HWTEST_F(ResourceManagerTest, ResourceManagerResolveParentReferenceTest001, Test
     std::map<std::string, std::string> outValue;
     const IdItem *idItem;
     RState ret;
+    // keep the found items alive while they are resolved
+    HapManager::SnapshotGuard snapshot(((ResourceManagerImpl *)rm)->hapManager_);
 
     id = GetResId("base", ResType::PATTERN);
     ASSERT_TRUE(id > 0);
-    idItem = ((ResourceManagerImpl *)rm)->hapManager_->FindResourceById(id);
+    idItem = snapshot->FindResourceById(id);
     ASSERT_TRUE(idItem != nullptr);
     ret = ((ResourceManagerImpl *)rm)->ResolveParentReference(idItem, outValue);
     ASSERT_EQ(SUCCESS, ret);
@@ -1640,7 +2143,7 @@ HWTEST_F(ResourceManagerTest, ResourceManagerResolveParentReferenceTest001, Test
     HILOG_DEBUG("=====");
     id = GetResId("child", ResType::PATTERN);
     ASSERT_TRUE(id > 0);
-    idItem = ((ResourceManagerImpl *)rm)->hapManager_->FindResourceById(id);
+    idItem = snapshot->FindResourceById(id);
     ASSERT_TRUE(idItem != nullptr);
     ret = ((ResourceManagerImpl *)rm)->ResolveParentReference(idItem, outValue);
     ASSERT_EQ(SUCCESS, ret);
@@ -1649,7 +2152,7 @@ HWTEST_F(ResourceManagerTest, ResourceManagerResolveParentReferenceTest001, Test
     HILOG_DEBUG("=====");
     id = GetResId("ccchild", ResType::PATTERN);
     ASSERT_TRUE(id > 0);
-    idItem = ((ResourceManagerImpl *)rm)->hapManager_->FindResourceById(id);
+    idItem = snapshot->FindResourceById(id);
     ASSERT_TRUE(idItem != nullptr);
     ret = ((ResourceManagerImpl *)rm)->ResolveParentReference(idItem, outValue);
     ASSERT_EQ(SUCCESS, ret);
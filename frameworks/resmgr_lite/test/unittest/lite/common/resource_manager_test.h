@@ -19,6 +19,12 @@
 int ResourceManagerAddResourceTest001(void);
 int ResourceManagerAddResourceTest002(void);
 int ResourceManagerAddResourceTest003(void);
+int ResourceManagerAddResourcesTest001(void);
+int ResourceManagerAddResourcesTest002(void);
+int ResourceManagerRefreshTest001(void);
+int ResourceManagerRefreshTest002(void);
+int ResourceManagerAddResourceAsyncTest001(void);
+int ResourceManagerAddResourceAsyncTest002(void);
 int ResourceManagerUpdateResConfigTest001(void);
 int ResourceManagerUpdateResConfigTest002(void);
 int ResourceManagerUpdateResConfigTest003(void);
@@ -32,12 +38,17 @@ int ResourceManagerGetStringByIdTest003(void);
 int ResourceManagerGetStringByNameTest001(void);
 int ResourceManagerGetStringByNameTest002(void);
 int ResourceManagerGetStringByNameTest003(void);
+int ResourceManagerGetStringByNameTest004(void);
+int ResourceManagerResolveTest001(void);
+int ResourceManagerResolveTest002(void);
 int ResourceManagerGetStringFormatByIdTest001(void);
 int ResourceManagerGetStringFormatByIdTest002(void);
 int ResourceManagerGetStringFormatByNameTest001(void);
 int ResourceManagerGetStringFormatByNameTest002(void);
 int ResourceManagerGetStringArrayByIdTest001(void);
 int ResourceManagerGetStringArrayByIdTest002(void);
+int ResourceManagerGetStringViewByIdTest001(void);
+int ResourceManagerGetResourcesByIdsTest001(void);
 int ResourceManagerGetStringArrayByNameTest001(void);
 int ResourceManagerGetStringArrayByNameTest002(void);
 int ResourceManagerGetPatternByIdTest001(void);
@@ -57,12 +68,14 @@ int ResourceManagerGetPluralStringByNameTest001(void);
 int ResourceManagerGetPluralStringByNameTest002(void);
 int ResourceManagerGetPluralStringByIdFormatTest001(void);
 int ResourceManagerGetPluralStringByIdFormatTest002(void);
+int ResourceManagerGetPluralStringByIdFormatTest003(void);
 int ResourceManagerGetPluralStringByNameFormatTest001(void);
 int ResourceManagerGetPluralStringByNameFormatTest002(void);
 int ResourceManagerGetThemeByIdTest001(void);
 int ResourceManagerGetThemeByIdTest002(void);
 int ResourceManagerGetThemeByNameTest001(void);
 int ResourceManagerGetThemeByNameTest002(void);
+int ResourceManagerGetThemeByNameTest003(void);
 int ResourceManagerGetBooleanByIdTest001(void);
 int ResourceManagerGetBooleanByIdTest002(void);
 int ResourceManagerGetBooleanByNameTest001(void);
@@ -92,6 +105,7 @@ int ResourceManagerGetMediaByIdTest002(void);
 int ResourceManagerGetMediaByNameTest001(void);
 int ResourceManagerGetMediaByNameTest002(void);
 int ResourceManagerResolveReferenceTest001(void);
+int ResourceManagerResolveReferenceTest002(void);
 int ResourceManagerResolveParentReferenceTest001(void);
 int ResourceManagerSameNameTest001(void);
 
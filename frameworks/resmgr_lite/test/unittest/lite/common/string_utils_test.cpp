@@ -19,6 +19,7 @@
 #include <thread>
 #include "auto_mutex.h"
 #include "test_common.h"
+#include "utils/format_template.h"
 #include "utils/string_utils.h"
 
 using namespace OHOS::Global::Resource;
@@ -71,6 +72,56 @@ HWTEST_F(StringUtilsTest, StringUtilsFuncTest001, TestSize.Level1)
     EXPECT_EQ("I'm cici, I'm 5", result);
 }
 
+std::string FormatByTemplate(const FormatTemplate &formatTemplate, ...)
+{
+    std::string result;
+    va_list args;
+    va_start(args, formatTemplate);
+    formatTemplate.Format(result, args);
+    va_end(args);
+    return result;
+}
+
+/*
+ * @tc.name: StringUtilsFuncTest002
+ * @tc.desc: Test FormatTemplate gives the same result as FormatString, none file case.
+ * @tc.type: FUNC
+ */
+HWTEST_F(StringUtilsTest, StringUtilsFuncTest002, TestSize.Level1)
+{
+    const char *fmt = "%d|%i|%5d|%-5d|%05d|%+d|%u|%x|%#X|%o|%hhd|%hd|%ld|%lld|%zu|%c|%s|%8.3s|%.2f|%e|%g|100%%";
+    FormatTemplate formatTemplate(fmt);
+    EXPECT_EQ(static_cast<size_t>(21), formatTemplate.GetPlaceholderCount());
+    std::string expect = FormatString(fmt, -12, 34, 56, 78, 9, 10, 4000000000U, 255, 255, 8, 300, 70000, -5L,
+        LLONG_MIN, static_cast<size_t>(7), 'a', "str", "abcdef", 3.14159, 12345.678, 0.0001);
+    std::string result = FormatByTemplate(formatTemplate, -12, 34, 56, 78, 9, 10, 4000000000U, 255, 255, 8, 300,
+        70000, -5L, LLONG_MIN, static_cast<size_t>(7), 'a', "str", "abcdef", 3.14159, 12345.678, 0.0001);
+    EXPECT_EQ(expect, result);
+
+    // typed args, the reused string is overwritten
+    FormatTemplate apples("%d apples, %s and %.1f");
+    std::vector<FormatArg> args = { 3, "pears", 2.25 };
+    EXPECT_TRUE(apples.Format(result, args));
+    EXPECT_EQ("3 apples, pears and 2.2", result);
+    args[0] = FormatArg("three");
+    EXPECT_FALSE(apples.Format(result, args));
+    args.pop_back();
+    args[0] = FormatArg(3);
+    EXPECT_FALSE(apples.Format(result, args));
+
+    // positional placeholders with varargs fall back to vsnprintf
+    FormatTemplate positional("%2$s has %1$d");
+    args = { 5, "cici" };
+    EXPECT_TRUE(positional.Format(result, args));
+    EXPECT_EQ("cici has 5", result);
+    EXPECT_EQ("cici has 5", FormatByTemplate(positional, 5, "cici"));
+
+    // '*' width is not parsed, only varargs work
+    FormatTemplate star("%*d");
+    EXPECT_FALSE(star.Format(result, args));
+    EXPECT_EQ("   42", FormatByTemplate(star, 5, 42));
+}
+
 void FuncMultiThread(int* num, Lock* lock)
 {
     AutoMutex mtx(*lock);
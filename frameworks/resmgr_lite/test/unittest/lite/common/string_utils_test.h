@@ -17,6 +17,7 @@
 #define RESOURCE_MANAGER_STRING_UTILS_TEST_H
 
 int StringUtilsFuncTest001(void);
+int StringUtilsFuncTest002(void);
 int LockFuncTest001(void);
 
 #endif
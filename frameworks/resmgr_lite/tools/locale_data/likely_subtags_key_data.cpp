@@ -18,12 +18,254 @@
 namespace OHOS {
 namespace Global {
 namespace Resource {
-const uint64_t LIKELY_TAGS_CODES_KEY[] = {
+// sorted by encoded locale, input of tools/locale_data_gen.cpp
+constexpr uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x6161000000000000), /* aa */
+    static_cast<uint64_t>(0x6162000000000000), /* ab */
+    static_cast<uint64_t>(0x6165000000000000), /* ae */
+    static_cast<uint64_t>(0x6166000000000000), /* af */
+    static_cast<uint64_t>(0x616b000000000000), /* ak */
+    static_cast<uint64_t>(0x616d000000000000), /* am */
+    static_cast<uint64_t>(0x616e000000000000), /* an */
+    static_cast<uint64_t>(0x6172000000000000), /* ar */
+    static_cast<uint64_t>(0x6173000000000000), /* as */
+    static_cast<uint64_t>(0x6176000000000000), /* av */
+    static_cast<uint64_t>(0x6179000000000000), /* ay */
+    static_cast<uint64_t>(0x617a000000000000), /* az */
+    static_cast<uint64_t>(0x617a000000004951), /* az-IQ */
+    static_cast<uint64_t>(0x617a000000004952), /* az-IR */
+    static_cast<uint64_t>(0x617a000000005255), /* az-RU */
+    static_cast<uint64_t>(0x617a417261620000), /* az-Arab */
+    static_cast<uint64_t>(0x6261000000000000), /* ba */
+    static_cast<uint64_t>(0x6265000000000000), /* be */
+    static_cast<uint64_t>(0x6267000000000000), /* bg */
+    static_cast<uint64_t>(0x6269000000000000), /* bi */
+    static_cast<uint64_t>(0x626d000000000000), /* bm */
+    static_cast<uint64_t>(0x626e000000000000), /* bn */
+    static_cast<uint64_t>(0x626f000000000000), /* bo */
+    static_cast<uint64_t>(0x6272000000000000), /* br */
+    static_cast<uint64_t>(0x6273000000000000), /* bs */
+    static_cast<uint64_t>(0x6361000000000000), /* ca */
+    static_cast<uint64_t>(0x6365000000000000), /* ce */
+    static_cast<uint64_t>(0x6368000000000000), /* ch */
+    static_cast<uint64_t>(0x636f000000000000), /* co */
+    static_cast<uint64_t>(0x6372000000000000), /* cr */
+    static_cast<uint64_t>(0x6373000000000000), /* cs */
+    static_cast<uint64_t>(0x6375000000000000), /* cu */
+    static_cast<uint64_t>(0x6375476c61670000), /* cu-Glag */
+    static_cast<uint64_t>(0x6376000000000000), /* cv */
+    static_cast<uint64_t>(0x6379000000000000), /* cy */
+    static_cast<uint64_t>(0x6461000000000000), /* da */
+    static_cast<uint64_t>(0x6465000000000000), /* de */
+    static_cast<uint64_t>(0x6476000000000000), /* dv */
+    static_cast<uint64_t>(0x647a000000000000), /* dz */
+    static_cast<uint64_t>(0x6565000000000000), /* ee */
+    static_cast<uint64_t>(0x656c000000000000), /* el */
+    static_cast<uint64_t>(0x656e000000000000), /* en */
+    static_cast<uint64_t>(0x656e536861770000), /* en-Shaw */
+    static_cast<uint64_t>(0x656f000000000000), /* eo */
+    static_cast<uint64_t>(0x6573000000000000), /* es */
+    static_cast<uint64_t>(0x6574000000000000), /* et */
+    static_cast<uint64_t>(0x6575000000000000), /* eu */
+    static_cast<uint64_t>(0x6661000000000000), /* fa */
+    static_cast<uint64_t>(0x6666000000000000), /* ff */
+    static_cast<uint64_t>(0x666641646c6d0000), /* ff-Adlm */
+    static_cast<uint64_t>(0x6669000000000000), /* fi */
+    static_cast<uint64_t>(0x666a000000000000), /* fj */
+    static_cast<uint64_t>(0x666f000000000000), /* fo */
+    static_cast<uint64_t>(0x6672000000000000), /* fr */
+    static_cast<uint64_t>(0x6679000000000000), /* fy */
+    static_cast<uint64_t>(0x6761000000000000), /* ga */
+    static_cast<uint64_t>(0x6764000000000000), /* gd */
+    static_cast<uint64_t>(0x676c000000000000), /* gl */
+    static_cast<uint64_t>(0x676e000000000000), /* gn */
+    static_cast<uint64_t>(0x6775000000000000), /* gu */
+    static_cast<uint64_t>(0x6776000000000000), /* gv */
+    static_cast<uint64_t>(0x6861000000000000), /* ha */
+    static_cast<uint64_t>(0x686100000000434d), /* ha-CM */
+    static_cast<uint64_t>(0x6861000000005344), /* ha-SD */
+    static_cast<uint64_t>(0x6865000000000000), /* he */
+    static_cast<uint64_t>(0x6869000000000000), /* hi */
+    static_cast<uint64_t>(0x686f000000000000), /* ho */
+    static_cast<uint64_t>(0x6872000000000000), /* hr */
+    static_cast<uint64_t>(0x6874000000000000), /* ht */
+    static_cast<uint64_t>(0x6875000000000000), /* hu */
+    static_cast<uint64_t>(0x6879000000000000), /* hy */
+    static_cast<uint64_t>(0x687a000000000000), /* hz */
+    static_cast<uint64_t>(0x6961000000000000), /* ia */
+    static_cast<uint64_t>(0x6964000000000000), /* id */
+    static_cast<uint64_t>(0x6967000000000000), /* ig */
+    static_cast<uint64_t>(0x6969000000000000), /* ii */
+    static_cast<uint64_t>(0x696b000000000000), /* ik */
+    static_cast<uint64_t>(0x696e000000000000), /* in */
+    static_cast<uint64_t>(0x696f000000000000), /* io */
+    static_cast<uint64_t>(0x6973000000000000), /* is */
+    static_cast<uint64_t>(0x6974000000000000), /* it */
+    static_cast<uint64_t>(0x6975000000000000), /* iu */
+    static_cast<uint64_t>(0x6977000000000000), /* iw */
+    static_cast<uint64_t>(0x6a61000000000000), /* ja */
+    static_cast<uint64_t>(0x6a69000000000000), /* ji */
+    static_cast<uint64_t>(0x6a76000000000000), /* jv */
+    static_cast<uint64_t>(0x6a77000000000000), /* jw */
+    static_cast<uint64_t>(0x6b61000000000000), /* ka */
+    static_cast<uint64_t>(0x6b67000000000000), /* kg */
+    static_cast<uint64_t>(0x6b69000000000000), /* ki */
+    static_cast<uint64_t>(0x6b6a000000000000), /* kj */
+    static_cast<uint64_t>(0x6b6b000000000000), /* kk */
+    static_cast<uint64_t>(0x6b6b000000004146), /* kk-AF */
+    static_cast<uint64_t>(0x6b6b00000000434e), /* kk-CN */
+    static_cast<uint64_t>(0x6b6b000000004952), /* kk-IR */
+    static_cast<uint64_t>(0x6b6b000000004d4e), /* kk-MN */
+    static_cast<uint64_t>(0x6b6b417261620000), /* kk-Arab */
+    static_cast<uint64_t>(0x6b6c000000000000), /* kl */
+    static_cast<uint64_t>(0x6b6d000000000000), /* km */
+    static_cast<uint64_t>(0x6b6e000000000000), /* kn */
+    static_cast<uint64_t>(0x6b6f000000000000), /* ko */
+    static_cast<uint64_t>(0x6b72000000000000), /* kr */
+    static_cast<uint64_t>(0x6b73000000000000), /* ks */
+    static_cast<uint64_t>(0x6b75000000000000), /* ku */
+    static_cast<uint64_t>(0x6b75000000004c42), /* ku-LB */
+    static_cast<uint64_t>(0x6b75417261620000), /* ku-Arab */
+    static_cast<uint64_t>(0x6b7559657a690000), /* ku-Yezi */
+    static_cast<uint64_t>(0x6b76000000000000), /* kv */
+    static_cast<uint64_t>(0x6b77000000000000), /* kw */
+    static_cast<uint64_t>(0x6b79000000000000), /* ky */
+    static_cast<uint64_t>(0x6b7900000000434e), /* ky-CN */
+    static_cast<uint64_t>(0x6b79000000005452), /* ky-TR */
+    static_cast<uint64_t>(0x6b79417261620000), /* ky-Arab */
+    static_cast<uint64_t>(0x6b794c61746e0000), /* ky-Latn */
+    static_cast<uint64_t>(0x6c61000000000000), /* la */
+    static_cast<uint64_t>(0x6c62000000000000), /* lb */
+    static_cast<uint64_t>(0x6c67000000000000), /* lg */
+    static_cast<uint64_t>(0x6c69000000000000), /* li */
+    static_cast<uint64_t>(0x6c6e000000000000), /* ln */
+    static_cast<uint64_t>(0x6c6f000000000000), /* lo */
+    static_cast<uint64_t>(0x6c74000000000000), /* lt */
+    static_cast<uint64_t>(0x6c75000000000000), /* lu */
+    static_cast<uint64_t>(0x6c76000000000000), /* lv */
+    static_cast<uint64_t>(0x6d67000000000000), /* mg */
+    static_cast<uint64_t>(0x6d68000000000000), /* mh */
+    static_cast<uint64_t>(0x6d69000000000000), /* mi */
+    static_cast<uint64_t>(0x6d6b000000000000), /* mk */
+    static_cast<uint64_t>(0x6d6c000000000000), /* ml */
+    static_cast<uint64_t>(0x6d6e000000000000), /* mn */
+    static_cast<uint64_t>(0x6d6e00000000434e), /* mn-CN */
+    static_cast<uint64_t>(0x6d6e4d6f6e670000), /* mn-Mong */
+    static_cast<uint64_t>(0x6d6f000000000000), /* mo */
+    static_cast<uint64_t>(0x6d72000000000000), /* mr */
+    static_cast<uint64_t>(0x6d73000000000000), /* ms */
+    static_cast<uint64_t>(0x6d73000000004343), /* ms-CC */
+    static_cast<uint64_t>(0x6d74000000000000), /* mt */
+    static_cast<uint64_t>(0x6d79000000000000), /* my */
+    static_cast<uint64_t>(0x6e61000000000000), /* na */
+    static_cast<uint64_t>(0x6e62000000000000), /* nb */
+    static_cast<uint64_t>(0x6e64000000000000), /* nd */
+    static_cast<uint64_t>(0x6e65000000000000), /* ne */
+    static_cast<uint64_t>(0x6e67000000000000), /* ng */
+    static_cast<uint64_t>(0x6e6c000000000000), /* nl */
+    static_cast<uint64_t>(0x6e6e000000000000), /* nn */
+    static_cast<uint64_t>(0x6e6f000000000000), /* no */
+    static_cast<uint64_t>(0x6e72000000000000), /* nr */
+    static_cast<uint64_t>(0x6e76000000000000), /* nv */
+    static_cast<uint64_t>(0x6e79000000000000), /* ny */
+    static_cast<uint64_t>(0x6f63000000000000), /* oc */
+    static_cast<uint64_t>(0x6f6d000000000000), /* om */
+    static_cast<uint64_t>(0x6f72000000000000), /* or */
+    static_cast<uint64_t>(0x6f73000000000000), /* os */
+    static_cast<uint64_t>(0x7061000000000000), /* pa */
+    static_cast<uint64_t>(0x706100000000504b), /* pa-PK */
+    static_cast<uint64_t>(0x7061417261620000), /* pa-Arab */
+    static_cast<uint64_t>(0x706c000000000000), /* pl */
+    static_cast<uint64_t>(0x7073000000000000), /* ps */
+    static_cast<uint64_t>(0x7074000000000000), /* pt */
+    static_cast<uint64_t>(0x7175000000000000), /* qu */
+    static_cast<uint64_t>(0x726d000000000000), /* rm */
+    static_cast<uint64_t>(0x726e000000000000), /* rn */
+    static_cast<uint64_t>(0x726f000000000000), /* ro */
+    static_cast<uint64_t>(0x7275000000000000), /* ru */
+    static_cast<uint64_t>(0x7277000000000000), /* rw */
+    static_cast<uint64_t>(0x7361000000000000), /* sa */
+    static_cast<uint64_t>(0x7363000000000000), /* sc */
+    static_cast<uint64_t>(0x7364000000000000), /* sd */
+    static_cast<uint64_t>(0x7364446576610000), /* sd-Deva */
+    static_cast<uint64_t>(0x73644b686f6a0000), /* sd-Khoj */
+    static_cast<uint64_t>(0x736453696e640000), /* sd-Sind */
+    static_cast<uint64_t>(0x7365000000000000), /* se */
+    static_cast<uint64_t>(0x7367000000000000), /* sg */
+    static_cast<uint64_t>(0x7369000000000000), /* si */
+    static_cast<uint64_t>(0x736b000000000000), /* sk */
+    static_cast<uint64_t>(0x736c000000000000), /* sl */
+    static_cast<uint64_t>(0x736d000000000000), /* sm */
+    static_cast<uint64_t>(0x736e000000000000), /* sn */
+    static_cast<uint64_t>(0x736f000000000000), /* so */
+    static_cast<uint64_t>(0x7371000000000000), /* sq */
+    static_cast<uint64_t>(0x7372000000000000), /* sr */
+    static_cast<uint64_t>(0x7372000000004d45), /* sr-ME */
+    static_cast<uint64_t>(0x737200000000524f), /* sr-RO */
+    static_cast<uint64_t>(0x7372000000005255), /* sr-RU */
+    static_cast<uint64_t>(0x7372000000005452), /* sr-TR */
+    static_cast<uint64_t>(0x7373000000000000), /* ss */
+    static_cast<uint64_t>(0x7374000000000000), /* st */
+    static_cast<uint64_t>(0x7375000000000000), /* su */
+    static_cast<uint64_t>(0x7376000000000000), /* sv */
+    static_cast<uint64_t>(0x7377000000000000), /* sw */
+    static_cast<uint64_t>(0x7461000000000000), /* ta */
+    static_cast<uint64_t>(0x7465000000000000), /* te */
+    static_cast<uint64_t>(0x7467000000000000), /* tg */
+    static_cast<uint64_t>(0x746700000000504b), /* tg-PK */
+    static_cast<uint64_t>(0x7467417261620000), /* tg-Arab */
+    static_cast<uint64_t>(0x7468000000000000), /* th */
+    static_cast<uint64_t>(0x7469000000000000), /* ti */
+    static_cast<uint64_t>(0x746b000000000000), /* tk */
+    static_cast<uint64_t>(0x746c000000000000), /* tl */
+    static_cast<uint64_t>(0x746e000000000000), /* tn */
+    static_cast<uint64_t>(0x746f000000000000), /* to */
+    static_cast<uint64_t>(0x7472000000000000), /* tr */
+    static_cast<uint64_t>(0x7473000000000000), /* ts */
+    static_cast<uint64_t>(0x7474000000000000), /* tt */
+    static_cast<uint64_t>(0x7479000000000000), /* ty */
+    static_cast<uint64_t>(0x7567000000000000), /* ug */
+    static_cast<uint64_t>(0x7567000000004b5a), /* ug-KZ */
+    static_cast<uint64_t>(0x7567000000004d4e), /* ug-MN */
+    static_cast<uint64_t>(0x75674379726c0000), /* ug-Cyrl */
+    static_cast<uint64_t>(0x756b000000000000), /* uk */
+    static_cast<uint64_t>(0x7572000000000000), /* ur */
+    static_cast<uint64_t>(0x757a000000000000), /* uz */
+    static_cast<uint64_t>(0x757a000000004146), /* uz-AF */
+    static_cast<uint64_t>(0x757a00000000434e), /* uz-CN */
+    static_cast<uint64_t>(0x757a417261620000), /* uz-Arab */
+    static_cast<uint64_t>(0x7665000000000000), /* ve */
+    static_cast<uint64_t>(0x7669000000000000), /* vi */
+    static_cast<uint64_t>(0x766f000000000000), /* vo */
+    static_cast<uint64_t>(0x7761000000000000), /* wa */
+    static_cast<uint64_t>(0x776f000000000000), /* wo */
+    static_cast<uint64_t>(0x7868000000000000), /* xh */
+    static_cast<uint64_t>(0x7969000000000000), /* yi */
+    static_cast<uint64_t>(0x796f000000000000), /* yo */
+    static_cast<uint64_t>(0x7a61000000000000), /* za */
+    static_cast<uint64_t>(0x7a68000000000000), /* zh */
+    static_cast<uint64_t>(0x7a68000000004155), /* zh-AU */
+    static_cast<uint64_t>(0x7a6800000000424e), /* zh-BN */
+    static_cast<uint64_t>(0x7a68000000004742), /* zh-GB */
+    static_cast<uint64_t>(0x7a68000000004746), /* zh-GF */
+    static_cast<uint64_t>(0x7a6800000000484b), /* zh-HK */
+    static_cast<uint64_t>(0x7a68000000004944), /* zh-ID */
+    static_cast<uint64_t>(0x7a68000000004d4f), /* zh-MO */
+    static_cast<uint64_t>(0x7a68000000005041), /* zh-PA */
+    static_cast<uint64_t>(0x7a68000000005046), /* zh-PF */
+    static_cast<uint64_t>(0x7a68000000005048), /* zh-PH */
+    static_cast<uint64_t>(0x7a68000000005352), /* zh-SR */
+    static_cast<uint64_t>(0x7a68000000005448), /* zh-TH */
+    static_cast<uint64_t>(0x7a68000000005457), /* zh-TW */
+    static_cast<uint64_t>(0x7a68000000005553), /* zh-US */
+    static_cast<uint64_t>(0x7a6800000000564e), /* zh-VN */
+    static_cast<uint64_t>(0x7a68426f706f0000), /* zh-Bopo */
+    static_cast<uint64_t>(0x7a6848616e620000), /* zh-Hanb */
+    static_cast<uint64_t>(0x7a6848616e740000), /* zh-Hant */
+    static_cast<uint64_t>(0x7a75000000000000), /* zu */
     static_cast<uint64_t>(0x8008000000000000), /* aai */
     static_cast<uint64_t>(0x800a000000000000), /* aak */
     static_cast<uint64_t>(0x8014000000000000), /* aau */
-    static_cast<uint64_t>(0x6162000000000000), /* ab */
     static_cast<uint64_t>(0x8028000000000000), /* abi */
     static_cast<uint64_t>(0x8030000000000000), /* abq */
     static_cast<uint64_t>(0x8031000000000000), /* abr */
@@ -38,10 +280,8 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x806f000000000000), /* adp */
     static_cast<uint64_t>(0x8078000000000000), /* ady */
     static_cast<uint64_t>(0x8079000000000000), /* adz */
-    static_cast<uint64_t>(0x6165000000000000), /* ae */
     static_cast<uint64_t>(0x8081000000000000), /* aeb */
     static_cast<uint64_t>(0x8098000000000000), /* aey */
-    static_cast<uint64_t>(0x6166000000000000), /* af */
     static_cast<uint64_t>(0x80c2000000000000), /* agc */
     static_cast<uint64_t>(0x80c3000000000000), /* agd */
     static_cast<uint64_t>(0x80c6000000000000), /* agg */
@@ -52,18 +292,15 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x80eb000000000000), /* ahl */
     static_cast<uint64_t>(0x80ee000000000000), /* aho */
     static_cast<uint64_t>(0x8126000000000000), /* ajg */
-    static_cast<uint64_t>(0x616b000000000000), /* ak */
     static_cast<uint64_t>(0x814a000000000000), /* akk */
     static_cast<uint64_t>(0x8160000000000000), /* ala */
     static_cast<uint64_t>(0x8168000000000000), /* ali */
     static_cast<uint64_t>(0x816d000000000000), /* aln */
     static_cast<uint64_t>(0x8173000000000000), /* alt */
-    static_cast<uint64_t>(0x616d000000000000), /* am */
     static_cast<uint64_t>(0x818c000000000000), /* amm */
     static_cast<uint64_t>(0x818d000000000000), /* amn */
     static_cast<uint64_t>(0x818e000000000000), /* amo */
     static_cast<uint64_t>(0x818f000000000000), /* amp */
-    static_cast<uint64_t>(0x616e000000000000), /* an */
     static_cast<uint64_t>(0x81a2000000000000), /* anc */
     static_cast<uint64_t>(0x81aa000000000000), /* ank */
     static_cast<uint64_t>(0x81ad000000000000), /* ann */
@@ -77,7 +314,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x81f1000000000000), /* apr */
     static_cast<uint64_t>(0x81f2000000000000), /* aps */
     static_cast<uint64_t>(0x81f9000000000000), /* apz */
-    static_cast<uint64_t>(0x6172000000000000), /* ar */
     static_cast<uint64_t>(0x8222000000000000), /* arc */
     static_cast<uint64_t>(0x82224e6261740000), /* arc-Nbat */
     static_cast<uint64_t>(0x822250616c6d0000), /* arc-Palm */
@@ -88,7 +324,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x8232000000000000), /* ars */
     static_cast<uint64_t>(0x8238000000000000), /* ary */
     static_cast<uint64_t>(0x8239000000000000), /* arz */
-    static_cast<uint64_t>(0x6173000000000000), /* as */
     static_cast<uint64_t>(0x8240000000000000), /* asa */
     static_cast<uint64_t>(0x8244000000000000), /* ase */
     static_cast<uint64_t>(0x8246000000000000), /* asg */
@@ -98,7 +333,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x8266000000000000), /* atg */
     static_cast<uint64_t>(0x8269000000000000), /* atj */
     static_cast<uint64_t>(0x8298000000000000), /* auy */
-    static_cast<uint64_t>(0x6176000000000000), /* av */
     static_cast<uint64_t>(0x82ab000000000000), /* avl */
     static_cast<uint64_t>(0x82ad000000000000), /* avn */
     static_cast<uint64_t>(0x82b3000000000000), /* avt */
@@ -107,14 +341,7 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x82c1000000000000), /* awb */
     static_cast<uint64_t>(0x82ce000000000000), /* awo */
     static_cast<uint64_t>(0x82d7000000000000), /* awx */
-    static_cast<uint64_t>(0x6179000000000000), /* ay */
     static_cast<uint64_t>(0x8301000000000000), /* ayb */
-    static_cast<uint64_t>(0x617a000000000000), /* az */
-    static_cast<uint64_t>(0x617a417261620000), /* az-Arab */
-    static_cast<uint64_t>(0x617a000000004951), /* az-IQ */
-    static_cast<uint64_t>(0x617a000000004952), /* az-IR */
-    static_cast<uint64_t>(0x617a000000005255), /* az-RU */
-    static_cast<uint64_t>(0x6261000000000000), /* ba */
     static_cast<uint64_t>(0x840b000000000000), /* bal */
     static_cast<uint64_t>(0x840d000000000000), /* ban */
     static_cast<uint64_t>(0x840f000000000000), /* bap */
@@ -138,7 +365,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x8450000000000000), /* bcq */
     static_cast<uint64_t>(0x8454000000000000), /* bcu */
     static_cast<uint64_t>(0x8463000000000000), /* bdd */
-    static_cast<uint64_t>(0x6265000000000000), /* be */
     static_cast<uint64_t>(0x8485000000000000), /* bef */
     static_cast<uint64_t>(0x8487000000000000), /* beh */
     static_cast<uint64_t>(0x8489000000000000), /* bej */
@@ -151,7 +377,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x84b0000000000000), /* bfq */
     static_cast<uint64_t>(0x84b3000000000000), /* bft */
     static_cast<uint64_t>(0x84b8000000000000), /* bfy */
-    static_cast<uint64_t>(0x6267000000000000), /* bg */
     static_cast<uint64_t>(0x84c2000000000000), /* bgc */
     static_cast<uint64_t>(0x84cd000000000000), /* bgn */
     static_cast<uint64_t>(0x84d7000000000000), /* bgx */
@@ -161,7 +386,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x84eb000000000000), /* bhl */
     static_cast<uint64_t>(0x84ee000000000000), /* bho */
     static_cast<uint64_t>(0x84f8000000000000), /* bhy */
-    static_cast<uint64_t>(0x6269000000000000), /* bi */
     static_cast<uint64_t>(0x8501000000000000), /* bib */
     static_cast<uint64_t>(0x8506000000000000), /* big */
     static_cast<uint64_t>(0x850a000000000000), /* bik */
@@ -183,16 +407,13 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x8554000000000000), /* bku */
     static_cast<uint64_t>(0x8555000000000000), /* bkv */
     static_cast<uint64_t>(0x8573000000000000), /* blt */
-    static_cast<uint64_t>(0x626d000000000000), /* bm */
     static_cast<uint64_t>(0x8587000000000000), /* bmh */
     static_cast<uint64_t>(0x858a000000000000), /* bmk */
     static_cast<uint64_t>(0x8590000000000000), /* bmq */
     static_cast<uint64_t>(0x8594000000000000), /* bmu */
-    static_cast<uint64_t>(0x626e000000000000), /* bn */
     static_cast<uint64_t>(0x85a6000000000000), /* bng */
     static_cast<uint64_t>(0x85ac000000000000), /* bnm */
     static_cast<uint64_t>(0x85af000000000000), /* bnp */
-    static_cast<uint64_t>(0x626f000000000000), /* bo */
     static_cast<uint64_t>(0x85c9000000000000), /* boj */
     static_cast<uint64_t>(0x85cc000000000000), /* bom */
     static_cast<uint64_t>(0x85cd000000000000), /* bon */
@@ -201,12 +422,10 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x8608000000000000), /* bqi */
     static_cast<uint64_t>(0x860f000000000000), /* bqp */
     static_cast<uint64_t>(0x8615000000000000), /* bqv */
-    static_cast<uint64_t>(0x6272000000000000), /* br */
     static_cast<uint64_t>(0x8620000000000000), /* bra */
     static_cast<uint64_t>(0x8627000000000000), /* brh */
     static_cast<uint64_t>(0x8637000000000000), /* brx */
     static_cast<uint64_t>(0x8639000000000000), /* brz */
-    static_cast<uint64_t>(0x6273000000000000), /* bs */
     static_cast<uint64_t>(0x8649000000000000), /* bsj */
     static_cast<uint64_t>(0x8650000000000000), /* bsq */
     static_cast<uint64_t>(0x8652000000000000), /* bss */
@@ -238,17 +457,14 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x8725000000000000), /* bzf */
     static_cast<uint64_t>(0x8727000000000000), /* bzh */
     static_cast<uint64_t>(0x8736000000000000), /* bzw */
-    static_cast<uint64_t>(0x6361000000000000), /* ca */
     static_cast<uint64_t>(0x8803000000000000), /* cad */
     static_cast<uint64_t>(0x880d000000000000), /* can */
     static_cast<uint64_t>(0x8829000000000000), /* cbj */
     static_cast<uint64_t>(0x8847000000000000), /* cch */
     static_cast<uint64_t>(0x884f000000000000), /* ccp */
-    static_cast<uint64_t>(0x6365000000000000), /* ce */
     static_cast<uint64_t>(0x8881000000000000), /* ceb */
     static_cast<uint64_t>(0x88a0000000000000), /* cfa */
     static_cast<uint64_t>(0x88c6000000000000), /* cgg */
-    static_cast<uint64_t>(0x6368000000000000), /* ch */
     static_cast<uint64_t>(0x88ea000000000000), /* chk */
     static_cast<uint64_t>(0x88ec000000000000), /* chm */
     static_cast<uint64_t>(0x88ee000000000000), /* cho */
@@ -265,25 +481,17 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x8960000000000000), /* cla */
     static_cast<uint64_t>(0x8984000000000000), /* cme */
     static_cast<uint64_t>(0x8986000000000000), /* cmg */
-    static_cast<uint64_t>(0x636f000000000000), /* co */
     static_cast<uint64_t>(0x89cf000000000000), /* cop */
     static_cast<uint64_t>(0x89f2000000000000), /* cps */
-    static_cast<uint64_t>(0x6372000000000000), /* cr */
     static_cast<uint64_t>(0x8a27000000000000), /* crh */
     static_cast<uint64_t>(0x8a29000000000000), /* crj */
     static_cast<uint64_t>(0x8a2a000000000000), /* crk */
     static_cast<uint64_t>(0x8a2b000000000000), /* crl */
     static_cast<uint64_t>(0x8a2c000000000000), /* crm */
     static_cast<uint64_t>(0x8a32000000000000), /* crs */
-    static_cast<uint64_t>(0x6373000000000000), /* cs */
     static_cast<uint64_t>(0x8a41000000000000), /* csb */
     static_cast<uint64_t>(0x8a56000000000000), /* csw */
     static_cast<uint64_t>(0x8a63000000000000), /* ctd */
-    static_cast<uint64_t>(0x6375000000000000), /* cu */
-    static_cast<uint64_t>(0x6375476c61670000), /* cu-Glag */
-    static_cast<uint64_t>(0x6376000000000000), /* cv */
-    static_cast<uint64_t>(0x6379000000000000), /* cy */
-    static_cast<uint64_t>(0x6461000000000000), /* da */
     static_cast<uint64_t>(0x8c03000000000000), /* dad */
     static_cast<uint64_t>(0x8c05000000000000), /* daf */
     static_cast<uint64_t>(0x8c06000000000000), /* dag */
@@ -295,7 +503,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x8c30000000000000), /* dbq */
     static_cast<uint64_t>(0x8c42000000000000), /* dcc */
     static_cast<uint64_t>(0x8c6d000000000000), /* ddn */
-    static_cast<uint64_t>(0x6465000000000000), /* de */
     static_cast<uint64_t>(0x8c83000000000000), /* ded */
     static_cast<uint64_t>(0x8c8d000000000000), /* den */
     static_cast<uint64_t>(0x8cc0000000000000), /* dga */
@@ -323,65 +530,48 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x8e82000000000000), /* duc */
     static_cast<uint64_t>(0x8e83000000000000), /* dud */
     static_cast<uint64_t>(0x8e86000000000000), /* dug */
-    static_cast<uint64_t>(0x6476000000000000), /* dv */
     static_cast<uint64_t>(0x8ea0000000000000), /* dva */
     static_cast<uint64_t>(0x8ed6000000000000), /* dww */
     static_cast<uint64_t>(0x8f0e000000000000), /* dyo */
     static_cast<uint64_t>(0x8f14000000000000), /* dyu */
-    static_cast<uint64_t>(0x647a000000000000), /* dz */
     static_cast<uint64_t>(0x8f26000000000000), /* dzg */
     static_cast<uint64_t>(0x9034000000000000), /* ebu */
-    static_cast<uint64_t>(0x6565000000000000), /* ee */
     static_cast<uint64_t>(0x90a8000000000000), /* efi */
     static_cast<uint64_t>(0x90cb000000000000), /* egl */
     static_cast<uint64_t>(0x90d8000000000000), /* egy */
     static_cast<uint64_t>(0x9140000000000000), /* eka */
     static_cast<uint64_t>(0x9158000000000000), /* eky */
-    static_cast<uint64_t>(0x656c000000000000), /* el */
     static_cast<uint64_t>(0x9180000000000000), /* ema */
     static_cast<uint64_t>(0x9188000000000000), /* emi */
-    static_cast<uint64_t>(0x656e000000000000), /* en */
-    static_cast<uint64_t>(0x656e536861770000), /* en-Shaw */
     static_cast<uint64_t>(0x91ad000000000000), /* enn */
     static_cast<uint64_t>(0x91b0000000000000), /* enq */
-    static_cast<uint64_t>(0x656f000000000000), /* eo */
     static_cast<uint64_t>(0x9228000000000000), /* eri */
-    static_cast<uint64_t>(0x6573000000000000), /* es */
     static_cast<uint64_t>(0x9246000000000000), /* esg */
     static_cast<uint64_t>(0x9254000000000000), /* esu */
-    static_cast<uint64_t>(0x6574000000000000), /* et */
     static_cast<uint64_t>(0x9271000000000000), /* etr */
     static_cast<uint64_t>(0x9273000000000000), /* ett */
     static_cast<uint64_t>(0x9274000000000000), /* etu */
     static_cast<uint64_t>(0x9277000000000000), /* etx */
-    static_cast<uint64_t>(0x6575000000000000), /* eu */
     static_cast<uint64_t>(0x92ce000000000000), /* ewo */
     static_cast<uint64_t>(0x92f3000000000000), /* ext */
     static_cast<uint64_t>(0x9320000000000000), /* eza */
-    static_cast<uint64_t>(0x6661000000000000), /* fa */
     static_cast<uint64_t>(0x9400000000000000), /* faa */
     static_cast<uint64_t>(0x9401000000000000), /* fab */
     static_cast<uint64_t>(0x9406000000000000), /* fag */
     static_cast<uint64_t>(0x9408000000000000), /* fai */
     static_cast<uint64_t>(0x940d000000000000), /* fan */
-    static_cast<uint64_t>(0x6666000000000000), /* ff */
-    static_cast<uint64_t>(0x666641646c6d0000), /* ff-Adlm */
     static_cast<uint64_t>(0x94a8000000000000), /* ffi */
     static_cast<uint64_t>(0x94ac000000000000), /* ffm */
-    static_cast<uint64_t>(0x6669000000000000), /* fi */
     static_cast<uint64_t>(0x9500000000000000), /* fia */
     static_cast<uint64_t>(0x950b000000000000), /* fil */
     static_cast<uint64_t>(0x9513000000000000), /* fit */
-    static_cast<uint64_t>(0x666a000000000000), /* fj */
     static_cast<uint64_t>(0x9571000000000000), /* flr */
     static_cast<uint64_t>(0x958f000000000000), /* fmp */
-    static_cast<uint64_t>(0x666f000000000000), /* fo */
     static_cast<uint64_t>(0x95c3000000000000), /* fod */
     static_cast<uint64_t>(0x95cd000000000000), /* fon */
     static_cast<uint64_t>(0x95d1000000000000), /* for */
     static_cast<uint64_t>(0x95e4000000000000), /* fpe */
     static_cast<uint64_t>(0x9612000000000000), /* fqs */
-    static_cast<uint64_t>(0x6672000000000000), /* fr */
     static_cast<uint64_t>(0x9622000000000000), /* frc */
     static_cast<uint64_t>(0x962f000000000000), /* frp */
     static_cast<uint64_t>(0x9631000000000000), /* frr */
@@ -396,8 +586,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x9695000000000000), /* fuv */
     static_cast<uint64_t>(0x9698000000000000), /* fuy */
     static_cast<uint64_t>(0x96b1000000000000), /* fvr */
-    static_cast<uint64_t>(0x6679000000000000), /* fy */
-    static_cast<uint64_t>(0x6761000000000000), /* ga */
     static_cast<uint64_t>(0x9800000000000000), /* gaa */
     static_cast<uint64_t>(0x9805000000000000), /* gaf */
     static_cast<uint64_t>(0x9806000000000000), /* gag */
@@ -413,7 +601,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x9838000000000000), /* gby */
     static_cast<uint64_t>(0x9839000000000000), /* gbz */
     static_cast<uint64_t>(0x9851000000000000), /* gcr */
-    static_cast<uint64_t>(0x6764000000000000), /* gd */
     static_cast<uint64_t>(0x9864000000000000), /* gde */
     static_cast<uint64_t>(0x986d000000000000), /* gdn */
     static_cast<uint64_t>(0x9871000000000000), /* gdr */
@@ -431,11 +618,9 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x9934000000000000), /* gju */
     static_cast<uint64_t>(0x994d000000000000), /* gkn */
     static_cast<uint64_t>(0x994f000000000000), /* gkp */
-    static_cast<uint64_t>(0x676c000000000000), /* gl */
     static_cast<uint64_t>(0x996a000000000000), /* glk */
     static_cast<uint64_t>(0x998c000000000000), /* gmm */
     static_cast<uint64_t>(0x9995000000000000), /* gmv */
-    static_cast<uint64_t>(0x676e000000000000), /* gn */
     static_cast<uint64_t>(0x99a3000000000000), /* gnd */
     static_cast<uint64_t>(0x99a6000000000000), /* gng */
     static_cast<uint64_t>(0x99c3000000000000), /* god */
@@ -452,7 +637,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x9a33000000000000), /* grt */
     static_cast<uint64_t>(0x9a36000000000000), /* grw */
     static_cast<uint64_t>(0x9a56000000000000), /* gsw */
-    static_cast<uint64_t>(0x6775000000000000), /* gu */
     static_cast<uint64_t>(0x9a81000000000000), /* gub */
     static_cast<uint64_t>(0x9a82000000000000), /* guc */
     static_cast<uint64_t>(0x9a83000000000000), /* gud */
@@ -460,7 +644,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x9a96000000000000), /* guw */
     static_cast<uint64_t>(0x9a97000000000000), /* gux */
     static_cast<uint64_t>(0x9a99000000000000), /* guz */
-    static_cast<uint64_t>(0x6776000000000000), /* gv */
     static_cast<uint64_t>(0x9aa5000000000000), /* gvf */
     static_cast<uint64_t>(0x9ab1000000000000), /* gvr */
     static_cast<uint64_t>(0x9ab2000000000000), /* gvs */
@@ -468,9 +651,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x9ac8000000000000), /* gwi */
     static_cast<uint64_t>(0x9ad3000000000000), /* gwt */
     static_cast<uint64_t>(0x9b08000000000000), /* gyi */
-    static_cast<uint64_t>(0x6861000000000000), /* ha */
-    static_cast<uint64_t>(0x686100000000434d), /* ha-CM */
-    static_cast<uint64_t>(0x6861000000005344), /* ha-SD */
     static_cast<uint64_t>(0x9c06000000000000), /* hag */
     static_cast<uint64_t>(0x9c0a000000000000), /* hak */
     static_cast<uint64_t>(0x9c0c000000000000), /* ham */
@@ -478,9 +658,7 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x9c19000000000000), /* haz */
     static_cast<uint64_t>(0x9c21000000000000), /* hbb */
     static_cast<uint64_t>(0x9c78000000000000), /* hdy */
-    static_cast<uint64_t>(0x6865000000000000), /* he */
     static_cast<uint64_t>(0x9cf8000000000000), /* hhy */
-    static_cast<uint64_t>(0x6869000000000000), /* hi */
     static_cast<uint64_t>(0x9d00000000000000), /* hia */
     static_cast<uint64_t>(0x9d05000000000000), /* hif */
     static_cast<uint64_t>(0x9d06000000000000), /* hig */
@@ -495,19 +673,12 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0x9da9000000000000), /* hnj */
     static_cast<uint64_t>(0x9dad000000000000), /* hnn */
     static_cast<uint64_t>(0x9dae000000000000), /* hno */
-    static_cast<uint64_t>(0x686f000000000000), /* ho */
     static_cast<uint64_t>(0x9dc2000000000000), /* hoc */
     static_cast<uint64_t>(0x9dc9000000000000), /* hoj */
     static_cast<uint64_t>(0x9dd3000000000000), /* hot */
-    static_cast<uint64_t>(0x6872000000000000), /* hr */
     static_cast<uint64_t>(0x9e41000000000000), /* hsb */
     static_cast<uint64_t>(0x9e4d000000000000), /* hsn */
-    static_cast<uint64_t>(0x6874000000000000), /* ht */
-    static_cast<uint64_t>(0x6875000000000000), /* hu */
     static_cast<uint64_t>(0x9e88000000000000), /* hui */
-    static_cast<uint64_t>(0x6879000000000000), /* hy */
-    static_cast<uint64_t>(0x687a000000000000), /* hz */
-    static_cast<uint64_t>(0x6961000000000000), /* ia */
     static_cast<uint64_t>(0xa00d000000000000), /* ian */
     static_cast<uint64_t>(0xa011000000000000), /* iar */
     static_cast<uint64_t>(0xa020000000000000), /* iba */
@@ -515,37 +686,26 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xa038000000000000), /* iby */
     static_cast<uint64_t>(0xa040000000000000), /* ica */
     static_cast<uint64_t>(0xa047000000000000), /* ich */
-    static_cast<uint64_t>(0x6964000000000000), /* id */
     static_cast<uint64_t>(0xa063000000000000), /* idd */
     static_cast<uint64_t>(0xa068000000000000), /* idi */
     static_cast<uint64_t>(0xa074000000000000), /* idu */
     static_cast<uint64_t>(0xa0a4000000000000), /* ife */
-    static_cast<uint64_t>(0x6967000000000000), /* ig */
     static_cast<uint64_t>(0xa0c1000000000000), /* igb */
     static_cast<uint64_t>(0xa0c4000000000000), /* ige */
-    static_cast<uint64_t>(0x6969000000000000), /* ii */
     static_cast<uint64_t>(0xa129000000000000), /* ijj */
-    static_cast<uint64_t>(0x696b000000000000), /* ik */
     static_cast<uint64_t>(0xa14a000000000000), /* ikk */
     static_cast<uint64_t>(0xa153000000000000), /* ikt */
     static_cast<uint64_t>(0xa156000000000000), /* ikw */
     static_cast<uint64_t>(0xa157000000000000), /* ikx */
     static_cast<uint64_t>(0xa16e000000000000), /* ilo */
     static_cast<uint64_t>(0xa18e000000000000), /* imo */
-    static_cast<uint64_t>(0x696e000000000000), /* in */
     static_cast<uint64_t>(0xa1a7000000000000), /* inh */
-    static_cast<uint64_t>(0x696f000000000000), /* io */
     static_cast<uint64_t>(0xa1d4000000000000), /* iou */
     static_cast<uint64_t>(0xa228000000000000), /* iri */
-    static_cast<uint64_t>(0x6973000000000000), /* is */
-    static_cast<uint64_t>(0x6974000000000000), /* it */
-    static_cast<uint64_t>(0x6975000000000000), /* iu */
-    static_cast<uint64_t>(0x6977000000000000), /* iw */
     static_cast<uint64_t>(0xa2cc000000000000), /* iwm */
     static_cast<uint64_t>(0xa2d2000000000000), /* iws */
     static_cast<uint64_t>(0xa327000000000000), /* izh */
     static_cast<uint64_t>(0xa328000000000000), /* izi */
-    static_cast<uint64_t>(0x6a61000000000000), /* ja */
     static_cast<uint64_t>(0xa401000000000000), /* jab */
     static_cast<uint64_t>(0xa40c000000000000), /* jam */
     static_cast<uint64_t>(0xa411000000000000), /* jar */
@@ -554,15 +714,11 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xa48d000000000000), /* jen */
     static_cast<uint64_t>(0xa4ca000000000000), /* jgk */
     static_cast<uint64_t>(0xa4ce000000000000), /* jgo */
-    static_cast<uint64_t>(0x6a69000000000000), /* ji */
     static_cast<uint64_t>(0xa501000000000000), /* jib */
     static_cast<uint64_t>(0xa582000000000000), /* jmc */
     static_cast<uint64_t>(0xa58b000000000000), /* jml */
     static_cast<uint64_t>(0xa620000000000000), /* jra */
     static_cast<uint64_t>(0xa693000000000000), /* jut */
-    static_cast<uint64_t>(0x6a76000000000000), /* jv */
-    static_cast<uint64_t>(0x6a77000000000000), /* jw */
-    static_cast<uint64_t>(0x6b61000000000000), /* ka */
     static_cast<uint64_t>(0xa800000000000000), /* kaa */
     static_cast<uint64_t>(0xa801000000000000), /* kab */
     static_cast<uint64_t>(0xa802000000000000), /* kac */
@@ -591,7 +747,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xa8ae000000000000), /* kfo */
     static_cast<uint64_t>(0xa8b1000000000000), /* kfr */
     static_cast<uint64_t>(0xa8b8000000000000), /* kfy */
-    static_cast<uint64_t>(0x6b67000000000000), /* kg */
     static_cast<uint64_t>(0xa8c4000000000000), /* kge */
     static_cast<uint64_t>(0xa8c5000000000000), /* kgf */
     static_cast<uint64_t>(0xa8cf000000000000), /* kgp */
@@ -603,39 +758,27 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xa8f3000000000000), /* kht */
     static_cast<uint64_t>(0xa8f6000000000000), /* khw */
     static_cast<uint64_t>(0xa8f9000000000000), /* khz */
-    static_cast<uint64_t>(0x6b69000000000000), /* ki */
     static_cast<uint64_t>(0xa909000000000000), /* kij */
     static_cast<uint64_t>(0xa914000000000000), /* kiu */
     static_cast<uint64_t>(0xa916000000000000), /* kiw */
-    static_cast<uint64_t>(0x6b6a000000000000), /* kj */
     static_cast<uint64_t>(0xa923000000000000), /* kjd */
     static_cast<uint64_t>(0xa926000000000000), /* kjg */
     static_cast<uint64_t>(0xa932000000000000), /* kjs */
     static_cast<uint64_t>(0xa938000000000000), /* kjy */
-    static_cast<uint64_t>(0x6b6b000000000000), /* kk */
-    static_cast<uint64_t>(0x6b6b000000004146), /* kk-AF */
-    static_cast<uint64_t>(0x6b6b417261620000), /* kk-Arab */
-    static_cast<uint64_t>(0x6b6b00000000434e), /* kk-CN */
-    static_cast<uint64_t>(0x6b6b000000004952), /* kk-IR */
-    static_cast<uint64_t>(0x6b6b000000004d4e), /* kk-MN */
     static_cast<uint64_t>(0xa942000000000000), /* kkc */
     static_cast<uint64_t>(0xa949000000000000), /* kkj */
-    static_cast<uint64_t>(0x6b6c000000000000), /* kl */
     static_cast<uint64_t>(0xa96d000000000000), /* kln */
     static_cast<uint64_t>(0xa970000000000000), /* klq */
     static_cast<uint64_t>(0xa973000000000000), /* klt */
     static_cast<uint64_t>(0xa977000000000000), /* klx */
-    static_cast<uint64_t>(0x6b6d000000000000), /* km */
     static_cast<uint64_t>(0xa981000000000000), /* kmb */
     static_cast<uint64_t>(0xa987000000000000), /* kmh */
     static_cast<uint64_t>(0xa98e000000000000), /* kmo */
     static_cast<uint64_t>(0xa992000000000000), /* kms */
     static_cast<uint64_t>(0xa994000000000000), /* kmu */
     static_cast<uint64_t>(0xa996000000000000), /* kmw */
-    static_cast<uint64_t>(0x6b6e000000000000), /* kn */
     static_cast<uint64_t>(0xa9a5000000000000), /* knf */
     static_cast<uint64_t>(0xa9af000000000000), /* knp */
-    static_cast<uint64_t>(0x6b6f000000000000), /* ko */
     static_cast<uint64_t>(0xa9c8000000000000), /* koi */
     static_cast<uint64_t>(0xa9ca000000000000), /* kok */
     static_cast<uint64_t>(0xa9cb000000000000), /* kol */
@@ -650,14 +793,12 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xaa05000000000000), /* kqf */
     static_cast<uint64_t>(0xaa12000000000000), /* kqs */
     static_cast<uint64_t>(0xaa18000000000000), /* kqy */
-    static_cast<uint64_t>(0x6b72000000000000), /* kr */
     static_cast<uint64_t>(0xaa22000000000000), /* krc */
     static_cast<uint64_t>(0xaa28000000000000), /* kri */
     static_cast<uint64_t>(0xaa29000000000000), /* krj */
     static_cast<uint64_t>(0xaa2b000000000000), /* krl */
     static_cast<uint64_t>(0xaa32000000000000), /* krs */
     static_cast<uint64_t>(0xaa34000000000000), /* kru */
-    static_cast<uint64_t>(0x6b73000000000000), /* ks */
     static_cast<uint64_t>(0xaa41000000000000), /* ksb */
     static_cast<uint64_t>(0xaa43000000000000), /* ksd */
     static_cast<uint64_t>(0xaa45000000000000), /* ksf */
@@ -668,10 +809,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xaa6c000000000000), /* ktm */
     static_cast<uint64_t>(0xaa6e000000000000), /* kto */
     static_cast<uint64_t>(0xaa71000000000000), /* ktr */
-    static_cast<uint64_t>(0x6b75000000000000), /* ku */
-    static_cast<uint64_t>(0x6b75417261620000), /* ku-Arab */
-    static_cast<uint64_t>(0x6b75000000004c42), /* ku-LB */
-    static_cast<uint64_t>(0x6b7559657a690000), /* ku-Yezi */
     static_cast<uint64_t>(0xaa81000000000000), /* kub */
     static_cast<uint64_t>(0xaa83000000000000), /* kud */
     static_cast<uint64_t>(0xaa84000000000000), /* kue */
@@ -680,11 +817,9 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xaa8d000000000000), /* kun */
     static_cast<uint64_t>(0xaa8f000000000000), /* kup */
     static_cast<uint64_t>(0xaa92000000000000), /* kus */
-    static_cast<uint64_t>(0x6b76000000000000), /* kv */
     static_cast<uint64_t>(0xaaa6000000000000), /* kvg */
     static_cast<uint64_t>(0xaab1000000000000), /* kvr */
     static_cast<uint64_t>(0xaab7000000000000), /* kvx */
-    static_cast<uint64_t>(0x6b77000000000000), /* kw */
     static_cast<uint64_t>(0xaac9000000000000), /* kwj */
     static_cast<uint64_t>(0xaace000000000000), /* kwo */
     static_cast<uint64_t>(0xaad0000000000000), /* kwq */
@@ -696,25 +831,18 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xaaef000000000000), /* kxp */
     static_cast<uint64_t>(0xaaf6000000000000), /* kxw */
     static_cast<uint64_t>(0xaaf9000000000000), /* kxz */
-    static_cast<uint64_t>(0x6b79000000000000), /* ky */
-    static_cast<uint64_t>(0x6b79417261620000), /* ky-Arab */
-    static_cast<uint64_t>(0x6b7900000000434e), /* ky-CN */
-    static_cast<uint64_t>(0x6b794c61746e0000), /* ky-Latn */
-    static_cast<uint64_t>(0x6b79000000005452), /* ky-TR */
     static_cast<uint64_t>(0xab04000000000000), /* kye */
     static_cast<uint64_t>(0xab17000000000000), /* kyx */
     static_cast<uint64_t>(0xab27000000000000), /* kzh */
     static_cast<uint64_t>(0xab29000000000000), /* kzj */
     static_cast<uint64_t>(0xab31000000000000), /* kzr */
     static_cast<uint64_t>(0xab33000000000000), /* kzt */
-    static_cast<uint64_t>(0x6c61000000000000), /* la */
     static_cast<uint64_t>(0xac01000000000000), /* lab */
     static_cast<uint64_t>(0xac03000000000000), /* lad */
     static_cast<uint64_t>(0xac06000000000000), /* lag */
     static_cast<uint64_t>(0xac07000000000000), /* lah */
     static_cast<uint64_t>(0xac09000000000000), /* laj */
     static_cast<uint64_t>(0xac12000000000000), /* las */
-    static_cast<uint64_t>(0x6c62000000000000), /* lb */
     static_cast<uint64_t>(0xac24000000000000), /* lbe */
     static_cast<uint64_t>(0xac34000000000000), /* lbu */
     static_cast<uint64_t>(0xac36000000000000), /* lbw */
@@ -728,9 +856,7 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xac90000000000000), /* leq */
     static_cast<uint64_t>(0xac94000000000000), /* leu */
     static_cast<uint64_t>(0xac99000000000000), /* lez */
-    static_cast<uint64_t>(0x6c67000000000000), /* lg */
     static_cast<uint64_t>(0xacc6000000000000), /* lgg */
-    static_cast<uint64_t>(0x6c69000000000000), /* li */
     static_cast<uint64_t>(0xad00000000000000), /* lia */
     static_cast<uint64_t>(0xad03000000000000), /* lid */
     static_cast<uint64_t>(0xad05000000000000), /* lif */
@@ -747,10 +873,8 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xad8d000000000000), /* lmn */
     static_cast<uint64_t>(0xad8e000000000000), /* lmo */
     static_cast<uint64_t>(0xad8f000000000000), /* lmp */
-    static_cast<uint64_t>(0x6c6e000000000000), /* ln */
     static_cast<uint64_t>(0xadb2000000000000), /* lns */
     static_cast<uint64_t>(0xadb4000000000000), /* lnu */
-    static_cast<uint64_t>(0x6c6f000000000000), /* lo */
     static_cast<uint64_t>(0xadc9000000000000), /* loj */
     static_cast<uint64_t>(0xadca000000000000), /* lok */
     static_cast<uint64_t>(0xadcb000000000000), /* lol */
@@ -758,14 +882,11 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xadd2000000000000), /* los */
     static_cast<uint64_t>(0xadd9000000000000), /* loz */
     static_cast<uint64_t>(0xae22000000000000), /* lrc */
-    static_cast<uint64_t>(0x6c74000000000000), /* lt */
     static_cast<uint64_t>(0xae66000000000000), /* ltg */
-    static_cast<uint64_t>(0x6c75000000000000), /* lu */
     static_cast<uint64_t>(0xae80000000000000), /* lua */
     static_cast<uint64_t>(0xae8e000000000000), /* luo */
     static_cast<uint64_t>(0xae98000000000000), /* luy */
     static_cast<uint64_t>(0xae99000000000000), /* luz */
-    static_cast<uint64_t>(0x6c76000000000000), /* lv */
     static_cast<uint64_t>(0xaecb000000000000), /* lwl */
     static_cast<uint64_t>(0xaf27000000000000), /* lzh */
     static_cast<uint64_t>(0xaf39000000000000), /* lzz */
@@ -809,41 +930,32 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xb0ad000000000000), /* mfn */
     static_cast<uint64_t>(0xb0ae000000000000), /* mfo */
     static_cast<uint64_t>(0xb0b0000000000000), /* mfq */
-    static_cast<uint64_t>(0x6d67000000000000), /* mg */
     static_cast<uint64_t>(0xb0c7000000000000), /* mgh */
     static_cast<uint64_t>(0xb0cb000000000000), /* mgl */
     static_cast<uint64_t>(0xb0ce000000000000), /* mgo */
     static_cast<uint64_t>(0xb0cf000000000000), /* mgp */
     static_cast<uint64_t>(0xb0d8000000000000), /* mgy */
-    static_cast<uint64_t>(0x6d68000000000000), /* mh */
     static_cast<uint64_t>(0xb0e8000000000000), /* mhi */
     static_cast<uint64_t>(0xb0eb000000000000), /* mhl */
-    static_cast<uint64_t>(0x6d69000000000000), /* mi */
     static_cast<uint64_t>(0xb105000000000000), /* mif */
     static_cast<uint64_t>(0xb10d000000000000), /* min */
     static_cast<uint64_t>(0xb112000000000000), /* mis */
     static_cast<uint64_t>(0xb1124d6564660000), /* mis-Medf */
     static_cast<uint64_t>(0xb116000000000000), /* miw */
-    static_cast<uint64_t>(0x6d6b000000000000), /* mk */
     static_cast<uint64_t>(0xb148000000000000), /* mki */
     static_cast<uint64_t>(0xb14b000000000000), /* mkl */
     static_cast<uint64_t>(0xb14f000000000000), /* mkp */
     static_cast<uint64_t>(0xb156000000000000), /* mkw */
-    static_cast<uint64_t>(0x6d6c000000000000), /* ml */
     static_cast<uint64_t>(0xb164000000000000), /* mle */
     static_cast<uint64_t>(0xb16f000000000000), /* mlp */
     static_cast<uint64_t>(0xb172000000000000), /* mls */
     static_cast<uint64_t>(0xb18e000000000000), /* mmo */
     static_cast<uint64_t>(0xb194000000000000), /* mmu */
     static_cast<uint64_t>(0xb197000000000000), /* mmx */
-    static_cast<uint64_t>(0x6d6e000000000000), /* mn */
-    static_cast<uint64_t>(0x6d6e00000000434e), /* mn-CN */
-    static_cast<uint64_t>(0x6d6e4d6f6e670000), /* mn-Mong */
     static_cast<uint64_t>(0xb1a0000000000000), /* mna */
     static_cast<uint64_t>(0xb1a5000000000000), /* mnf */
     static_cast<uint64_t>(0xb1a8000000000000), /* mni */
     static_cast<uint64_t>(0xb1b6000000000000), /* mnw */
-    static_cast<uint64_t>(0x6d6f000000000000), /* mo */
     static_cast<uint64_t>(0xb1c0000000000000), /* moa */
     static_cast<uint64_t>(0xb1c4000000000000), /* moe */
     static_cast<uint64_t>(0xb1c7000000000000), /* moh */
@@ -854,13 +966,9 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xb1f3000000000000), /* mpt */
     static_cast<uint64_t>(0xb1f7000000000000), /* mpx */
     static_cast<uint64_t>(0xb20b000000000000), /* mql */
-    static_cast<uint64_t>(0x6d72000000000000), /* mr */
     static_cast<uint64_t>(0xb223000000000000), /* mrd */
     static_cast<uint64_t>(0xb229000000000000), /* mrj */
     static_cast<uint64_t>(0xb22e000000000000), /* mro */
-    static_cast<uint64_t>(0x6d73000000000000), /* ms */
-    static_cast<uint64_t>(0x6d73000000004343), /* ms-CC */
-    static_cast<uint64_t>(0x6d74000000000000), /* mt */
     static_cast<uint64_t>(0xb262000000000000), /* mtc */
     static_cast<uint64_t>(0xb265000000000000), /* mtf */
     static_cast<uint64_t>(0xb268000000000000), /* mti */
@@ -877,7 +985,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xb2d6000000000000), /* mww */
     static_cast<uint64_t>(0xb2e2000000000000), /* mxc */
     static_cast<uint64_t>(0xb2ec000000000000), /* mxm */
-    static_cast<uint64_t>(0x6d79000000000000), /* my */
     static_cast<uint64_t>(0xb30a000000000000), /* myk */
     static_cast<uint64_t>(0xb30c000000000000), /* mym */
     static_cast<uint64_t>(0xb315000000000000), /* myv */
@@ -890,7 +997,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xb32f000000000000), /* mzp */
     static_cast<uint64_t>(0xb336000000000000), /* mzw */
     static_cast<uint64_t>(0xb339000000000000), /* mzz */
-    static_cast<uint64_t>(0x6e61000000000000), /* na */
     static_cast<uint64_t>(0xb402000000000000), /* nac */
     static_cast<uint64_t>(0xb405000000000000), /* naf */
     static_cast<uint64_t>(0xb40a000000000000), /* nak */
@@ -898,22 +1004,18 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xb40f000000000000), /* nap */
     static_cast<uint64_t>(0xb410000000000000), /* naq */
     static_cast<uint64_t>(0xb412000000000000), /* nas */
-    static_cast<uint64_t>(0x6e62000000000000), /* nb */
     static_cast<uint64_t>(0xb440000000000000), /* nca */
     static_cast<uint64_t>(0xb444000000000000), /* nce */
     static_cast<uint64_t>(0xb445000000000000), /* ncf */
     static_cast<uint64_t>(0xb447000000000000), /* nch */
     static_cast<uint64_t>(0xb44e000000000000), /* nco */
     static_cast<uint64_t>(0xb454000000000000), /* ncu */
-    static_cast<uint64_t>(0x6e64000000000000), /* nd */
     static_cast<uint64_t>(0xb462000000000000), /* ndc */
     static_cast<uint64_t>(0xb472000000000000), /* nds */
-    static_cast<uint64_t>(0x6e65000000000000), /* ne */
     static_cast<uint64_t>(0xb481000000000000), /* neb */
     static_cast<uint64_t>(0xb496000000000000), /* new */
     static_cast<uint64_t>(0xb497000000000000), /* nex */
     static_cast<uint64_t>(0xb4b1000000000000), /* nfr */
-    static_cast<uint64_t>(0x6e67000000000000), /* ng */
     static_cast<uint64_t>(0xb4c0000000000000), /* nga */
     static_cast<uint64_t>(0xb4c1000000000000), /* ngb */
     static_cast<uint64_t>(0xb4cb000000000000), /* ngl */
@@ -930,23 +1032,19 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xb52e000000000000), /* njo */
     static_cast<uint64_t>(0xb546000000000000), /* nkg */
     static_cast<uint64_t>(0xb54e000000000000), /* nko */
-    static_cast<uint64_t>(0x6e6c000000000000), /* nl */
     static_cast<uint64_t>(0xb586000000000000), /* nmg */
     static_cast<uint64_t>(0xb599000000000000), /* nmz */
-    static_cast<uint64_t>(0x6e6e000000000000), /* nn */
     static_cast<uint64_t>(0xb5a5000000000000), /* nnf */
     static_cast<uint64_t>(0xb5a7000000000000), /* nnh */
     static_cast<uint64_t>(0xb5aa000000000000), /* nnk */
     static_cast<uint64_t>(0xb5ac000000000000), /* nnm */
     static_cast<uint64_t>(0xb5af000000000000), /* nnp */
-    static_cast<uint64_t>(0x6e6f000000000000), /* no */
     static_cast<uint64_t>(0xb5c3000000000000), /* nod */
     static_cast<uint64_t>(0xb5c4000000000000), /* noe */
     static_cast<uint64_t>(0xb5cd000000000000), /* non */
     static_cast<uint64_t>(0xb5cf000000000000), /* nop */
     static_cast<uint64_t>(0xb5d4000000000000), /* nou */
     static_cast<uint64_t>(0xb60e000000000000), /* nqo */
-    static_cast<uint64_t>(0x6e72000000000000), /* nr */
     static_cast<uint64_t>(0xb621000000000000), /* nrb */
     static_cast<uint64_t>(0xb64a000000000000), /* nsk */
     static_cast<uint64_t>(0xb64d000000000000), /* nsn */
@@ -959,34 +1057,25 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xb692000000000000), /* nus */
     static_cast<uint64_t>(0xb695000000000000), /* nuv */
     static_cast<uint64_t>(0xb697000000000000), /* nux */
-    static_cast<uint64_t>(0x6e76000000000000), /* nv */
     static_cast<uint64_t>(0xb6c1000000000000), /* nwb */
     static_cast<uint64_t>(0xb6f0000000000000), /* nxq */
     static_cast<uint64_t>(0xb6f1000000000000), /* nxr */
-    static_cast<uint64_t>(0x6e79000000000000), /* ny */
     static_cast<uint64_t>(0xb70c000000000000), /* nym */
     static_cast<uint64_t>(0xb70d000000000000), /* nyn */
     static_cast<uint64_t>(0xb728000000000000), /* nzi */
-    static_cast<uint64_t>(0x6f63000000000000), /* oc */
     static_cast<uint64_t>(0xb8c2000000000000), /* ogc */
     static_cast<uint64_t>(0xb951000000000000), /* okr */
     static_cast<uint64_t>(0xb955000000000000), /* okv */
-    static_cast<uint64_t>(0x6f6d000000000000), /* om */
     static_cast<uint64_t>(0xb9a6000000000000), /* ong */
     static_cast<uint64_t>(0xb9ad000000000000), /* onn */
     static_cast<uint64_t>(0xb9b2000000000000), /* ons */
     static_cast<uint64_t>(0xb9ec000000000000), /* opm */
-    static_cast<uint64_t>(0x6f72000000000000), /* or */
     static_cast<uint64_t>(0xba2e000000000000), /* oro */
     static_cast<uint64_t>(0xba34000000000000), /* oru */
-    static_cast<uint64_t>(0x6f73000000000000), /* os */
     static_cast<uint64_t>(0xba40000000000000), /* osa */
     static_cast<uint64_t>(0xba60000000000000), /* ota */
     static_cast<uint64_t>(0xba6a000000000000), /* otk */
     static_cast<uint64_t>(0xbb2c000000000000), /* ozm */
-    static_cast<uint64_t>(0x7061000000000000), /* pa */
-    static_cast<uint64_t>(0x7061417261620000), /* pa-Arab */
-    static_cast<uint64_t>(0x706100000000504b), /* pa-PK */
     static_cast<uint64_t>(0xbc06000000000000), /* pag */
     static_cast<uint64_t>(0xbc0b000000000000), /* pal */
     static_cast<uint64_t>(0xbc0b50686c700000), /* pal-Phlp */
@@ -1008,7 +1097,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xbd0f000000000000), /* pip */
     static_cast<uint64_t>(0xbd40000000000000), /* pka */
     static_cast<uint64_t>(0xbd4e000000000000), /* pko */
-    static_cast<uint64_t>(0x706c000000000000), /* pl */
     static_cast<uint64_t>(0xbd60000000000000), /* pla */
     static_cast<uint64_t>(0xbd92000000000000), /* pms */
     static_cast<uint64_t>(0xbda6000000000000), /* png */
@@ -1020,13 +1108,10 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xbe20000000000000), /* pra */
     static_cast<uint64_t>(0xbe23000000000000), /* prd */
     static_cast<uint64_t>(0xbe26000000000000), /* prg */
-    static_cast<uint64_t>(0x7073000000000000), /* ps */
     static_cast<uint64_t>(0xbe52000000000000), /* pss */
-    static_cast<uint64_t>(0x7074000000000000), /* pt */
     static_cast<uint64_t>(0xbe6f000000000000), /* ptp */
     static_cast<uint64_t>(0xbe94000000000000), /* puu */
     static_cast<uint64_t>(0xbec0000000000000), /* pwa */
-    static_cast<uint64_t>(0x7175000000000000), /* qu */
     static_cast<uint64_t>(0xc282000000000000), /* quc */
     static_cast<uint64_t>(0xc286000000000000), /* qug */
     static_cast<uint64_t>(0xc408000000000000), /* rai */
@@ -1043,28 +1128,22 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xc505000000004e4c), /* rif-NL */
     static_cast<uint64_t>(0xc532000000000000), /* rjs */
     static_cast<uint64_t>(0xc553000000000000), /* rkt */
-    static_cast<uint64_t>(0x726d000000000000), /* rm */
     static_cast<uint64_t>(0xc585000000000000), /* rmf */
     static_cast<uint64_t>(0xc58e000000000000), /* rmo */
     static_cast<uint64_t>(0xc593000000000000), /* rmt */
     static_cast<uint64_t>(0xc594000000000000), /* rmu */
-    static_cast<uint64_t>(0x726e000000000000), /* rn */
     static_cast<uint64_t>(0xc5a0000000000000), /* rna */
     static_cast<uint64_t>(0xc5a6000000000000), /* rng */
-    static_cast<uint64_t>(0x726f000000000000), /* ro */
     static_cast<uint64_t>(0xc5c1000000000000), /* rob */
     static_cast<uint64_t>(0xc5c5000000000000), /* rof */
     static_cast<uint64_t>(0xc5ce000000000000), /* roo */
     static_cast<uint64_t>(0xc62e000000000000), /* rro */
     static_cast<uint64_t>(0xc66c000000000000), /* rtm */
-    static_cast<uint64_t>(0x7275000000000000), /* ru */
     static_cast<uint64_t>(0xc684000000000000), /* rue */
     static_cast<uint64_t>(0xc686000000000000), /* rug */
-    static_cast<uint64_t>(0x7277000000000000), /* rw */
     static_cast<uint64_t>(0xc6ca000000000000), /* rwk */
     static_cast<uint64_t>(0xc6ce000000000000), /* rwo */
     static_cast<uint64_t>(0xc714000000000000), /* ryu */
-    static_cast<uint64_t>(0x7361000000000000), /* sa */
     static_cast<uint64_t>(0xc805000000000000), /* saf */
     static_cast<uint64_t>(0xc807000000000000), /* sah */
     static_cast<uint64_t>(0xc810000000000000), /* saq */
@@ -1075,24 +1154,17 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xc820000000000000), /* sba */
     static_cast<uint64_t>(0xc824000000000000), /* sbe */
     static_cast<uint64_t>(0xc82f000000000000), /* sbp */
-    static_cast<uint64_t>(0x7363000000000000), /* sc */
     static_cast<uint64_t>(0xc84a000000000000), /* sck */
     static_cast<uint64_t>(0xc84b000000000000), /* scl */
     static_cast<uint64_t>(0xc84d000000000000), /* scn */
     static_cast<uint64_t>(0xc84e000000000000), /* sco */
     static_cast<uint64_t>(0xc852000000000000), /* scs */
-    static_cast<uint64_t>(0x7364000000000000), /* sd */
-    static_cast<uint64_t>(0x7364446576610000), /* sd-Deva */
-    static_cast<uint64_t>(0x73644b686f6a0000), /* sd-Khoj */
-    static_cast<uint64_t>(0x736453696e640000), /* sd-Sind */
     static_cast<uint64_t>(0xc862000000000000), /* sdc */
     static_cast<uint64_t>(0xc867000000000000), /* sdh */
-    static_cast<uint64_t>(0x7365000000000000), /* se */
     static_cast<uint64_t>(0xc885000000000000), /* sef */
     static_cast<uint64_t>(0xc887000000000000), /* seh */
     static_cast<uint64_t>(0xc888000000000000), /* sei */
     static_cast<uint64_t>(0xc892000000000000), /* ses */
-    static_cast<uint64_t>(0x7367000000000000), /* sg */
     static_cast<uint64_t>(0xc8c0000000000000), /* sga */
     static_cast<uint64_t>(0xc8d2000000000000), /* sgs */
     static_cast<uint64_t>(0xc8d6000000000000), /* sgw */
@@ -1101,35 +1173,29 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xc8ea000000000000), /* shk */
     static_cast<uint64_t>(0xc8ed000000000000), /* shn */
     static_cast<uint64_t>(0xc8f4000000000000), /* shu */
-    static_cast<uint64_t>(0x7369000000000000), /* si */
     static_cast<uint64_t>(0xc903000000000000), /* sid */
     static_cast<uint64_t>(0xc906000000000000), /* sig */
     static_cast<uint64_t>(0xc90b000000000000), /* sil */
     static_cast<uint64_t>(0xc90c000000000000), /* sim */
     static_cast<uint64_t>(0xc931000000000000), /* sjr */
-    static_cast<uint64_t>(0x736b000000000000), /* sk */
     static_cast<uint64_t>(0xc942000000000000), /* skc */
     static_cast<uint64_t>(0xc951000000000000), /* skr */
     static_cast<uint64_t>(0xc952000000000000), /* sks */
-    static_cast<uint64_t>(0x736c000000000000), /* sl */
     static_cast<uint64_t>(0xc963000000000000), /* sld */
     static_cast<uint64_t>(0xc968000000000000), /* sli */
     static_cast<uint64_t>(0xc96b000000000000), /* sll */
     static_cast<uint64_t>(0xc978000000000000), /* sly */
-    static_cast<uint64_t>(0x736d000000000000), /* sm */
     static_cast<uint64_t>(0xc980000000000000), /* sma */
     static_cast<uint64_t>(0xc989000000000000), /* smj */
     static_cast<uint64_t>(0xc98d000000000000), /* smn */
     static_cast<uint64_t>(0xc98f000000000000), /* smp */
     static_cast<uint64_t>(0xc990000000000000), /* smq */
     static_cast<uint64_t>(0xc992000000000000), /* sms */
-    static_cast<uint64_t>(0x736e000000000000), /* sn */
     static_cast<uint64_t>(0xc9a2000000000000), /* snc */
     static_cast<uint64_t>(0xc9aa000000000000), /* snk */
     static_cast<uint64_t>(0xc9af000000000000), /* snp */
     static_cast<uint64_t>(0xc9b7000000000000), /* snx */
     static_cast<uint64_t>(0xc9b8000000000000), /* sny */
-    static_cast<uint64_t>(0x736f000000000000), /* so */
     static_cast<uint64_t>(0xc9c6000000000000), /* sog */
     static_cast<uint64_t>(0xc9ca000000000000), /* sok */
     static_cast<uint64_t>(0xc9d0000000000000), /* soq */
@@ -1138,31 +1204,20 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xc9e3000000000000), /* spd */
     static_cast<uint64_t>(0xc9eb000000000000), /* spl */
     static_cast<uint64_t>(0xc9f2000000000000), /* sps */
-    static_cast<uint64_t>(0x7371000000000000), /* sq */
-    static_cast<uint64_t>(0x7372000000000000), /* sr */
-    static_cast<uint64_t>(0x7372000000004d45), /* sr-ME */
-    static_cast<uint64_t>(0x737200000000524f), /* sr-RO */
-    static_cast<uint64_t>(0x7372000000005255), /* sr-RU */
-    static_cast<uint64_t>(0x7372000000005452), /* sr-TR */
     static_cast<uint64_t>(0xca21000000000000), /* srb */
     static_cast<uint64_t>(0xca2d000000000000), /* srn */
     static_cast<uint64_t>(0xca31000000000000), /* srr */
     static_cast<uint64_t>(0xca37000000000000), /* srx */
-    static_cast<uint64_t>(0x7373000000000000), /* ss */
     static_cast<uint64_t>(0xca43000000000000), /* ssd */
     static_cast<uint64_t>(0xca46000000000000), /* ssg */
     static_cast<uint64_t>(0xca58000000000000), /* ssy */
-    static_cast<uint64_t>(0x7374000000000000), /* st */
     static_cast<uint64_t>(0xca6a000000000000), /* stk */
     static_cast<uint64_t>(0xca70000000000000), /* stq */
-    static_cast<uint64_t>(0x7375000000000000), /* su */
     static_cast<uint64_t>(0xca80000000000000), /* sua */
     static_cast<uint64_t>(0xca84000000000000), /* sue */
     static_cast<uint64_t>(0xca8a000000000000), /* suk */
     static_cast<uint64_t>(0xca91000000000000), /* sur */
     static_cast<uint64_t>(0xca92000000000000), /* sus */
-    static_cast<uint64_t>(0x7376000000000000), /* sv */
-    static_cast<uint64_t>(0x7377000000000000), /* sw */
     static_cast<uint64_t>(0xcac1000000000000), /* swb */
     static_cast<uint64_t>(0xcac2000000000000), /* swc */
     static_cast<uint64_t>(0xcac6000000000000), /* swg */
@@ -1173,7 +1228,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xcb0b000000000000), /* syl */
     static_cast<uint64_t>(0xcb11000000000000), /* syr */
     static_cast<uint64_t>(0xcb2b000000000000), /* szl */
-    static_cast<uint64_t>(0x7461000000000000), /* ta */
     static_cast<uint64_t>(0xcc09000000000000), /* taj */
     static_cast<uint64_t>(0xcc0b000000000000), /* tal */
     static_cast<uint64_t>(0xcc0d000000000000), /* tan */
@@ -1191,42 +1245,32 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xcc66000000000000), /* tdg */
     static_cast<uint64_t>(0xcc67000000000000), /* tdh */
     static_cast<uint64_t>(0xcc74000000000000), /* tdu */
-    static_cast<uint64_t>(0x7465000000000000), /* te */
     static_cast<uint64_t>(0xcc83000000000000), /* ted */
     static_cast<uint64_t>(0xcc8c000000000000), /* tem */
     static_cast<uint64_t>(0xcc8e000000000000), /* teo */
     static_cast<uint64_t>(0xcc93000000000000), /* tet */
     static_cast<uint64_t>(0xcca8000000000000), /* tfi */
-    static_cast<uint64_t>(0x7467000000000000), /* tg */
-    static_cast<uint64_t>(0x7467417261620000), /* tg-Arab */
-    static_cast<uint64_t>(0x746700000000504b), /* tg-PK */
     static_cast<uint64_t>(0xccc2000000000000), /* tgc */
     static_cast<uint64_t>(0xccce000000000000), /* tgo */
     static_cast<uint64_t>(0xccd4000000000000), /* tgu */
-    static_cast<uint64_t>(0x7468000000000000), /* th */
     static_cast<uint64_t>(0xcceb000000000000), /* thl */
     static_cast<uint64_t>(0xccf0000000000000), /* thq */
     static_cast<uint64_t>(0xccf1000000000000), /* thr */
-    static_cast<uint64_t>(0x7469000000000000), /* ti */
     static_cast<uint64_t>(0xcd05000000000000), /* tif */
     static_cast<uint64_t>(0xcd06000000000000), /* tig */
     static_cast<uint64_t>(0xcd0a000000000000), /* tik */
     static_cast<uint64_t>(0xcd0c000000000000), /* tim */
     static_cast<uint64_t>(0xcd0e000000000000), /* tio */
     static_cast<uint64_t>(0xcd15000000000000), /* tiv */
-    static_cast<uint64_t>(0x746b000000000000), /* tk */
     static_cast<uint64_t>(0xcd4b000000000000), /* tkl */
     static_cast<uint64_t>(0xcd51000000000000), /* tkr */
     static_cast<uint64_t>(0xcd53000000000000), /* tkt */
-    static_cast<uint64_t>(0x746c000000000000), /* tl */
     static_cast<uint64_t>(0xcd65000000000000), /* tlf */
     static_cast<uint64_t>(0xcd77000000000000), /* tlx */
     static_cast<uint64_t>(0xcd78000000000000), /* tly */
     static_cast<uint64_t>(0xcd87000000000000), /* tmh */
     static_cast<uint64_t>(0xcd98000000000000), /* tmy */
-    static_cast<uint64_t>(0x746e000000000000), /* tn */
     static_cast<uint64_t>(0xcda7000000000000), /* tnh */
-    static_cast<uint64_t>(0x746f000000000000), /* to */
     static_cast<uint64_t>(0xcdc5000000000000), /* tof */
     static_cast<uint64_t>(0xcdc6000000000000), /* tog */
     static_cast<uint64_t>(0xcdd0000000000000), /* toq */
@@ -1234,17 +1278,14 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xcdec000000000000), /* tpm */
     static_cast<uint64_t>(0xcdf9000000000000), /* tpz */
     static_cast<uint64_t>(0xce0e000000000000), /* tqo */
-    static_cast<uint64_t>(0x7472000000000000), /* tr */
     static_cast<uint64_t>(0xce34000000000000), /* tru */
     static_cast<uint64_t>(0xce35000000000000), /* trv */
     static_cast<uint64_t>(0xce36000000000000), /* trw */
-    static_cast<uint64_t>(0x7473000000000000), /* ts */
     static_cast<uint64_t>(0xce43000000000000), /* tsd */
     static_cast<uint64_t>(0xce45000000000000), /* tsf */
     static_cast<uint64_t>(0xce46000000000000), /* tsg */
     static_cast<uint64_t>(0xce49000000000000), /* tsj */
     static_cast<uint64_t>(0xce56000000000000), /* tsw */
-    static_cast<uint64_t>(0x7474000000000000), /* tt */
     static_cast<uint64_t>(0xce63000000000000), /* ttd */
     static_cast<uint64_t>(0xce64000000000000), /* tte */
     static_cast<uint64_t>(0xce69000000000000), /* ttj */
@@ -1261,26 +1302,19 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xcec7000000000000), /* twh */
     static_cast<uint64_t>(0xced0000000000000), /* twq */
     static_cast<uint64_t>(0xcee6000000000000), /* txg */
-    static_cast<uint64_t>(0x7479000000000000), /* ty */
     static_cast<uint64_t>(0xcf00000000000000), /* tya */
     static_cast<uint64_t>(0xcf15000000000000), /* tyv */
     static_cast<uint64_t>(0xcf2c000000000000), /* tzm */
     static_cast<uint64_t>(0xd034000000000000), /* ubu */
     static_cast<uint64_t>(0xd06c000000000000), /* udm */
-    static_cast<uint64_t>(0x7567000000000000), /* ug */
-    static_cast<uint64_t>(0x75674379726c0000), /* ug-Cyrl */
-    static_cast<uint64_t>(0x7567000000004b5a), /* ug-KZ */
-    static_cast<uint64_t>(0x7567000000004d4e), /* ug-MN */
     static_cast<uint64_t>(0xd0c0000000000000), /* uga */
-    static_cast<uint64_t>(0x756b000000000000), /* uk */
     static_cast<uint64_t>(0xd168000000000000), /* uli */
     static_cast<uint64_t>(0xd181000000000000), /* umb */
     static_cast<uint64_t>(0xd1b1000000000000), /* unr */
-    static_cast<uint64_t>(0xd1b1446576610000), /* unr-Deva */
     static_cast<uint64_t>(0xd1b1000000004e50), /* unr-NP */
+    static_cast<uint64_t>(0xd1b1446576610000), /* unr-Deva */
     static_cast<uint64_t>(0xd1b7000000000000), /* unx */
     static_cast<uint64_t>(0xd1ca000000000000), /* uok */
-    static_cast<uint64_t>(0x7572000000000000), /* ur */
     static_cast<uint64_t>(0xd228000000000000), /* uri */
     static_cast<uint64_t>(0xd233000000000000), /* urt */
     static_cast<uint64_t>(0xd236000000000000), /* urw */
@@ -1289,28 +1323,20 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xd271000000000000), /* utr */
     static_cast<uint64_t>(0xd2a7000000000000), /* uvh */
     static_cast<uint64_t>(0xd2ab000000000000), /* uvl */
-    static_cast<uint64_t>(0x757a000000000000), /* uz */
-    static_cast<uint64_t>(0x757a000000004146), /* uz-AF */
-    static_cast<uint64_t>(0x757a417261620000), /* uz-Arab */
-    static_cast<uint64_t>(0x757a00000000434e), /* uz-CN */
     static_cast<uint64_t>(0xd406000000000000), /* vag */
     static_cast<uint64_t>(0xd408000000000000), /* vai */
     static_cast<uint64_t>(0xd40d000000000000), /* van */
-    static_cast<uint64_t>(0x7665000000000000), /* ve */
     static_cast<uint64_t>(0xd482000000000000), /* vec */
     static_cast<uint64_t>(0xd48f000000000000), /* vep */
-    static_cast<uint64_t>(0x7669000000000000), /* vi */
     static_cast<uint64_t>(0xd502000000000000), /* vic */
     static_cast<uint64_t>(0xd515000000000000), /* viv */
     static_cast<uint64_t>(0xd572000000000000), /* vls */
     static_cast<uint64_t>(0xd585000000000000), /* vmf */
     static_cast<uint64_t>(0xd596000000000000), /* vmw */
-    static_cast<uint64_t>(0x766f000000000000), /* vo */
     static_cast<uint64_t>(0xd5d3000000000000), /* vot */
     static_cast<uint64_t>(0xd62e000000000000), /* vro */
     static_cast<uint64_t>(0xd68d000000000000), /* vun */
     static_cast<uint64_t>(0xd693000000000000), /* vut */
-    static_cast<uint64_t>(0x7761000000000000), /* wa */
     static_cast<uint64_t>(0xd804000000000000), /* wae */
     static_cast<uint64_t>(0xd809000000000000), /* waj */
     static_cast<uint64_t>(0xd80b000000000000), /* wal */
@@ -1333,7 +1359,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xd9a2000000000000), /* wnc */
     static_cast<uint64_t>(0xd9a8000000000000), /* wni */
     static_cast<uint64_t>(0xd9b4000000000000), /* wnu */
-    static_cast<uint64_t>(0x776f000000000000), /* wo */
     static_cast<uint64_t>(0xd9c1000000000000), /* wob */
     static_cast<uint64_t>(0xd9d2000000000000), /* wos */
     static_cast<uint64_t>(0xda32000000000000), /* wrs */
@@ -1348,7 +1373,6 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xdc4e000000000000), /* xco */
     static_cast<uint64_t>(0xdc51000000000000), /* xcr */
     static_cast<uint64_t>(0xdc92000000000000), /* xes */
-    static_cast<uint64_t>(0x7868000000000000), /* xh */
     static_cast<uint64_t>(0xdd60000000000000), /* xla */
     static_cast<uint64_t>(0xdd62000000000000), /* xlc */
     static_cast<uint64_t>(0xdd63000000000000), /* xld */
@@ -1380,13 +1404,11 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xe091000000000000), /* yer */
     static_cast<uint64_t>(0xe0d1000000000000), /* ygr */
     static_cast<uint64_t>(0xe0d6000000000000), /* ygw */
-    static_cast<uint64_t>(0x7969000000000000), /* yi */
     static_cast<uint64_t>(0xe14e000000000000), /* yko */
     static_cast<uint64_t>(0xe164000000000000), /* yle */
     static_cast<uint64_t>(0xe166000000000000), /* ylg */
     static_cast<uint64_t>(0xe16b000000000000), /* yll */
     static_cast<uint64_t>(0xe18b000000000000), /* yml */
-    static_cast<uint64_t>(0x796f000000000000), /* yo */
     static_cast<uint64_t>(0xe1cd000000000000), /* yon */
     static_cast<uint64_t>(0xe221000000000000), /* yrb */
     static_cast<uint64_t>(0xe224000000000000), /* yre */
@@ -1399,37 +1421,16 @@ const uint64_t LIKELY_TAGS_CODES_KEY[] = {
     static_cast<uint64_t>(0xe289000000000000), /* yuj */
     static_cast<uint64_t>(0xe293000000000000), /* yut */
     static_cast<uint64_t>(0xe296000000000000), /* yuw */
-    static_cast<uint64_t>(0x7a61000000000000), /* za */
     static_cast<uint64_t>(0xe406000000000000), /* zag */
     static_cast<uint64_t>(0xe469000000000000), /* zdj */
     static_cast<uint64_t>(0xe480000000000000), /* zea */
     static_cast<uint64_t>(0xe4c7000000000000), /* zgh */
-    static_cast<uint64_t>(0x7a68000000000000), /* zh */
-    static_cast<uint64_t>(0x7a68000000004155), /* zh-AU */
-    static_cast<uint64_t>(0x7a6800000000424e), /* zh-BN */
-    static_cast<uint64_t>(0x7a68426f706f0000), /* zh-Bopo */
-    static_cast<uint64_t>(0x7a68000000004742), /* zh-GB */
-    static_cast<uint64_t>(0x7a68000000004746), /* zh-GF */
-    static_cast<uint64_t>(0x7a6800000000484b), /* zh-HK */
-    static_cast<uint64_t>(0x7a6848616e620000), /* zh-Hanb */
-    static_cast<uint64_t>(0x7a6848616e740000), /* zh-Hant */
-    static_cast<uint64_t>(0x7a68000000004944), /* zh-ID */
-    static_cast<uint64_t>(0x7a68000000004d4f), /* zh-MO */
-    static_cast<uint64_t>(0x7a68000000005041), /* zh-PA */
-    static_cast<uint64_t>(0x7a68000000005046), /* zh-PF */
-    static_cast<uint64_t>(0x7a68000000005048), /* zh-PH */
-    static_cast<uint64_t>(0x7a68000000005352), /* zh-SR */
-    static_cast<uint64_t>(0x7a68000000005448), /* zh-TH */
-    static_cast<uint64_t>(0x7a68000000005457), /* zh-TW */
-    static_cast<uint64_t>(0x7a68000000005553), /* zh-US */
-    static_cast<uint64_t>(0x7a6800000000564e), /* zh-VN */
     static_cast<uint64_t>(0xe4f7000000000000), /* zhx */
     static_cast<uint64_t>(0xe500000000000000), /* zia */
     static_cast<uint64_t>(0xe553000000000000), /* zkt */
     static_cast<uint64_t>(0xe56c000000000000), /* zlm */
     static_cast<uint64_t>(0xe588000000000000), /* zmi */
     static_cast<uint64_t>(0xe5a4000000000000), /* zne */
-    static_cast<uint64_t>(0x7a75000000000000), /* zu */
     static_cast<uint64_t>(0xe720000000000000), /* zza */
 };
 } // namespace Resource
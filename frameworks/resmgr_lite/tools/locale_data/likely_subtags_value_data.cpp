@@ -18,12 +18,253 @@
 namespace OHOS {
 namespace Global {
 namespace Resource {
-const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
+constexpr uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x61614c61746e4554), /* aa-Latn-ET */
+    static_cast<uint64_t>(0x61624379726c4745), /* ab-Cyrl-GE */
+    static_cast<uint64_t>(0x6165417673744952), /* ae-Avst-IR */
+    static_cast<uint64_t>(0x61664c61746e5a41), /* af-Latn-ZA */
+    static_cast<uint64_t>(0x616b4c61746e4748), /* ak-Latn-GH */
+    static_cast<uint64_t>(0x616d457468694554), /* am-Ethi-ET */
+    static_cast<uint64_t>(0x616e4c61746e4553), /* an-Latn-ES */
+    static_cast<uint64_t>(0x6172417261624547), /* ar-Arab-EG */
+    static_cast<uint64_t>(0x617342656e67494e), /* as-Beng-IN */
+    static_cast<uint64_t>(0x61764379726c5255), /* av-Cyrl-RU */
+    static_cast<uint64_t>(0x61794c61746e424f), /* ay-Latn-BO */
+    static_cast<uint64_t>(0x617a4c61746e415a), /* az-Latn-AZ */
+    static_cast<uint64_t>(0x617a417261624951), /* az-Arab-IQ */
+    static_cast<uint64_t>(0x617a417261624952), /* az-Arab-IR */
+    static_cast<uint64_t>(0x617a4379726c5255), /* az-Cyrl-RU */
+    static_cast<uint64_t>(0x617a417261624952), /* az-Arab-IR */
+    static_cast<uint64_t>(0x62614379726c5255), /* ba-Cyrl-RU */
+    static_cast<uint64_t>(0x62654379726c4259), /* be-Cyrl-BY */
+    static_cast<uint64_t>(0x62674379726c4247), /* bg-Cyrl-BG */
+    static_cast<uint64_t>(0x62694c61746e5655), /* bi-Latn-VU */
+    static_cast<uint64_t>(0x626d4c61746e4d4c), /* bm-Latn-ML */
+    static_cast<uint64_t>(0x626e42656e674244), /* bn-Beng-BD */
+    static_cast<uint64_t>(0x626f54696274434e), /* bo-Tibt-CN */
+    static_cast<uint64_t>(0x62724c61746e4652), /* br-Latn-FR */
+    static_cast<uint64_t>(0x62734c61746e4241), /* bs-Latn-BA */
+    static_cast<uint64_t>(0x63614c61746e4553), /* ca-Latn-ES */
+    static_cast<uint64_t>(0x63654379726c5255), /* ce-Cyrl-RU */
+    static_cast<uint64_t>(0x63684c61746e4755), /* ch-Latn-GU */
+    static_cast<uint64_t>(0x636f4c61746e4652), /* co-Latn-FR */
+    static_cast<uint64_t>(0x637243616e734341), /* cr-Cans-CA */
+    static_cast<uint64_t>(0x63734c61746e435a), /* cs-Latn-CZ */
+    static_cast<uint64_t>(0x63754379726c5255), /* cu-Cyrl-RU */
+    static_cast<uint64_t>(0x6375476c61674247), /* cu-Glag-BG */
+    static_cast<uint64_t>(0x63764379726c5255), /* cv-Cyrl-RU */
+    static_cast<uint64_t>(0x63794c61746e4742), /* cy-Latn-GB */
+    static_cast<uint64_t>(0x64614c61746e444b), /* da-Latn-DK */
+    static_cast<uint64_t>(0x64654c61746e4445), /* de-Latn-DE */
+    static_cast<uint64_t>(0x6476546861614d56), /* dv-Thaa-MV */
+    static_cast<uint64_t>(0x647a546962744254), /* dz-Tibt-BT */
+    static_cast<uint64_t>(0x65654c61746e4748), /* ee-Latn-GH */
+    static_cast<uint64_t>(0x656c4772656b4752), /* el-Grek-GR */
+    static_cast<uint64_t>(0x656e4c61746e5553), /* en-Latn-US */
+    static_cast<uint64_t>(0x656e536861774742), /* en-Shaw-GB */
+    static_cast<uint64_t>(0x656f4c61746e8001), /* eo-Latn-001 */
+    static_cast<uint64_t>(0x65734c61746e4553), /* es-Latn-ES */
+    static_cast<uint64_t>(0x65744c61746e4545), /* et-Latn-EE */
+    static_cast<uint64_t>(0x65754c61746e4553), /* eu-Latn-ES */
+    static_cast<uint64_t>(0x6661417261624952), /* fa-Arab-IR */
+    static_cast<uint64_t>(0x66664c61746e534e), /* ff-Latn-SN */
+    static_cast<uint64_t>(0x666641646c6d474e), /* ff-Adlm-GN */
+    static_cast<uint64_t>(0x66694c61746e4649), /* fi-Latn-FI */
+    static_cast<uint64_t>(0x666a4c61746e464a), /* fj-Latn-FJ */
+    static_cast<uint64_t>(0x666f4c61746e464f), /* fo-Latn-FO */
+    static_cast<uint64_t>(0x66724c61746e4652), /* fr-Latn-FR */
+    static_cast<uint64_t>(0x66794c61746e4e4c), /* fy-Latn-NL */
+    static_cast<uint64_t>(0x67614c61746e4945), /* ga-Latn-IE */
+    static_cast<uint64_t>(0x67644c61746e4742), /* gd-Latn-GB */
+    static_cast<uint64_t>(0x676c4c61746e4553), /* gl-Latn-ES */
+    static_cast<uint64_t>(0x676e4c61746e5059), /* gn-Latn-PY */
+    static_cast<uint64_t>(0x677547756a72494e), /* gu-Gujr-IN */
+    static_cast<uint64_t>(0x67764c61746e494d), /* gv-Latn-IM */
+    static_cast<uint64_t>(0x68614c61746e4e47), /* ha-Latn-NG */
+    static_cast<uint64_t>(0x686141726162434d), /* ha-Arab-CM */
+    static_cast<uint64_t>(0x6861417261625344), /* ha-Arab-SD */
+    static_cast<uint64_t>(0x686548656272494c), /* he-Hebr-IL */
+    static_cast<uint64_t>(0x686944657661494e), /* hi-Deva-IN */
+    static_cast<uint64_t>(0x686f4c61746e5047), /* ho-Latn-PG */
+    static_cast<uint64_t>(0x68724c61746e4852), /* hr-Latn-HR */
+    static_cast<uint64_t>(0x68744c61746e4854), /* ht-Latn-HT */
+    static_cast<uint64_t>(0x68754c61746e4855), /* hu-Latn-HU */
+    static_cast<uint64_t>(0x687941726d6e414d), /* hy-Armn-AM */
+    static_cast<uint64_t>(0x687a4c61746e4e41), /* hz-Latn-NA */
+    static_cast<uint64_t>(0x69614c61746e8001), /* ia-Latn-001 */
+    static_cast<uint64_t>(0x69644c61746e4944), /* id-Latn-ID */
+    static_cast<uint64_t>(0x69674c61746e4e47), /* ig-Latn-NG */
+    static_cast<uint64_t>(0x696959696969434e), /* ii-Yiii-CN */
+    static_cast<uint64_t>(0x696b4c61746e5553), /* ik-Latn-US */
+    static_cast<uint64_t>(0x696e4c61746e4944), /* in-Latn-ID */
+    static_cast<uint64_t>(0x696f4c61746e8001), /* io-Latn-001 */
+    static_cast<uint64_t>(0x69734c61746e4953), /* is-Latn-IS */
+    static_cast<uint64_t>(0x69744c61746e4954), /* it-Latn-IT */
+    static_cast<uint64_t>(0x697543616e734341), /* iu-Cans-CA */
+    static_cast<uint64_t>(0x697748656272494c), /* iw-Hebr-IL */
+    static_cast<uint64_t>(0x6a614a70616e4a50), /* ja-Jpan-JP */
+    static_cast<uint64_t>(0x6a69486562725541), /* ji-Hebr-UA */
+    static_cast<uint64_t>(0x6a764c61746e4944), /* jv-Latn-ID */
+    static_cast<uint64_t>(0x6a774c61746e4944), /* jw-Latn-ID */
+    static_cast<uint64_t>(0x6b6147656f724745), /* ka-Geor-GE */
+    static_cast<uint64_t>(0x6b674c61746e4344), /* kg-Latn-CD */
+    static_cast<uint64_t>(0x6b694c61746e4b45), /* ki-Latn-KE */
+    static_cast<uint64_t>(0x6b6a4c61746e4e41), /* kj-Latn-NA */
+    static_cast<uint64_t>(0x6b6b4379726c4b5a), /* kk-Cyrl-KZ */
+    static_cast<uint64_t>(0x6b6b417261624146), /* kk-Arab-AF */
+    static_cast<uint64_t>(0x6b6b41726162434e), /* kk-Arab-CN */
+    static_cast<uint64_t>(0x6b6b417261624952), /* kk-Arab-IR */
+    static_cast<uint64_t>(0x6b6b417261624d4e), /* kk-Arab-MN */
+    static_cast<uint64_t>(0x6b6b41726162434e), /* kk-Arab-CN */
+    static_cast<uint64_t>(0x6b6c4c61746e474c), /* kl-Latn-GL */
+    static_cast<uint64_t>(0x6b6d4b686d724b48), /* km-Khmr-KH */
+    static_cast<uint64_t>(0x6b6e4b6e6461494e), /* kn-Knda-IN */
+    static_cast<uint64_t>(0x6b6f4b6f72654b52), /* ko-Kore-KR */
+    static_cast<uint64_t>(0x6b724c61746e5a5a), /* kr-Latn-ZZ */
+    static_cast<uint64_t>(0x6b7341726162494e), /* ks-Arab-IN */
+    static_cast<uint64_t>(0x6b754c61746e5452), /* ku-Latn-TR */
+    static_cast<uint64_t>(0x6b75417261624c42), /* ku-Arab-LB */
+    static_cast<uint64_t>(0x6b75417261624951), /* ku-Arab-IQ */
+    static_cast<uint64_t>(0x6b7559657a694745), /* ku-Yezi-GE */
+    static_cast<uint64_t>(0x6b764379726c5255), /* kv-Cyrl-RU */
+    static_cast<uint64_t>(0x6b774c61746e4742), /* kw-Latn-GB */
+    static_cast<uint64_t>(0x6b794379726c4b47), /* ky-Cyrl-KG */
+    static_cast<uint64_t>(0x6b7941726162434e), /* ky-Arab-CN */
+    static_cast<uint64_t>(0x6b794c61746e5452), /* ky-Latn-TR */
+    static_cast<uint64_t>(0x6b7941726162434e), /* ky-Arab-CN */
+    static_cast<uint64_t>(0x6b794c61746e5452), /* ky-Latn-TR */
+    static_cast<uint64_t>(0x6c614c61746e5641), /* la-Latn-VA */
+    static_cast<uint64_t>(0x6c624c61746e4c55), /* lb-Latn-LU */
+    static_cast<uint64_t>(0x6c674c61746e5547), /* lg-Latn-UG */
+    static_cast<uint64_t>(0x6c694c61746e4e4c), /* li-Latn-NL */
+    static_cast<uint64_t>(0x6c6e4c61746e4344), /* ln-Latn-CD */
+    static_cast<uint64_t>(0x6c6f4c616f6f4c41), /* lo-Laoo-LA */
+    static_cast<uint64_t>(0x6c744c61746e4c54), /* lt-Latn-LT */
+    static_cast<uint64_t>(0x6c754c61746e4344), /* lu-Latn-CD */
+    static_cast<uint64_t>(0x6c764c61746e4c56), /* lv-Latn-LV */
+    static_cast<uint64_t>(0x6d674c61746e4d47), /* mg-Latn-MG */
+    static_cast<uint64_t>(0x6d684c61746e4d48), /* mh-Latn-MH */
+    static_cast<uint64_t>(0x6d694c61746e4e5a), /* mi-Latn-NZ */
+    static_cast<uint64_t>(0x6d6b4379726c4d4b), /* mk-Cyrl-MK */
+    static_cast<uint64_t>(0x6d6c4d6c796d494e), /* ml-Mlym-IN */
+    static_cast<uint64_t>(0x6d6e4379726c4d4e), /* mn-Cyrl-MN */
+    static_cast<uint64_t>(0x6d6e4d6f6e67434e), /* mn-Mong-CN */
+    static_cast<uint64_t>(0x6d6e4d6f6e67434e), /* mn-Mong-CN */
+    static_cast<uint64_t>(0x6d6f4c61746e524f), /* mo-Latn-RO */
+    static_cast<uint64_t>(0x6d7244657661494e), /* mr-Deva-IN */
+    static_cast<uint64_t>(0x6d734c61746e4d59), /* ms-Latn-MY */
+    static_cast<uint64_t>(0x6d73417261624343), /* ms-Arab-CC */
+    static_cast<uint64_t>(0x6d744c61746e4d54), /* mt-Latn-MT */
+    static_cast<uint64_t>(0x6d794d796d724d4d), /* my-Mymr-MM */
+    static_cast<uint64_t>(0x6e614c61746e4e52), /* na-Latn-NR */
+    static_cast<uint64_t>(0x6e624c61746e4e4f), /* nb-Latn-NO */
+    static_cast<uint64_t>(0x6e644c61746e5a57), /* nd-Latn-ZW */
+    static_cast<uint64_t>(0x6e65446576614e50), /* ne-Deva-NP */
+    static_cast<uint64_t>(0x6e674c61746e4e41), /* ng-Latn-NA */
+    static_cast<uint64_t>(0x6e6c4c61746e4e4c), /* nl-Latn-NL */
+    static_cast<uint64_t>(0x6e6e4c61746e4e4f), /* nn-Latn-NO */
+    static_cast<uint64_t>(0x6e6f4c61746e4e4f), /* no-Latn-NO */
+    static_cast<uint64_t>(0x6e724c61746e5a41), /* nr-Latn-ZA */
+    static_cast<uint64_t>(0x6e764c61746e5553), /* nv-Latn-US */
+    static_cast<uint64_t>(0x6e794c61746e4d57), /* ny-Latn-MW */
+    static_cast<uint64_t>(0x6f634c61746e4652), /* oc-Latn-FR */
+    static_cast<uint64_t>(0x6f6d4c61746e4554), /* om-Latn-ET */
+    static_cast<uint64_t>(0x6f724f727961494e), /* or-Orya-IN */
+    static_cast<uint64_t>(0x6f734379726c4745), /* os-Cyrl-GE */
+    static_cast<uint64_t>(0x706147757275494e), /* pa-Guru-IN */
+    static_cast<uint64_t>(0x706141726162504b), /* pa-Arab-PK */
+    static_cast<uint64_t>(0x706141726162504b), /* pa-Arab-PK */
+    static_cast<uint64_t>(0x706c4c61746e504c), /* pl-Latn-PL */
+    static_cast<uint64_t>(0x7073417261624146), /* ps-Arab-AF */
+    static_cast<uint64_t>(0x70744c61746e4252), /* pt-Latn-BR */
+    static_cast<uint64_t>(0x71754c61746e5045), /* qu-Latn-PE */
+    static_cast<uint64_t>(0x726d4c61746e4348), /* rm-Latn-CH */
+    static_cast<uint64_t>(0x726e4c61746e4249), /* rn-Latn-BI */
+    static_cast<uint64_t>(0x726f4c61746e524f), /* ro-Latn-RO */
+    static_cast<uint64_t>(0x72754379726c5255), /* ru-Cyrl-RU */
+    static_cast<uint64_t>(0x72774c61746e5257), /* rw-Latn-RW */
+    static_cast<uint64_t>(0x736144657661494e), /* sa-Deva-IN */
+    static_cast<uint64_t>(0x73634c61746e4954), /* sc-Latn-IT */
+    static_cast<uint64_t>(0x736441726162504b), /* sd-Arab-PK */
+    static_cast<uint64_t>(0x736444657661494e), /* sd-Deva-IN */
+    static_cast<uint64_t>(0x73644b686f6a494e), /* sd-Khoj-IN */
+    static_cast<uint64_t>(0x736453696e64494e), /* sd-Sind-IN */
+    static_cast<uint64_t>(0x73654c61746e4e4f), /* se-Latn-NO */
+    static_cast<uint64_t>(0x73674c61746e4346), /* sg-Latn-CF */
+    static_cast<uint64_t>(0x736953696e684c4b), /* si-Sinh-LK */
+    static_cast<uint64_t>(0x736b4c61746e534b), /* sk-Latn-SK */
+    static_cast<uint64_t>(0x736c4c61746e5349), /* sl-Latn-SI */
+    static_cast<uint64_t>(0x736d4c61746e5753), /* sm-Latn-WS */
+    static_cast<uint64_t>(0x736e4c61746e5a57), /* sn-Latn-ZW */
+    static_cast<uint64_t>(0x736f4c61746e534f), /* so-Latn-SO */
+    static_cast<uint64_t>(0x73714c61746e414c), /* sq-Latn-AL */
+    static_cast<uint64_t>(0x73724379726c5253), /* sr-Cyrl-RS */
+    static_cast<uint64_t>(0x73724c61746e4d45), /* sr-Latn-ME */
+    static_cast<uint64_t>(0x73724c61746e524f), /* sr-Latn-RO */
+    static_cast<uint64_t>(0x73724c61746e5255), /* sr-Latn-RU */
+    static_cast<uint64_t>(0x73724c61746e5452), /* sr-Latn-TR */
+    static_cast<uint64_t>(0x73734c61746e5a41), /* ss-Latn-ZA */
+    static_cast<uint64_t>(0x73744c61746e5a41), /* st-Latn-ZA */
+    static_cast<uint64_t>(0x73754c61746e4944), /* su-Latn-ID */
+    static_cast<uint64_t>(0x73764c61746e5345), /* sv-Latn-SE */
+    static_cast<uint64_t>(0x73774c61746e545a), /* sw-Latn-TZ */
+    static_cast<uint64_t>(0x746154616d6c494e), /* ta-Taml-IN */
+    static_cast<uint64_t>(0x746554656c75494e), /* te-Telu-IN */
+    static_cast<uint64_t>(0x74674379726c544a), /* tg-Cyrl-TJ */
+    static_cast<uint64_t>(0x746741726162504b), /* tg-Arab-PK */
+    static_cast<uint64_t>(0x746741726162504b), /* tg-Arab-PK */
+    static_cast<uint64_t>(0x7468546861695448), /* th-Thai-TH */
+    static_cast<uint64_t>(0x7469457468694554), /* ti-Ethi-ET */
+    static_cast<uint64_t>(0x746b4c61746e544d), /* tk-Latn-TM */
+    static_cast<uint64_t>(0x746c4c61746e5048), /* tl-Latn-PH */
+    static_cast<uint64_t>(0x746e4c61746e5a41), /* tn-Latn-ZA */
+    static_cast<uint64_t>(0x746f4c61746e544f), /* to-Latn-TO */
+    static_cast<uint64_t>(0x74724c61746e5452), /* tr-Latn-TR */
+    static_cast<uint64_t>(0x74734c61746e5a41), /* ts-Latn-ZA */
+    static_cast<uint64_t>(0x74744379726c5255), /* tt-Cyrl-RU */
+    static_cast<uint64_t>(0x74794c61746e5046), /* ty-Latn-PF */
+    static_cast<uint64_t>(0x756741726162434e), /* ug-Arab-CN */
+    static_cast<uint64_t>(0x75674379726c4b5a), /* ug-Cyrl-KZ */
+    static_cast<uint64_t>(0x75674379726c4d4e), /* ug-Cyrl-MN */
+    static_cast<uint64_t>(0x75674379726c4b5a), /* ug-Cyrl-KZ */
+    static_cast<uint64_t>(0x756b4379726c5541), /* uk-Cyrl-UA */
+    static_cast<uint64_t>(0x757241726162504b), /* ur-Arab-PK */
+    static_cast<uint64_t>(0x757a4c61746e555a), /* uz-Latn-UZ */
+    static_cast<uint64_t>(0x757a417261624146), /* uz-Arab-AF */
+    static_cast<uint64_t>(0x757a4379726c434e), /* uz-Cyrl-CN */
+    static_cast<uint64_t>(0x757a417261624146), /* uz-Arab-AF */
+    static_cast<uint64_t>(0x76654c61746e5a41), /* ve-Latn-ZA */
+    static_cast<uint64_t>(0x76694c61746e564e), /* vi-Latn-VN */
+    static_cast<uint64_t>(0x766f4c61746e8001), /* vo-Latn-001 */
+    static_cast<uint64_t>(0x77614c61746e4245), /* wa-Latn-BE */
+    static_cast<uint64_t>(0x776f4c61746e534e), /* wo-Latn-SN */
+    static_cast<uint64_t>(0x78684c61746e5a41), /* xh-Latn-ZA */
+    static_cast<uint64_t>(0x7969486562728001), /* yi-Hebr-001 */
+    static_cast<uint64_t>(0x796f4c61746e4e47), /* yo-Latn-NG */
+    static_cast<uint64_t>(0x7a614c61746e434e), /* za-Latn-CN */
+    static_cast<uint64_t>(0x7a6848616e73434e), /* zh-Hans-CN */
+    static_cast<uint64_t>(0x7a6848616e744155), /* zh-Hant-AU */
+    static_cast<uint64_t>(0x7a6848616e74424e), /* zh-Hant-BN */
+    static_cast<uint64_t>(0x7a6848616e744742), /* zh-Hant-GB */
+    static_cast<uint64_t>(0x7a6848616e744746), /* zh-Hant-GF */
+    static_cast<uint64_t>(0x7a6848616e74484b), /* zh-Hant-HK */
+    static_cast<uint64_t>(0x7a6848616e744944), /* zh-Hant-ID */
+    static_cast<uint64_t>(0x7a6848616e744d4f), /* zh-Hant-MO */
+    static_cast<uint64_t>(0x7a6848616e745041), /* zh-Hant-PA */
+    static_cast<uint64_t>(0x7a6848616e745046), /* zh-Hant-PF */
+    static_cast<uint64_t>(0x7a6848616e745048), /* zh-Hant-PH */
+    static_cast<uint64_t>(0x7a6848616e745352), /* zh-Hant-SR */
+    static_cast<uint64_t>(0x7a6848616e745448), /* zh-Hant-TH */
+    static_cast<uint64_t>(0x7a6848616e745457), /* zh-Hant-TW */
+    static_cast<uint64_t>(0x7a6848616e745553), /* zh-Hant-US */
+    static_cast<uint64_t>(0x7a6848616e74564e), /* zh-Hant-VN */
+    static_cast<uint64_t>(0x7a68426f706f5457), /* zh-Bopo-TW */
+    static_cast<uint64_t>(0x7a6848616e625457), /* zh-Hanb-TW */
+    static_cast<uint64_t>(0x7a6848616e745457), /* zh-Hant-TW */
+    static_cast<uint64_t>(0x7a754c61746e5a41), /* zu-Latn-ZA */
     static_cast<uint64_t>(0x80084c61746e5a5a), /* aai-Latn-ZZ */
     static_cast<uint64_t>(0x800a4c61746e5a5a), /* aak-Latn-ZZ */
     static_cast<uint64_t>(0x80144c61746e5a5a), /* aau-Latn-ZZ */
-    static_cast<uint64_t>(0x61624379726c4745), /* ab-Cyrl-GE */
     static_cast<uint64_t>(0x80284c61746e5a5a), /* abi-Latn-ZZ */
     static_cast<uint64_t>(0x80304379726c5a5a), /* abq-Cyrl-ZZ */
     static_cast<uint64_t>(0x80314c61746e4748), /* abr-Latn-GH */
@@ -38,10 +279,8 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x806f546962744254), /* adp-Tibt-BT */
     static_cast<uint64_t>(0x80784379726c5255), /* ady-Cyrl-RU */
     static_cast<uint64_t>(0x80794c61746e5a5a), /* adz-Latn-ZZ */
-    static_cast<uint64_t>(0x6165417673744952), /* ae-Avst-IR */
     static_cast<uint64_t>(0x808141726162544e), /* aeb-Arab-TN */
     static_cast<uint64_t>(0x80984c61746e5a5a), /* aey-Latn-ZZ */
-    static_cast<uint64_t>(0x61664c61746e5a41), /* af-Latn-ZA */
     static_cast<uint64_t>(0x80c24c61746e5a5a), /* agc-Latn-ZZ */
     static_cast<uint64_t>(0x80c34c61746e5a5a), /* agd-Latn-ZZ */
     static_cast<uint64_t>(0x80c64c61746e5a5a), /* agg-Latn-ZZ */
@@ -52,18 +291,15 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x80eb4c61746e5a5a), /* ahl-Latn-ZZ */
     static_cast<uint64_t>(0x80ee41686f6d494e), /* aho-Ahom-IN */
     static_cast<uint64_t>(0x81264c61746e5a5a), /* ajg-Latn-ZZ */
-    static_cast<uint64_t>(0x616b4c61746e4748), /* ak-Latn-GH */
     static_cast<uint64_t>(0x814a587375784951), /* akk-Xsux-IQ */
     static_cast<uint64_t>(0x81604c61746e5a5a), /* ala-Latn-ZZ */
     static_cast<uint64_t>(0x81684c61746e5a5a), /* ali-Latn-ZZ */
     static_cast<uint64_t>(0x816d4c61746e584b), /* aln-Latn-XK */
     static_cast<uint64_t>(0x81734379726c5255), /* alt-Cyrl-RU */
-    static_cast<uint64_t>(0x616d457468694554), /* am-Ethi-ET */
     static_cast<uint64_t>(0x818c4c61746e5a5a), /* amm-Latn-ZZ */
     static_cast<uint64_t>(0x818d4c61746e5a5a), /* amn-Latn-ZZ */
     static_cast<uint64_t>(0x818e4c61746e4e47), /* amo-Latn-NG */
     static_cast<uint64_t>(0x818f4c61746e5a5a), /* amp-Latn-ZZ */
-    static_cast<uint64_t>(0x616e4c61746e4553), /* an-Latn-ES */
     static_cast<uint64_t>(0x81a24c61746e5a5a), /* anc-Latn-ZZ */
     static_cast<uint64_t>(0x81aa4c61746e5a5a), /* ank-Latn-ZZ */
     static_cast<uint64_t>(0x81ad4c61746e5a5a), /* ann-Latn-ZZ */
@@ -77,7 +313,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x81f14c61746e5a5a), /* apr-Latn-ZZ */
     static_cast<uint64_t>(0x81f24c61746e5a5a), /* aps-Latn-ZZ */
     static_cast<uint64_t>(0x81f94c61746e5a5a), /* apz-Latn-ZZ */
-    static_cast<uint64_t>(0x6172417261624547), /* ar-Arab-EG */
     static_cast<uint64_t>(0x822241726d694952), /* arc-Armi-IR */
     static_cast<uint64_t>(0x82224e6261744a4f), /* arc-Nbat-JO */
     static_cast<uint64_t>(0x822250616c6d5359), /* arc-Palm-SY */
@@ -88,7 +323,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x8232417261625341), /* ars-Arab-SA */
     static_cast<uint64_t>(0x8238417261624d41), /* ary-Arab-MA */
     static_cast<uint64_t>(0x8239417261624547), /* arz-Arab-EG */
-    static_cast<uint64_t>(0x617342656e67494e), /* as-Beng-IN */
     static_cast<uint64_t>(0x82404c61746e545a), /* asa-Latn-TZ */
     static_cast<uint64_t>(0x824453676e775553), /* ase-Sgnw-US */
     static_cast<uint64_t>(0x82464c61746e5a5a), /* asg-Latn-ZZ */
@@ -98,7 +332,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x82664c61746e5a5a), /* atg-Latn-ZZ */
     static_cast<uint64_t>(0x82694c61746e4341), /* atj-Latn-CA */
     static_cast<uint64_t>(0x82984c61746e5a5a), /* auy-Latn-ZZ */
-    static_cast<uint64_t>(0x61764379726c5255), /* av-Cyrl-RU */
     static_cast<uint64_t>(0x82ab417261625a5a), /* avl-Arab-ZZ */
     static_cast<uint64_t>(0x82ad4c61746e5a5a), /* avn-Latn-ZZ */
     static_cast<uint64_t>(0x82b34c61746e5a5a), /* avt-Latn-ZZ */
@@ -107,14 +340,7 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x82c14c61746e5a5a), /* awb-Latn-ZZ */
     static_cast<uint64_t>(0x82ce4c61746e5a5a), /* awo-Latn-ZZ */
     static_cast<uint64_t>(0x82d74c61746e5a5a), /* awx-Latn-ZZ */
-    static_cast<uint64_t>(0x61794c61746e424f), /* ay-Latn-BO */
     static_cast<uint64_t>(0x83014c61746e5a5a), /* ayb-Latn-ZZ */
-    static_cast<uint64_t>(0x617a4c61746e415a), /* az-Latn-AZ */
-    static_cast<uint64_t>(0x617a417261624952), /* az-Arab-IR */
-    static_cast<uint64_t>(0x617a417261624951), /* az-Arab-IQ */
-    static_cast<uint64_t>(0x617a417261624952), /* az-Arab-IR */
-    static_cast<uint64_t>(0x617a4379726c5255), /* az-Cyrl-RU */
-    static_cast<uint64_t>(0x62614379726c5255), /* ba-Cyrl-RU */
     static_cast<uint64_t>(0x840b41726162504b), /* bal-Arab-PK */
     static_cast<uint64_t>(0x840d4c61746e4944), /* ban-Latn-ID */
     static_cast<uint64_t>(0x840f446576614e50), /* bap-Deva-NP */
@@ -138,7 +364,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x8450457468695a5a), /* bcq-Ethi-ZZ */
     static_cast<uint64_t>(0x84544c61746e5a5a), /* bcu-Latn-ZZ */
     static_cast<uint64_t>(0x84634c61746e5a5a), /* bdd-Latn-ZZ */
-    static_cast<uint64_t>(0x62654379726c4259), /* be-Cyrl-BY */
     static_cast<uint64_t>(0x84854c61746e5a5a), /* bef-Latn-ZZ */
     static_cast<uint64_t>(0x84874c61746e5a5a), /* beh-Latn-ZZ */
     static_cast<uint64_t>(0x8489417261625344), /* bej-Arab-SD */
@@ -151,7 +376,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x84b054616d6c494e), /* bfq-Taml-IN */
     static_cast<uint64_t>(0x84b341726162504b), /* bft-Arab-PK */
     static_cast<uint64_t>(0x84b844657661494e), /* bfy-Deva-IN */
-    static_cast<uint64_t>(0x62674379726c4247), /* bg-Cyrl-BG */
     static_cast<uint64_t>(0x84c244657661494e), /* bgc-Deva-IN */
     static_cast<uint64_t>(0x84cd41726162504b), /* bgn-Arab-PK */
     static_cast<uint64_t>(0x84d74772656b5452), /* bgx-Grek-TR */
@@ -161,7 +385,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x84eb4c61746e5a5a), /* bhl-Latn-ZZ */
     static_cast<uint64_t>(0x84ee44657661494e), /* bho-Deva-IN */
     static_cast<uint64_t>(0x84f84c61746e5a5a), /* bhy-Latn-ZZ */
-    static_cast<uint64_t>(0x62694c61746e5655), /* bi-Latn-VU */
     static_cast<uint64_t>(0x85014c61746e5a5a), /* bib-Latn-ZZ */
     static_cast<uint64_t>(0x85064c61746e5a5a), /* big-Latn-ZZ */
     static_cast<uint64_t>(0x850a4c61746e5048), /* bik-Latn-PH */
@@ -183,16 +406,13 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x85544c61746e5048), /* bku-Latn-PH */
     static_cast<uint64_t>(0x85554c61746e5a5a), /* bkv-Latn-ZZ */
     static_cast<uint64_t>(0x857354617674564e), /* blt-Tavt-VN */
-    static_cast<uint64_t>(0x626d4c61746e4d4c), /* bm-Latn-ML */
     static_cast<uint64_t>(0x85874c61746e5a5a), /* bmh-Latn-ZZ */
     static_cast<uint64_t>(0x858a4c61746e5a5a), /* bmk-Latn-ZZ */
     static_cast<uint64_t>(0x85904c61746e4d4c), /* bmq-Latn-ML */
     static_cast<uint64_t>(0x85944c61746e5a5a), /* bmu-Latn-ZZ */
-    static_cast<uint64_t>(0x626e42656e674244), /* bn-Beng-BD */
     static_cast<uint64_t>(0x85a64c61746e5a5a), /* bng-Latn-ZZ */
     static_cast<uint64_t>(0x85ac4c61746e5a5a), /* bnm-Latn-ZZ */
     static_cast<uint64_t>(0x85af4c61746e5a5a), /* bnp-Latn-ZZ */
-    static_cast<uint64_t>(0x626f54696274434e), /* bo-Tibt-CN */
     static_cast<uint64_t>(0x85c94c61746e5a5a), /* boj-Latn-ZZ */
     static_cast<uint64_t>(0x85cc4c61746e5a5a), /* bom-Latn-ZZ */
     static_cast<uint64_t>(0x85cd4c61746e5a5a), /* bon-Latn-ZZ */
@@ -201,12 +421,10 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x8608417261624952), /* bqi-Arab-IR */
     static_cast<uint64_t>(0x860f4c61746e5a5a), /* bqp-Latn-ZZ */
     static_cast<uint64_t>(0x86154c61746e4349), /* bqv-Latn-CI */
-    static_cast<uint64_t>(0x62724c61746e4652), /* br-Latn-FR */
     static_cast<uint64_t>(0x862044657661494e), /* bra-Deva-IN */
     static_cast<uint64_t>(0x862741726162504b), /* brh-Arab-PK */
     static_cast<uint64_t>(0x863744657661494e), /* brx-Deva-IN */
     static_cast<uint64_t>(0x86394c61746e5a5a), /* brz-Latn-ZZ */
-    static_cast<uint64_t>(0x62734c61746e4241), /* bs-Latn-BA */
     static_cast<uint64_t>(0x86494c61746e5a5a), /* bsj-Latn-ZZ */
     static_cast<uint64_t>(0x8650426173734c52), /* bsq-Bass-LR */
     static_cast<uint64_t>(0x86524c61746e434d), /* bss-Latn-CM */
@@ -238,17 +456,14 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x87254c61746e5a5a), /* bzf-Latn-ZZ */
     static_cast<uint64_t>(0x87274c61746e5a5a), /* bzh-Latn-ZZ */
     static_cast<uint64_t>(0x87364c61746e5a5a), /* bzw-Latn-ZZ */
-    static_cast<uint64_t>(0x63614c61746e4553), /* ca-Latn-ES */
     static_cast<uint64_t>(0x88034c61746e5553), /* cad-Latn-US */
     static_cast<uint64_t>(0x880d4c61746e5a5a), /* can-Latn-ZZ */
     static_cast<uint64_t>(0x88294c61746e5a5a), /* cbj-Latn-ZZ */
     static_cast<uint64_t>(0x88474c61746e4e47), /* cch-Latn-NG */
     static_cast<uint64_t>(0x884f43616b6d4244), /* ccp-Cakm-BD */
-    static_cast<uint64_t>(0x63654379726c5255), /* ce-Cyrl-RU */
     static_cast<uint64_t>(0x88814c61746e5048), /* ceb-Latn-PH */
     static_cast<uint64_t>(0x88a04c61746e5a5a), /* cfa-Latn-ZZ */
     static_cast<uint64_t>(0x88c64c61746e5547), /* cgg-Latn-UG */
-    static_cast<uint64_t>(0x63684c61746e4755), /* ch-Latn-GU */
     static_cast<uint64_t>(0x88ea4c61746e464d), /* chk-Latn-FM */
     static_cast<uint64_t>(0x88ec4379726c5255), /* chm-Cyrl-RU */
     static_cast<uint64_t>(0x88ee4c61746e5553), /* cho-Latn-US */
@@ -265,25 +480,17 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x89604c61746e5a5a), /* cla-Latn-ZZ */
     static_cast<uint64_t>(0x89844c61746e5a5a), /* cme-Latn-ZZ */
     static_cast<uint64_t>(0x8986536f796f4d4e), /* cmg-Soyo-MN */
-    static_cast<uint64_t>(0x636f4c61746e4652), /* co-Latn-FR */
     static_cast<uint64_t>(0x89cf436f70744547), /* cop-Copt-EG */
     static_cast<uint64_t>(0x89f24c61746e5048), /* cps-Latn-PH */
-    static_cast<uint64_t>(0x637243616e734341), /* cr-Cans-CA */
     static_cast<uint64_t>(0x8a274379726c5541), /* crh-Cyrl-UA */
     static_cast<uint64_t>(0x8a2943616e734341), /* crj-Cans-CA */
     static_cast<uint64_t>(0x8a2a43616e734341), /* crk-Cans-CA */
     static_cast<uint64_t>(0x8a2b43616e734341), /* crl-Cans-CA */
     static_cast<uint64_t>(0x8a2c43616e734341), /* crm-Cans-CA */
     static_cast<uint64_t>(0x8a324c61746e5343), /* crs-Latn-SC */
-    static_cast<uint64_t>(0x63734c61746e435a), /* cs-Latn-CZ */
     static_cast<uint64_t>(0x8a414c61746e504c), /* csb-Latn-PL */
     static_cast<uint64_t>(0x8a5643616e734341), /* csw-Cans-CA */
     static_cast<uint64_t>(0x8a63506175634d4d), /* ctd-Pauc-MM */
-    static_cast<uint64_t>(0x63754379726c5255), /* cu-Cyrl-RU */
-    static_cast<uint64_t>(0x6375476c61674247), /* cu-Glag-BG */
-    static_cast<uint64_t>(0x63764379726c5255), /* cv-Cyrl-RU */
-    static_cast<uint64_t>(0x63794c61746e4742), /* cy-Latn-GB */
-    static_cast<uint64_t>(0x64614c61746e444b), /* da-Latn-DK */
     static_cast<uint64_t>(0x8c034c61746e5a5a), /* dad-Latn-ZZ */
     static_cast<uint64_t>(0x8c054c61746e4349), /* daf-Latn-CI */
     static_cast<uint64_t>(0x8c064c61746e5a5a), /* dag-Latn-ZZ */
@@ -295,7 +502,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x8c304c61746e5a5a), /* dbq-Latn-ZZ */
     static_cast<uint64_t>(0x8c4241726162494e), /* dcc-Arab-IN */
     static_cast<uint64_t>(0x8c6d4c61746e5a5a), /* ddn-Latn-ZZ */
-    static_cast<uint64_t>(0x64654c61746e4445), /* de-Latn-DE */
     static_cast<uint64_t>(0x8c834c61746e5a5a), /* ded-Latn-ZZ */
     static_cast<uint64_t>(0x8c8d4c61746e4341), /* den-Latn-CA */
     static_cast<uint64_t>(0x8cc04c61746e5a5a), /* dga-Latn-ZZ */
@@ -323,65 +529,48 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x8e824c61746e5a5a), /* duc-Latn-ZZ */
     static_cast<uint64_t>(0x8e834c61746e5a5a), /* dud-Latn-ZZ */
     static_cast<uint64_t>(0x8e864c61746e5a5a), /* dug-Latn-ZZ */
-    static_cast<uint64_t>(0x6476546861614d56), /* dv-Thaa-MV */
     static_cast<uint64_t>(0x8ea04c61746e5a5a), /* dva-Latn-ZZ */
     static_cast<uint64_t>(0x8ed64c61746e5a5a), /* dww-Latn-ZZ */
     static_cast<uint64_t>(0x8f0e4c61746e534e), /* dyo-Latn-SN */
     static_cast<uint64_t>(0x8f144c61746e4246), /* dyu-Latn-BF */
-    static_cast<uint64_t>(0x647a546962744254), /* dz-Tibt-BT */
     static_cast<uint64_t>(0x8f264c61746e5a5a), /* dzg-Latn-ZZ */
     static_cast<uint64_t>(0x90344c61746e4b45), /* ebu-Latn-KE */
-    static_cast<uint64_t>(0x65654c61746e4748), /* ee-Latn-GH */
     static_cast<uint64_t>(0x90a84c61746e4e47), /* efi-Latn-NG */
     static_cast<uint64_t>(0x90cb4c61746e4954), /* egl-Latn-IT */
     static_cast<uint64_t>(0x90d8456779704547), /* egy-Egyp-EG */
     static_cast<uint64_t>(0x91404c61746e5a5a), /* eka-Latn-ZZ */
     static_cast<uint64_t>(0x91584b616c694d4d), /* eky-Kali-MM */
-    static_cast<uint64_t>(0x656c4772656b4752), /* el-Grek-GR */
     static_cast<uint64_t>(0x91804c61746e5a5a), /* ema-Latn-ZZ */
     static_cast<uint64_t>(0x91884c61746e5a5a), /* emi-Latn-ZZ */
-    static_cast<uint64_t>(0x656e4c61746e5553), /* en-Latn-US */
-    static_cast<uint64_t>(0x656e536861774742), /* en-Shaw-GB */
     static_cast<uint64_t>(0x91ad4c61746e5a5a), /* enn-Latn-ZZ */
     static_cast<uint64_t>(0x91b04c61746e5a5a), /* enq-Latn-ZZ */
-    static_cast<uint64_t>(0x656f4c61746e8001), /* eo-Latn-001 */
     static_cast<uint64_t>(0x92284c61746e5a5a), /* eri-Latn-ZZ */
-    static_cast<uint64_t>(0x65734c61746e4553), /* es-Latn-ES */
     static_cast<uint64_t>(0x9246476f6e6d494e), /* esg-Gonm-IN */
     static_cast<uint64_t>(0x92544c61746e5553), /* esu-Latn-US */
-    static_cast<uint64_t>(0x65744c61746e4545), /* et-Latn-EE */
     static_cast<uint64_t>(0x92714c61746e5a5a), /* etr-Latn-ZZ */
     static_cast<uint64_t>(0x92734974616c4954), /* ett-Ital-IT */
     static_cast<uint64_t>(0x92744c61746e5a5a), /* etu-Latn-ZZ */
     static_cast<uint64_t>(0x92774c61746e5a5a), /* etx-Latn-ZZ */
-    static_cast<uint64_t>(0x65754c61746e4553), /* eu-Latn-ES */
     static_cast<uint64_t>(0x92ce4c61746e434d), /* ewo-Latn-CM */
     static_cast<uint64_t>(0x92f34c61746e4553), /* ext-Latn-ES */
     static_cast<uint64_t>(0x93204c61746e5a5a), /* eza-Latn-ZZ */
-    static_cast<uint64_t>(0x6661417261624952), /* fa-Arab-IR */
     static_cast<uint64_t>(0x94004c61746e5a5a), /* faa-Latn-ZZ */
     static_cast<uint64_t>(0x94014c61746e5a5a), /* fab-Latn-ZZ */
     static_cast<uint64_t>(0x94064c61746e5a5a), /* fag-Latn-ZZ */
     static_cast<uint64_t>(0x94084c61746e5a5a), /* fai-Latn-ZZ */
     static_cast<uint64_t>(0x940d4c61746e4751), /* fan-Latn-GQ */
-    static_cast<uint64_t>(0x66664c61746e534e), /* ff-Latn-SN */
-    static_cast<uint64_t>(0x666641646c6d474e), /* ff-Adlm-GN */
     static_cast<uint64_t>(0x94a84c61746e5a5a), /* ffi-Latn-ZZ */
     static_cast<uint64_t>(0x94ac4c61746e4d4c), /* ffm-Latn-ML */
-    static_cast<uint64_t>(0x66694c61746e4649), /* fi-Latn-FI */
     static_cast<uint64_t>(0x9500417261625344), /* fia-Arab-SD */
     static_cast<uint64_t>(0x950b4c61746e5048), /* fil-Latn-PH */
     static_cast<uint64_t>(0x95134c61746e5345), /* fit-Latn-SE */
-    static_cast<uint64_t>(0x666a4c61746e464a), /* fj-Latn-FJ */
     static_cast<uint64_t>(0x95714c61746e5a5a), /* flr-Latn-ZZ */
     static_cast<uint64_t>(0x958f4c61746e5a5a), /* fmp-Latn-ZZ */
-    static_cast<uint64_t>(0x666f4c61746e464f), /* fo-Latn-FO */
     static_cast<uint64_t>(0x95c34c61746e5a5a), /* fod-Latn-ZZ */
     static_cast<uint64_t>(0x95cd4c61746e424a), /* fon-Latn-BJ */
     static_cast<uint64_t>(0x95d14c61746e5a5a), /* for-Latn-ZZ */
     static_cast<uint64_t>(0x95e44c61746e5a5a), /* fpe-Latn-ZZ */
     static_cast<uint64_t>(0x96124c61746e5a5a), /* fqs-Latn-ZZ */
-    static_cast<uint64_t>(0x66724c61746e4652), /* fr-Latn-FR */
     static_cast<uint64_t>(0x96224c61746e5553), /* frc-Latn-US */
     static_cast<uint64_t>(0x962f4c61746e4652), /* frp-Latn-FR */
     static_cast<uint64_t>(0x96314c61746e4445), /* frr-Latn-DE */
@@ -396,8 +585,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x96954c61746e4e47), /* fuv-Latn-NG */
     static_cast<uint64_t>(0x96984c61746e5a5a), /* fuy-Latn-ZZ */
     static_cast<uint64_t>(0x96b14c61746e5344), /* fvr-Latn-SD */
-    static_cast<uint64_t>(0x66794c61746e4e4c), /* fy-Latn-NL */
-    static_cast<uint64_t>(0x67614c61746e4945), /* ga-Latn-IE */
     static_cast<uint64_t>(0x98004c61746e4748), /* gaa-Latn-GH */
     static_cast<uint64_t>(0x98054c61746e5a5a), /* gaf-Latn-ZZ */
     static_cast<uint64_t>(0x98064c61746e4d44), /* gag-Latn-MD */
@@ -413,7 +600,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x98384c61746e5a5a), /* gby-Latn-ZZ */
     static_cast<uint64_t>(0x9839417261624952), /* gbz-Arab-IR */
     static_cast<uint64_t>(0x98514c61746e4746), /* gcr-Latn-GF */
-    static_cast<uint64_t>(0x67644c61746e4742), /* gd-Latn-GB */
     static_cast<uint64_t>(0x98644c61746e5a5a), /* gde-Latn-ZZ */
     static_cast<uint64_t>(0x986d4c61746e5a5a), /* gdn-Latn-ZZ */
     static_cast<uint64_t>(0x98714c61746e5a5a), /* gdr-Latn-ZZ */
@@ -431,11 +617,9 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x993441726162504b), /* gju-Arab-PK */
     static_cast<uint64_t>(0x994d4c61746e5a5a), /* gkn-Latn-ZZ */
     static_cast<uint64_t>(0x994f4c61746e5a5a), /* gkp-Latn-ZZ */
-    static_cast<uint64_t>(0x676c4c61746e4553), /* gl-Latn-ES */
     static_cast<uint64_t>(0x996a417261624952), /* glk-Arab-IR */
     static_cast<uint64_t>(0x998c4c61746e5a5a), /* gmm-Latn-ZZ */
     static_cast<uint64_t>(0x9995457468695a5a), /* gmv-Ethi-ZZ */
-    static_cast<uint64_t>(0x676e4c61746e5059), /* gn-Latn-PY */
     static_cast<uint64_t>(0x99a34c61746e5a5a), /* gnd-Latn-ZZ */
     static_cast<uint64_t>(0x99a64c61746e5a5a), /* gng-Latn-ZZ */
     static_cast<uint64_t>(0x99c34c61746e5a5a), /* god-Latn-ZZ */
@@ -452,7 +636,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x9a3342656e67494e), /* grt-Beng-IN */
     static_cast<uint64_t>(0x9a364c61746e5a5a), /* grw-Latn-ZZ */
     static_cast<uint64_t>(0x9a564c61746e4348), /* gsw-Latn-CH */
-    static_cast<uint64_t>(0x677547756a72494e), /* gu-Gujr-IN */
     static_cast<uint64_t>(0x9a814c61746e4252), /* gub-Latn-BR */
     static_cast<uint64_t>(0x9a824c61746e434f), /* guc-Latn-CO */
     static_cast<uint64_t>(0x9a834c61746e5a5a), /* gud-Latn-ZZ */
@@ -460,7 +643,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x9a964c61746e5a5a), /* guw-Latn-ZZ */
     static_cast<uint64_t>(0x9a974c61746e5a5a), /* gux-Latn-ZZ */
     static_cast<uint64_t>(0x9a994c61746e4b45), /* guz-Latn-KE */
-    static_cast<uint64_t>(0x67764c61746e494d), /* gv-Latn-IM */
     static_cast<uint64_t>(0x9aa54c61746e5a5a), /* gvf-Latn-ZZ */
     static_cast<uint64_t>(0x9ab1446576614e50), /* gvr-Deva-NP */
     static_cast<uint64_t>(0x9ab24c61746e5a5a), /* gvs-Latn-ZZ */
@@ -468,9 +650,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x9ac84c61746e4341), /* gwi-Latn-CA */
     static_cast<uint64_t>(0x9ad3417261625a5a), /* gwt-Arab-ZZ */
     static_cast<uint64_t>(0x9b084c61746e5a5a), /* gyi-Latn-ZZ */
-    static_cast<uint64_t>(0x68614c61746e4e47), /* ha-Latn-NG */
-    static_cast<uint64_t>(0x686141726162434d), /* ha-Arab-CM */
-    static_cast<uint64_t>(0x6861417261625344), /* ha-Arab-SD */
     static_cast<uint64_t>(0x9c064c61746e5a5a), /* hag-Latn-ZZ */
     static_cast<uint64_t>(0x9c0a48616e73434e), /* hak-Hans-CN */
     static_cast<uint64_t>(0x9c0c4c61746e5a5a), /* ham-Latn-ZZ */
@@ -478,9 +657,7 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x9c19417261624146), /* haz-Arab-AF */
     static_cast<uint64_t>(0x9c214c61746e5a5a), /* hbb-Latn-ZZ */
     static_cast<uint64_t>(0x9c78457468695a5a), /* hdy-Ethi-ZZ */
-    static_cast<uint64_t>(0x686548656272494c), /* he-Hebr-IL */
     static_cast<uint64_t>(0x9cf84c61746e5a5a), /* hhy-Latn-ZZ */
-    static_cast<uint64_t>(0x686944657661494e), /* hi-Deva-IN */
     static_cast<uint64_t>(0x9d004c61746e5a5a), /* hia-Latn-ZZ */
     static_cast<uint64_t>(0x9d054c61746e464a), /* hif-Latn-FJ */
     static_cast<uint64_t>(0x9d064c61746e5a5a), /* hig-Latn-ZZ */
@@ -495,19 +672,12 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0x9da9486d6e674c41), /* hnj-Hmng-LA */
     static_cast<uint64_t>(0x9dad4c61746e5048), /* hnn-Latn-PH */
     static_cast<uint64_t>(0x9dae41726162504b), /* hno-Arab-PK */
-    static_cast<uint64_t>(0x686f4c61746e5047), /* ho-Latn-PG */
     static_cast<uint64_t>(0x9dc244657661494e), /* hoc-Deva-IN */
     static_cast<uint64_t>(0x9dc944657661494e), /* hoj-Deva-IN */
     static_cast<uint64_t>(0x9dd34c61746e5a5a), /* hot-Latn-ZZ */
-    static_cast<uint64_t>(0x68724c61746e4852), /* hr-Latn-HR */
     static_cast<uint64_t>(0x9e414c61746e4445), /* hsb-Latn-DE */
     static_cast<uint64_t>(0x9e4d48616e73434e), /* hsn-Hans-CN */
-    static_cast<uint64_t>(0x68744c61746e4854), /* ht-Latn-HT */
-    static_cast<uint64_t>(0x68754c61746e4855), /* hu-Latn-HU */
     static_cast<uint64_t>(0x9e884c61746e5a5a), /* hui-Latn-ZZ */
-    static_cast<uint64_t>(0x687941726d6e414d), /* hy-Armn-AM */
-    static_cast<uint64_t>(0x687a4c61746e4e41), /* hz-Latn-NA */
-    static_cast<uint64_t>(0x69614c61746e8001), /* ia-Latn-001 */
     static_cast<uint64_t>(0xa00d4c61746e5a5a), /* ian-Latn-ZZ */
     static_cast<uint64_t>(0xa0114c61746e5a5a), /* iar-Latn-ZZ */
     static_cast<uint64_t>(0xa0204c61746e4d59), /* iba-Latn-MY */
@@ -515,37 +685,26 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xa0384c61746e5a5a), /* iby-Latn-ZZ */
     static_cast<uint64_t>(0xa0404c61746e5a5a), /* ica-Latn-ZZ */
     static_cast<uint64_t>(0xa0474c61746e5a5a), /* ich-Latn-ZZ */
-    static_cast<uint64_t>(0x69644c61746e4944), /* id-Latn-ID */
     static_cast<uint64_t>(0xa0634c61746e5a5a), /* idd-Latn-ZZ */
     static_cast<uint64_t>(0xa0684c61746e5a5a), /* idi-Latn-ZZ */
     static_cast<uint64_t>(0xa0744c61746e5a5a), /* idu-Latn-ZZ */
     static_cast<uint64_t>(0xa0a44c61746e5447), /* ife-Latn-TG */
-    static_cast<uint64_t>(0x69674c61746e4e47), /* ig-Latn-NG */
     static_cast<uint64_t>(0xa0c14c61746e5a5a), /* igb-Latn-ZZ */
     static_cast<uint64_t>(0xa0c44c61746e5a5a), /* ige-Latn-ZZ */
-    static_cast<uint64_t>(0x696959696969434e), /* ii-Yiii-CN */
     static_cast<uint64_t>(0xa1294c61746e5a5a), /* ijj-Latn-ZZ */
-    static_cast<uint64_t>(0x696b4c61746e5553), /* ik-Latn-US */
     static_cast<uint64_t>(0xa14a4c61746e5a5a), /* ikk-Latn-ZZ */
     static_cast<uint64_t>(0xa1534c61746e4341), /* ikt-Latn-CA */
     static_cast<uint64_t>(0xa1564c61746e5a5a), /* ikw-Latn-ZZ */
     static_cast<uint64_t>(0xa1574c61746e5a5a), /* ikx-Latn-ZZ */
     static_cast<uint64_t>(0xa16e4c61746e5048), /* ilo-Latn-PH */
     static_cast<uint64_t>(0xa18e4c61746e5a5a), /* imo-Latn-ZZ */
-    static_cast<uint64_t>(0x696e4c61746e4944), /* in-Latn-ID */
     static_cast<uint64_t>(0xa1a74379726c5255), /* inh-Cyrl-RU */
-    static_cast<uint64_t>(0x696f4c61746e8001), /* io-Latn-001 */
     static_cast<uint64_t>(0xa1d44c61746e5a5a), /* iou-Latn-ZZ */
     static_cast<uint64_t>(0xa2284c61746e5a5a), /* iri-Latn-ZZ */
-    static_cast<uint64_t>(0x69734c61746e4953), /* is-Latn-IS */
-    static_cast<uint64_t>(0x69744c61746e4954), /* it-Latn-IT */
-    static_cast<uint64_t>(0x697543616e734341), /* iu-Cans-CA */
-    static_cast<uint64_t>(0x697748656272494c), /* iw-Hebr-IL */
     static_cast<uint64_t>(0xa2cc4c61746e5a5a), /* iwm-Latn-ZZ */
     static_cast<uint64_t>(0xa2d24c61746e5a5a), /* iws-Latn-ZZ */
     static_cast<uint64_t>(0xa3274c61746e5255), /* izh-Latn-RU */
     static_cast<uint64_t>(0xa3284c61746e5a5a), /* izi-Latn-ZZ */
-    static_cast<uint64_t>(0x6a614a70616e4a50), /* ja-Jpan-JP */
     static_cast<uint64_t>(0xa4014c61746e5a5a), /* jab-Latn-ZZ */
     static_cast<uint64_t>(0xa40c4c61746e4a4d), /* jam-Latn-JM */
     static_cast<uint64_t>(0xa4114c61746e5a5a), /* jar-Latn-ZZ */
@@ -554,15 +713,11 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xa48d4c61746e5a5a), /* jen-Latn-ZZ */
     static_cast<uint64_t>(0xa4ca4c61746e5a5a), /* jgk-Latn-ZZ */
     static_cast<uint64_t>(0xa4ce4c61746e434d), /* jgo-Latn-CM */
-    static_cast<uint64_t>(0x6a69486562725541), /* ji-Hebr-UA */
     static_cast<uint64_t>(0xa5014c61746e5a5a), /* jib-Latn-ZZ */
     static_cast<uint64_t>(0xa5824c61746e545a), /* jmc-Latn-TZ */
     static_cast<uint64_t>(0xa58b446576614e50), /* jml-Deva-NP */
     static_cast<uint64_t>(0xa6204c61746e5a5a), /* jra-Latn-ZZ */
     static_cast<uint64_t>(0xa6934c61746e444b), /* jut-Latn-DK */
-    static_cast<uint64_t>(0x6a764c61746e4944), /* jv-Latn-ID */
-    static_cast<uint64_t>(0x6a774c61746e4944), /* jw-Latn-ID */
-    static_cast<uint64_t>(0x6b6147656f724745), /* ka-Geor-GE */
     static_cast<uint64_t>(0xa8004379726c555a), /* kaa-Cyrl-UZ */
     static_cast<uint64_t>(0xa8014c61746e445a), /* kab-Latn-DZ */
     static_cast<uint64_t>(0xa8024c61746e4d4d), /* kac-Latn-MM */
@@ -591,7 +746,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xa8ae4c61746e4349), /* kfo-Latn-CI */
     static_cast<uint64_t>(0xa8b144657661494e), /* kfr-Deva-IN */
     static_cast<uint64_t>(0xa8b844657661494e), /* kfy-Deva-IN */
-    static_cast<uint64_t>(0x6b674c61746e4344), /* kg-Latn-CD */
     static_cast<uint64_t>(0xa8c44c61746e4944), /* kge-Latn-ID */
     static_cast<uint64_t>(0xa8c54c61746e5a5a), /* kgf-Latn-ZZ */
     static_cast<uint64_t>(0xa8cf4c61746e4252), /* kgp-Latn-BR */
@@ -603,39 +757,27 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xa8f34d796d72494e), /* kht-Mymr-IN */
     static_cast<uint64_t>(0xa8f641726162504b), /* khw-Arab-PK */
     static_cast<uint64_t>(0xa8f94c61746e5a5a), /* khz-Latn-ZZ */
-    static_cast<uint64_t>(0x6b694c61746e4b45), /* ki-Latn-KE */
     static_cast<uint64_t>(0xa9094c61746e5a5a), /* kij-Latn-ZZ */
     static_cast<uint64_t>(0xa9144c61746e5452), /* kiu-Latn-TR */
     static_cast<uint64_t>(0xa9164c61746e5a5a), /* kiw-Latn-ZZ */
-    static_cast<uint64_t>(0x6b6a4c61746e4e41), /* kj-Latn-NA */
     static_cast<uint64_t>(0xa9234c61746e5a5a), /* kjd-Latn-ZZ */
     static_cast<uint64_t>(0xa9264c616f6f4c41), /* kjg-Laoo-LA */
     static_cast<uint64_t>(0xa9324c61746e5a5a), /* kjs-Latn-ZZ */
     static_cast<uint64_t>(0xa9384c61746e5a5a), /* kjy-Latn-ZZ */
-    static_cast<uint64_t>(0x6b6b4379726c4b5a), /* kk-Cyrl-KZ */
-    static_cast<uint64_t>(0x6b6b417261624146), /* kk-Arab-AF */
-    static_cast<uint64_t>(0x6b6b41726162434e), /* kk-Arab-CN */
-    static_cast<uint64_t>(0x6b6b41726162434e), /* kk-Arab-CN */
-    static_cast<uint64_t>(0x6b6b417261624952), /* kk-Arab-IR */
-    static_cast<uint64_t>(0x6b6b417261624d4e), /* kk-Arab-MN */
     static_cast<uint64_t>(0xa9424c61746e5a5a), /* kkc-Latn-ZZ */
     static_cast<uint64_t>(0xa9494c61746e434d), /* kkj-Latn-CM */
-    static_cast<uint64_t>(0x6b6c4c61746e474c), /* kl-Latn-GL */
     static_cast<uint64_t>(0xa96d4c61746e4b45), /* kln-Latn-KE */
     static_cast<uint64_t>(0xa9704c61746e5a5a), /* klq-Latn-ZZ */
     static_cast<uint64_t>(0xa9734c61746e5a5a), /* klt-Latn-ZZ */
     static_cast<uint64_t>(0xa9774c61746e5a5a), /* klx-Latn-ZZ */
-    static_cast<uint64_t>(0x6b6d4b686d724b48), /* km-Khmr-KH */
     static_cast<uint64_t>(0xa9814c61746e414f), /* kmb-Latn-AO */
     static_cast<uint64_t>(0xa9874c61746e5a5a), /* kmh-Latn-ZZ */
     static_cast<uint64_t>(0xa98e4c61746e5a5a), /* kmo-Latn-ZZ */
     static_cast<uint64_t>(0xa9924c61746e5a5a), /* kms-Latn-ZZ */
     static_cast<uint64_t>(0xa9944c61746e5a5a), /* kmu-Latn-ZZ */
     static_cast<uint64_t>(0xa9964c61746e5a5a), /* kmw-Latn-ZZ */
-    static_cast<uint64_t>(0x6b6e4b6e6461494e), /* kn-Knda-IN */
     static_cast<uint64_t>(0xa9a54c61746e4757), /* knf-Latn-GW */
     static_cast<uint64_t>(0xa9af4c61746e5a5a), /* knp-Latn-ZZ */
-    static_cast<uint64_t>(0x6b6f4b6f72654b52), /* ko-Kore-KR */
     static_cast<uint64_t>(0xa9c84379726c5255), /* koi-Cyrl-RU */
     static_cast<uint64_t>(0xa9ca44657661494e), /* kok-Deva-IN */
     static_cast<uint64_t>(0xa9cb4c61746e5a5a), /* kol-Latn-ZZ */
@@ -650,14 +792,12 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xaa054c61746e5a5a), /* kqf-Latn-ZZ */
     static_cast<uint64_t>(0xaa124c61746e5a5a), /* kqs-Latn-ZZ */
     static_cast<uint64_t>(0xaa18457468695a5a), /* kqy-Ethi-ZZ */
-    static_cast<uint64_t>(0x6b724c61746e5a5a), /* kr-Latn-ZZ */
     static_cast<uint64_t>(0xaa224379726c5255), /* krc-Cyrl-RU */
     static_cast<uint64_t>(0xaa284c61746e534c), /* kri-Latn-SL */
     static_cast<uint64_t>(0xaa294c61746e5048), /* krj-Latn-PH */
     static_cast<uint64_t>(0xaa2b4c61746e5255), /* krl-Latn-RU */
     static_cast<uint64_t>(0xaa324c61746e5a5a), /* krs-Latn-ZZ */
     static_cast<uint64_t>(0xaa3444657661494e), /* kru-Deva-IN */
-    static_cast<uint64_t>(0x6b7341726162494e), /* ks-Arab-IN */
     static_cast<uint64_t>(0xaa414c61746e545a), /* ksb-Latn-TZ */
     static_cast<uint64_t>(0xaa434c61746e5a5a), /* ksd-Latn-ZZ */
     static_cast<uint64_t>(0xaa454c61746e434d), /* ksf-Latn-CM */
@@ -668,10 +808,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xaa6c4c61746e5a5a), /* ktm-Latn-ZZ */
     static_cast<uint64_t>(0xaa6e4c61746e5a5a), /* kto-Latn-ZZ */
     static_cast<uint64_t>(0xaa714c61746e4d59), /* ktr-Latn-MY */
-    static_cast<uint64_t>(0x6b754c61746e5452), /* ku-Latn-TR */
-    static_cast<uint64_t>(0x6b75417261624951), /* ku-Arab-IQ */
-    static_cast<uint64_t>(0x6b75417261624c42), /* ku-Arab-LB */
-    static_cast<uint64_t>(0x6b7559657a694745), /* ku-Yezi-GE */
     static_cast<uint64_t>(0xaa814c61746e5a5a), /* kub-Latn-ZZ */
     static_cast<uint64_t>(0xaa834c61746e5a5a), /* kud-Latn-ZZ */
     static_cast<uint64_t>(0xaa844c61746e5a5a), /* kue-Latn-ZZ */
@@ -680,11 +816,9 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xaa8d4c61746e5a5a), /* kun-Latn-ZZ */
     static_cast<uint64_t>(0xaa8f4c61746e5a5a), /* kup-Latn-ZZ */
     static_cast<uint64_t>(0xaa924c61746e5a5a), /* kus-Latn-ZZ */
-    static_cast<uint64_t>(0x6b764379726c5255), /* kv-Cyrl-RU */
     static_cast<uint64_t>(0xaaa64c61746e5a5a), /* kvg-Latn-ZZ */
     static_cast<uint64_t>(0xaab14c61746e4944), /* kvr-Latn-ID */
     static_cast<uint64_t>(0xaab741726162504b), /* kvx-Arab-PK */
-    static_cast<uint64_t>(0x6b774c61746e4742), /* kw-Latn-GB */
     static_cast<uint64_t>(0xaac94c61746e5a5a), /* kwj-Latn-ZZ */
     static_cast<uint64_t>(0xaace4c61746e5a5a), /* kwo-Latn-ZZ */
     static_cast<uint64_t>(0xaad04c61746e5a5a), /* kwq-Latn-ZZ */
@@ -696,25 +830,18 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xaaef41726162504b), /* kxp-Arab-PK */
     static_cast<uint64_t>(0xaaf64c61746e5a5a), /* kxw-Latn-ZZ */
     static_cast<uint64_t>(0xaaf94c61746e5a5a), /* kxz-Latn-ZZ */
-    static_cast<uint64_t>(0x6b794379726c4b47), /* ky-Cyrl-KG */
-    static_cast<uint64_t>(0x6b7941726162434e), /* ky-Arab-CN */
-    static_cast<uint64_t>(0x6b7941726162434e), /* ky-Arab-CN */
-    static_cast<uint64_t>(0x6b794c61746e5452), /* ky-Latn-TR */
-    static_cast<uint64_t>(0x6b794c61746e5452), /* ky-Latn-TR */
     static_cast<uint64_t>(0xab044c61746e5a5a), /* kye-Latn-ZZ */
     static_cast<uint64_t>(0xab174c61746e5a5a), /* kyx-Latn-ZZ */
     static_cast<uint64_t>(0xab27417261625a5a), /* kzh-Arab-ZZ */
     static_cast<uint64_t>(0xab294c61746e4d59), /* kzj-Latn-MY */
     static_cast<uint64_t>(0xab314c61746e5a5a), /* kzr-Latn-ZZ */
     static_cast<uint64_t>(0xab334c61746e4d59), /* kzt-Latn-MY */
-    static_cast<uint64_t>(0x6c614c61746e5641), /* la-Latn-VA */
     static_cast<uint64_t>(0xac014c696e614752), /* lab-Lina-GR */
     static_cast<uint64_t>(0xac0348656272494c), /* lad-Hebr-IL */
     static_cast<uint64_t>(0xac064c61746e545a), /* lag-Latn-TZ */
     static_cast<uint64_t>(0xac0741726162504b), /* lah-Arab-PK */
     static_cast<uint64_t>(0xac094c61746e5547), /* laj-Latn-UG */
     static_cast<uint64_t>(0xac124c61746e5a5a), /* las-Latn-ZZ */
-    static_cast<uint64_t>(0x6c624c61746e4c55), /* lb-Latn-LU */
     static_cast<uint64_t>(0xac244379726c5255), /* lbe-Cyrl-RU */
     static_cast<uint64_t>(0xac344c61746e5a5a), /* lbu-Latn-ZZ */
     static_cast<uint64_t>(0xac364c61746e4944), /* lbw-Latn-ID */
@@ -728,9 +855,7 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xac904c61746e5a5a), /* leq-Latn-ZZ */
     static_cast<uint64_t>(0xac944c61746e5a5a), /* leu-Latn-ZZ */
     static_cast<uint64_t>(0xac994379726c5255), /* lez-Cyrl-RU */
-    static_cast<uint64_t>(0x6c674c61746e5547), /* lg-Latn-UG */
     static_cast<uint64_t>(0xacc64c61746e5a5a), /* lgg-Latn-ZZ */
-    static_cast<uint64_t>(0x6c694c61746e4e4c), /* li-Latn-NL */
     static_cast<uint64_t>(0xad004c61746e5a5a), /* lia-Latn-ZZ */
     static_cast<uint64_t>(0xad034c61746e5a5a), /* lid-Latn-ZZ */
     static_cast<uint64_t>(0xad05446576614e50), /* lif-Deva-NP */
@@ -747,10 +872,8 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xad8d54656c75494e), /* lmn-Telu-IN */
     static_cast<uint64_t>(0xad8e4c61746e4954), /* lmo-Latn-IT */
     static_cast<uint64_t>(0xad8f4c61746e5a5a), /* lmp-Latn-ZZ */
-    static_cast<uint64_t>(0x6c6e4c61746e4344), /* ln-Latn-CD */
     static_cast<uint64_t>(0xadb24c61746e5a5a), /* lns-Latn-ZZ */
     static_cast<uint64_t>(0xadb44c61746e5a5a), /* lnu-Latn-ZZ */
-    static_cast<uint64_t>(0x6c6f4c616f6f4c41), /* lo-Laoo-LA */
     static_cast<uint64_t>(0xadc94c61746e5a5a), /* loj-Latn-ZZ */
     static_cast<uint64_t>(0xadca4c61746e5a5a), /* lok-Latn-ZZ */
     static_cast<uint64_t>(0xadcb4c61746e4344), /* lol-Latn-CD */
@@ -758,14 +881,11 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xadd24c61746e5a5a), /* los-Latn-ZZ */
     static_cast<uint64_t>(0xadd94c61746e5a4d), /* loz-Latn-ZM */
     static_cast<uint64_t>(0xae22417261624952), /* lrc-Arab-IR */
-    static_cast<uint64_t>(0x6c744c61746e4c54), /* lt-Latn-LT */
     static_cast<uint64_t>(0xae664c61746e4c56), /* ltg-Latn-LV */
-    static_cast<uint64_t>(0x6c754c61746e4344), /* lu-Latn-CD */
     static_cast<uint64_t>(0xae804c61746e4344), /* lua-Latn-CD */
     static_cast<uint64_t>(0xae8e4c61746e4b45), /* luo-Latn-KE */
     static_cast<uint64_t>(0xae984c61746e4b45), /* luy-Latn-KE */
     static_cast<uint64_t>(0xae99417261624952), /* luz-Arab-IR */
-    static_cast<uint64_t>(0x6c764c61746e4c56), /* lv-Latn-LV */
     static_cast<uint64_t>(0xaecb546861695448), /* lwl-Thai-TH */
     static_cast<uint64_t>(0xaf2748616e73434e), /* lzh-Hans-CN */
     static_cast<uint64_t>(0xaf394c61746e5452), /* lzz-Latn-TR */
@@ -809,41 +929,32 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xb0ad4c61746e5a5a), /* mfn-Latn-ZZ */
     static_cast<uint64_t>(0xb0ae4c61746e5a5a), /* mfo-Latn-ZZ */
     static_cast<uint64_t>(0xb0b04c61746e5a5a), /* mfq-Latn-ZZ */
-    static_cast<uint64_t>(0x6d674c61746e4d47), /* mg-Latn-MG */
     static_cast<uint64_t>(0xb0c74c61746e4d5a), /* mgh-Latn-MZ */
     static_cast<uint64_t>(0xb0cb4c61746e5a5a), /* mgl-Latn-ZZ */
     static_cast<uint64_t>(0xb0ce4c61746e434d), /* mgo-Latn-CM */
     static_cast<uint64_t>(0xb0cf446576614e50), /* mgp-Deva-NP */
     static_cast<uint64_t>(0xb0d84c61746e545a), /* mgy-Latn-TZ */
-    static_cast<uint64_t>(0x6d684c61746e4d48), /* mh-Latn-MH */
     static_cast<uint64_t>(0xb0e84c61746e5a5a), /* mhi-Latn-ZZ */
     static_cast<uint64_t>(0xb0eb4c61746e5a5a), /* mhl-Latn-ZZ */
-    static_cast<uint64_t>(0x6d694c61746e4e5a), /* mi-Latn-NZ */
     static_cast<uint64_t>(0xb1054c61746e5a5a), /* mif-Latn-ZZ */
     static_cast<uint64_t>(0xb10d4c61746e4944), /* min-Latn-ID */
     static_cast<uint64_t>(0xb112486174724951), /* mis-Hatr-IQ */
     static_cast<uint64_t>(0xb1124d6564664e47), /* mis-Medf-NG */
     static_cast<uint64_t>(0xb1164c61746e5a5a), /* miw-Latn-ZZ */
-    static_cast<uint64_t>(0x6d6b4379726c4d4b), /* mk-Cyrl-MK */
     static_cast<uint64_t>(0xb148417261625a5a), /* mki-Arab-ZZ */
     static_cast<uint64_t>(0xb14b4c61746e5a5a), /* mkl-Latn-ZZ */
     static_cast<uint64_t>(0xb14f4c61746e5a5a), /* mkp-Latn-ZZ */
     static_cast<uint64_t>(0xb1564c61746e5a5a), /* mkw-Latn-ZZ */
-    static_cast<uint64_t>(0x6d6c4d6c796d494e), /* ml-Mlym-IN */
     static_cast<uint64_t>(0xb1644c61746e5a5a), /* mle-Latn-ZZ */
     static_cast<uint64_t>(0xb16f4c61746e5a5a), /* mlp-Latn-ZZ */
     static_cast<uint64_t>(0xb1724c61746e5344), /* mls-Latn-SD */
     static_cast<uint64_t>(0xb18e4c61746e5a5a), /* mmo-Latn-ZZ */
     static_cast<uint64_t>(0xb1944c61746e5a5a), /* mmu-Latn-ZZ */
     static_cast<uint64_t>(0xb1974c61746e5a5a), /* mmx-Latn-ZZ */
-    static_cast<uint64_t>(0x6d6e4379726c4d4e), /* mn-Cyrl-MN */
-    static_cast<uint64_t>(0x6d6e4d6f6e67434e), /* mn-Mong-CN */
-    static_cast<uint64_t>(0x6d6e4d6f6e67434e), /* mn-Mong-CN */
     static_cast<uint64_t>(0xb1a04c61746e5a5a), /* mna-Latn-ZZ */
     static_cast<uint64_t>(0xb1a54c61746e5a5a), /* mnf-Latn-ZZ */
     static_cast<uint64_t>(0xb1a842656e67494e), /* mni-Beng-IN */
     static_cast<uint64_t>(0xb1b64d796d724d4d), /* mnw-Mymr-MM */
-    static_cast<uint64_t>(0x6d6f4c61746e524f), /* mo-Latn-RO */
     static_cast<uint64_t>(0xb1c04c61746e5a5a), /* moa-Latn-ZZ */
     static_cast<uint64_t>(0xb1c44c61746e4341), /* moe-Latn-CA */
     static_cast<uint64_t>(0xb1c74c61746e4341), /* moh-Latn-CA */
@@ -854,13 +965,9 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xb1f34c61746e5a5a), /* mpt-Latn-ZZ */
     static_cast<uint64_t>(0xb1f74c61746e5a5a), /* mpx-Latn-ZZ */
     static_cast<uint64_t>(0xb20b4c61746e5a5a), /* mql-Latn-ZZ */
-    static_cast<uint64_t>(0x6d7244657661494e), /* mr-Deva-IN */
     static_cast<uint64_t>(0xb223446576614e50), /* mrd-Deva-NP */
     static_cast<uint64_t>(0xb2294379726c5255), /* mrj-Cyrl-RU */
     static_cast<uint64_t>(0xb22e4d726f6f4244), /* mro-Mroo-BD */
-    static_cast<uint64_t>(0x6d734c61746e4d59), /* ms-Latn-MY */
-    static_cast<uint64_t>(0x6d73417261624343), /* ms-Arab-CC */
-    static_cast<uint64_t>(0x6d744c61746e4d54), /* mt-Latn-MT */
     static_cast<uint64_t>(0xb2624c61746e5a5a), /* mtc-Latn-ZZ */
     static_cast<uint64_t>(0xb2654c61746e5a5a), /* mtf-Latn-ZZ */
     static_cast<uint64_t>(0xb2684c61746e5a5a), /* mti-Latn-ZZ */
@@ -877,7 +984,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xb2d6486d6e705553), /* mww-Hmnp-US */
     static_cast<uint64_t>(0xb2e24c61746e5a57), /* mxc-Latn-ZW */
     static_cast<uint64_t>(0xb2ec4c61746e5a5a), /* mxm-Latn-ZZ */
-    static_cast<uint64_t>(0x6d794d796d724d4d), /* my-Mymr-MM */
     static_cast<uint64_t>(0xb30a4c61746e5a5a), /* myk-Latn-ZZ */
     static_cast<uint64_t>(0xb30c457468695a5a), /* mym-Ethi-ZZ */
     static_cast<uint64_t>(0xb3154379726c5255), /* myv-Cyrl-RU */
@@ -890,7 +996,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xb32f4c61746e5a5a), /* mzp-Latn-ZZ */
     static_cast<uint64_t>(0xb3364c61746e5a5a), /* mzw-Latn-ZZ */
     static_cast<uint64_t>(0xb3394c61746e5a5a), /* mzz-Latn-ZZ */
-    static_cast<uint64_t>(0x6e614c61746e4e52), /* na-Latn-NR */
     static_cast<uint64_t>(0xb4024c61746e5a5a), /* nac-Latn-ZZ */
     static_cast<uint64_t>(0xb4054c61746e5a5a), /* naf-Latn-ZZ */
     static_cast<uint64_t>(0xb40a4c61746e5a5a), /* nak-Latn-ZZ */
@@ -898,22 +1003,18 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xb40f4c61746e4954), /* nap-Latn-IT */
     static_cast<uint64_t>(0xb4104c61746e4e41), /* naq-Latn-NA */
     static_cast<uint64_t>(0xb4124c61746e5a5a), /* nas-Latn-ZZ */
-    static_cast<uint64_t>(0x6e624c61746e4e4f), /* nb-Latn-NO */
     static_cast<uint64_t>(0xb4404c61746e5a5a), /* nca-Latn-ZZ */
     static_cast<uint64_t>(0xb4444c61746e5a5a), /* nce-Latn-ZZ */
     static_cast<uint64_t>(0xb4454c61746e5a5a), /* ncf-Latn-ZZ */
     static_cast<uint64_t>(0xb4474c61746e4d58), /* nch-Latn-MX */
     static_cast<uint64_t>(0xb44e4c61746e5a5a), /* nco-Latn-ZZ */
     static_cast<uint64_t>(0xb4544c61746e5a5a), /* ncu-Latn-ZZ */
-    static_cast<uint64_t>(0x6e644c61746e5a57), /* nd-Latn-ZW */
     static_cast<uint64_t>(0xb4624c61746e4d5a), /* ndc-Latn-MZ */
     static_cast<uint64_t>(0xb4724c61746e4445), /* nds-Latn-DE */
-    static_cast<uint64_t>(0x6e65446576614e50), /* ne-Deva-NP */
     static_cast<uint64_t>(0xb4814c61746e5a5a), /* neb-Latn-ZZ */
     static_cast<uint64_t>(0xb496446576614e50), /* new-Deva-NP */
     static_cast<uint64_t>(0xb4974c61746e5a5a), /* nex-Latn-ZZ */
     static_cast<uint64_t>(0xb4b14c61746e5a5a), /* nfr-Latn-ZZ */
-    static_cast<uint64_t>(0x6e674c61746e4e41), /* ng-Latn-NA */
     static_cast<uint64_t>(0xb4c04c61746e5a5a), /* nga-Latn-ZZ */
     static_cast<uint64_t>(0xb4c14c61746e5a5a), /* ngb-Latn-ZZ */
     static_cast<uint64_t>(0xb4cb4c61746e4d5a), /* ngl-Latn-MZ */
@@ -930,23 +1031,19 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xb52e4c61746e494e), /* njo-Latn-IN */
     static_cast<uint64_t>(0xb5464c61746e5a5a), /* nkg-Latn-ZZ */
     static_cast<uint64_t>(0xb54e4c61746e5a5a), /* nko-Latn-ZZ */
-    static_cast<uint64_t>(0x6e6c4c61746e4e4c), /* nl-Latn-NL */
     static_cast<uint64_t>(0xb5864c61746e434d), /* nmg-Latn-CM */
     static_cast<uint64_t>(0xb5994c61746e5a5a), /* nmz-Latn-ZZ */
-    static_cast<uint64_t>(0x6e6e4c61746e4e4f), /* nn-Latn-NO */
     static_cast<uint64_t>(0xb5a54c61746e5a5a), /* nnf-Latn-ZZ */
     static_cast<uint64_t>(0xb5a74c61746e434d), /* nnh-Latn-CM */
     static_cast<uint64_t>(0xb5aa4c61746e5a5a), /* nnk-Latn-ZZ */
     static_cast<uint64_t>(0xb5ac4c61746e5a5a), /* nnm-Latn-ZZ */
     static_cast<uint64_t>(0xb5af5763686f494e), /* nnp-Wcho-IN */
-    static_cast<uint64_t>(0x6e6f4c61746e4e4f), /* no-Latn-NO */
     static_cast<uint64_t>(0xb5c34c616e615448), /* nod-Lana-TH */
     static_cast<uint64_t>(0xb5c444657661494e), /* noe-Deva-IN */
     static_cast<uint64_t>(0xb5cd52756e725345), /* non-Runr-SE */
     static_cast<uint64_t>(0xb5cf4c61746e5a5a), /* nop-Latn-ZZ */
     static_cast<uint64_t>(0xb5d44c61746e5a5a), /* nou-Latn-ZZ */
     static_cast<uint64_t>(0xb60e4e6b6f6f474e), /* nqo-Nkoo-GN */
-    static_cast<uint64_t>(0x6e724c61746e5a41), /* nr-Latn-ZA */
     static_cast<uint64_t>(0xb6214c61746e5a5a), /* nrb-Latn-ZZ */
     static_cast<uint64_t>(0xb64a43616e734341), /* nsk-Cans-CA */
     static_cast<uint64_t>(0xb64d4c61746e5a5a), /* nsn-Latn-ZZ */
@@ -959,34 +1056,25 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xb6924c61746e5353), /* nus-Latn-SS */
     static_cast<uint64_t>(0xb6954c61746e5a5a), /* nuv-Latn-ZZ */
     static_cast<uint64_t>(0xb6974c61746e5a5a), /* nux-Latn-ZZ */
-    static_cast<uint64_t>(0x6e764c61746e5553), /* nv-Latn-US */
     static_cast<uint64_t>(0xb6c14c61746e5a5a), /* nwb-Latn-ZZ */
     static_cast<uint64_t>(0xb6f04c61746e434e), /* nxq-Latn-CN */
     static_cast<uint64_t>(0xb6f14c61746e5a5a), /* nxr-Latn-ZZ */
-    static_cast<uint64_t>(0x6e794c61746e4d57), /* ny-Latn-MW */
     static_cast<uint64_t>(0xb70c4c61746e545a), /* nym-Latn-TZ */
     static_cast<uint64_t>(0xb70d4c61746e5547), /* nyn-Latn-UG */
     static_cast<uint64_t>(0xb7284c61746e4748), /* nzi-Latn-GH */
-    static_cast<uint64_t>(0x6f634c61746e4652), /* oc-Latn-FR */
     static_cast<uint64_t>(0xb8c24c61746e5a5a), /* ogc-Latn-ZZ */
     static_cast<uint64_t>(0xb9514c61746e5a5a), /* okr-Latn-ZZ */
     static_cast<uint64_t>(0xb9554c61746e5a5a), /* okv-Latn-ZZ */
-    static_cast<uint64_t>(0x6f6d4c61746e4554), /* om-Latn-ET */
     static_cast<uint64_t>(0xb9a64c61746e5a5a), /* ong-Latn-ZZ */
     static_cast<uint64_t>(0xb9ad4c61746e5a5a), /* onn-Latn-ZZ */
     static_cast<uint64_t>(0xb9b24c61746e5a5a), /* ons-Latn-ZZ */
     static_cast<uint64_t>(0xb9ec4c61746e5a5a), /* opm-Latn-ZZ */
-    static_cast<uint64_t>(0x6f724f727961494e), /* or-Orya-IN */
     static_cast<uint64_t>(0xba2e4c61746e5a5a), /* oro-Latn-ZZ */
     static_cast<uint64_t>(0xba34417261625a5a), /* oru-Arab-ZZ */
-    static_cast<uint64_t>(0x6f734379726c4745), /* os-Cyrl-GE */
     static_cast<uint64_t>(0xba404f7367655553), /* osa-Osge-US */
     static_cast<uint64_t>(0xba60417261625a5a), /* ota-Arab-ZZ */
     static_cast<uint64_t>(0xba6a4f726b684d4e), /* otk-Orkh-MN */
     static_cast<uint64_t>(0xbb2c4c61746e5a5a), /* ozm-Latn-ZZ */
-    static_cast<uint64_t>(0x706147757275494e), /* pa-Guru-IN */
-    static_cast<uint64_t>(0x706141726162504b), /* pa-Arab-PK */
-    static_cast<uint64_t>(0x706141726162504b), /* pa-Arab-PK */
     static_cast<uint64_t>(0xbc064c61746e5048), /* pag-Latn-PH */
     static_cast<uint64_t>(0xbc0b50686c694952), /* pal-Phli-IR */
     static_cast<uint64_t>(0xbc0b50686c70434e), /* pal-Phlp-CN */
@@ -1008,7 +1096,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xbd0f4c61746e5a5a), /* pip-Latn-ZZ */
     static_cast<uint64_t>(0xbd4042726168494e), /* pka-Brah-IN */
     static_cast<uint64_t>(0xbd4e4c61746e4b45), /* pko-Latn-KE */
-    static_cast<uint64_t>(0x706c4c61746e504c), /* pl-Latn-PL */
     static_cast<uint64_t>(0xbd604c61746e5a5a), /* pla-Latn-ZZ */
     static_cast<uint64_t>(0xbd924c61746e4954), /* pms-Latn-IT */
     static_cast<uint64_t>(0xbda64c61746e5a5a), /* png-Latn-ZZ */
@@ -1020,13 +1107,10 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xbe204b686172504b), /* pra-Khar-PK */
     static_cast<uint64_t>(0xbe23417261624952), /* prd-Arab-IR */
     static_cast<uint64_t>(0xbe264c61746e8001), /* prg-Latn-001 */
-    static_cast<uint64_t>(0x7073417261624146), /* ps-Arab-AF */
     static_cast<uint64_t>(0xbe524c61746e5a5a), /* pss-Latn-ZZ */
-    static_cast<uint64_t>(0x70744c61746e4252), /* pt-Latn-BR */
     static_cast<uint64_t>(0xbe6f4c61746e5a5a), /* ptp-Latn-ZZ */
     static_cast<uint64_t>(0xbe944c61746e4741), /* puu-Latn-GA */
     static_cast<uint64_t>(0xbec04c61746e5a5a), /* pwa-Latn-ZZ */
-    static_cast<uint64_t>(0x71754c61746e5045), /* qu-Latn-PE */
     static_cast<uint64_t>(0xc2824c61746e4754), /* quc-Latn-GT */
     static_cast<uint64_t>(0xc2864c61746e4543), /* qug-Latn-EC */
     static_cast<uint64_t>(0xc4084c61746e5a5a), /* rai-Latn-ZZ */
@@ -1043,28 +1127,22 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xc5054c61746e4e4c), /* rif-Latn-NL */
     static_cast<uint64_t>(0xc532446576614e50), /* rjs-Deva-NP */
     static_cast<uint64_t>(0xc55342656e674244), /* rkt-Beng-BD */
-    static_cast<uint64_t>(0x726d4c61746e4348), /* rm-Latn-CH */
     static_cast<uint64_t>(0xc5854c61746e4649), /* rmf-Latn-FI */
     static_cast<uint64_t>(0xc58e4c61746e4348), /* rmo-Latn-CH */
     static_cast<uint64_t>(0xc593417261624952), /* rmt-Arab-IR */
     static_cast<uint64_t>(0xc5944c61746e5345), /* rmu-Latn-SE */
-    static_cast<uint64_t>(0x726e4c61746e4249), /* rn-Latn-BI */
     static_cast<uint64_t>(0xc5a04c61746e5a5a), /* rna-Latn-ZZ */
     static_cast<uint64_t>(0xc5a64c61746e4d5a), /* rng-Latn-MZ */
-    static_cast<uint64_t>(0x726f4c61746e524f), /* ro-Latn-RO */
     static_cast<uint64_t>(0xc5c14c61746e4944), /* rob-Latn-ID */
     static_cast<uint64_t>(0xc5c54c61746e545a), /* rof-Latn-TZ */
     static_cast<uint64_t>(0xc5ce4c61746e5a5a), /* roo-Latn-ZZ */
     static_cast<uint64_t>(0xc62e4c61746e5a5a), /* rro-Latn-ZZ */
     static_cast<uint64_t>(0xc66c4c61746e464a), /* rtm-Latn-FJ */
-    static_cast<uint64_t>(0x72754379726c5255), /* ru-Cyrl-RU */
     static_cast<uint64_t>(0xc6844379726c5541), /* rue-Cyrl-UA */
     static_cast<uint64_t>(0xc6864c61746e5342), /* rug-Latn-SB */
-    static_cast<uint64_t>(0x72774c61746e5257), /* rw-Latn-RW */
     static_cast<uint64_t>(0xc6ca4c61746e545a), /* rwk-Latn-TZ */
     static_cast<uint64_t>(0xc6ce4c61746e5a5a), /* rwo-Latn-ZZ */
     static_cast<uint64_t>(0xc7144b616e614a50), /* ryu-Kana-JP */
-    static_cast<uint64_t>(0x736144657661494e), /* sa-Deva-IN */
     static_cast<uint64_t>(0xc8054c61746e4748), /* saf-Latn-GH */
     static_cast<uint64_t>(0xc8074379726c5255), /* sah-Cyrl-RU */
     static_cast<uint64_t>(0xc8104c61746e4b45), /* saq-Latn-KE */
@@ -1075,24 +1153,17 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xc8204c61746e5a5a), /* sba-Latn-ZZ */
     static_cast<uint64_t>(0xc8244c61746e5a5a), /* sbe-Latn-ZZ */
     static_cast<uint64_t>(0xc82f4c61746e545a), /* sbp-Latn-TZ */
-    static_cast<uint64_t>(0x73634c61746e4954), /* sc-Latn-IT */
     static_cast<uint64_t>(0xc84a44657661494e), /* sck-Deva-IN */
     static_cast<uint64_t>(0xc84b417261625a5a), /* scl-Arab-ZZ */
     static_cast<uint64_t>(0xc84d4c61746e4954), /* scn-Latn-IT */
     static_cast<uint64_t>(0xc84e4c61746e4742), /* sco-Latn-GB */
     static_cast<uint64_t>(0xc8524c61746e4341), /* scs-Latn-CA */
-    static_cast<uint64_t>(0x736441726162504b), /* sd-Arab-PK */
-    static_cast<uint64_t>(0x736444657661494e), /* sd-Deva-IN */
-    static_cast<uint64_t>(0x73644b686f6a494e), /* sd-Khoj-IN */
-    static_cast<uint64_t>(0x736453696e64494e), /* sd-Sind-IN */
     static_cast<uint64_t>(0xc8624c61746e4954), /* sdc-Latn-IT */
     static_cast<uint64_t>(0xc867417261624952), /* sdh-Arab-IR */
-    static_cast<uint64_t>(0x73654c61746e4e4f), /* se-Latn-NO */
     static_cast<uint64_t>(0xc8854c61746e4349), /* sef-Latn-CI */
     static_cast<uint64_t>(0xc8874c61746e4d5a), /* seh-Latn-MZ */
     static_cast<uint64_t>(0xc8884c61746e4d58), /* sei-Latn-MX */
     static_cast<uint64_t>(0xc8924c61746e4d4c), /* ses-Latn-ML */
-    static_cast<uint64_t>(0x73674c61746e4346), /* sg-Latn-CF */
     static_cast<uint64_t>(0xc8c04f67616d4945), /* sga-Ogam-IE */
     static_cast<uint64_t>(0xc8d24c61746e4c54), /* sgs-Latn-LT */
     static_cast<uint64_t>(0xc8d6457468695a5a), /* sgw-Ethi-ZZ */
@@ -1101,35 +1172,29 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xc8ea4c61746e5a5a), /* shk-Latn-ZZ */
     static_cast<uint64_t>(0xc8ed4d796d724d4d), /* shn-Mymr-MM */
     static_cast<uint64_t>(0xc8f4417261625a5a), /* shu-Arab-ZZ */
-    static_cast<uint64_t>(0x736953696e684c4b), /* si-Sinh-LK */
     static_cast<uint64_t>(0xc9034c61746e4554), /* sid-Latn-ET */
     static_cast<uint64_t>(0xc9064c61746e5a5a), /* sig-Latn-ZZ */
     static_cast<uint64_t>(0xc90b4c61746e5a5a), /* sil-Latn-ZZ */
     static_cast<uint64_t>(0xc90c4c61746e5a5a), /* sim-Latn-ZZ */
     static_cast<uint64_t>(0xc9314c61746e5a5a), /* sjr-Latn-ZZ */
-    static_cast<uint64_t>(0x736b4c61746e534b), /* sk-Latn-SK */
     static_cast<uint64_t>(0xc9424c61746e5a5a), /* skc-Latn-ZZ */
     static_cast<uint64_t>(0xc95141726162504b), /* skr-Arab-PK */
     static_cast<uint64_t>(0xc9524c61746e5a5a), /* sks-Latn-ZZ */
-    static_cast<uint64_t>(0x736c4c61746e5349), /* sl-Latn-SI */
     static_cast<uint64_t>(0xc9634c61746e5a5a), /* sld-Latn-ZZ */
     static_cast<uint64_t>(0xc9684c61746e504c), /* sli-Latn-PL */
     static_cast<uint64_t>(0xc96b4c61746e5a5a), /* sll-Latn-ZZ */
     static_cast<uint64_t>(0xc9784c61746e4944), /* sly-Latn-ID */
-    static_cast<uint64_t>(0x736d4c61746e5753), /* sm-Latn-WS */
     static_cast<uint64_t>(0xc9804c61746e5345), /* sma-Latn-SE */
     static_cast<uint64_t>(0xc9894c61746e5345), /* smj-Latn-SE */
     static_cast<uint64_t>(0xc98d4c61746e4649), /* smn-Latn-FI */
     static_cast<uint64_t>(0xc98f53616d72494c), /* smp-Samr-IL */
     static_cast<uint64_t>(0xc9904c61746e5a5a), /* smq-Latn-ZZ */
     static_cast<uint64_t>(0xc9924c61746e4649), /* sms-Latn-FI */
-    static_cast<uint64_t>(0x736e4c61746e5a57), /* sn-Latn-ZW */
     static_cast<uint64_t>(0xc9a24c61746e5a5a), /* snc-Latn-ZZ */
     static_cast<uint64_t>(0xc9aa4c61746e4d4c), /* snk-Latn-ML */
     static_cast<uint64_t>(0xc9af4c61746e5a5a), /* snp-Latn-ZZ */
     static_cast<uint64_t>(0xc9b74c61746e5a5a), /* snx-Latn-ZZ */
     static_cast<uint64_t>(0xc9b84c61746e5a5a), /* sny-Latn-ZZ */
-    static_cast<uint64_t>(0x736f4c61746e534f), /* so-Latn-SO */
     static_cast<uint64_t>(0xc9c6536f6764555a), /* sog-Sogd-UZ */
     static_cast<uint64_t>(0xc9ca4c61746e5a5a), /* sok-Latn-ZZ */
     static_cast<uint64_t>(0xc9d04c61746e5a5a), /* soq-Latn-ZZ */
@@ -1138,31 +1203,20 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xc9e34c61746e5a5a), /* spd-Latn-ZZ */
     static_cast<uint64_t>(0xc9eb4c61746e5a5a), /* spl-Latn-ZZ */
     static_cast<uint64_t>(0xc9f24c61746e5a5a), /* sps-Latn-ZZ */
-    static_cast<uint64_t>(0x73714c61746e414c), /* sq-Latn-AL */
-    static_cast<uint64_t>(0x73724379726c5253), /* sr-Cyrl-RS */
-    static_cast<uint64_t>(0x73724c61746e4d45), /* sr-Latn-ME */
-    static_cast<uint64_t>(0x73724c61746e524f), /* sr-Latn-RO */
-    static_cast<uint64_t>(0x73724c61746e5255), /* sr-Latn-RU */
-    static_cast<uint64_t>(0x73724c61746e5452), /* sr-Latn-TR */
     static_cast<uint64_t>(0xca21536f7261494e), /* srb-Sora-IN */
     static_cast<uint64_t>(0xca2d4c61746e5352), /* srn-Latn-SR */
     static_cast<uint64_t>(0xca314c61746e534e), /* srr-Latn-SN */
     static_cast<uint64_t>(0xca3744657661494e), /* srx-Deva-IN */
-    static_cast<uint64_t>(0x73734c61746e5a41), /* ss-Latn-ZA */
     static_cast<uint64_t>(0xca434c61746e5a5a), /* ssd-Latn-ZZ */
     static_cast<uint64_t>(0xca464c61746e5a5a), /* ssg-Latn-ZZ */
     static_cast<uint64_t>(0xca584c61746e4552), /* ssy-Latn-ER */
-    static_cast<uint64_t>(0x73744c61746e5a41), /* st-Latn-ZA */
     static_cast<uint64_t>(0xca6a4c61746e5a5a), /* stk-Latn-ZZ */
     static_cast<uint64_t>(0xca704c61746e4445), /* stq-Latn-DE */
-    static_cast<uint64_t>(0x73754c61746e4944), /* su-Latn-ID */
     static_cast<uint64_t>(0xca804c61746e5a5a), /* sua-Latn-ZZ */
     static_cast<uint64_t>(0xca844c61746e5a5a), /* sue-Latn-ZZ */
     static_cast<uint64_t>(0xca8a4c61746e545a), /* suk-Latn-TZ */
     static_cast<uint64_t>(0xca914c61746e5a5a), /* sur-Latn-ZZ */
     static_cast<uint64_t>(0xca924c61746e474e), /* sus-Latn-GN */
-    static_cast<uint64_t>(0x73764c61746e5345), /* sv-Latn-SE */
-    static_cast<uint64_t>(0x73774c61746e545a), /* sw-Latn-TZ */
     static_cast<uint64_t>(0xcac1417261625954), /* swb-Arab-YT */
     static_cast<uint64_t>(0xcac24c61746e4344), /* swc-Latn-CD */
     static_cast<uint64_t>(0xcac64c61746e4445), /* swg-Latn-DE */
@@ -1173,7 +1227,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xcb0b42656e674244), /* syl-Beng-BD */
     static_cast<uint64_t>(0xcb11537972634951), /* syr-Syrc-IQ */
     static_cast<uint64_t>(0xcb2b4c61746e504c), /* szl-Latn-PL */
-    static_cast<uint64_t>(0x746154616d6c494e), /* ta-Taml-IN */
     static_cast<uint64_t>(0xcc09446576614e50), /* taj-Deva-NP */
     static_cast<uint64_t>(0xcc0b4c61746e5a5a), /* tal-Latn-ZZ */
     static_cast<uint64_t>(0xcc0d4c61746e5a5a), /* tan-Latn-ZZ */
@@ -1191,42 +1244,32 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xcc66446576614e50), /* tdg-Deva-NP */
     static_cast<uint64_t>(0xcc67446576614e50), /* tdh-Deva-NP */
     static_cast<uint64_t>(0xcc744c61746e4d59), /* tdu-Latn-MY */
-    static_cast<uint64_t>(0x746554656c75494e), /* te-Telu-IN */
     static_cast<uint64_t>(0xcc834c61746e5a5a), /* ted-Latn-ZZ */
     static_cast<uint64_t>(0xcc8c4c61746e534c), /* tem-Latn-SL */
     static_cast<uint64_t>(0xcc8e4c61746e5547), /* teo-Latn-UG */
     static_cast<uint64_t>(0xcc934c61746e544c), /* tet-Latn-TL */
     static_cast<uint64_t>(0xcca84c61746e5a5a), /* tfi-Latn-ZZ */
-    static_cast<uint64_t>(0x74674379726c544a), /* tg-Cyrl-TJ */
-    static_cast<uint64_t>(0x746741726162504b), /* tg-Arab-PK */
-    static_cast<uint64_t>(0x746741726162504b), /* tg-Arab-PK */
     static_cast<uint64_t>(0xccc24c61746e5a5a), /* tgc-Latn-ZZ */
     static_cast<uint64_t>(0xccce4c61746e5a5a), /* tgo-Latn-ZZ */
     static_cast<uint64_t>(0xccd44c61746e5a5a), /* tgu-Latn-ZZ */
-    static_cast<uint64_t>(0x7468546861695448), /* th-Thai-TH */
     static_cast<uint64_t>(0xcceb446576614e50), /* thl-Deva-NP */
     static_cast<uint64_t>(0xccf0446576614e50), /* thq-Deva-NP */
     static_cast<uint64_t>(0xccf1446576614e50), /* thr-Deva-NP */
-    static_cast<uint64_t>(0x7469457468694554), /* ti-Ethi-ET */
     static_cast<uint64_t>(0xcd054c61746e5a5a), /* tif-Latn-ZZ */
     static_cast<uint64_t>(0xcd06457468694552), /* tig-Ethi-ER */
     static_cast<uint64_t>(0xcd0a4c61746e5a5a), /* tik-Latn-ZZ */
     static_cast<uint64_t>(0xcd0c4c61746e5a5a), /* tim-Latn-ZZ */
     static_cast<uint64_t>(0xcd0e4c61746e5a5a), /* tio-Latn-ZZ */
     static_cast<uint64_t>(0xcd154c61746e4e47), /* tiv-Latn-NG */
-    static_cast<uint64_t>(0x746b4c61746e544d), /* tk-Latn-TM */
     static_cast<uint64_t>(0xcd4b4c61746e544b), /* tkl-Latn-TK */
     static_cast<uint64_t>(0xcd514c61746e415a), /* tkr-Latn-AZ */
     static_cast<uint64_t>(0xcd53446576614e50), /* tkt-Deva-NP */
-    static_cast<uint64_t>(0x746c4c61746e5048), /* tl-Latn-PH */
     static_cast<uint64_t>(0xcd654c61746e5a5a), /* tlf-Latn-ZZ */
     static_cast<uint64_t>(0xcd774c61746e5a5a), /* tlx-Latn-ZZ */
     static_cast<uint64_t>(0xcd784c61746e415a), /* tly-Latn-AZ */
     static_cast<uint64_t>(0xcd874c61746e4e45), /* tmh-Latn-NE */
     static_cast<uint64_t>(0xcd984c61746e5a5a), /* tmy-Latn-ZZ */
-    static_cast<uint64_t>(0x746e4c61746e5a41), /* tn-Latn-ZA */
     static_cast<uint64_t>(0xcda74c61746e5a5a), /* tnh-Latn-ZZ */
-    static_cast<uint64_t>(0x746f4c61746e544f), /* to-Latn-TO */
     static_cast<uint64_t>(0xcdc54c61746e5a5a), /* tof-Latn-ZZ */
     static_cast<uint64_t>(0xcdc64c61746e4d57), /* tog-Latn-MW */
     static_cast<uint64_t>(0xcdd04c61746e5a5a), /* toq-Latn-ZZ */
@@ -1234,17 +1277,14 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xcdec4c61746e5a5a), /* tpm-Latn-ZZ */
     static_cast<uint64_t>(0xcdf94c61746e5a5a), /* tpz-Latn-ZZ */
     static_cast<uint64_t>(0xce0e4c61746e5a5a), /* tqo-Latn-ZZ */
-    static_cast<uint64_t>(0x74724c61746e5452), /* tr-Latn-TR */
     static_cast<uint64_t>(0xce344c61746e5452), /* tru-Latn-TR */
     static_cast<uint64_t>(0xce354c61746e5457), /* trv-Latn-TW */
     static_cast<uint64_t>(0xce3641726162504b), /* trw-Arab-PK */
-    static_cast<uint64_t>(0x74734c61746e5a41), /* ts-Latn-ZA */
     static_cast<uint64_t>(0xce434772656b4752), /* tsd-Grek-GR */
     static_cast<uint64_t>(0xce45446576614e50), /* tsf-Deva-NP */
     static_cast<uint64_t>(0xce464c61746e5048), /* tsg-Latn-PH */
     static_cast<uint64_t>(0xce49546962744254), /* tsj-Tibt-BT */
     static_cast<uint64_t>(0xce564c61746e5a5a), /* tsw-Latn-ZZ */
-    static_cast<uint64_t>(0x74744379726c5255), /* tt-Cyrl-RU */
     static_cast<uint64_t>(0xce634c61746e5a5a), /* ttd-Latn-ZZ */
     static_cast<uint64_t>(0xce644c61746e5a5a), /* tte-Latn-ZZ */
     static_cast<uint64_t>(0xce694c61746e5547), /* ttj-Latn-UG */
@@ -1261,18 +1301,12 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xcec74c61746e5a5a), /* twh-Latn-ZZ */
     static_cast<uint64_t>(0xced04c61746e4e45), /* twq-Latn-NE */
     static_cast<uint64_t>(0xcee654616e67434e), /* txg-Tang-CN */
-    static_cast<uint64_t>(0x74794c61746e5046), /* ty-Latn-PF */
     static_cast<uint64_t>(0xcf004c61746e5a5a), /* tya-Latn-ZZ */
     static_cast<uint64_t>(0xcf154379726c5255), /* tyv-Cyrl-RU */
     static_cast<uint64_t>(0xcf2c4c61746e4d41), /* tzm-Latn-MA */
     static_cast<uint64_t>(0xd0344c61746e5a5a), /* ubu-Latn-ZZ */
     static_cast<uint64_t>(0xd06c4379726c5255), /* udm-Cyrl-RU */
-    static_cast<uint64_t>(0x756741726162434e), /* ug-Arab-CN */
-    static_cast<uint64_t>(0x75674379726c4b5a), /* ug-Cyrl-KZ */
-    static_cast<uint64_t>(0x75674379726c4b5a), /* ug-Cyrl-KZ */
-    static_cast<uint64_t>(0x75674379726c4d4e), /* ug-Cyrl-MN */
     static_cast<uint64_t>(0xd0c0556761725359), /* uga-Ugar-SY */
-    static_cast<uint64_t>(0x756b4379726c5541), /* uk-Cyrl-UA */
     static_cast<uint64_t>(0xd1684c61746e464d), /* uli-Latn-FM */
     static_cast<uint64_t>(0xd1814c61746e414f), /* umb-Latn-AO */
     static_cast<uint64_t>(0xd1b142656e67494e), /* unr-Beng-IN */
@@ -1280,7 +1314,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xd1b1446576614e50), /* unr-Deva-NP */
     static_cast<uint64_t>(0xd1b742656e67494e), /* unx-Beng-IN */
     static_cast<uint64_t>(0xd1ca4c61746e5a5a), /* uok-Latn-ZZ */
-    static_cast<uint64_t>(0x757241726162504b), /* ur-Arab-PK */
     static_cast<uint64_t>(0xd2284c61746e5a5a), /* uri-Latn-ZZ */
     static_cast<uint64_t>(0xd2334c61746e5a5a), /* urt-Latn-ZZ */
     static_cast<uint64_t>(0xd2364c61746e5a5a), /* urw-Latn-ZZ */
@@ -1289,28 +1322,20 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xd2714c61746e5a5a), /* utr-Latn-ZZ */
     static_cast<uint64_t>(0xd2a74c61746e5a5a), /* uvh-Latn-ZZ */
     static_cast<uint64_t>(0xd2ab4c61746e5a5a), /* uvl-Latn-ZZ */
-    static_cast<uint64_t>(0x757a4c61746e555a), /* uz-Latn-UZ */
-    static_cast<uint64_t>(0x757a417261624146), /* uz-Arab-AF */
-    static_cast<uint64_t>(0x757a417261624146), /* uz-Arab-AF */
-    static_cast<uint64_t>(0x757a4379726c434e), /* uz-Cyrl-CN */
     static_cast<uint64_t>(0xd4064c61746e5a5a), /* vag-Latn-ZZ */
     static_cast<uint64_t>(0xd408566169694c52), /* vai-Vaii-LR */
     static_cast<uint64_t>(0xd40d4c61746e5a5a), /* van-Latn-ZZ */
-    static_cast<uint64_t>(0x76654c61746e5a41), /* ve-Latn-ZA */
     static_cast<uint64_t>(0xd4824c61746e4954), /* vec-Latn-IT */
     static_cast<uint64_t>(0xd48f4c61746e5255), /* vep-Latn-RU */
-    static_cast<uint64_t>(0x76694c61746e564e), /* vi-Latn-VN */
     static_cast<uint64_t>(0xd5024c61746e5358), /* vic-Latn-SX */
     static_cast<uint64_t>(0xd5154c61746e5a5a), /* viv-Latn-ZZ */
     static_cast<uint64_t>(0xd5724c61746e4245), /* vls-Latn-BE */
     static_cast<uint64_t>(0xd5854c61746e4445), /* vmf-Latn-DE */
     static_cast<uint64_t>(0xd5964c61746e4d5a), /* vmw-Latn-MZ */
-    static_cast<uint64_t>(0x766f4c61746e8001), /* vo-Latn-001 */
     static_cast<uint64_t>(0xd5d34c61746e5255), /* vot-Latn-RU */
     static_cast<uint64_t>(0xd62e4c61746e4545), /* vro-Latn-EE */
     static_cast<uint64_t>(0xd68d4c61746e545a), /* vun-Latn-TZ */
     static_cast<uint64_t>(0xd6934c61746e5a5a), /* vut-Latn-ZZ */
-    static_cast<uint64_t>(0x77614c61746e4245), /* wa-Latn-BE */
     static_cast<uint64_t>(0xd8044c61746e4348), /* wae-Latn-CH */
     static_cast<uint64_t>(0xd8094c61746e5a5a), /* waj-Latn-ZZ */
     static_cast<uint64_t>(0xd80b457468694554), /* wal-Ethi-ET */
@@ -1333,7 +1358,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xd9a24c61746e5a5a), /* wnc-Latn-ZZ */
     static_cast<uint64_t>(0xd9a8417261624b4d), /* wni-Arab-KM */
     static_cast<uint64_t>(0xd9b44c61746e5a5a), /* wnu-Latn-ZZ */
-    static_cast<uint64_t>(0x776f4c61746e534e), /* wo-Latn-SN */
     static_cast<uint64_t>(0xd9c14c61746e5a5a), /* wob-Latn-ZZ */
     static_cast<uint64_t>(0xd9d24c61746e5a5a), /* wos-Latn-ZZ */
     static_cast<uint64_t>(0xda324c61746e5a5a), /* wrs-Latn-ZZ */
@@ -1348,7 +1372,6 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xdc4e43687273555a), /* xco-Chrs-UZ */
     static_cast<uint64_t>(0xdc51436172695452), /* xcr-Cari-TR */
     static_cast<uint64_t>(0xdc924c61746e5a5a), /* xes-Latn-ZZ */
-    static_cast<uint64_t>(0x78684c61746e5a41), /* xh-Latn-ZA */
     static_cast<uint64_t>(0xdd604c61746e5a5a), /* xla-Latn-ZZ */
     static_cast<uint64_t>(0xdd624c7963695452), /* xlc-Lyci-TR */
     static_cast<uint64_t>(0xdd634c7964695452), /* xld-Lydi-TR */
@@ -1380,13 +1403,11 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xe0914c61746e5a5a), /* yer-Latn-ZZ */
     static_cast<uint64_t>(0xe0d14c61746e5a5a), /* ygr-Latn-ZZ */
     static_cast<uint64_t>(0xe0d64c61746e5a5a), /* ygw-Latn-ZZ */
-    static_cast<uint64_t>(0x7969486562728001), /* yi-Hebr-001 */
     static_cast<uint64_t>(0xe14e4c61746e5a5a), /* yko-Latn-ZZ */
     static_cast<uint64_t>(0xe1644c61746e5a5a), /* yle-Latn-ZZ */
     static_cast<uint64_t>(0xe1664c61746e5a5a), /* ylg-Latn-ZZ */
     static_cast<uint64_t>(0xe16b4c61746e5a5a), /* yll-Latn-ZZ */
     static_cast<uint64_t>(0xe18b4c61746e5a5a), /* yml-Latn-ZZ */
-    static_cast<uint64_t>(0x796f4c61746e4e47), /* yo-Latn-NG */
     static_cast<uint64_t>(0xe1cd4c61746e5a5a), /* yon-Latn-ZZ */
     static_cast<uint64_t>(0xe2214c61746e5a5a), /* yrb-Latn-ZZ */
     static_cast<uint64_t>(0xe2244c61746e5a5a), /* yre-Latn-ZZ */
@@ -1399,37 +1420,16 @@ const uint64_t LIKELY_TAGS_CODES_VALUE[] = {
     static_cast<uint64_t>(0xe2894c61746e5a5a), /* yuj-Latn-ZZ */
     static_cast<uint64_t>(0xe2934c61746e5a5a), /* yut-Latn-ZZ */
     static_cast<uint64_t>(0xe2964c61746e5a5a), /* yuw-Latn-ZZ */
-    static_cast<uint64_t>(0x7a614c61746e434e), /* za-Latn-CN */
     static_cast<uint64_t>(0xe4064c61746e5344), /* zag-Latn-SD */
     static_cast<uint64_t>(0xe469417261624b4d), /* zdj-Arab-KM */
     static_cast<uint64_t>(0xe4804c61746e4e4c), /* zea-Latn-NL */
     static_cast<uint64_t>(0xe4c754666e674d41), /* zgh-Tfng-MA */
-    static_cast<uint64_t>(0x7a6848616e73434e), /* zh-Hans-CN */
-    static_cast<uint64_t>(0x7a6848616e744155), /* zh-Hant-AU */
-    static_cast<uint64_t>(0x7a6848616e74424e), /* zh-Hant-BN */
-    static_cast<uint64_t>(0x7a68426f706f5457), /* zh-Bopo-TW */
-    static_cast<uint64_t>(0x7a6848616e744742), /* zh-Hant-GB */
-    static_cast<uint64_t>(0x7a6848616e744746), /* zh-Hant-GF */
-    static_cast<uint64_t>(0x7a6848616e74484b), /* zh-Hant-HK */
-    static_cast<uint64_t>(0x7a6848616e625457), /* zh-Hanb-TW */
-    static_cast<uint64_t>(0x7a6848616e745457), /* zh-Hant-TW */
-    static_cast<uint64_t>(0x7a6848616e744944), /* zh-Hant-ID */
-    static_cast<uint64_t>(0x7a6848616e744d4f), /* zh-Hant-MO */
-    static_cast<uint64_t>(0x7a6848616e745041), /* zh-Hant-PA */
-    static_cast<uint64_t>(0x7a6848616e745046), /* zh-Hant-PF */
-    static_cast<uint64_t>(0x7a6848616e745048), /* zh-Hant-PH */
-    static_cast<uint64_t>(0x7a6848616e745352), /* zh-Hant-SR */
-    static_cast<uint64_t>(0x7a6848616e745448), /* zh-Hant-TH */
-    static_cast<uint64_t>(0x7a6848616e745457), /* zh-Hant-TW */
-    static_cast<uint64_t>(0x7a6848616e745553), /* zh-Hant-US */
-    static_cast<uint64_t>(0x7a6848616e74564e), /* zh-Hant-VN */
     static_cast<uint64_t>(0xe4f74e736875434e), /* zhx-Nshu-CN */
     static_cast<uint64_t>(0xe5004c61746e5a5a), /* zia-Latn-ZZ */
     static_cast<uint64_t>(0xe5534b697473434e), /* zkt-Kits-CN */
     static_cast<uint64_t>(0xe56c4c61746e5447), /* zlm-Latn-TG */
     static_cast<uint64_t>(0xe5884c61746e4d59), /* zmi-Latn-MY */
     static_cast<uint64_t>(0xe5a44c61746e5a5a), /* zne-Latn-ZZ */
-    static_cast<uint64_t>(0x7a754c61746e5a41), /* zu-Latn-ZA */
     static_cast<uint64_t>(0xe7204c61746e5452), /* zza-Latn-TR */
 };
 } // namespace Resource
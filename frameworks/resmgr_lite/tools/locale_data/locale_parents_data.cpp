@@ -0,0 +1,378 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+// sorted by encoded locale, input of tools/locale_data_gen.cpp
+constexpr uint64_t LOCALE_PARENTS_KEY[] = {
+    static_cast<uint64_t>(0x617200000000445a), /* ar-DZ */
+    static_cast<uint64_t>(0x6172000000004548), /* ar-EH */
+    static_cast<uint64_t>(0x6172000000004c59), /* ar-LY */
+    static_cast<uint64_t>(0x6172000000004d41), /* ar-MA */
+    static_cast<uint64_t>(0x617200000000544e), /* ar-TN */
+    static_cast<uint64_t>(0x617a417261620000), /* az-Arab */
+    static_cast<uint64_t>(0x617a4379726c0000), /* az-Cyrl */
+    static_cast<uint64_t>(0x626d4e6b6f6f0000), /* bm-Nkoo */
+    static_cast<uint64_t>(0x62734379726c0000), /* bs-Cyrl */
+    static_cast<uint64_t>(0x6375476c61670000), /* cu-Glag */
+    static_cast<uint64_t>(0x656e000000004147), /* en-AG */
+    static_cast<uint64_t>(0x656e000000004149), /* en-AI */
+    static_cast<uint64_t>(0x656e000000004154), /* en-AT */
+    static_cast<uint64_t>(0x656e000000004155), /* en-AU */
+    static_cast<uint64_t>(0x656e000000004242), /* en-BB */
+    static_cast<uint64_t>(0x656e000000004245), /* en-BE */
+    static_cast<uint64_t>(0x656e00000000424d), /* en-BM */
+    static_cast<uint64_t>(0x656e000000004253), /* en-BS */
+    static_cast<uint64_t>(0x656e000000004257), /* en-BW */
+    static_cast<uint64_t>(0x656e00000000425a), /* en-BZ */
+    static_cast<uint64_t>(0x656e000000004343), /* en-CC */
+    static_cast<uint64_t>(0x656e000000004348), /* en-CH */
+    static_cast<uint64_t>(0x656e00000000434b), /* en-CK */
+    static_cast<uint64_t>(0x656e00000000434d), /* en-CM */
+    static_cast<uint64_t>(0x656e000000004358), /* en-CX */
+    static_cast<uint64_t>(0x656e000000004359), /* en-CY */
+    static_cast<uint64_t>(0x656e000000004445), /* en-DE */
+    static_cast<uint64_t>(0x656e000000004447), /* en-DG */
+    static_cast<uint64_t>(0x656e00000000444b), /* en-DK */
+    static_cast<uint64_t>(0x656e00000000444d), /* en-DM */
+    static_cast<uint64_t>(0x656e000000004552), /* en-ER */
+    static_cast<uint64_t>(0x656e000000004649), /* en-FI */
+    static_cast<uint64_t>(0x656e00000000464a), /* en-FJ */
+    static_cast<uint64_t>(0x656e00000000464b), /* en-FK */
+    static_cast<uint64_t>(0x656e00000000464d), /* en-FM */
+    static_cast<uint64_t>(0x656e000000004742), /* en-GB */
+    static_cast<uint64_t>(0x656e000000004744), /* en-GD */
+    static_cast<uint64_t>(0x656e000000004747), /* en-GG */
+    static_cast<uint64_t>(0x656e000000004748), /* en-GH */
+    static_cast<uint64_t>(0x656e000000004749), /* en-GI */
+    static_cast<uint64_t>(0x656e00000000474d), /* en-GM */
+    static_cast<uint64_t>(0x656e000000004759), /* en-GY */
+    static_cast<uint64_t>(0x656e00000000484b), /* en-HK */
+    static_cast<uint64_t>(0x656e000000004945), /* en-IE */
+    static_cast<uint64_t>(0x656e00000000494c), /* en-IL */
+    static_cast<uint64_t>(0x656e00000000494d), /* en-IM */
+    static_cast<uint64_t>(0x656e00000000494e), /* en-IN */
+    static_cast<uint64_t>(0x656e00000000494f), /* en-IO */
+    static_cast<uint64_t>(0x656e000000004a45), /* en-JE */
+    static_cast<uint64_t>(0x656e000000004a4d), /* en-JM */
+    static_cast<uint64_t>(0x656e000000004b45), /* en-KE */
+    static_cast<uint64_t>(0x656e000000004b49), /* en-KI */
+    static_cast<uint64_t>(0x656e000000004b4e), /* en-KN */
+    static_cast<uint64_t>(0x656e000000004b59), /* en-KY */
+    static_cast<uint64_t>(0x656e000000004c43), /* en-LC */
+    static_cast<uint64_t>(0x656e000000004c52), /* en-LR */
+    static_cast<uint64_t>(0x656e000000004c53), /* en-LS */
+    static_cast<uint64_t>(0x656e000000004d47), /* en-MG */
+    static_cast<uint64_t>(0x656e000000004d4f), /* en-MO */
+    static_cast<uint64_t>(0x656e000000004d53), /* en-MS */
+    static_cast<uint64_t>(0x656e000000004d54), /* en-MT */
+    static_cast<uint64_t>(0x656e000000004d55), /* en-MU */
+    static_cast<uint64_t>(0x656e000000004d57), /* en-MW */
+    static_cast<uint64_t>(0x656e000000004d59), /* en-MY */
+    static_cast<uint64_t>(0x656e000000004e41), /* en-NA */
+    static_cast<uint64_t>(0x656e000000004e46), /* en-NF */
+    static_cast<uint64_t>(0x656e000000004e47), /* en-NG */
+    static_cast<uint64_t>(0x656e000000004e4c), /* en-NL */
+    static_cast<uint64_t>(0x656e000000004e52), /* en-NR */
+    static_cast<uint64_t>(0x656e000000004e55), /* en-NU */
+    static_cast<uint64_t>(0x656e000000004e5a), /* en-NZ */
+    static_cast<uint64_t>(0x656e000000005047), /* en-PG */
+    static_cast<uint64_t>(0x656e000000005048), /* en-PH */
+    static_cast<uint64_t>(0x656e00000000504b), /* en-PK */
+    static_cast<uint64_t>(0x656e00000000504e), /* en-PN */
+    static_cast<uint64_t>(0x656e000000005057), /* en-PW */
+    static_cast<uint64_t>(0x656e000000005257), /* en-RW */
+    static_cast<uint64_t>(0x656e000000005342), /* en-SB */
+    static_cast<uint64_t>(0x656e000000005343), /* en-SC */
+    static_cast<uint64_t>(0x656e000000005344), /* en-SD */
+    static_cast<uint64_t>(0x656e000000005345), /* en-SE */
+    static_cast<uint64_t>(0x656e000000005347), /* en-SG */
+    static_cast<uint64_t>(0x656e000000005348), /* en-SH */
+    static_cast<uint64_t>(0x656e000000005349), /* en-SI */
+    static_cast<uint64_t>(0x656e00000000534c), /* en-SL */
+    static_cast<uint64_t>(0x656e000000005353), /* en-SS */
+    static_cast<uint64_t>(0x656e000000005358), /* en-SX */
+    static_cast<uint64_t>(0x656e00000000535a), /* en-SZ */
+    static_cast<uint64_t>(0x656e000000005443), /* en-TC */
+    static_cast<uint64_t>(0x656e00000000544b), /* en-TK */
+    static_cast<uint64_t>(0x656e00000000544f), /* en-TO */
+    static_cast<uint64_t>(0x656e000000005454), /* en-TT */
+    static_cast<uint64_t>(0x656e000000005456), /* en-TV */
+    static_cast<uint64_t>(0x656e00000000545a), /* en-TZ */
+    static_cast<uint64_t>(0x656e000000005547), /* en-UG */
+    static_cast<uint64_t>(0x656e000000005643), /* en-VC */
+    static_cast<uint64_t>(0x656e000000005647), /* en-VG */
+    static_cast<uint64_t>(0x656e000000005655), /* en-VU */
+    static_cast<uint64_t>(0x656e000000005753), /* en-WS */
+    static_cast<uint64_t>(0x656e000000005a41), /* en-ZA */
+    static_cast<uint64_t>(0x656e000000005a4d), /* en-ZM */
+    static_cast<uint64_t>(0x656e000000005a57), /* en-ZW */
+    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
+    static_cast<uint64_t>(0x656e447372740000), /* en-Dsrt */
+    static_cast<uint64_t>(0x656e536861770000), /* en-Shaw */
+    static_cast<uint64_t>(0x6573000000004152), /* es-AR */
+    static_cast<uint64_t>(0x657300000000424f), /* es-BO */
+    static_cast<uint64_t>(0x6573000000004252), /* es-BR */
+    static_cast<uint64_t>(0x657300000000425a), /* es-BZ */
+    static_cast<uint64_t>(0x657300000000434c), /* es-CL */
+    static_cast<uint64_t>(0x657300000000434f), /* es-CO */
+    static_cast<uint64_t>(0x6573000000004352), /* es-CR */
+    static_cast<uint64_t>(0x6573000000004355), /* es-CU */
+    static_cast<uint64_t>(0x657300000000444f), /* es-DO */
+    static_cast<uint64_t>(0x6573000000004543), /* es-EC */
+    static_cast<uint64_t>(0x6573000000004754), /* es-GT */
+    static_cast<uint64_t>(0x657300000000484e), /* es-HN */
+    static_cast<uint64_t>(0x6573000000004d58), /* es-MX */
+    static_cast<uint64_t>(0x6573000000004e49), /* es-NI */
+    static_cast<uint64_t>(0x6573000000005041), /* es-PA */
+    static_cast<uint64_t>(0x6573000000005045), /* es-PE */
+    static_cast<uint64_t>(0x6573000000005052), /* es-PR */
+    static_cast<uint64_t>(0x6573000000005059), /* es-PY */
+    static_cast<uint64_t>(0x6573000000005356), /* es-SV */
+    static_cast<uint64_t>(0x6573000000005553), /* es-US */
+    static_cast<uint64_t>(0x6573000000005559), /* es-UY */
+    static_cast<uint64_t>(0x6573000000005645), /* es-VE */
+    static_cast<uint64_t>(0x666641646c6d0000), /* ff-Adlm */
+    static_cast<uint64_t>(0x6666417261620000), /* ff-Arab */
+    static_cast<uint64_t>(0x6861417261620000), /* ha-Arab */
+    static_cast<uint64_t>(0x68694c61746e0000), /* hi-Latn */
+    static_cast<uint64_t>(0x69754c61746e0000), /* iu-Latn */
+    static_cast<uint64_t>(0x6b6b417261620000), /* kk-Arab */
+    static_cast<uint64_t>(0x6b73446576610000), /* ks-Deva */
+    static_cast<uint64_t>(0x6b75417261620000), /* ku-Arab */
+    static_cast<uint64_t>(0x6b79417261620000), /* ky-Arab */
+    static_cast<uint64_t>(0x6b794c61746e0000), /* ky-Latn */
+    static_cast<uint64_t>(0x6d6c417261620000), /* ml-Arab */
+    static_cast<uint64_t>(0x6d6e4d6f6e670000), /* mn-Mong */
+    static_cast<uint64_t>(0x6d73417261620000), /* ms-Arab */
+    static_cast<uint64_t>(0x7061417261620000), /* pa-Arab */
+    static_cast<uint64_t>(0x707400000000414f), /* pt-AO */
+    static_cast<uint64_t>(0x7074000000004348), /* pt-CH */
+    static_cast<uint64_t>(0x7074000000004356), /* pt-CV */
+    static_cast<uint64_t>(0x7074000000004652), /* pt-FR */
+    static_cast<uint64_t>(0x7074000000004751), /* pt-GQ */
+    static_cast<uint64_t>(0x7074000000004757), /* pt-GW */
+    static_cast<uint64_t>(0x7074000000004c55), /* pt-LU */
+    static_cast<uint64_t>(0x7074000000004d4f), /* pt-MO */
+    static_cast<uint64_t>(0x7074000000004d5a), /* pt-MZ */
+    static_cast<uint64_t>(0x7074000000005354), /* pt-ST */
+    static_cast<uint64_t>(0x707400000000544c), /* pt-TL */
+    static_cast<uint64_t>(0x7364446576610000), /* sd-Deva */
+    static_cast<uint64_t>(0x73644b686f6a0000), /* sd-Khoj */
+    static_cast<uint64_t>(0x736453696e640000), /* sd-Sind */
+    static_cast<uint64_t>(0x736f417261620000), /* so-Arab */
+    static_cast<uint64_t>(0x73724c61746e0000), /* sr-Latn */
+    static_cast<uint64_t>(0x7377417261620000), /* sw-Arab */
+    static_cast<uint64_t>(0x7467417261620000), /* tg-Arab */
+    static_cast<uint64_t>(0x75674379726c0000), /* ug-Cyrl */
+    static_cast<uint64_t>(0x757a417261620000), /* uz-Arab */
+    static_cast<uint64_t>(0x757a4379726c0000), /* uz-Cyrl */
+    static_cast<uint64_t>(0x776f417261620000), /* wo-Arab */
+    static_cast<uint64_t>(0x796f417261620000), /* yo-Arab */
+    static_cast<uint64_t>(0x7a6848616e740000), /* zh-Hant */
+    static_cast<uint64_t>(0x7a6848616e744d4f), /* zh-Hant-MO */
+    static_cast<uint64_t>(0x85734c61746e0000), /* blt-Latn */
+    static_cast<uint64_t>(0x870d4c61746e0000), /* byn-Latn */
+    static_cast<uint64_t>(0x8d24417261620000), /* dje-Arab */
+    static_cast<uint64_t>(0x8f0e417261620000), /* dyo-Arab */
+    static_cast<uint64_t>(0xb1a84d7465690000), /* mni-Mtei */
+    static_cast<uint64_t>(0xc813446576610000), /* sat-Deva */
+    static_cast<uint64_t>(0xc8e84c61746e0000), /* shi-Latn */
+    static_cast<uint64_t>(0xd4084c61746e0000), /* vai-Latn */
+    static_cast<uint64_t>(0xe28448616e730000), /* yue-Hans */
+};
+constexpr uint64_t LOCALE_PARENTS_VALUE[] = {
+    static_cast<uint64_t>(0x6172000000008025), /* ar-015 */
+    static_cast<uint64_t>(0x6172000000008025), /* ar-015 */
+    static_cast<uint64_t>(0x6172000000008025), /* ar-015 */
+    static_cast<uint64_t>(0x6172000000008025), /* ar-015 */
+    static_cast<uint64_t>(0x6172000000008025), /* ar-015 */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e0000000084a0), /* en-150 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x656e000000008001), /* en-001 */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x6573000000009029), /* es-419 */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
+    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
+    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
+    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
+    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
+    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
+    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
+    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
+    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
+    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
+    static_cast<uint64_t>(0x7074000000005054), /* pt-PT */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x7a6848616e74484b), /* zh-Hant-HK */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+    static_cast<uint64_t>(0x0), /* ROOT Locale */
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
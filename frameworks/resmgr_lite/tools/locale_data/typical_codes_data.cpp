@@ -0,0 +1,782 @@
+/*
+ * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+
+namespace OHOS {
+namespace Global {
+namespace Resource {
+// sorted by encoded locale, input of tools/locale_data_gen.cpp
+constexpr uint64_t TYPICAL_CODES_VALUE[] = {
+    static_cast<uint64_t>(0x61614c61746e4554), /* aa-Latn-ET */
+    static_cast<uint64_t>(0x61624379726c4745), /* ab-Cyrl-GE */
+    static_cast<uint64_t>(0x6165417673744952), /* ae-Avst-IR */
+    static_cast<uint64_t>(0x61664c61746e5a41), /* af-Latn-ZA */
+    static_cast<uint64_t>(0x616b4c61746e4748), /* ak-Latn-GH */
+    static_cast<uint64_t>(0x616d457468694554), /* am-Ethi-ET */
+    static_cast<uint64_t>(0x616e4c61746e4553), /* an-Latn-ES */
+    static_cast<uint64_t>(0x6172417261624547), /* ar-Arab-EG */
+    static_cast<uint64_t>(0x617342656e67494e), /* as-Beng-IN */
+    static_cast<uint64_t>(0x61764379726c5255), /* av-Cyrl-RU */
+    static_cast<uint64_t>(0x61794c61746e424f), /* ay-Latn-BO */
+    static_cast<uint64_t>(0x617a417261624952), /* az-Arab-IR */
+    static_cast<uint64_t>(0x617a4c61746e415a), /* az-Latn-AZ */
+    static_cast<uint64_t>(0x62614379726c5255), /* ba-Cyrl-RU */
+    static_cast<uint64_t>(0x62654379726c4259), /* be-Cyrl-BY */
+    static_cast<uint64_t>(0x62674379726c4247), /* bg-Cyrl-BG */
+    static_cast<uint64_t>(0x62694c61746e5655), /* bi-Latn-VU */
+    static_cast<uint64_t>(0x626d4c61746e4d4c), /* bm-Latn-ML */
+    static_cast<uint64_t>(0x626e42656e674244), /* bn-Beng-BD */
+    static_cast<uint64_t>(0x626f54696274434e), /* bo-Tibt-CN */
+    static_cast<uint64_t>(0x62724c61746e4652), /* br-Latn-FR */
+    static_cast<uint64_t>(0x62734c61746e4241), /* bs-Latn-BA */
+    static_cast<uint64_t>(0x63614c61746e4553), /* ca-Latn-ES */
+    static_cast<uint64_t>(0x63654379726c5255), /* ce-Cyrl-RU */
+    static_cast<uint64_t>(0x63684c61746e4755), /* ch-Latn-GU */
+    static_cast<uint64_t>(0x636f4c61746e4652), /* co-Latn-FR */
+    static_cast<uint64_t>(0x637243616e734341), /* cr-Cans-CA */
+    static_cast<uint64_t>(0x63734c61746e435a), /* cs-Latn-CZ */
+    static_cast<uint64_t>(0x63754379726c5255), /* cu-Cyrl-RU */
+    static_cast<uint64_t>(0x6375476c61674247), /* cu-Glag-BG */
+    static_cast<uint64_t>(0x63764379726c5255), /* cv-Cyrl-RU */
+    static_cast<uint64_t>(0x63794c61746e4742), /* cy-Latn-GB */
+    static_cast<uint64_t>(0x64614c61746e444b), /* da-Latn-DK */
+    static_cast<uint64_t>(0x64654c61746e4445), /* de-Latn-DE */
+    static_cast<uint64_t>(0x6476546861614d56), /* dv-Thaa-MV */
+    static_cast<uint64_t>(0x647a546962744254), /* dz-Tibt-BT */
+    static_cast<uint64_t>(0x65654c61746e4748), /* ee-Latn-GH */
+    static_cast<uint64_t>(0x656c4772656b4752), /* el-Grek-GR */
+    static_cast<uint64_t>(0x656e4c61746e4742), /* en-Latn-GB */
+    static_cast<uint64_t>(0x656e4c61746e5553), /* en-Latn-US */
+    static_cast<uint64_t>(0x656e536861774742), /* en-Shaw-GB */
+    static_cast<uint64_t>(0x65734c61746e4553), /* es-Latn-ES */
+    static_cast<uint64_t>(0x65734c61746e4d58), /* es-Latn-MX */
+    static_cast<uint64_t>(0x65734c61746e5553), /* es-Latn-US */
+    static_cast<uint64_t>(0x65744c61746e4545), /* et-Latn-EE */
+    static_cast<uint64_t>(0x65754c61746e4553), /* eu-Latn-ES */
+    static_cast<uint64_t>(0x6661417261624952), /* fa-Arab-IR */
+    static_cast<uint64_t>(0x666641646c6d474e), /* ff-Adlm-GN */
+    static_cast<uint64_t>(0x66664c61746e534e), /* ff-Latn-SN */
+    static_cast<uint64_t>(0x66694c61746e4649), /* fi-Latn-FI */
+    static_cast<uint64_t>(0x666a4c61746e464a), /* fj-Latn-FJ */
+    static_cast<uint64_t>(0x666f4c61746e464f), /* fo-Latn-FO */
+    static_cast<uint64_t>(0x66724c61746e4652), /* fr-Latn-FR */
+    static_cast<uint64_t>(0x66794c61746e4e4c), /* fy-Latn-NL */
+    static_cast<uint64_t>(0x67614c61746e4945), /* ga-Latn-IE */
+    static_cast<uint64_t>(0x67644c61746e4742), /* gd-Latn-GB */
+    static_cast<uint64_t>(0x676c4c61746e4553), /* gl-Latn-ES */
+    static_cast<uint64_t>(0x676e4c61746e5059), /* gn-Latn-PY */
+    static_cast<uint64_t>(0x677547756a72494e), /* gu-Gujr-IN */
+    static_cast<uint64_t>(0x67764c61746e494d), /* gv-Latn-IM */
+    static_cast<uint64_t>(0x68614c61746e4e47), /* ha-Latn-NG */
+    static_cast<uint64_t>(0x686548656272494c), /* he-Hebr-IL */
+    static_cast<uint64_t>(0x686944657661494e), /* hi-Deva-IN */
+    static_cast<uint64_t>(0x686f4c61746e5047), /* ho-Latn-PG */
+    static_cast<uint64_t>(0x68724c61746e4852), /* hr-Latn-HR */
+    static_cast<uint64_t>(0x68744c61746e4854), /* ht-Latn-HT */
+    static_cast<uint64_t>(0x68754c61746e4855), /* hu-Latn-HU */
+    static_cast<uint64_t>(0x687941726d6e414d), /* hy-Armn-AM */
+    static_cast<uint64_t>(0x687a4c61746e4e41), /* hz-Latn-NA */
+    static_cast<uint64_t>(0x69644c61746e4944), /* id-Latn-ID */
+    static_cast<uint64_t>(0x69674c61746e4e47), /* ig-Latn-NG */
+    static_cast<uint64_t>(0x696959696969434e), /* ii-Yiii-CN */
+    static_cast<uint64_t>(0x696b4c61746e5553), /* ik-Latn-US */
+    static_cast<uint64_t>(0x696e4c61746e4944), /* in-Latn-ID */
+    static_cast<uint64_t>(0x69734c61746e4953), /* is-Latn-IS */
+    static_cast<uint64_t>(0x69744c61746e4954), /* it-Latn-IT */
+    static_cast<uint64_t>(0x697543616e734341), /* iu-Cans-CA */
+    static_cast<uint64_t>(0x697748656272494c), /* iw-Hebr-IL */
+    static_cast<uint64_t>(0x6a614a70616e4a50), /* ja-Jpan-JP */
+    static_cast<uint64_t>(0x6a69486562725541), /* ji-Hebr-UA */
+    static_cast<uint64_t>(0x6a764c61746e4944), /* jv-Latn-ID */
+    static_cast<uint64_t>(0x6a774c61746e4944), /* jw-Latn-ID */
+    static_cast<uint64_t>(0x6b6147656f724745), /* ka-Geor-GE */
+    static_cast<uint64_t>(0x6b674c61746e4344), /* kg-Latn-CD */
+    static_cast<uint64_t>(0x6b694c61746e4b45), /* ki-Latn-KE */
+    static_cast<uint64_t>(0x6b6a4c61746e4e41), /* kj-Latn-NA */
+    static_cast<uint64_t>(0x6b6b41726162434e), /* kk-Arab-CN */
+    static_cast<uint64_t>(0x6b6b4379726c4b5a), /* kk-Cyrl-KZ */
+    static_cast<uint64_t>(0x6b6c4c61746e474c), /* kl-Latn-GL */
+    static_cast<uint64_t>(0x6b6d4b686d724b48), /* km-Khmr-KH */
+    static_cast<uint64_t>(0x6b6e4b6e6461494e), /* kn-Knda-IN */
+    static_cast<uint64_t>(0x6b6f4b6f72654b52), /* ko-Kore-KR */
+    static_cast<uint64_t>(0x6b7341726162494e), /* ks-Arab-IN */
+    static_cast<uint64_t>(0x6b75417261624951), /* ku-Arab-IQ */
+    static_cast<uint64_t>(0x6b754c61746e5452), /* ku-Latn-TR */
+    static_cast<uint64_t>(0x6b7559657a694745), /* ku-Yezi-GE */
+    static_cast<uint64_t>(0x6b764379726c5255), /* kv-Cyrl-RU */
+    static_cast<uint64_t>(0x6b774c61746e4742), /* kw-Latn-GB */
+    static_cast<uint64_t>(0x6b7941726162434e), /* ky-Arab-CN */
+    static_cast<uint64_t>(0x6b794379726c4b47), /* ky-Cyrl-KG */
+    static_cast<uint64_t>(0x6b794c61746e5452), /* ky-Latn-TR */
+    static_cast<uint64_t>(0x6c614c61746e5641), /* la-Latn-VA */
+    static_cast<uint64_t>(0x6c624c61746e4c55), /* lb-Latn-LU */
+    static_cast<uint64_t>(0x6c674c61746e5547), /* lg-Latn-UG */
+    static_cast<uint64_t>(0x6c694c61746e4e4c), /* li-Latn-NL */
+    static_cast<uint64_t>(0x6c6e4c61746e4344), /* ln-Latn-CD */
+    static_cast<uint64_t>(0x6c6f4c616f6f4c41), /* lo-Laoo-LA */
+    static_cast<uint64_t>(0x6c744c61746e4c54), /* lt-Latn-LT */
+    static_cast<uint64_t>(0x6c754c61746e4344), /* lu-Latn-CD */
+    static_cast<uint64_t>(0x6c764c61746e4c56), /* lv-Latn-LV */
+    static_cast<uint64_t>(0x6d674c61746e4d47), /* mg-Latn-MG */
+    static_cast<uint64_t>(0x6d684c61746e4d48), /* mh-Latn-MH */
+    static_cast<uint64_t>(0x6d694c61746e4e5a), /* mi-Latn-NZ */
+    static_cast<uint64_t>(0x6d6b4379726c4d4b), /* mk-Cyrl-MK */
+    static_cast<uint64_t>(0x6d6c4d6c796d494e), /* ml-Mlym-IN */
+    static_cast<uint64_t>(0x6d6e4379726c4d4e), /* mn-Cyrl-MN */
+    static_cast<uint64_t>(0x6d6e4d6f6e67434e), /* mn-Mong-CN */
+    static_cast<uint64_t>(0x6d6f4c61746e524f), /* mo-Latn-RO */
+    static_cast<uint64_t>(0x6d7244657661494e), /* mr-Deva-IN */
+    static_cast<uint64_t>(0x6d734c61746e4d59), /* ms-Latn-MY */
+    static_cast<uint64_t>(0x6d744c61746e4d54), /* mt-Latn-MT */
+    static_cast<uint64_t>(0x6d794d796d724d4d), /* my-Mymr-MM */
+    static_cast<uint64_t>(0x6e614c61746e4e52), /* na-Latn-NR */
+    static_cast<uint64_t>(0x6e624c61746e4e4f), /* nb-Latn-NO */
+    static_cast<uint64_t>(0x6e644c61746e5a57), /* nd-Latn-ZW */
+    static_cast<uint64_t>(0x6e65446576614e50), /* ne-Deva-NP */
+    static_cast<uint64_t>(0x6e674c61746e4e41), /* ng-Latn-NA */
+    static_cast<uint64_t>(0x6e6c4c61746e4e4c), /* nl-Latn-NL */
+    static_cast<uint64_t>(0x6e6e4c61746e4e4f), /* nn-Latn-NO */
+    static_cast<uint64_t>(0x6e6f4c61746e4e4f), /* no-Latn-NO */
+    static_cast<uint64_t>(0x6e724c61746e5a41), /* nr-Latn-ZA */
+    static_cast<uint64_t>(0x6e764c61746e5553), /* nv-Latn-US */
+    static_cast<uint64_t>(0x6e794c61746e4d57), /* ny-Latn-MW */
+    static_cast<uint64_t>(0x6f634c61746e4652), /* oc-Latn-FR */
+    static_cast<uint64_t>(0x6f6d4c61746e4554), /* om-Latn-ET */
+    static_cast<uint64_t>(0x6f724f727961494e), /* or-Orya-IN */
+    static_cast<uint64_t>(0x6f734379726c4745), /* os-Cyrl-GE */
+    static_cast<uint64_t>(0x706141726162504b), /* pa-Arab-PK */
+    static_cast<uint64_t>(0x706147757275494e), /* pa-Guru-IN */
+    static_cast<uint64_t>(0x706c4c61746e504c), /* pl-Latn-PL */
+    static_cast<uint64_t>(0x7073417261624146), /* ps-Arab-AF */
+    static_cast<uint64_t>(0x70744c61746e4252), /* pt-Latn-BR */
+    static_cast<uint64_t>(0x71754c61746e5045), /* qu-Latn-PE */
+    static_cast<uint64_t>(0x726d4c61746e4348), /* rm-Latn-CH */
+    static_cast<uint64_t>(0x726e4c61746e4249), /* rn-Latn-BI */
+    static_cast<uint64_t>(0x726f4c61746e524f), /* ro-Latn-RO */
+    static_cast<uint64_t>(0x72754379726c5255), /* ru-Cyrl-RU */
+    static_cast<uint64_t>(0x72774c61746e5257), /* rw-Latn-RW */
+    static_cast<uint64_t>(0x736144657661494e), /* sa-Deva-IN */
+    static_cast<uint64_t>(0x73634c61746e4954), /* sc-Latn-IT */
+    static_cast<uint64_t>(0x736441726162504b), /* sd-Arab-PK */
+    static_cast<uint64_t>(0x736444657661494e), /* sd-Deva-IN */
+    static_cast<uint64_t>(0x73644b686f6a494e), /* sd-Khoj-IN */
+    static_cast<uint64_t>(0x736453696e64494e), /* sd-Sind-IN */
+    static_cast<uint64_t>(0x73654c61746e4e4f), /* se-Latn-NO */
+    static_cast<uint64_t>(0x73674c61746e4346), /* sg-Latn-CF */
+    static_cast<uint64_t>(0x736953696e684c4b), /* si-Sinh-LK */
+    static_cast<uint64_t>(0x736b4c61746e534b), /* sk-Latn-SK */
+    static_cast<uint64_t>(0x736c4c61746e5349), /* sl-Latn-SI */
+    static_cast<uint64_t>(0x736d4c61746e5753), /* sm-Latn-WS */
+    static_cast<uint64_t>(0x736e4c61746e5a57), /* sn-Latn-ZW */
+    static_cast<uint64_t>(0x736f4c61746e534f), /* so-Latn-SO */
+    static_cast<uint64_t>(0x73714c61746e414c), /* sq-Latn-AL */
+    static_cast<uint64_t>(0x73724379726c5253), /* sr-Cyrl-RS */
+    static_cast<uint64_t>(0x73734c61746e5a41), /* ss-Latn-ZA */
+    static_cast<uint64_t>(0x73744c61746e5a41), /* st-Latn-ZA */
+    static_cast<uint64_t>(0x73754c61746e4944), /* su-Latn-ID */
+    static_cast<uint64_t>(0x73764c61746e5345), /* sv-Latn-SE */
+    static_cast<uint64_t>(0x73774c61746e545a), /* sw-Latn-TZ */
+    static_cast<uint64_t>(0x746154616d6c494e), /* ta-Taml-IN */
+    static_cast<uint64_t>(0x746554656c75494e), /* te-Telu-IN */
+    static_cast<uint64_t>(0x746741726162504b), /* tg-Arab-PK */
+    static_cast<uint64_t>(0x74674379726c544a), /* tg-Cyrl-TJ */
+    static_cast<uint64_t>(0x7468546861695448), /* th-Thai-TH */
+    static_cast<uint64_t>(0x7469457468694554), /* ti-Ethi-ET */
+    static_cast<uint64_t>(0x746b4c61746e544d), /* tk-Latn-TM */
+    static_cast<uint64_t>(0x746c4c61746e5048), /* tl-Latn-PH */
+    static_cast<uint64_t>(0x746e4c61746e5a41), /* tn-Latn-ZA */
+    static_cast<uint64_t>(0x746f4c61746e544f), /* to-Latn-TO */
+    static_cast<uint64_t>(0x74724c61746e5452), /* tr-Latn-TR */
+    static_cast<uint64_t>(0x74734c61746e5a41), /* ts-Latn-ZA */
+    static_cast<uint64_t>(0x74744379726c5255), /* tt-Cyrl-RU */
+    static_cast<uint64_t>(0x74794c61746e5046), /* ty-Latn-PF */
+    static_cast<uint64_t>(0x756741726162434e), /* ug-Arab-CN */
+    static_cast<uint64_t>(0x75674379726c4b5a), /* ug-Cyrl-KZ */
+    static_cast<uint64_t>(0x756b4379726c5541), /* uk-Cyrl-UA */
+    static_cast<uint64_t>(0x757241726162504b), /* ur-Arab-PK */
+    static_cast<uint64_t>(0x757a417261624146), /* uz-Arab-AF */
+    static_cast<uint64_t>(0x757a4c61746e555a), /* uz-Latn-UZ */
+    static_cast<uint64_t>(0x76654c61746e5a41), /* ve-Latn-ZA */
+    static_cast<uint64_t>(0x76694c61746e564e), /* vi-Latn-VN */
+    static_cast<uint64_t>(0x77614c61746e4245), /* wa-Latn-BE */
+    static_cast<uint64_t>(0x776f4c61746e534e), /* wo-Latn-SN */
+    static_cast<uint64_t>(0x78684c61746e5a41), /* xh-Latn-ZA */
+    static_cast<uint64_t>(0x796f4c61746e4e47), /* yo-Latn-NG */
+    static_cast<uint64_t>(0x7a614c61746e434e), /* za-Latn-CN */
+    static_cast<uint64_t>(0x7a68426f706f5457), /* zh-Bopo-TW */
+    static_cast<uint64_t>(0x7a6848616e625457), /* zh-Hanb-TW */
+    static_cast<uint64_t>(0x7a6848616e73434e), /* zh-Hans-CN */
+    static_cast<uint64_t>(0x7a6848616e745457), /* zh-Hant-TW */
+    static_cast<uint64_t>(0x7a754c61746e5a41), /* zu-Latn-ZA */
+    static_cast<uint64_t>(0x80314c61746e4748), /* abr-Latn-GH */
+    static_cast<uint64_t>(0x80444c61746e4944), /* ace-Latn-ID */
+    static_cast<uint64_t>(0x80474c61746e5547), /* ach-Latn-UG */
+    static_cast<uint64_t>(0x80604c61746e4748), /* ada-Latn-GH */
+    static_cast<uint64_t>(0x806f546962744254), /* adp-Tibt-BT */
+    static_cast<uint64_t>(0x80784379726c5255), /* ady-Cyrl-RU */
+    static_cast<uint64_t>(0x808141726162544e), /* aeb-Arab-TN */
+    static_cast<uint64_t>(0x80d04c61746e434d), /* agq-Latn-CM */
+    static_cast<uint64_t>(0x80ee41686f6d494e), /* aho-Ahom-IN */
+    static_cast<uint64_t>(0x814a587375784951), /* akk-Xsux-IQ */
+    static_cast<uint64_t>(0x816d4c61746e584b), /* aln-Latn-XK */
+    static_cast<uint64_t>(0x81734379726c5255), /* alt-Cyrl-RU */
+    static_cast<uint64_t>(0x818e4c61746e4e47), /* amo-Latn-NG */
+    static_cast<uint64_t>(0x81d94c61746e4944), /* aoz-Latn-ID */
+    static_cast<uint64_t>(0x81e3417261625447), /* apd-Arab-TG */
+    static_cast<uint64_t>(0x822241726d694952), /* arc-Armi-IR */
+    static_cast<uint64_t>(0x82224e6261744a4f), /* arc-Nbat-JO */
+    static_cast<uint64_t>(0x822250616c6d5359), /* arc-Palm-SY */
+    static_cast<uint64_t>(0x822d4c61746e434c), /* arn-Latn-CL */
+    static_cast<uint64_t>(0x822e4c61746e424f), /* aro-Latn-BO */
+    static_cast<uint64_t>(0x823041726162445a), /* arq-Arab-DZ */
+    static_cast<uint64_t>(0x8232417261625341), /* ars-Arab-SA */
+    static_cast<uint64_t>(0x8238417261624d41), /* ary-Arab-MA */
+    static_cast<uint64_t>(0x8239417261624547), /* arz-Arab-EG */
+    static_cast<uint64_t>(0x82404c61746e545a), /* asa-Latn-TZ */
+    static_cast<uint64_t>(0x824453676e775553), /* ase-Sgnw-US */
+    static_cast<uint64_t>(0x82534c61746e4553), /* ast-Latn-ES */
+    static_cast<uint64_t>(0x82694c61746e4341), /* atj-Latn-CA */
+    static_cast<uint64_t>(0x82c044657661494e), /* awa-Deva-IN */
+    static_cast<uint64_t>(0x840b41726162504b), /* bal-Arab-PK */
+    static_cast<uint64_t>(0x840d4c61746e4944), /* ban-Latn-ID */
+    static_cast<uint64_t>(0x840f446576614e50), /* bap-Deva-NP */
+    static_cast<uint64_t>(0x84114c61746e4154), /* bar-Latn-AT */
+    static_cast<uint64_t>(0x84124c61746e434d), /* bas-Latn-CM */
+    static_cast<uint64_t>(0x841742616d75434d), /* bax-Bamu-CM */
+    static_cast<uint64_t>(0x84224c61746e4944), /* bbc-Latn-ID */
+    static_cast<uint64_t>(0x84294c61746e434d), /* bbj-Latn-CM */
+    static_cast<uint64_t>(0x84484c61746e4349), /* bci-Latn-CI */
+    static_cast<uint64_t>(0x8489417261625344), /* bej-Arab-SD */
+    static_cast<uint64_t>(0x848c4c61746e5a4d), /* bem-Latn-ZM */
+    static_cast<uint64_t>(0x84964c61746e4944), /* bew-Latn-ID */
+    static_cast<uint64_t>(0x84994c61746e545a), /* bez-Latn-TZ */
+    static_cast<uint64_t>(0x84a34c61746e434d), /* bfd-Latn-CM */
+    static_cast<uint64_t>(0x84b054616d6c494e), /* bfq-Taml-IN */
+    static_cast<uint64_t>(0x84b341726162504b), /* bft-Arab-PK */
+    static_cast<uint64_t>(0x84b844657661494e), /* bfy-Deva-IN */
+    static_cast<uint64_t>(0x84c244657661494e), /* bgc-Deva-IN */
+    static_cast<uint64_t>(0x84cd41726162504b), /* bgn-Arab-PK */
+    static_cast<uint64_t>(0x84d74772656b5452), /* bgx-Grek-TR */
+    static_cast<uint64_t>(0x84e144657661494e), /* bhb-Deva-IN */
+    static_cast<uint64_t>(0x84e844657661494e), /* bhi-Deva-IN */
+    static_cast<uint64_t>(0x84ee44657661494e), /* bho-Deva-IN */
+    static_cast<uint64_t>(0x850a4c61746e5048), /* bik-Latn-PH */
+    static_cast<uint64_t>(0x850d4c61746e4e47), /* bin-Latn-NG */
+    static_cast<uint64_t>(0x852944657661494e), /* bjj-Deva-IN */
+    static_cast<uint64_t>(0x852d4c61746e4944), /* bjn-Latn-ID */
+    static_cast<uint64_t>(0x85334c61746e534e), /* bjt-Latn-SN */
+    static_cast<uint64_t>(0x854c4c61746e434d), /* bkm-Latn-CM */
+    static_cast<uint64_t>(0x85544c61746e5048), /* bku-Latn-PH */
+    static_cast<uint64_t>(0x857354617674564e), /* blt-Tavt-VN */
+    static_cast<uint64_t>(0x85904c61746e4d4c), /* bmq-Latn-ML */
+    static_cast<uint64_t>(0x85f842656e67494e), /* bpy-Beng-IN */
+    static_cast<uint64_t>(0x8608417261624952), /* bqi-Arab-IR */
+    static_cast<uint64_t>(0x86154c61746e4349), /* bqv-Latn-CI */
+    static_cast<uint64_t>(0x862044657661494e), /* bra-Deva-IN */
+    static_cast<uint64_t>(0x862741726162504b), /* brh-Arab-PK */
+    static_cast<uint64_t>(0x863744657661494e), /* brx-Deva-IN */
+    static_cast<uint64_t>(0x8650426173734c52), /* bsq-Bass-LR */
+    static_cast<uint64_t>(0x86524c61746e434d), /* bss-Latn-CM */
+    static_cast<uint64_t>(0x866e4c61746e5048), /* bto-Latn-PH */
+    static_cast<uint64_t>(0x867544657661504b), /* btv-Deva-PK */
+    static_cast<uint64_t>(0x86804379726c5255), /* bua-Cyrl-RU */
+    static_cast<uint64_t>(0x86824c61746e5954), /* buc-Latn-YT */
+    static_cast<uint64_t>(0x86864c61746e4944), /* bug-Latn-ID */
+    static_cast<uint64_t>(0x868c4c61746e434d), /* bum-Latn-CM */
+    static_cast<uint64_t>(0x86a14c61746e4751), /* bvb-Latn-GQ */
+    static_cast<uint64_t>(0x870d457468694552), /* byn-Ethi-ER */
+    static_cast<uint64_t>(0x87154c61746e434d), /* byv-Latn-CM */
+    static_cast<uint64_t>(0x87244c61746e4d4c), /* bze-Latn-ML */
+    static_cast<uint64_t>(0x88034c61746e5553), /* cad-Latn-US */
+    static_cast<uint64_t>(0x88474c61746e4e47), /* cch-Latn-NG */
+    static_cast<uint64_t>(0x884f43616b6d4244), /* ccp-Cakm-BD */
+    static_cast<uint64_t>(0x88814c61746e5048), /* ceb-Latn-PH */
+    static_cast<uint64_t>(0x88c64c61746e5547), /* cgg-Latn-UG */
+    static_cast<uint64_t>(0x88ea4c61746e464d), /* chk-Latn-FM */
+    static_cast<uint64_t>(0x88ec4379726c5255), /* chm-Cyrl-RU */
+    static_cast<uint64_t>(0x88ee4c61746e5553), /* cho-Latn-US */
+    static_cast<uint64_t>(0x88ef4c61746e4341), /* chp-Latn-CA */
+    static_cast<uint64_t>(0x88f1436865725553), /* chr-Cher-US */
+    static_cast<uint64_t>(0x89024c61746e5553), /* cic-Latn-US */
+    static_cast<uint64_t>(0x8920417261624b48), /* cja-Arab-KH */
+    static_cast<uint64_t>(0x892c4368616d564e), /* cjm-Cham-VN */
+    static_cast<uint64_t>(0x8941417261624951), /* ckb-Arab-IQ */
+    static_cast<uint64_t>(0x8986536f796f4d4e), /* cmg-Soyo-MN */
+    static_cast<uint64_t>(0x89cf436f70744547), /* cop-Copt-EG */
+    static_cast<uint64_t>(0x89f24c61746e5048), /* cps-Latn-PH */
+    static_cast<uint64_t>(0x8a274379726c5541), /* crh-Cyrl-UA */
+    static_cast<uint64_t>(0x8a2943616e734341), /* crj-Cans-CA */
+    static_cast<uint64_t>(0x8a2a43616e734341), /* crk-Cans-CA */
+    static_cast<uint64_t>(0x8a2b43616e734341), /* crl-Cans-CA */
+    static_cast<uint64_t>(0x8a2c43616e734341), /* crm-Cans-CA */
+    static_cast<uint64_t>(0x8a324c61746e5343), /* crs-Latn-SC */
+    static_cast<uint64_t>(0x8a414c61746e504c), /* csb-Latn-PL */
+    static_cast<uint64_t>(0x8a5643616e734341), /* csw-Cans-CA */
+    static_cast<uint64_t>(0x8a63506175634d4d), /* ctd-Pauc-MM */
+    static_cast<uint64_t>(0x8c054c61746e4349), /* daf-Latn-CI */
+    static_cast<uint64_t>(0x8c0a4c61746e5553), /* dak-Latn-US */
+    static_cast<uint64_t>(0x8c114379726c5255), /* dar-Cyrl-RU */
+    static_cast<uint64_t>(0x8c154c61746e4b45), /* dav-Latn-KE */
+    static_cast<uint64_t>(0x8c4241726162494e), /* dcc-Arab-IN */
+    static_cast<uint64_t>(0x8c8d4c61746e4341), /* den-Latn-CA */
+    static_cast<uint64_t>(0x8cd14c61746e4341), /* dgr-Latn-CA */
+    static_cast<uint64_t>(0x8d244c61746e4e45), /* dje-Latn-NE */
+    static_cast<uint64_t>(0x8da94c61746e4349), /* dnj-Latn-CI */
+    static_cast<uint64_t>(0x8dc844657661494e), /* doi-Deva-IN */
+    static_cast<uint64_t>(0x8e274d6f6e67434e), /* drh-Mong-CN */
+    static_cast<uint64_t>(0x8e414c61746e4445), /* dsb-Latn-DE */
+    static_cast<uint64_t>(0x8e6c4c61746e4d4c), /* dtm-Latn-ML */
+    static_cast<uint64_t>(0x8e6f4c61746e4d59), /* dtp-Latn-MY */
+    static_cast<uint64_t>(0x8e78446576614e50), /* dty-Deva-NP */
+    static_cast<uint64_t>(0x8e804c61746e434d), /* dua-Latn-CM */
+    static_cast<uint64_t>(0x8f0e4c61746e534e), /* dyo-Latn-SN */
+    static_cast<uint64_t>(0x8f144c61746e4246), /* dyu-Latn-BF */
+    static_cast<uint64_t>(0x90344c61746e4b45), /* ebu-Latn-KE */
+    static_cast<uint64_t>(0x90a84c61746e4e47), /* efi-Latn-NG */
+    static_cast<uint64_t>(0x90cb4c61746e4954), /* egl-Latn-IT */
+    static_cast<uint64_t>(0x90d8456779704547), /* egy-Egyp-EG */
+    static_cast<uint64_t>(0x91584b616c694d4d), /* eky-Kali-MM */
+    static_cast<uint64_t>(0x9246476f6e6d494e), /* esg-Gonm-IN */
+    static_cast<uint64_t>(0x92544c61746e5553), /* esu-Latn-US */
+    static_cast<uint64_t>(0x92734974616c4954), /* ett-Ital-IT */
+    static_cast<uint64_t>(0x92ce4c61746e434d), /* ewo-Latn-CM */
+    static_cast<uint64_t>(0x92f34c61746e4553), /* ext-Latn-ES */
+    static_cast<uint64_t>(0x940d4c61746e4751), /* fan-Latn-GQ */
+    static_cast<uint64_t>(0x94ac4c61746e4d4c), /* ffm-Latn-ML */
+    static_cast<uint64_t>(0x9500417261625344), /* fia-Arab-SD */
+    static_cast<uint64_t>(0x950b4c61746e5048), /* fil-Latn-PH */
+    static_cast<uint64_t>(0x95134c61746e5345), /* fit-Latn-SE */
+    static_cast<uint64_t>(0x95cd4c61746e424a), /* fon-Latn-BJ */
+    static_cast<uint64_t>(0x96224c61746e5553), /* frc-Latn-US */
+    static_cast<uint64_t>(0x962f4c61746e4652), /* frp-Latn-FR */
+    static_cast<uint64_t>(0x96314c61746e4445), /* frr-Latn-DE */
+    static_cast<uint64_t>(0x96324c61746e4445), /* frs-Latn-DE */
+    static_cast<uint64_t>(0x968141726162434d), /* fub-Arab-CM */
+    static_cast<uint64_t>(0x96834c61746e5746), /* fud-Latn-WF */
+    static_cast<uint64_t>(0x96854c61746e474e), /* fuf-Latn-GN */
+    static_cast<uint64_t>(0x96904c61746e4e45), /* fuq-Latn-NE */
+    static_cast<uint64_t>(0x96914c61746e4954), /* fur-Latn-IT */
+    static_cast<uint64_t>(0x96954c61746e4e47), /* fuv-Latn-NG */
+    static_cast<uint64_t>(0x96b14c61746e5344), /* fvr-Latn-SD */
+    static_cast<uint64_t>(0x98004c61746e4748), /* gaa-Latn-GH */
+    static_cast<uint64_t>(0x98064c61746e4d44), /* gag-Latn-MD */
+    static_cast<uint64_t>(0x980d48616e73434e), /* gan-Hans-CN */
+    static_cast<uint64_t>(0x98184c61746e4944), /* gay-Latn-ID */
+    static_cast<uint64_t>(0x982c44657661494e), /* gbm-Deva-IN */
+    static_cast<uint64_t>(0x9839417261624952), /* gbz-Arab-IR */
+    static_cast<uint64_t>(0x98514c61746e4746), /* gcr-Latn-GF */
+    static_cast<uint64_t>(0x9899457468694554), /* gez-Ethi-ET */
+    static_cast<uint64_t>(0x98cd446576614e50), /* ggn-Deva-NP */
+    static_cast<uint64_t>(0x990b4c61746e4b49), /* gil-Latn-KI */
+    static_cast<uint64_t>(0x992a41726162504b), /* gjk-Arab-PK */
+    static_cast<uint64_t>(0x993441726162504b), /* gju-Arab-PK */
+    static_cast<uint64_t>(0x996a417261624952), /* glk-Arab-IR */
+    static_cast<uint64_t>(0x99cc44657661494e), /* gom-Deva-IN */
+    static_cast<uint64_t>(0x99cd54656c75494e), /* gon-Telu-IN */
+    static_cast<uint64_t>(0x99d14c61746e4944), /* gor-Latn-ID */
+    static_cast<uint64_t>(0x99d24c61746e4e4c), /* gos-Latn-NL */
+    static_cast<uint64_t>(0x99d3476f74685541), /* got-Goth-UA */
+    static_cast<uint64_t>(0x9a22437072744359), /* grc-Cprt-CY */
+    static_cast<uint64_t>(0x9a224c696e624752), /* grc-Linb-GR */
+    static_cast<uint64_t>(0x9a3342656e67494e), /* grt-Beng-IN */
+    static_cast<uint64_t>(0x9a564c61746e4348), /* gsw-Latn-CH */
+    static_cast<uint64_t>(0x9a814c61746e4252), /* gub-Latn-BR */
+    static_cast<uint64_t>(0x9a824c61746e434f), /* guc-Latn-CO */
+    static_cast<uint64_t>(0x9a914c61746e4748), /* gur-Latn-GH */
+    static_cast<uint64_t>(0x9a994c61746e4b45), /* guz-Latn-KE */
+    static_cast<uint64_t>(0x9ab1446576614e50), /* gvr-Deva-NP */
+    static_cast<uint64_t>(0x9ac84c61746e4341), /* gwi-Latn-CA */
+    static_cast<uint64_t>(0x9c0a48616e73434e), /* hak-Hans-CN */
+    static_cast<uint64_t>(0x9c164c61746e5553), /* haw-Latn-US */
+    static_cast<uint64_t>(0x9c19417261624146), /* haz-Arab-AF */
+    static_cast<uint64_t>(0x9d054c61746e464a), /* hif-Latn-FJ */
+    static_cast<uint64_t>(0x9d0b4c61746e5048), /* hil-Latn-PH */
+    static_cast<uint64_t>(0x9d74486c75775452), /* hlu-Hluw-TR */
+    static_cast<uint64_t>(0x9d83506c7264434e), /* hmd-Plrd-CN */
+    static_cast<uint64_t>(0x9da341726162504b), /* hnd-Arab-PK */
+    static_cast<uint64_t>(0x9da444657661494e), /* hne-Deva-IN */
+    static_cast<uint64_t>(0x9da9486d6e674c41), /* hnj-Hmng-LA */
+    static_cast<uint64_t>(0x9dad4c61746e5048), /* hnn-Latn-PH */
+    static_cast<uint64_t>(0x9dae41726162504b), /* hno-Arab-PK */
+    static_cast<uint64_t>(0x9dc244657661494e), /* hoc-Deva-IN */
+    static_cast<uint64_t>(0x9dc944657661494e), /* hoj-Deva-IN */
+    static_cast<uint64_t>(0x9e414c61746e4445), /* hsb-Latn-DE */
+    static_cast<uint64_t>(0x9e4d48616e73434e), /* hsn-Hans-CN */
+    static_cast<uint64_t>(0xa0204c61746e4d59), /* iba-Latn-MY */
+    static_cast<uint64_t>(0xa0214c61746e4e47), /* ibb-Latn-NG */
+    static_cast<uint64_t>(0xa0a44c61746e5447), /* ife-Latn-TG */
+    static_cast<uint64_t>(0xa1534c61746e4341), /* ikt-Latn-CA */
+    static_cast<uint64_t>(0xa16e4c61746e5048), /* ilo-Latn-PH */
+    static_cast<uint64_t>(0xa1a74379726c5255), /* inh-Cyrl-RU */
+    static_cast<uint64_t>(0xa3274c61746e5255), /* izh-Latn-RU */
+    static_cast<uint64_t>(0xa40c4c61746e4a4d), /* jam-Latn-JM */
+    static_cast<uint64_t>(0xa4ce4c61746e434d), /* jgo-Latn-CM */
+    static_cast<uint64_t>(0xa5824c61746e545a), /* jmc-Latn-TZ */
+    static_cast<uint64_t>(0xa58b446576614e50), /* jml-Deva-NP */
+    static_cast<uint64_t>(0xa6934c61746e444b), /* jut-Latn-DK */
+    static_cast<uint64_t>(0xa8004379726c555a), /* kaa-Cyrl-UZ */
+    static_cast<uint64_t>(0xa8014c61746e445a), /* kab-Latn-DZ */
+    static_cast<uint64_t>(0xa8024c61746e4d4d), /* kac-Latn-MM */
+    static_cast<uint64_t>(0xa8094c61746e4e47), /* kaj-Latn-NG */
+    static_cast<uint64_t>(0xa80c4c61746e4b45), /* kam-Latn-KE */
+    static_cast<uint64_t>(0xa80e4c61746e4d4c), /* kao-Latn-ML */
+    static_cast<uint64_t>(0xa8234379726c5255), /* kbd-Cyrl-RU */
+    static_cast<uint64_t>(0xa838417261624e45), /* kby-Arab-NE */
+    static_cast<uint64_t>(0xa8464c61746e4e47), /* kcg-Latn-NG */
+    static_cast<uint64_t>(0xa84a4c61746e5a57), /* kck-Latn-ZW */
+    static_cast<uint64_t>(0xa8644c61746e545a), /* kde-Latn-TZ */
+    static_cast<uint64_t>(0xa867417261625447), /* kdh-Arab-TG */
+    static_cast<uint64_t>(0xa873546861695448), /* kdt-Thai-TH */
+    static_cast<uint64_t>(0xa8804c61746e4356), /* kea-Latn-CV */
+    static_cast<uint64_t>(0xa88d4c61746e434d), /* ken-Latn-CM */
+    static_cast<uint64_t>(0xa8ae4c61746e4349), /* kfo-Latn-CI */
+    static_cast<uint64_t>(0xa8b144657661494e), /* kfr-Deva-IN */
+    static_cast<uint64_t>(0xa8b844657661494e), /* kfy-Deva-IN */
+    static_cast<uint64_t>(0xa8c44c61746e4944), /* kge-Latn-ID */
+    static_cast<uint64_t>(0xa8cf4c61746e4252), /* kgp-Latn-BR */
+    static_cast<uint64_t>(0xa8e04c61746e494e), /* kha-Latn-IN */
+    static_cast<uint64_t>(0xa8e154616c75434e), /* khb-Talu-CN */
+    static_cast<uint64_t>(0xa8ed44657661494e), /* khn-Deva-IN */
+    static_cast<uint64_t>(0xa8f04c61746e4d4c), /* khq-Latn-ML */
+    static_cast<uint64_t>(0xa8f34d796d72494e), /* kht-Mymr-IN */
+    static_cast<uint64_t>(0xa8f641726162504b), /* khw-Arab-PK */
+    static_cast<uint64_t>(0xa9144c61746e5452), /* kiu-Latn-TR */
+    static_cast<uint64_t>(0xa9264c616f6f4c41), /* kjg-Laoo-LA */
+    static_cast<uint64_t>(0xa9494c61746e434d), /* kkj-Latn-CM */
+    static_cast<uint64_t>(0xa96d4c61746e4b45), /* kln-Latn-KE */
+    static_cast<uint64_t>(0xa9814c61746e414f), /* kmb-Latn-AO */
+    static_cast<uint64_t>(0xa9a54c61746e4757), /* knf-Latn-GW */
+    static_cast<uint64_t>(0xa9c84379726c5255), /* koi-Cyrl-RU */
+    static_cast<uint64_t>(0xa9ca44657661494e), /* kok-Deva-IN */
+    static_cast<uint64_t>(0xa9d24c61746e464d), /* kos-Latn-FM */
+    static_cast<uint64_t>(0xa9e44c61746e4c52), /* kpe-Latn-LR */
+    static_cast<uint64_t>(0xaa224379726c5255), /* krc-Cyrl-RU */
+    static_cast<uint64_t>(0xaa284c61746e534c), /* kri-Latn-SL */
+    static_cast<uint64_t>(0xaa294c61746e5048), /* krj-Latn-PH */
+    static_cast<uint64_t>(0xaa2b4c61746e5255), /* krl-Latn-RU */
+    static_cast<uint64_t>(0xaa3444657661494e), /* kru-Deva-IN */
+    static_cast<uint64_t>(0xaa414c61746e545a), /* ksb-Latn-TZ */
+    static_cast<uint64_t>(0xaa454c61746e434d), /* ksf-Latn-CM */
+    static_cast<uint64_t>(0xaa474c61746e4445), /* ksh-Latn-DE */
+    static_cast<uint64_t>(0xaa714c61746e4d59), /* ktr-Latn-MY */
+    static_cast<uint64_t>(0xaa8c4379726c5255), /* kum-Cyrl-RU */
+    static_cast<uint64_t>(0xaab14c61746e4944), /* kvr-Latn-ID */
+    static_cast<uint64_t>(0xaab741726162504b), /* kvx-Arab-PK */
+    static_cast<uint64_t>(0xaaeb44657661494e), /* kxl-Deva-IN */
+    static_cast<uint64_t>(0xaaec546861695448), /* kxm-Thai-TH */
+    static_cast<uint64_t>(0xaaef41726162504b), /* kxp-Arab-PK */
+    static_cast<uint64_t>(0xab294c61746e4d59), /* kzj-Latn-MY */
+    static_cast<uint64_t>(0xab334c61746e4d59), /* kzt-Latn-MY */
+    static_cast<uint64_t>(0xac014c696e614752), /* lab-Lina-GR */
+    static_cast<uint64_t>(0xac0348656272494c), /* lad-Hebr-IL */
+    static_cast<uint64_t>(0xac064c61746e545a), /* lag-Latn-TZ */
+    static_cast<uint64_t>(0xac0741726162504b), /* lah-Arab-PK */
+    static_cast<uint64_t>(0xac094c61746e5547), /* laj-Latn-UG */
+    static_cast<uint64_t>(0xac244379726c5255), /* lbe-Cyrl-RU */
+    static_cast<uint64_t>(0xac364c61746e4944), /* lbw-Latn-ID */
+    static_cast<uint64_t>(0xac4f54686169434e), /* lcp-Thai-CN */
+    static_cast<uint64_t>(0xac8f4c657063494e), /* lep-Lepc-IN */
+    static_cast<uint64_t>(0xac994379726c5255), /* lez-Cyrl-RU */
+    static_cast<uint64_t>(0xad05446576614e50), /* lif-Deva-NP */
+    static_cast<uint64_t>(0xad054c696d62494e), /* lif-Limb-IN */
+    static_cast<uint64_t>(0xad094c61746e4954), /* lij-Latn-IT */
+    static_cast<uint64_t>(0xad124c697375434e), /* lis-Lisu-CN */
+    static_cast<uint64_t>(0xad2f4c61746e4944), /* ljp-Latn-ID */
+    static_cast<uint64_t>(0xad48417261624952), /* lki-Arab-IR */
+    static_cast<uint64_t>(0xad534c61746e5553), /* lkt-Latn-US */
+    static_cast<uint64_t>(0xad8d54656c75494e), /* lmn-Telu-IN */
+    static_cast<uint64_t>(0xad8e4c61746e4954), /* lmo-Latn-IT */
+    static_cast<uint64_t>(0xadcb4c61746e4344), /* lol-Latn-CD */
+    static_cast<uint64_t>(0xadd94c61746e5a4d), /* loz-Latn-ZM */
+    static_cast<uint64_t>(0xae22417261624952), /* lrc-Arab-IR */
+    static_cast<uint64_t>(0xae664c61746e4c56), /* ltg-Latn-LV */
+    static_cast<uint64_t>(0xae804c61746e4344), /* lua-Latn-CD */
+    static_cast<uint64_t>(0xae8e4c61746e4b45), /* luo-Latn-KE */
+    static_cast<uint64_t>(0xae984c61746e4b45), /* luy-Latn-KE */
+    static_cast<uint64_t>(0xae99417261624952), /* luz-Arab-IR */
+    static_cast<uint64_t>(0xaecb546861695448), /* lwl-Thai-TH */
+    static_cast<uint64_t>(0xaf2748616e73434e), /* lzh-Hans-CN */
+    static_cast<uint64_t>(0xaf394c61746e5452), /* lzz-Latn-TR */
+    static_cast<uint64_t>(0xb0034c61746e4944), /* mad-Latn-ID */
+    static_cast<uint64_t>(0xb0054c61746e434d), /* maf-Latn-CM */
+    static_cast<uint64_t>(0xb00644657661494e), /* mag-Deva-IN */
+    static_cast<uint64_t>(0xb00844657661494e), /* mai-Deva-IN */
+    static_cast<uint64_t>(0xb00a4c61746e4944), /* mak-Latn-ID */
+    static_cast<uint64_t>(0xb00d4c61746e474d), /* man-Latn-GM */
+    static_cast<uint64_t>(0xb00d4e6b6f6f474e), /* man-Nkoo-GN */
+    static_cast<uint64_t>(0xb0124c61746e4b45), /* mas-Latn-KE */
+    static_cast<uint64_t>(0xb0194c61746e4d58), /* maz-Latn-MX */
+    static_cast<uint64_t>(0xb0654379726c5255), /* mdf-Cyrl-RU */
+    static_cast<uint64_t>(0xb0674c61746e5048), /* mdh-Latn-PH */
+    static_cast<uint64_t>(0xb0714c61746e4944), /* mdr-Latn-ID */
+    static_cast<uint64_t>(0xb08d4c61746e534c), /* men-Latn-SL */
+    static_cast<uint64_t>(0xb0914c61746e4b45), /* mer-Latn-KE */
+    static_cast<uint64_t>(0xb0a0417261625448), /* mfa-Arab-TH */
+    static_cast<uint64_t>(0xb0a44c61746e4d55), /* mfe-Latn-MU */
+    static_cast<uint64_t>(0xb0c74c61746e4d5a), /* mgh-Latn-MZ */
+    static_cast<uint64_t>(0xb0ce4c61746e434d), /* mgo-Latn-CM */
+    static_cast<uint64_t>(0xb0cf446576614e50), /* mgp-Deva-NP */
+    static_cast<uint64_t>(0xb0d84c61746e545a), /* mgy-Latn-TZ */
+    static_cast<uint64_t>(0xb10d4c61746e4944), /* min-Latn-ID */
+    static_cast<uint64_t>(0xb112486174724951), /* mis-Hatr-IQ */
+    static_cast<uint64_t>(0xb1124d6564664e47), /* mis-Medf-NG */
+    static_cast<uint64_t>(0xb1724c61746e5344), /* mls-Latn-SD */
+    static_cast<uint64_t>(0xb1a842656e67494e), /* mni-Beng-IN */
+    static_cast<uint64_t>(0xb1b64d796d724d4d), /* mnw-Mymr-MM */
+    static_cast<uint64_t>(0xb1c44c61746e4341), /* moe-Latn-CA */
+    static_cast<uint64_t>(0xb1c74c61746e4341), /* moh-Latn-CA */
+    static_cast<uint64_t>(0xb1d24c61746e4246), /* mos-Latn-BF */
+    static_cast<uint64_t>(0xb223446576614e50), /* mrd-Deva-NP */
+    static_cast<uint64_t>(0xb2294379726c5255), /* mrj-Cyrl-RU */
+    static_cast<uint64_t>(0xb22e4d726f6f4244), /* mro-Mroo-BD */
+    static_cast<uint64_t>(0xb27144657661494e), /* mtr-Deva-IN */
+    static_cast<uint64_t>(0xb2804c61746e434d), /* mua-Latn-CM */
+    static_cast<uint64_t>(0xb2924c61746e5553), /* mus-Latn-US */
+    static_cast<uint64_t>(0xb2b841726162504b), /* mvy-Arab-PK */
+    static_cast<uint64_t>(0xb2ca4c61746e4d4c), /* mwk-Latn-ML */
+    static_cast<uint64_t>(0xb2d144657661494e), /* mwr-Deva-IN */
+    static_cast<uint64_t>(0xb2d54c61746e4944), /* mwv-Latn-ID */
+    static_cast<uint64_t>(0xb2d6486d6e705553), /* mww-Hmnp-US */
+    static_cast<uint64_t>(0xb2e24c61746e5a57), /* mxc-Latn-ZW */
+    static_cast<uint64_t>(0xb3154379726c5255), /* myv-Cyrl-RU */
+    static_cast<uint64_t>(0xb3174c61746e5547), /* myx-Latn-UG */
+    static_cast<uint64_t>(0xb3194d616e644952), /* myz-Mand-IR */
+    static_cast<uint64_t>(0xb32d417261624952), /* mzn-Arab-IR */
+    static_cast<uint64_t>(0xb40d48616e73434e), /* nan-Hans-CN */
+    static_cast<uint64_t>(0xb40f4c61746e4954), /* nap-Latn-IT */
+    static_cast<uint64_t>(0xb4104c61746e4e41), /* naq-Latn-NA */
+    static_cast<uint64_t>(0xb4474c61746e4d58), /* nch-Latn-MX */
+    static_cast<uint64_t>(0xb4624c61746e4d5a), /* ndc-Latn-MZ */
+    static_cast<uint64_t>(0xb4724c61746e4445), /* nds-Latn-DE */
+    static_cast<uint64_t>(0xb496446576614e50), /* new-Deva-NP */
+    static_cast<uint64_t>(0xb4cb4c61746e4d5a), /* ngl-Latn-MZ */
+    static_cast<uint64_t>(0xb4e44c61746e4d58), /* nhe-Latn-MX */
+    static_cast<uint64_t>(0xb4f64c61746e4d58), /* nhw-Latn-MX */
+    static_cast<uint64_t>(0xb5094c61746e4944), /* nij-Latn-ID */
+    static_cast<uint64_t>(0xb5144c61746e4e55), /* niu-Latn-NU */
+    static_cast<uint64_t>(0xb52e4c61746e494e), /* njo-Latn-IN */
+    static_cast<uint64_t>(0xb5864c61746e434d), /* nmg-Latn-CM */
+    static_cast<uint64_t>(0xb5a74c61746e434d), /* nnh-Latn-CM */
+    static_cast<uint64_t>(0xb5af5763686f494e), /* nnp-Wcho-IN */
+    static_cast<uint64_t>(0xb5c34c616e615448), /* nod-Lana-TH */
+    static_cast<uint64_t>(0xb5c444657661494e), /* noe-Deva-IN */
+    static_cast<uint64_t>(0xb5cd52756e725345), /* non-Runr-SE */
+    static_cast<uint64_t>(0xb60e4e6b6f6f474e), /* nqo-Nkoo-GN */
+    static_cast<uint64_t>(0xb64a43616e734341), /* nsk-Cans-CA */
+    static_cast<uint64_t>(0xb64e4c61746e5a41), /* nso-Latn-ZA */
+    static_cast<uint64_t>(0xb6924c61746e5353), /* nus-Latn-SS */
+    static_cast<uint64_t>(0xb6f04c61746e434e), /* nxq-Latn-CN */
+    static_cast<uint64_t>(0xb70c4c61746e545a), /* nym-Latn-TZ */
+    static_cast<uint64_t>(0xb70d4c61746e5547), /* nyn-Latn-UG */
+    static_cast<uint64_t>(0xb7284c61746e4748), /* nzi-Latn-GH */
+    static_cast<uint64_t>(0xba404f7367655553), /* osa-Osge-US */
+    static_cast<uint64_t>(0xba6a4f726b684d4e), /* otk-Orkh-MN */
+    static_cast<uint64_t>(0xbc064c61746e5048), /* pag-Latn-PH */
+    static_cast<uint64_t>(0xbc0b50686c694952), /* pal-Phli-IR */
+    static_cast<uint64_t>(0xbc0b50686c70434e), /* pal-Phlp-CN */
+    static_cast<uint64_t>(0xbc0c4c61746e5048), /* pam-Latn-PH */
+    static_cast<uint64_t>(0xbc0f4c61746e4157), /* pap-Latn-AW */
+    static_cast<uint64_t>(0xbc144c61746e5057), /* pau-Latn-PW */
+    static_cast<uint64_t>(0xbc434c61746e4652), /* pcd-Latn-FR */
+    static_cast<uint64_t>(0xbc4c4c61746e4e47), /* pcm-Latn-NG */
+    static_cast<uint64_t>(0xbc624c61746e5553), /* pdc-Latn-US */
+    static_cast<uint64_t>(0xbc734c61746e4341), /* pdt-Latn-CA */
+    static_cast<uint64_t>(0xbc8e5870656f4952), /* peo-Xpeo-IR */
+    static_cast<uint64_t>(0xbcab4c61746e4445), /* pfl-Latn-DE */
+    static_cast<uint64_t>(0xbced50686e784c42), /* phn-Phnx-LB */
+    static_cast<uint64_t>(0xbd4042726168494e), /* pka-Brah-IN */
+    static_cast<uint64_t>(0xbd4e4c61746e4b45), /* pko-Latn-KE */
+    static_cast<uint64_t>(0xbd924c61746e4954), /* pms-Latn-IT */
+    static_cast<uint64_t>(0xbdb34772656b4752), /* pnt-Grek-GR */
+    static_cast<uint64_t>(0xbdcd4c61746e464d), /* pon-Latn-FM */
+    static_cast<uint64_t>(0xbde044657661494e), /* ppa-Deva-IN */
+    static_cast<uint64_t>(0xbe204b686172504b), /* pra-Khar-PK */
+    static_cast<uint64_t>(0xbe23417261624952), /* prd-Arab-IR */
+    static_cast<uint64_t>(0xbe944c61746e4741), /* puu-Latn-GA */
+    static_cast<uint64_t>(0xc2824c61746e4754), /* quc-Latn-GT */
+    static_cast<uint64_t>(0xc2864c61746e4543), /* qug-Latn-EC */
+    static_cast<uint64_t>(0xc40944657661494e), /* raj-Deva-IN */
+    static_cast<uint64_t>(0xc4454c61746e5245), /* rcf-Latn-RE */
+    static_cast<uint64_t>(0xc4894c61746e4944), /* rej-Latn-ID */
+    static_cast<uint64_t>(0xc4cd4c61746e4954), /* rgn-Latn-IT */
+    static_cast<uint64_t>(0xc4e6417261624d4d), /* rhg-Arab-MM */
+    static_cast<uint64_t>(0xc5004c61746e494e), /* ria-Latn-IN */
+    static_cast<uint64_t>(0xc50554666e674d41), /* rif-Tfng-MA */
+    static_cast<uint64_t>(0xc532446576614e50), /* rjs-Deva-NP */
+    static_cast<uint64_t>(0xc55342656e674244), /* rkt-Beng-BD */
+    static_cast<uint64_t>(0xc5854c61746e4649), /* rmf-Latn-FI */
+    static_cast<uint64_t>(0xc58e4c61746e4348), /* rmo-Latn-CH */
+    static_cast<uint64_t>(0xc593417261624952), /* rmt-Arab-IR */
+    static_cast<uint64_t>(0xc5944c61746e5345), /* rmu-Latn-SE */
+    static_cast<uint64_t>(0xc5a64c61746e4d5a), /* rng-Latn-MZ */
+    static_cast<uint64_t>(0xc5c14c61746e4944), /* rob-Latn-ID */
+    static_cast<uint64_t>(0xc5c54c61746e545a), /* rof-Latn-TZ */
+    static_cast<uint64_t>(0xc66c4c61746e464a), /* rtm-Latn-FJ */
+    static_cast<uint64_t>(0xc6844379726c5541), /* rue-Cyrl-UA */
+    static_cast<uint64_t>(0xc6864c61746e5342), /* rug-Latn-SB */
+    static_cast<uint64_t>(0xc6ca4c61746e545a), /* rwk-Latn-TZ */
+    static_cast<uint64_t>(0xc7144b616e614a50), /* ryu-Kana-JP */
+    static_cast<uint64_t>(0xc8054c61746e4748), /* saf-Latn-GH */
+    static_cast<uint64_t>(0xc8074379726c5255), /* sah-Cyrl-RU */
+    static_cast<uint64_t>(0xc8104c61746e4b45), /* saq-Latn-KE */
+    static_cast<uint64_t>(0xc8124c61746e4944), /* sas-Latn-ID */
+    static_cast<uint64_t>(0xc8134f6c636b494e), /* sat-Olck-IN */
+    static_cast<uint64_t>(0xc8154c61746e534e), /* sav-Latn-SN */
+    static_cast<uint64_t>(0xc81953617572494e), /* saz-Saur-IN */
+    static_cast<uint64_t>(0xc82f4c61746e545a), /* sbp-Latn-TZ */
+    static_cast<uint64_t>(0xc84a44657661494e), /* sck-Deva-IN */
+    static_cast<uint64_t>(0xc84d4c61746e4954), /* scn-Latn-IT */
+    static_cast<uint64_t>(0xc84e4c61746e4742), /* sco-Latn-GB */
+    static_cast<uint64_t>(0xc8524c61746e4341), /* scs-Latn-CA */
+    static_cast<uint64_t>(0xc8624c61746e4954), /* sdc-Latn-IT */
+    static_cast<uint64_t>(0xc867417261624952), /* sdh-Arab-IR */
+    static_cast<uint64_t>(0xc8854c61746e4349), /* sef-Latn-CI */
+    static_cast<uint64_t>(0xc8874c61746e4d5a), /* seh-Latn-MZ */
+    static_cast<uint64_t>(0xc8884c61746e4d58), /* sei-Latn-MX */
+    static_cast<uint64_t>(0xc8924c61746e4d4c), /* ses-Latn-ML */
+    static_cast<uint64_t>(0xc8c04f67616d4945), /* sga-Ogam-IE */
+    static_cast<uint64_t>(0xc8d24c61746e4c54), /* sgs-Latn-LT */
+    static_cast<uint64_t>(0xc8e854666e674d41), /* shi-Tfng-MA */
+    static_cast<uint64_t>(0xc8ed4d796d724d4d), /* shn-Mymr-MM */
+    static_cast<uint64_t>(0xc9034c61746e4554), /* sid-Latn-ET */
+    static_cast<uint64_t>(0xc95141726162504b), /* skr-Arab-PK */
+    static_cast<uint64_t>(0xc9684c61746e504c), /* sli-Latn-PL */
+    static_cast<uint64_t>(0xc9784c61746e4944), /* sly-Latn-ID */
+    static_cast<uint64_t>(0xc9804c61746e5345), /* sma-Latn-SE */
+    static_cast<uint64_t>(0xc9894c61746e5345), /* smj-Latn-SE */
+    static_cast<uint64_t>(0xc98d4c61746e4649), /* smn-Latn-FI */
+    static_cast<uint64_t>(0xc98f53616d72494c), /* smp-Samr-IL */
+    static_cast<uint64_t>(0xc9924c61746e4649), /* sms-Latn-FI */
+    static_cast<uint64_t>(0xc9aa4c61746e4d4c), /* snk-Latn-ML */
+    static_cast<uint64_t>(0xc9c6536f6764555a), /* sog-Sogd-UZ */
+    static_cast<uint64_t>(0xc9d4546861695448), /* sou-Thai-TH */
+    static_cast<uint64_t>(0xca21536f7261494e), /* srb-Sora-IN */
+    static_cast<uint64_t>(0xca2d4c61746e5352), /* srn-Latn-SR */
+    static_cast<uint64_t>(0xca314c61746e534e), /* srr-Latn-SN */
+    static_cast<uint64_t>(0xca3744657661494e), /* srx-Deva-IN */
+    static_cast<uint64_t>(0xca584c61746e4552), /* ssy-Latn-ER */
+    static_cast<uint64_t>(0xca704c61746e4445), /* stq-Latn-DE */
+    static_cast<uint64_t>(0xca8a4c61746e545a), /* suk-Latn-TZ */
+    static_cast<uint64_t>(0xca924c61746e474e), /* sus-Latn-GN */
+    static_cast<uint64_t>(0xcac1417261625954), /* swb-Arab-YT */
+    static_cast<uint64_t>(0xcac24c61746e4344), /* swc-Latn-CD */
+    static_cast<uint64_t>(0xcac64c61746e4445), /* swg-Latn-DE */
+    static_cast<uint64_t>(0xcad544657661494e), /* swv-Deva-IN */
+    static_cast<uint64_t>(0xcaed4c61746e4944), /* sxn-Latn-ID */
+    static_cast<uint64_t>(0xcb0b42656e674244), /* syl-Beng-BD */
+    static_cast<uint64_t>(0xcb11537972634951), /* syr-Syrc-IQ */
+    static_cast<uint64_t>(0xcb2b4c61746e504c), /* szl-Latn-PL */
+    static_cast<uint64_t>(0xcc09446576614e50), /* taj-Deva-NP */
+    static_cast<uint64_t>(0xcc364c61746e5048), /* tbw-Latn-PH */
+    static_cast<uint64_t>(0xcc584b6e6461494e), /* tcy-Knda-IN */
+    static_cast<uint64_t>(0xcc6354616c65434e), /* tdd-Tale-CN */
+    static_cast<uint64_t>(0xcc66446576614e50), /* tdg-Deva-NP */
+    static_cast<uint64_t>(0xcc67446576614e50), /* tdh-Deva-NP */
+    static_cast<uint64_t>(0xcc744c61746e4d59), /* tdu-Latn-MY */
+    static_cast<uint64_t>(0xcc8c4c61746e534c), /* tem-Latn-SL */
+    static_cast<uint64_t>(0xcc8e4c61746e5547), /* teo-Latn-UG */
+    static_cast<uint64_t>(0xcc934c61746e544c), /* tet-Latn-TL */
+    static_cast<uint64_t>(0xcceb446576614e50), /* thl-Deva-NP */
+    static_cast<uint64_t>(0xccf0446576614e50), /* thq-Deva-NP */
+    static_cast<uint64_t>(0xccf1446576614e50), /* thr-Deva-NP */
+    static_cast<uint64_t>(0xcd06457468694552), /* tig-Ethi-ER */
+    static_cast<uint64_t>(0xcd154c61746e4e47), /* tiv-Latn-NG */
+    static_cast<uint64_t>(0xcd4b4c61746e544b), /* tkl-Latn-TK */
+    static_cast<uint64_t>(0xcd514c61746e415a), /* tkr-Latn-AZ */
+    static_cast<uint64_t>(0xcd53446576614e50), /* tkt-Deva-NP */
+    static_cast<uint64_t>(0xcd784c61746e415a), /* tly-Latn-AZ */
+    static_cast<uint64_t>(0xcd874c61746e4e45), /* tmh-Latn-NE */
+    static_cast<uint64_t>(0xcdc64c61746e4d57), /* tog-Latn-MW */
+    static_cast<uint64_t>(0xcde84c61746e5047), /* tpi-Latn-PG */
+    static_cast<uint64_t>(0xce344c61746e5452), /* tru-Latn-TR */
+    static_cast<uint64_t>(0xce354c61746e5457), /* trv-Latn-TW */
+    static_cast<uint64_t>(0xce3641726162504b), /* trw-Arab-PK */
+    static_cast<uint64_t>(0xce434772656b4752), /* tsd-Grek-GR */
+    static_cast<uint64_t>(0xce45446576614e50), /* tsf-Deva-NP */
+    static_cast<uint64_t>(0xce464c61746e5048), /* tsg-Latn-PH */
+    static_cast<uint64_t>(0xce49546962744254), /* tsj-Tibt-BT */
+    static_cast<uint64_t>(0xce694c61746e5547), /* ttj-Latn-UG */
+    static_cast<uint64_t>(0xce72546861695448), /* tts-Thai-TH */
+    static_cast<uint64_t>(0xce734c61746e415a), /* ttt-Latn-AZ */
+    static_cast<uint64_t>(0xce8c4c61746e4d57), /* tum-Latn-MW */
+    static_cast<uint64_t>(0xceab4c61746e5456), /* tvl-Latn-TV */
+    static_cast<uint64_t>(0xced04c61746e4e45), /* twq-Latn-NE */
+    static_cast<uint64_t>(0xcee654616e67434e), /* txg-Tang-CN */
+    static_cast<uint64_t>(0xcf154379726c5255), /* tyv-Cyrl-RU */
+    static_cast<uint64_t>(0xcf2c4c61746e4d41), /* tzm-Latn-MA */
+    static_cast<uint64_t>(0xd06c4379726c5255), /* udm-Cyrl-RU */
+    static_cast<uint64_t>(0xd0c0556761725359), /* uga-Ugar-SY */
+    static_cast<uint64_t>(0xd1684c61746e464d), /* uli-Latn-FM */
+    static_cast<uint64_t>(0xd1814c61746e414f), /* umb-Latn-AO */
+    static_cast<uint64_t>(0xd1b142656e67494e), /* unr-Beng-IN */
+    static_cast<uint64_t>(0xd1b1446576614e50), /* unr-Deva-NP */
+    static_cast<uint64_t>(0xd1b742656e67494e), /* unx-Beng-IN */
+    static_cast<uint64_t>(0xd408566169694c52), /* vai-Vaii-LR */
+    static_cast<uint64_t>(0xd4824c61746e4954), /* vec-Latn-IT */
+    static_cast<uint64_t>(0xd48f4c61746e5255), /* vep-Latn-RU */
+    static_cast<uint64_t>(0xd5024c61746e5358), /* vic-Latn-SX */
+    static_cast<uint64_t>(0xd5724c61746e4245), /* vls-Latn-BE */
+    static_cast<uint64_t>(0xd5854c61746e4445), /* vmf-Latn-DE */
+    static_cast<uint64_t>(0xd5964c61746e4d5a), /* vmw-Latn-MZ */
+    static_cast<uint64_t>(0xd5d34c61746e5255), /* vot-Latn-RU */
+    static_cast<uint64_t>(0xd62e4c61746e4545), /* vro-Latn-EE */
+    static_cast<uint64_t>(0xd68d4c61746e545a), /* vun-Latn-TZ */
+    static_cast<uint64_t>(0xd8044c61746e4348), /* wae-Latn-CH */
+    static_cast<uint64_t>(0xd80b457468694554), /* wal-Ethi-ET */
+    static_cast<uint64_t>(0xd8114c61746e5048), /* war-Latn-PH */
+    static_cast<uint64_t>(0xd82f4c61746e4155), /* wbp-Latn-AU */
+    static_cast<uint64_t>(0xd83054656c75494e), /* wbq-Telu-IN */
+    static_cast<uint64_t>(0xd83144657661494e), /* wbr-Deva-IN */
+    static_cast<uint64_t>(0xd9724c61746e5746), /* wls-Latn-WF */
+    static_cast<uint64_t>(0xd9a8417261624b4d), /* wni-Arab-KM */
+    static_cast<uint64_t>(0xda46476f6e67494e), /* wsg-Gong-IN */
+    static_cast<uint64_t>(0xda6c44657661494e), /* wtm-Deva-IN */
+    static_cast<uint64_t>(0xda9448616e73434e), /* wuu-Hans-CN */
+    static_cast<uint64_t>(0xdc154c61746e4252), /* xav-Latn-BR */
+    static_cast<uint64_t>(0xdc4e43687273555a), /* xco-Chrs-UZ */
+    static_cast<uint64_t>(0xdc51436172695452), /* xcr-Cari-TR */
+    static_cast<uint64_t>(0xdd624c7963695452), /* xlc-Lyci-TR */
+    static_cast<uint64_t>(0xdd634c7964695452), /* xld-Lydi-TR */
+    static_cast<uint64_t>(0xdd8547656f724745), /* xmf-Geor-GE */
+    static_cast<uint64_t>(0xdd8d4d616e69434e), /* xmn-Mani-CN */
+    static_cast<uint64_t>(0xdd914d6572635344), /* xmr-Merc-SD */
+    static_cast<uint64_t>(0xdda04e6172625341), /* xna-Narb-SA */
+    static_cast<uint64_t>(0xddb144657661494e), /* xnr-Deva-IN */
+    static_cast<uint64_t>(0xddc64c61746e5547), /* xog-Latn-UG */
+    static_cast<uint64_t>(0xddf1507274694952), /* xpr-Prti-IR */
+    static_cast<uint64_t>(0xde40536172625945), /* xsa-Sarb-YE */
+    static_cast<uint64_t>(0xde51446576614e50), /* xsr-Deva-NP */
+    static_cast<uint64_t>(0xe00e4c61746e4d5a), /* yao-Latn-MZ */
+    static_cast<uint64_t>(0xe00f4c61746e464d), /* yap-Latn-FM */
+    static_cast<uint64_t>(0xe0154c61746e434d), /* yav-Latn-CM */
+    static_cast<uint64_t>(0xe0214c61746e434d), /* ybb-Latn-CM */
+    static_cast<uint64_t>(0xe22b4c61746e4252), /* yrl-Latn-BR */
+    static_cast<uint64_t>(0xe2804c61746e4d58), /* yua-Latn-MX */
+    static_cast<uint64_t>(0xe28448616e73434e), /* yue-Hans-CN */
+    static_cast<uint64_t>(0xe28448616e74484b), /* yue-Hant-HK */
+    static_cast<uint64_t>(0xe4064c61746e5344), /* zag-Latn-SD */
+    static_cast<uint64_t>(0xe469417261624b4d), /* zdj-Arab-KM */
+    static_cast<uint64_t>(0xe4804c61746e4e4c), /* zea-Latn-NL */
+    static_cast<uint64_t>(0xe4c754666e674d41), /* zgh-Tfng-MA */
+    static_cast<uint64_t>(0xe4f74e736875434e), /* zhx-Nshu-CN */
+    static_cast<uint64_t>(0xe5534b697473434e), /* zkt-Kits-CN */
+    static_cast<uint64_t>(0xe56c4c61746e5447), /* zlm-Latn-TG */
+    static_cast<uint64_t>(0xe5884c61746e4d59), /* zmi-Latn-MY */
+    static_cast<uint64_t>(0xe7204c61746e5452), /* zza-Latn-TR */
+};
+} // namespace Resource
+} // namespace Global
+} // namespace OHOS
@@ -0,0 +1,309 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host tool, generate include/utils/compact_locale_data.h from the full tables in tools/locale_data:
+//     locale_data_gen <output header>
+// A 64-bit encoded locale is language(16) script(32) region(16). The tables hold 115 scripts and 223 regions,
+// so a locale packs into 32 bits as language(16) script index(8) region index(8). The script and region
+// dictionaries are sorted, so packing keeps the order and the packed tables stay binary searchable.
+// Likely subtags of a bare language, most of the table, are keyed by the 16-bit language alone,
+// and their values keep only the script and region index since the language never changes.
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "locale_data/likely_subtags_key_data.cpp"
+#include "locale_data/likely_subtags_value_data.cpp"
+#include "locale_data/locale_parents_data.cpp"
+#include "locale_data/typical_codes_data.cpp"
+
+using namespace OHOS::Global::Resource;
+
+namespace {
+const size_t MAX_INDEX = 256;
+
+const char *LICENSE_HEADER =
+    "/*\n"
+    " * Copyright (c) 2022 Huawei Device Co., Ltd.\n"
+    " * Licensed under the Apache License, Version 2.0 (the \"License\");\n"
+    " * you may not use this file except in compliance with the License.\n"
+    " * You may obtain a copy of the License at\n"
+    " *\n"
+    " *     http://www.apache.org/licenses/LICENSE-2.0\n"
+    " *\n"
+    " * Unless required by applicable law or agreed to in writing, software\n"
+    " * distributed under the License is distributed on an \"AS IS\" BASIS,\n"
+    " * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.\n"
+    " * See the License for the specific language governing permissions and\n"
+    " * limitations under the License.\n"
+    " */\n\n";
+
+#define TABLE_LEN(table) (sizeof(table) / sizeof((table)[0]))
+
+uint16_t GetLanguage(uint64_t encodedLocale)
+{
+    return static_cast<uint16_t>(encodedLocale >> 48);
+}
+
+uint32_t GetScript(uint64_t encodedLocale)
+{
+    return static_cast<uint32_t>((encodedLocale & 0x0000ffffffff0000) >> 16);
+}
+
+uint16_t GetRegion(uint64_t encodedLocale)
+{
+    return static_cast<uint16_t>(encodedLocale & 0x000000000000ffff);
+}
+
+// reverse of Utils::EncodeLanguageOrRegion
+std::string DecodeLanguageOrRegion(uint16_t code, char base)
+{
+    std::string out;
+    if ((code & 0x8000) == 0) {
+        out.push_back(static_cast<char>(code >> 8));
+        out.push_back(static_cast<char>(code & 0xff));
+        return out;
+    }
+    out.push_back(static_cast<char>(base + ((code >> 10) & 0x1f)));
+    out.push_back(static_cast<char>(base + ((code >> 5) & 0x1f)));
+    out.push_back(static_cast<char>(base + (code & 0x1f)));
+    return out;
+}
+
+std::string DecodeScript(uint32_t script)
+{
+    std::string out;
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<char>((script >> shift) & 0xff));
+    }
+    return out;
+}
+
+// three char regions are digits, see Utils::EncodeRegion
+std::string DecodeRegion(uint16_t region)
+{
+    return DecodeLanguageOrRegion(region, '0');
+}
+
+std::string DecodeLocale(uint64_t encodedLocale)
+{
+    if (encodedLocale == 0) {
+        return "root";
+    }
+    std::string out = DecodeLanguageOrRegion(GetLanguage(encodedLocale), 'a');
+    if (GetScript(encodedLocale) != 0) {
+        out += "-" + DecodeScript(GetScript(encodedLocale));
+    }
+    if (GetRegion(encodedLocale) != 0) {
+        out += "-" + DecodeRegion(GetRegion(encodedLocale));
+    }
+    return out;
+}
+
+bool IsStrictlySorted(const uint64_t *table, size_t len)
+{
+    for (size_t i = 1; i < len; ++i) {
+        if (table[i - 1] >= table[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+size_t IndexOf(const std::vector<T> &dictionary, T code)
+{
+    return std::lower_bound(dictionary.begin(), dictionary.end(), code) - dictionary.begin();
+}
+
+class Packer {
+public:
+    Packer() : scripts_(1, 0), regions_(1, 0)
+    {}
+
+    void Add(uint64_t encodedLocale)
+    {
+        scripts_.push_back(GetScript(encodedLocale));
+        regions_.push_back(GetRegion(encodedLocale));
+    }
+
+    bool Build()
+    {
+        std::sort(scripts_.begin(), scripts_.end());
+        scripts_.erase(std::unique(scripts_.begin(), scripts_.end()), scripts_.end());
+        std::sort(regions_.begin(), regions_.end());
+        regions_.erase(std::unique(regions_.begin(), regions_.end()), regions_.end());
+        return scripts_.size() <= MAX_INDEX && regions_.size() <= MAX_INDEX;
+    }
+
+    uint16_t PackSubtags(uint64_t encodedLocale) const
+    {
+        return static_cast<uint16_t>((IndexOf(scripts_, GetScript(encodedLocale)) << 8) |
+            IndexOf(regions_, GetRegion(encodedLocale)));
+    }
+
+    uint32_t Pack(uint64_t encodedLocale) const
+    {
+        return (static_cast<uint32_t>(GetLanguage(encodedLocale)) << 16) | PackSubtags(encodedLocale);
+    }
+
+    const std::vector<uint32_t> &GetScripts() const
+    {
+        return scripts_;
+    }
+
+    const std::vector<uint16_t> &GetRegions() const
+    {
+        return regions_;
+    }
+
+private:
+    std::vector<uint32_t> scripts_;
+    std::vector<uint16_t> regions_;
+};
+
+struct Entry {
+    uint32_t code;
+    std::string comment;
+};
+
+template<typename T>
+void WriteTable(FILE *out, const char *comment, const char *type, const char *name, const std::vector<Entry> &entries)
+{
+    fprintf(out, "// %s\nconstexpr %s %s[] = {\n", comment, type, name);
+    for (size_t i = 0; i < entries.size(); ++i) {
+        fprintf(out, "    static_cast<%s>(0x%0*" PRIx32 "), /* %s */\n", type, static_cast<int>(sizeof(T) * 2),
+            entries[i].code, entries[i].comment.c_str());
+    }
+    fprintf(out, "};\n");
+}
+
+size_t TableSize(const std::vector<Entry> &entries, size_t width)
+{
+    return entries.size() * width;
+}
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <output header>\n", argv[0]);
+        return 1;
+    }
+    if (!IsStrictlySorted(LIKELY_TAGS_CODES_KEY, TABLE_LEN(LIKELY_TAGS_CODES_KEY)) ||
+        !IsStrictlySorted(LOCALE_PARENTS_KEY, TABLE_LEN(LOCALE_PARENTS_KEY)) ||
+        !IsStrictlySorted(TYPICAL_CODES_VALUE, TABLE_LEN(TYPICAL_CODES_VALUE))) {
+        fprintf(stderr, "input tables must be sorted by encoded locale without duplicates\n");
+        return 1;
+    }
+    Packer packer;
+    for (size_t i = 0; i < TABLE_LEN(LIKELY_TAGS_CODES_KEY); ++i) {
+        packer.Add(LIKELY_TAGS_CODES_KEY[i]);
+        packer.Add(LIKELY_TAGS_CODES_VALUE[i]);
+    }
+    for (size_t i = 0; i < TABLE_LEN(LOCALE_PARENTS_KEY); ++i) {
+        packer.Add(LOCALE_PARENTS_KEY[i]);
+        packer.Add(LOCALE_PARENTS_VALUE[i]);
+    }
+    for (size_t i = 0; i < TABLE_LEN(TYPICAL_CODES_VALUE); ++i) {
+        packer.Add(TYPICAL_CODES_VALUE[i]);
+    }
+    if (!packer.Build()) {
+        fprintf(stderr, "more than %zu scripts or regions, widen the packed locale\n", MAX_INDEX);
+        return 1;
+    }
+
+    std::vector<Entry> scripts;
+    for (size_t i = 0; i < packer.GetScripts().size(); ++i) {
+        uint32_t script = packer.GetScripts()[i];
+        scripts.push_back({ script, (script == 0) ? "none" : DecodeScript(script) });
+    }
+    std::vector<Entry> regions;
+    for (size_t i = 0; i < packer.GetRegions().size(); ++i) {
+        uint16_t region = packer.GetRegions()[i];
+        regions.push_back({ region, (region == 0) ? "none" : DecodeRegion(region) });
+    }
+    std::vector<Entry> languageKeys;
+    std::vector<Entry> languageValues;
+    std::vector<Entry> localeKeys;
+    std::vector<Entry> localeValues;
+    for (size_t i = 0; i < TABLE_LEN(LIKELY_TAGS_CODES_KEY); ++i) {
+        uint64_t key = LIKELY_TAGS_CODES_KEY[i];
+        uint64_t value = LIKELY_TAGS_CODES_VALUE[i];
+        if (GetLanguage(key) != GetLanguage(value)) {
+            fprintf(stderr, "likely subtags of %s change the language\n", DecodeLocale(key).c_str());
+            return 1;
+        }
+        Entry valueEntry = { packer.PackSubtags(value), DecodeLocale(value) };
+        if ((key & 0x0000ffffffffffff) == 0) {
+            languageKeys.push_back({ GetLanguage(key), DecodeLocale(key) });
+            languageValues.push_back(valueEntry);
+        } else {
+            localeKeys.push_back({ packer.Pack(key), DecodeLocale(key) });
+            localeValues.push_back(valueEntry);
+        }
+    }
+    std::vector<Entry> parentKeys;
+    std::vector<Entry> parentValues;
+    for (size_t i = 0; i < TABLE_LEN(LOCALE_PARENTS_KEY); ++i) {
+        parentKeys.push_back({ packer.Pack(LOCALE_PARENTS_KEY[i]), DecodeLocale(LOCALE_PARENTS_KEY[i]) });
+        parentValues.push_back({ packer.Pack(LOCALE_PARENTS_VALUE[i]), DecodeLocale(LOCALE_PARENTS_VALUE[i]) });
+    }
+    std::vector<Entry> typicalCodes;
+    for (size_t i = 0; i < TABLE_LEN(TYPICAL_CODES_VALUE); ++i) {
+        typicalCodes.push_back({ packer.Pack(TYPICAL_CODES_VALUE[i]), DecodeLocale(TYPICAL_CODES_VALUE[i]) });
+    }
+
+    FILE *out = fopen(argv[1], "w");
+    if (out == nullptr) {
+        fprintf(stderr, "open %s failed\n", argv[1]);
+        return 1;
+    }
+    fprintf(out, "%s", LICENSE_HEADER);
+    fprintf(out, "// generated by tools/locale_data_gen.cpp from tools/locale_data, do not edit\n");
+    fprintf(out, "#ifndef RESOURCE_MANAGER_COMPACT_LOCALE_DATA_H\n#define RESOURCE_MANAGER_COMPACT_LOCALE_DATA_H\n");
+    fprintf(out, "#include <cstdint>\n\nnamespace OHOS {\nnamespace Global {\nnamespace Resource {\n");
+    fprintf(out, "// a packed locale is language << 16 | script index << 8 | region index,\n"
+        "// packed subtags are script index << 8 | region index\n");
+    WriteTable<uint32_t>(out, "sorted, the index of a script", "uint32_t", "SCRIPT_CODES", scripts);
+    WriteTable<uint16_t>(out, "sorted, the index of a region", "uint16_t", "REGION_CODES", regions);
+    WriteTable<uint16_t>(out, "sorted, likely subtags of a bare language", "uint16_t", "LIKELY_TAGS_LANGUAGE_KEY",
+        languageKeys);
+    WriteTable<uint16_t>(out, "packed subtags", "uint16_t", "LIKELY_TAGS_LANGUAGE_VALUE", languageValues);
+    WriteTable<uint32_t>(out, "sorted packed locale, likely subtags of a language with script or region", "uint32_t",
+        "LIKELY_TAGS_LOCALE_KEY", localeKeys);
+    WriteTable<uint16_t>(out, "packed subtags", "uint16_t", "LIKELY_TAGS_LOCALE_VALUE", localeValues);
+    WriteTable<uint32_t>(out, "sorted packed locale", "uint32_t", "LOCALE_PARENTS_KEY", parentKeys);
+    WriteTable<uint32_t>(out, "packed locale", "uint32_t", "LOCALE_PARENTS_VALUE", parentValues);
+    WriteTable<uint32_t>(out, "sorted packed locale", "uint32_t", "TYPICAL_CODES_VALUE", typicalCodes);
+    fprintf(out, "} // namespace Resource\n} // namespace Global\n} // namespace OHOS\n#endif\n");
+    if (fclose(out) != 0) {
+        fprintf(stderr, "write %s failed\n", argv[1]);
+        return 1;
+    }
+
+    size_t fullSize = sizeof(LIKELY_TAGS_CODES_KEY) + sizeof(LIKELY_TAGS_CODES_VALUE) + sizeof(LOCALE_PARENTS_KEY) +
+        sizeof(LOCALE_PARENTS_VALUE) + sizeof(TYPICAL_CODES_VALUE);
+    size_t compactSize = TableSize(scripts, sizeof(uint32_t)) + TableSize(regions, sizeof(uint16_t)) +
+        TableSize(languageKeys, sizeof(uint16_t)) + TableSize(languageValues, sizeof(uint16_t)) +
+        TableSize(localeKeys, sizeof(uint32_t)) + TableSize(localeValues, sizeof(uint16_t)) +
+        TableSize(parentKeys, sizeof(uint32_t)) + TableSize(parentValues, sizeof(uint32_t)) +
+        TableSize(typicalCodes, sizeof(uint32_t));
+    printf("locale tables: full %zu bytes, compact %zu bytes\n", fullSize, compactSize);
+    return 0;
+}
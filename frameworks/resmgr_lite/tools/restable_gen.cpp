@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host tool, generate the ResourceTable header of a resources.index:
+//     restable_gen <resources.index> <output header>
+// For each resource it emits the id, ResourceTable::String::app_name, and the name with its hash,
+// ResourceTable::StringName::app_name, to pass to the ResName overloads of the ResourceManager getters.
+
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "hap_parser.h"
+#include "res_common.h"
+#include "res_desc.h"
+#include "utils/errors.h"
+
+using namespace OHOS::Global::Resource;
+
+namespace {
+struct TypeName {
+    ResType resType;
+    const char *name;
+    const char *enumName;
+};
+
+const TypeName TYPE_NAMES[] = {
+    { ResType::INTEGER, "Integer", "INTEGER" },
+    { ResType::STRING, "String", "STRING" },
+    { ResType::STRINGARRAY, "StringArray", "STRINGARRAY" },
+    { ResType::INTARRAY, "IntArray", "INTARRAY" },
+    { ResType::BOOLEAN, "Boolean", "BOOLEAN" },
+    { ResType::DIMEN, "Dimen", "DIMEN" },
+    { ResType::COLOR, "Color", "COLOR" },
+    { ResType::ID, "Id", "ID" },
+    { ResType::THEME, "Theme", "THEME" },
+    { ResType::PLURALS, "Plural", "PLURALS" },
+    { ResType::FLOAT, "Float", "FLOAT" },
+    { ResType::MEDIA, "Media", "MEDIA" },
+    { ResType::PROF, "Profile", "PROF" },
+    { ResType::SVG, "Svg", "SVG" },
+    { ResType::PATTERN, "Pattern", "PATTERN" },
+};
+
+const char *CPP_KEYWORDS[] = {
+    "auto", "bool", "break", "case", "char", "class", "const", "continue", "default", "delete", "do", "double",
+    "else", "enum", "false", "float", "for", "if", "int", "long", "namespace", "new", "operator", "private",
+    "protected", "public", "return", "short", "signed", "sizeof", "static", "struct", "switch", "template", "this",
+    "true", "union", "unsigned", "void", "while",
+};
+
+// make name a C++ identifier, the hash is still taken over the original name
+std::string ToIdentifier(const std::string &name)
+{
+    std::string out;
+    for (size_t i = 0; i < name.size(); ++i) {
+        char c = name[i];
+        bool valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        out.push_back(valid ? c : '_');
+    }
+    if (out.empty() || (out[0] >= '0' && out[0] <= '9')) {
+        out.insert(0, "_");
+    }
+    for (size_t i = 0; i < sizeof(CPP_KEYWORDS) / sizeof(CPP_KEYWORDS[0]); ++i) {
+        if (out == CPP_KEYWORDS[i]) {
+            out.push_back('_');
+            break;
+        }
+    }
+    return out;
+}
+
+// escape name for a C++ string literal, other bytes than printable ASCII are written in octal
+std::string ToStringLiteral(const std::string &name)
+{
+    std::string out;
+    for (size_t i = 0; i < name.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(name[i]);
+        if (c == '"' || c == '\\' || c == '?') {
+            // '?' too, so no trigraph is formed
+            out.push_back('\\');
+            out.push_back(static_cast<char>(c));
+        } else if (c >= ' ' && c <= '~') {
+            out.push_back(static_cast<char>(c));
+        } else {
+            char octal[5]; // 5 means '\\', three digits and '\0'
+            snprintf(octal, sizeof(octal), "\\%03o", c);
+            out.append(octal);
+        }
+    }
+    return out;
+}
+
+// distinct names such as "a.b" and "a_b" must not get the same identifier in one namespace
+bool CheckIdentifiers(const TypeName &typeName, const std::map<std::string, uint32_t> &resources)
+{
+    std::map<std::string, std::string> names;
+    std::map<std::string, uint32_t>::const_iterator iter;
+    for (iter = resources.begin(); iter != resources.end(); ++iter) {
+        std::string identifier = ToIdentifier(iter->first);
+        std::pair<std::map<std::string, std::string>::iterator, bool> result =
+            names.insert(std::make_pair(identifier, iter->first));
+        if (!result.second) {
+            fprintf(stderr, "%s names \"%s\" and \"%s\" both map to identifier %s, rename one of them\n",
+                typeName.name, result.first->second.c_str(), iter->first.c_str(), identifier.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReadFile(const char *path, std::vector<char> &buf)
+{
+    std::ifstream inFile(path, std::ios::binary | std::ios::in);
+    if (!inFile.good()) {
+        return false;
+    }
+    inFile.seekg(0, std::ios::end);
+    std::streamoff len = inFile.tellg();
+    if (len <= 0) {
+        return false;
+    }
+    buf.resize(static_cast<size_t>(len));
+    inFile.seekg(0, std::ios::beg);
+    inFile.read(buf.data(), len);
+    return inFile.good();
+}
+
+void WriteType(FILE *out, const TypeName &typeName, const std::map<std::string, uint32_t> &resources)
+{
+    fprintf(out, "namespace %s {\n", typeName.name);
+    std::map<std::string, uint32_t>::const_iterator iter;
+    for (iter = resources.begin(); iter != resources.end(); ++iter) {
+        fprintf(out, "constexpr uint32_t %s = 0x%08" PRIx32 ";\n", ToIdentifier(iter->first).c_str(), iter->second);
+    }
+    fprintf(out, "} // namespace %s\n\n", typeName.name);
+
+    fprintf(out, "namespace %sName {\n", typeName.name);
+    for (iter = resources.begin(); iter != resources.end(); ++iter) {
+        fprintf(out, "constexpr OHOS::Global::Resource::ResName %s = { \"%s\", OHOS::Global::Resource::%s, "
+            "0x%016" PRIx64 "ULL };\n", ToIdentifier(iter->first).c_str(), ToStringLiteral(iter->first).c_str(),
+            typeName.enumName, HashResName(iter->first.c_str(), typeName.resType));
+    }
+    fprintf(out, "} // namespace %sName\n\n", typeName.name);
+}
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s <resources.index> <output header>\n", argv[0]);
+        return 1;
+    }
+    std::vector<char> buf;
+    if (!ReadFile(argv[1], buf)) {
+        fprintf(stderr, "read %s failed\n", argv[1]);
+        return 1;
+    }
+    ResDesc resDesc;
+    if (HapParser::ParseResHex(buf.data(), buf.size(), resDesc, nullptr) != OK) {
+        fprintf(stderr, "parse %s failed\n", argv[1]);
+        return 1;
+    }
+    // name to id of each type, an id appears once per qualifier directory
+    std::map<std::string, uint32_t> resources[MAX_RES_TYPE];
+    for (size_t i = 0; i < resDesc.keys_.size(); ++i) {
+        const std::vector<IdParam *> &idParams = resDesc.keys_[i]->resId_->idParams_;
+        for (size_t j = 0; j < idParams.size(); ++j) {
+            const IdItem *idItem = idParams[j]->idItem_;
+            if (idItem->resType_ < MAX_RES_TYPE) {
+                resources[idItem->resType_].insert(std::make_pair(idItem->name_, idItem->id_));
+            }
+        }
+    }
+
+    bool valid = true;
+    for (size_t i = 0; i < sizeof(TYPE_NAMES) / sizeof(TYPE_NAMES[0]); ++i) {
+        valid = CheckIdentifiers(TYPE_NAMES[i], resources[TYPE_NAMES[i].resType]) && valid;
+    }
+    if (!valid) {
+        // report every collision, and write no header which would not compile
+        return 1;
+    }
+
+    FILE *out = fopen(argv[2], "w");
+    if (out == nullptr) {
+        fprintf(stderr, "open %s failed\n", argv[2]);
+        return 1;
+    }
+    fprintf(out, "// generated by restable_gen from resources.index, do not edit\n");
+    fprintf(out, "#ifndef RESOURCE_TABLE_H\n#define RESOURCE_TABLE_H\n\n");
+    fprintf(out, "#include <cstdint>\n\n#include \"res_common.h\"\n\n");
+    fprintf(out, "namespace ResourceTable {\n");
+    for (size_t i = 0; i < sizeof(TYPE_NAMES) / sizeof(TYPE_NAMES[0]); ++i) {
+        if (!resources[TYPE_NAMES[i].resType].empty()) {
+            WriteType(out, TYPE_NAMES[i], resources[TYPE_NAMES[i].resType]);
+        }
+    }
+    fprintf(out, "} // namespace ResourceTable\n#endif\n");
+    if (fclose(out) != 0) {
+        fprintf(stderr, "write %s failed\n", argv[2]);
+        return 1;
+    }
+    return 0;
+}